@@ -33,16 +33,56 @@
 // 0=portrait, 1=landscape, 2=portrait (inverted), 3=landscape (inverted)
 #define TFT_ROTATION 1
 
+// Log the regions and bytes each screen update pushes to the panel.
+// #define UI_FRAME_LOG 1
+
+// RAM for decoded flags, so a redrawn flag skips SPIFFS and the PNG decode.
+// #define FLAG_CACHE_BYTES (32 * 1024)
+
+// PNG decode buffers (two, in full-width lines) pushed to the panel by DMA,
+// and a log line with the time each PNG draw took.
+// #define PNG_BLIT_LINES 8
+// #define PNG_BLIT_LOG 1
+
+// Anti-aliased digits for scores, clocks and the countdown, scaled at boot
+// from the masters in src/glyph_masters.h (about 12 KB of RAM, 9 KB of
+// flash); 0 draws them with the plain fonts.
+// #define GLYPH_ATLAS 0
+
 
 // -------------------- Team focus --------------------
 // 3-letter team abbreviation used by this project (and your flags).
 #define FOCUS_TEAM_ABBR "CAN"
 
 
+// -------------------- Data source --------------------
+// Uncomment to replay fixtures from tools/espn_standin.py on your LAN instead of live ESPN.
+// #define ESPN_BASE_URL "http://192.168.1.50:8080/apis/site/v2/sports/hockey/olympics-mens-ice-hockey"
+
+
 // -------------------- Poll intervals (ms) --------------------
+// Live-game rates; the network task adapts around them based on the game state.
 #define POLL_SCOREBOARD_MS   15000   // 15s
 #define POLL_GAMEDETAIL_MS   8000    // 8s (only when a game is live)
 
+// Adaptive polling curve.
+#define POLL_CLUTCH_DETAIL_MS          4000     // 3rd period / OT, within one goal
+#define POLL_INTERMISSION_MS           60000    // scoreboard + detail during intermissions
+#define POLL_FINAL_COOLDOWN_MS         60000    // right after a final, to catch corrections...
+#define POLL_FINAL_COOLDOWN_WINDOW_MS  600000   // ...for this long
+#define POLL_FINAL_RECENT_SEC          14400    // ...if seen live here or started this recently
+#define POLL_IDLE_MS                   1800000  // no upcoming game known
+// Scoreboard interval by time until the next game: {seconds before start, interval ms}.
+// The first row whose threshold the remaining time exceeds wins.
+#define POLL_PREGAME_CURVE { {86400, 1800000}, {10800, 600000}, {1800, 120000}, {0, 30000} }
+
+// Boot snapshot of the last-known state in SPIFFS: rewritten at most this often.
+#define STATE_SNAPSHOT_MIN_INTERVAL_MS 60000
+
+// Log HTTP session pool counters and heap free/low/largest block after every
+// scoreboard poll.
+// #define NET_STATS_LOG 1
+
 
 // -------------------- Optional SD access --------------------
 // (disabled in esp32-cyd-sdfix)
@@ -4,5 +4,5 @@
 // Call once in setup() (it will attempt primary or fallback).
 bool wifiConnectWithFallback();
 
-// Call frequently in loop() to keep Wi-Fi up (retries periodically if disconnected).
+// Call frequently from the network task to keep Wi-Fi up (retries periodically if disconnected).
 void wifiTick();
\ No newline at end of file
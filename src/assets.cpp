@@ -1,14 +1,30 @@
 #include "assets.h"
 #include "palette.h"
 #include "config.h"
+#include "flag_atlas.h"
+#include "flag_cache.h"
+#include "flag_fetch.h"
 
 #include <SPI.h>
 #include <SPIFFS.h>
 #include <SD.h>
 #include <PNGdec.h>
-#include <HTTPClient.h>
-#include <WiFi.h>
-#include <WiFiClientSecure.h>
+
+// RAM for decoded flags; see FlagCache.
+#ifndef FLAG_CACHE_BYTES
+#define FLAG_CACHE_BYTES (32 * 1024)
+#endif
+
+// Size of each PNG blit buffer, in full-width (320 px) lines. Narrower images
+// fit proportionally more lines per block.
+#ifndef PNG_BLIT_LINES
+#define PNG_BLIT_LINES 8
+#endif
+
+// Log the time and block count of every PNG drawn.
+#ifndef PNG_BLIT_LOG
+#define PNG_BLIT_LOG 0
+#endif
 
 namespace {
 
@@ -23,8 +39,27 @@ File g_file;
 int16_t g_drawX = 0;
 int16_t g_drawY = 0;
 
-// Line buffer for PNG decode.
-uint16_t g_line[320];
+// Decoded lines are gathered into blocks and each block is pushed with one
+// address window. With DMA there are two blocks: one is decoded into while
+// the other is on its way to the panel.
+constexpr int16_t kBlitWidth = 320;
+constexpr size_t kBlockPixels = (size_t)PNG_BLIT_LINES * kBlitWidth;
+uint16_t g_block[2][kBlockPixels];
+uint8_t g_blockIndex = 0;
+int16_t g_blockTop = 0;    // image row of the block's first line
+int16_t g_blockRows = 0;   // lines decoded into the block so far
+int16_t g_blockLines = 1;  // lines a block holds at the current image width
+int16_t g_blitHeight = 0;
+uint16_t g_blocksSent = 0;
+bool g_dmaReady = false;   // initDMA() succeeded
+bool g_blitDma = false;    // the current decode pushes blocks with DMA
+
+// While a flag is decoded for the cache, rows are copied here as well.
+uint16_t *g_capture = nullptr;
+int16_t g_captureW = 0;
+int16_t g_captureH = 0;
+
+FlagCache g_flagCache(FLAG_CACHE_BYTES);
 
 bool g_spiffsReady = false;
 bool g_sdReady = false;
@@ -34,7 +69,6 @@ SPIClass g_sdHspi(HSPI);
 
 constexpr uint32_t SD_SPI_HZ = 4000000;
 constexpr uint32_t SD_SPI_HZ_FALLBACK = 1000000;
-constexpr size_t FLAG_MAX_BYTES = 120 * 1024;
 
 bool tryBeginSd(SPIClass &bus, const char *busName, uint32_t hz) {
   bus.begin(SD_SCLK, SD_MISO, SD_MOSI, SD_CS);
@@ -72,15 +106,67 @@ int32_t pngSeek(PNGFILE *pFile, int32_t position) {
   return (int32_t)g_file.seek(position);
 }
 
+void flushBlock(int16_t w) {
+  if (!g_blockRows) return;
+  uint16_t *block = g_block[g_blockIndex];
+  const int16_t y = (int16_t)(g_drawY + g_blockTop);
+  if (g_blitDma) {
+    // Waits for the previous block, then returns while this one is sent.
+    g_tft->pushImageDMA(g_drawX, y, w, g_blockRows, block);
+    g_blockIndex ^= 1;
+  } else {
+    g_tft->pushImage(g_drawX, y, w, g_blockRows, block);
+  }
+  g_blockRows = 0;
+  g_blocksSent++;
+}
+
 int pngDraw(PNGDRAW *pDraw) {
   if (!g_tft) return 0;
+  const int16_t w = (int16_t)pDraw->iWidth;
+  if (w > kBlitWidth) return 0;
+  if (g_blockRows == 0) g_blockTop = (int16_t)pDraw->y;
+  uint16_t *line = g_block[g_blockIndex] + (size_t)g_blockRows * w;
   // TFT_eSPI expects big-endian RGB565 pixel order when swap-bytes is disabled.
-  g_png.getLineAsRGB565(pDraw, g_line, PNG_RGB565_BIG_ENDIAN, 0x00000000);
-  const int16_t y = (int16_t)(g_drawY + pDraw->y);
-  g_tft->pushImage(g_drawX, y, pDraw->iWidth, 1, g_line);
+  g_png.getLineAsRGB565(pDraw, line, PNG_RGB565_BIG_ENDIAN, 0x00000000);
+  if (g_capture && pDraw->y < g_captureH) {
+    memcpy(g_capture + (size_t)pDraw->y * g_captureW, line, (size_t)g_captureW * sizeof(uint16_t));
+  }
+  g_blockRows++;
+  if (g_blockRows == g_blockLines || pDraw->y == g_blitHeight - 1) flushBlock(w);
   return 1;
 }
 
+// Decodes the PNG opened on g_png to the panel at g_drawX, g_drawY. Files on
+// the SD card are drawn without DMA: the card may share the panel's SPI bus,
+// which a DMA draw holds for the whole decode.
+int decodeOpenPng(const String &path, bool dma) {
+  const int16_t w = (int16_t)g_png.getWidth();
+  g_blitHeight = (int16_t)g_png.getHeight();
+  g_blockLines = (w > 0 && w <= kBlitWidth) ? (int16_t)(kBlockPixels / (size_t)w) : 1;
+  g_blockIndex = 0;
+  g_blockRows = 0;
+  g_blocksSent = 0;
+  g_blitDma = dma && g_dmaReady;
+
+  const uint32_t started = micros();
+  if (g_blitDma) g_tft->startWrite();
+  const int rc = g_png.decode(nullptr, 0);
+  if (g_blitDma) {
+    g_tft->dmaWait();
+    g_tft->endWrite();
+  }
+#if PNG_BLIT_LOG
+  Serial.printf("PNG: %s %dx%d in %lu us, %u block(s)%s\n",
+                path.c_str(), (int)w, (int)g_blitHeight, (unsigned long)(micros() - started),
+                (unsigned)g_blocksSent, g_blitDma ? " via DMA" : "");
+#else
+  (void)path;
+  (void)started;
+#endif
+  return rc;
+}
+
 bool drawPngFromFs(fs::FS &fs, const String &path, int16_t x, int16_t y) {
   if (!g_tft) return false;
 
@@ -91,201 +177,51 @@ bool drawPngFromFs(fs::FS &fs, const String &path, int16_t x, int16_t y) {
   const int rcOpen = g_png.open((char *)path.c_str(), pngOpen, pngClose, pngRead, pngSeek, pngDraw);
   if (rcOpen != 0) return false;
 
-  const int rcDec = g_png.decode(nullptr, 0);
+  const int rcDec = decodeOpenPng(path, &fs == &SPIFFS);
   g_png.close();
   return (rcDec == 0);
 }
-
-
-String makeFlagSizePath(int16_t size, const String &abbr) {
-  return String("/flags/") + String(size) + "/" + abbr + ".png";
-}
-
-String makeFlagFlatPath(const String &abbr) {
-  return String("/flags/") + abbr + ".png";
-}
-
-bool ensureSpiffsDir(const String &dirPath) {
-  if (!g_spiffsReady) return false;
-  if (dirPath.length() == 0 || dirPath == "/") return true;
-
-  int slash = 1;
-  while (slash > 0) {
-    slash = dirPath.indexOf('/', slash);
-    String segment = (slash >= 0) ? dirPath.substring(0, slash) : dirPath;
-    if (segment.length() > 1 && !SPIFFS.exists(segment)) {
-      if (!SPIFFS.mkdir(segment) && !SPIFFS.exists(segment)) {
-        return false;
-      }
-    }
-    if (slash >= 0) slash++;
-  }
-  return true;
-}
-
-String rewriteEspnLogoUrlForSize(const String &url, int16_t size) {
-  if (!url.length()) return url;
-
-  String path = url;
-  const int scheme = path.indexOf("://");
-  if (scheme >= 0) {
-    const int slash = path.indexOf('/', scheme + 3);
-    if (slash >= 0) {
-      path = path.substring(slash);
-    }
-  }
-
-  const int query = path.indexOf('?');
-  if (query >= 0) {
-    path = path.substring(0, query);
-  }
-
-  return String("https://a.espncdn.com/combiner/i?img=") + path +
-         "&w=" + String(size) + "&h=" + String(size);
-}
-
-bool downloadToSpiffs(const String &url, const String &destPath, size_t maxBytes) {
-  if (!g_spiffsReady) return false;
-  if (url.isEmpty()) return false;
-  if (WiFi.status() != WL_CONNECTED) return false;
-
-  const int slash = destPath.lastIndexOf('/');
-  if (slash > 0) {
-    const String dir = destPath.substring(0, slash);
-    if (!ensureSpiffsDir(dir)) return false;
-  }
-
-  WiFiClientSecure client;
-  client.setInsecure();
-  client.setTimeout(12000);
-
-  HTTPClient http;
-  http.setTimeout(12000);
-  if (!http.begin(client, url)) return false;
-  http.addHeader("User-Agent", "olympic-scoreboard-esp32");
-  http.addHeader("Accept", "image/png");
-
-  const int code = http.GET();
-  if (code != 200) {
-    http.end();
-    return false;
-  }
-
-  const int len = http.getSize();
-  if (len > 0 && (size_t)len > maxBytes) {
-    http.end();
-    return false;
-  }
-
-  File out = SPIFFS.open(destPath, "w");
-  if (!out) {
-    http.end();
-    return false;
-  }
-
-  Stream &stream = http.getStream();
-  uint8_t buf[1024];
-  size_t total = 0;
-  int remaining = len;
-
-  while (http.connected() && (remaining > 0 || remaining == -1)) {
-    size_t avail = (size_t)stream.available();
-    if (!avail) {
-      delay(1);
-      continue;
-    }
-
-    const size_t want = (avail > sizeof(buf)) ? sizeof(buf) : avail;
-    const int readN = stream.readBytes((char *)buf, want);
-    if (readN <= 0) break;
-
-    total += (size_t)readN;
-    if (total > maxBytes) {
-      out.close();
-      SPIFFS.remove(destPath);
-      http.end();
-      return false;
-    }
 
-    if (out.write(buf, (size_t)readN) != (size_t)readN) {
-      out.close();
-      SPIFFS.remove(destPath);
-      http.end();
-      return false;
-    }
-
-    if (remaining > 0) remaining -= readN;
-  }
-
-  out.close();
-  http.end();
-
-  if (total == 0) {
-    SPIFFS.remove(destPath);
-    return false;
-  }
-
-  return true;
-}
+// Draws a flag PNG from SPIFFS and, with `keep`, captures the decoded bitmap
+// for the flag cache, which keeps it for the next draw if it fits the budget
+// once encoded.
+bool drawFlagPng(const String &path, Teams::TeamId team, int16_t size, int16_t x, int16_t y, bool keep) {
+  if (!g_tft) return false;
 
-bool copySpiffsFile(const String &src, const String &dst) {
-  if (!SPIFFS.exists(src)) return false;
+  g_fs = &SPIFFS;
+  g_drawX = x;
+  g_drawY = y;
 
-  const int slash = dst.lastIndexOf('/');
-  if (slash > 0) {
-    const String dir = dst.substring(0, slash);
-    if (!ensureSpiffsDir(dir)) return false;
-  }
+  const int rcOpen = g_png.open((char *)path.c_str(), pngOpen, pngClose, pngRead, pngSeek, pngDraw);
+  if (rcOpen != 0) return false;
 
-  File in = SPIFFS.open(src, "r");
-  if (!in) return false;
-  File out = SPIFFS.open(dst, "w");
-  if (!out) {
-    in.close();
-    return false;
+  const int16_t w = (int16_t)g_png.getWidth();
+  const int16_t h = (int16_t)g_png.getHeight();
+  uint16_t *capture = nullptr;
+  if (keep && w <= kBlitWidth) {
+    capture = (uint16_t *)malloc((size_t)w * h * sizeof(uint16_t));
   }
+  g_capture = capture;
+  g_captureW = w;
+  g_captureH = h;
 
-  uint8_t buf[1024];
-  while (in.available()) {
-    const size_t n = in.read(buf, sizeof(buf));
-    if (!n) break;
-    if (out.write(buf, n) != n) {
-      in.close();
-      out.close();
-      SPIFFS.remove(dst);
-      return false;
+  const int rcDec = decodeOpenPng(path, true);
+  g_png.close();
+  g_capture = nullptr;
+
+  if (capture) {
+    if (rcDec == 0 && g_flagCache.store(team, size, w, h, capture)) {
+      const FlagCache::Stats &st = g_flagCache.stats();
+      Serial.printf("Flags: cached %s@%d (%dx%d); %lu hit(s), %lu miss(es), %u entries, %lu/%u B\n",
+                    Teams::code(team), (int)size, (int)w, (int)h,
+                    (unsigned long)st.hits, (unsigned long)st.misses, (unsigned)st.entries,
+                    (unsigned long)st.bytes, (unsigned)g_flagCache.budget());
     }
+    free(capture);
   }
-
-  in.close();
-  out.close();
-  return true;
+  return (rcDec == 0);
 }
 
-bool ensureFlagCached(const String &abbr, const String &logoUrl, int16_t size) {
-  if (!g_spiffsReady) return false;
-
-  const String sizedPath = makeFlagSizePath(size, abbr);
-  const String flatPath = makeFlagFlatPath(abbr);
-  if (SPIFFS.exists(sizedPath) || SPIFFS.exists(flatPath)) return true;
-
-  if (!logoUrl.length()) return false;
-
-  const String sizedUrl = rewriteEspnLogoUrlForSize(logoUrl, size);
-  if (downloadToSpiffs(sizedUrl, sizedPath, FLAG_MAX_BYTES)) {
-    if (!SPIFFS.exists(flatPath)) {
-      copySpiffsFile(sizedPath, flatPath);
-    }
-    return true;
-  }
-
-  if (!SPIFFS.exists(flatPath) && downloadToSpiffs(logoUrl, flatPath, FLAG_MAX_BYTES)) {
-    copySpiffsFile(flatPath, sizedPath);
-    return true;
-  }
-
-  return SPIFFS.exists(sizedPath) || SPIFFS.exists(flatPath);
-}
 
 void drawFallbackBadge(int16_t x, int16_t y, int size, const char *label) {
   if (!g_tft) return;
@@ -302,31 +238,46 @@ void drawFallbackBadge(int16_t x, int16_t y, int size, const char *label) {
   }
 }
 
-void drawLogoImpl(TFT_eSPI &tft,
-                  const String &abbr,
-                  const String &logoUrl,
-                  int16_t x,
-                  int16_t y,
-                  int16_t size) {
+void drawLogoImpl(TFT_eSPI &tft, Teams::TeamId team, int16_t x, int16_t y, int16_t size) {
   if (!g_tft) g_tft = &tft;
-  g_tft->fillRect(x, y, size, size, Palette::BG);
-
-  if (!abbr.isEmpty()) {
-    ensureFlagCached(abbr, logoUrl, size);
+  // Flash atlas first, then flags decoded earlier, then the PNGs.
+  if (team != Teams::kNone && (FlagAtlas::draw(*g_tft, Teams::code(team), size, x, y, Palette::BG) ||
+                               g_flagCache.draw(*g_tft, team, size, x, y, Palette::BG))) {
+    return;
   }
+  g_tft->fillRect(x, y, size, size, Palette::BG);
 
-  const String flagSized = makeFlagSizePath(size, abbr);
-  const String flagFlat = makeFlagFlatPath(abbr);
-
+  const char *abbr = Teams::code(team);
   bool ok = false;
-  if (g_spiffsReady) {
-    if (!ok && SPIFFS.exists(flagSized)) ok = drawPngFromFs(SPIFFS, flagSized, x, y);
-    if (!ok && SPIFFS.exists(flagFlat)) ok = drawPngFromFs(SPIFFS, flagFlat, x, y);
+  if (team != Teams::kNone && g_spiffsReady) {
+    const String flagSized = FlagFetch::sizedPath(size, abbr);
+    const String flagFlat = FlagFetch::flatPath(abbr);
+
+    // A file that drew before is opened straight away; if it has gone, forget
+    // it and probe again. The size-less file stands in until the sized one is
+    // fetched, so it is not kept in the RAM cache.
+    const Teams::FlagFile known = Teams::flagFile(team, size);
+    if (known == Teams::FlagFile::Sized) ok = drawFlagPng(flagSized, team, size, x, y, true);
+    if (known == Teams::FlagFile::Flat) ok = drawFlagPng(flagFlat, team, size, x, y, false);
+
+    // A flag already known to be missing is not probed for on every draw; the
+    // badge stays up until the network task lands it.
+    const FlagFetch::State fetch = FlagFetch::state(team, size);
+    if (!ok && (fetch == FlagFetch::State::Unknown || fetch == FlagFetch::State::Ready)) {
+      Teams::FlagFile found = Teams::FlagFile::Unknown;
+      if (SPIFFS.exists(flagSized) && drawFlagPng(flagSized, team, size, x, y, true)) {
+        found = Teams::FlagFile::Sized;
+      } else if (SPIFFS.exists(flagFlat) && drawFlagPng(flagFlat, team, size, x, y, false)) {
+        found = Teams::FlagFile::Flat;
+      }
+      ok = (found != Teams::FlagFile::Unknown);
+      if (found != known) Teams::setFlagFile(team, size, found);
+    }
+    if (!ok) FlagFetch::request(team, size);
   }
-
 
   if (!ok) {
-    drawFallbackBadge(x, y, size, abbr.c_str());
+    drawFallbackBadge(x, y, size, abbr);
   }
 }
 
@@ -337,6 +288,10 @@ namespace Assets {
 void begin(TFT_eSPI &tft) {
   g_tft = &tft;
   g_tft->setSwapBytes(false);
+  g_dmaReady = g_tft->initDMA();
+  Serial.println(g_dmaReady ? "PNG: DMA blit ready" : "PNG: DMA unavailable, blocking blit");
+
+  FlagAtlas::begin();
 
   g_spiffsReady = SPIFFS.begin(true);
   Serial.println(g_spiffsReady ? "SPIFFS: ready" : "SPIFFS: FAIL");
@@ -363,12 +318,7 @@ void begin(TFT_eSPI &tft) {
   g_sdReady = false;
 #endif
 
-  if (g_spiffsReady) {
-    ensureSpiffsDir("/flags");
-    ensureSpiffsDir("/flags/56");
-    ensureSpiffsDir("/flags/64");
-    ensureSpiffsDir("/flags/96");
-  }
+  FlagFetch::begin(g_spiffsReady);
 }
 
 bool drawPng(TFT_eSPI &tft, const String &path, int16_t x, int16_t y) {
@@ -387,29 +337,24 @@ bool drawPng(TFT_eSPI &tft, const String &path, int16_t x, int16_t y) {
   return false;
 }
 
-void drawLogo(TFT_eSPI &tft, const String &abbr, int16_t x, int16_t y, int16_t size) {
-  drawLogoImpl(tft, abbr, String(""), x, y, size);
-}
-
-void drawLogo(TFT_eSPI &tft,
-              const String &abbr,
-              const String &logoUrl,
-              int16_t x,
-              int16_t y,
-              int16_t size) {
-  drawLogoImpl(tft, abbr, logoUrl, x, y, size);
+void drawLogo(TFT_eSPI &tft, Teams::TeamId team, int16_t x, int16_t y, int16_t size) {
+  drawLogoImpl(tft, team, x, y, size);
 }
 
 bool sdReady() {
   return g_sdReady;
 }
 
-} // namespace Assets
-
-
-
-
-
-
-
-
+const FlagCache::Stats &flagCacheStats() {
+  return g_flagCache.stats();
+}
+
+} // namespace Assets
+
+
+
+
+
+
+
+
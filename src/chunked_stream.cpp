@@ -0,0 +1,195 @@
+#include "chunked_stream.h"
+
+#include <string.h>
+
+namespace {
+
+// Chunk sizes above this are treated as a malformed header.
+constexpr uint32_t kMaxChunkSize = 0x0FFFFFFF;
+
+int hexValue(int c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+}  // namespace
+
+ChunkedStream::ChunkedStream(Stream &src) : _src(src) {
+  setTimeout(src.getTimeout());
+}
+
+// Tops up the ring with whatever the source has ready. With `wait`, an empty
+// ring blocks (up to the source timeout) for at least one byte.
+bool ChunkedStream::fill(bool wait) {
+  if (_count == kRingSize) return true;
+  const size_t tail = (_head + _count) % kRingSize;
+  const size_t contiguous = (tail < _head) ? _head - tail : kRingSize - tail;
+
+  const int ready = _src.available();
+  size_t want = 0;
+  if (ready > 0) {
+    want = ((size_t)ready < contiguous) ? (size_t)ready : contiguous;
+  } else if (wait && _count == 0) {
+    want = 1;
+  }
+  if (want == 0) return _count > 0;
+
+  const size_t n = _src.readBytes((char *)_ring + tail, want);
+  _count += n;
+  return _count > 0;
+}
+
+int ChunkedStream::nextRaw() {
+  if (_count == 0 && !fill(true)) return -1;
+  const uint8_t c = _ring[_head];
+  _head = (_head + 1) % kRingSize;
+  _count--;
+  return c;
+}
+
+void ChunkedStream::fail() {
+  if (_state != State::Failed) Serial.println("HTTP chunked: malformed or truncated body");
+  _state = State::Failed;
+}
+
+// Steps the framing state machine until payload bytes are due (true) or the
+// body is over (false).
+bool ChunkedStream::advance() {
+  while (!(_state == State::Data && _remaining > 0)) {
+    int c;
+    switch (_state) {
+      case State::Data:
+        _state = State::DataEnd;
+        break;
+
+      case State::DataEnd:
+        c = nextRaw();
+        if (c == '\n') {
+          _state = State::Size;
+          _remaining = 0;
+          _sizeDigits = 0;
+        } else if (c != '\r') {
+          fail();
+        }
+        break;
+
+      case State::Size:
+      case State::Extension:
+        c = nextRaw();
+        if (c < 0) {
+          fail();
+        } else if (c == '\n') {
+          if (_sizeDigits == 0) {
+            fail();
+          } else if (_remaining == 0) {
+            _state = State::Trailer;
+            _lineLen = 0;
+          } else {
+            _state = State::Data;
+          }
+        } else if (c == '\r' || _state == State::Extension) {
+          // Extension text (";name=value") is ignored up to the line end.
+        } else if (c == ';' || c == ' ' || c == '\t') {
+          _state = State::Extension;
+        } else {
+          const int v = hexValue(c);
+          if (v < 0 || _remaining > (kMaxChunkSize >> 4)) {
+            fail();
+          } else {
+            _remaining = (_remaining << 4) | (uint32_t)v;
+            _sizeDigits++;
+          }
+        }
+        break;
+
+      case State::Trailer:
+        // Trailer fields until an empty line.
+        c = nextRaw();
+        if (c < 0) {
+          fail();
+        } else if (c == '\n') {
+          if (_lineLen == 0) {
+            _state = State::Done;
+          } else {
+            _lineLen = 0;
+          }
+        } else if (c != '\r') {
+          _lineLen++;
+        }
+        break;
+
+      case State::Done:
+      case State::Failed:
+        return false;
+    }
+  }
+  return true;
+}
+
+int ChunkedStream::available() {
+  if (_state == State::Done || _state == State::Failed) return 0;
+  fill(false);
+  if (_state != State::Data) return _count ? 1 : 0;
+  return (int)((_count < _remaining) ? _count : _remaining);
+}
+
+int ChunkedStream::read() {
+  if (!advance()) return -1;
+  const int c = nextRaw();
+  if (c < 0) {
+    fail();
+    return -1;
+  }
+  _remaining--;
+  _payload++;
+  return c;
+}
+
+int ChunkedStream::peek() {
+  if (!advance()) return -1;
+  if (_count == 0 && !fill(true)) {
+    fail();
+    return -1;
+  }
+  return _ring[_head];
+}
+
+size_t ChunkedStream::readBytes(char *buffer, size_t length) {
+  size_t copied = 0;
+  while (copied < length && advance()) {
+    if (_count == 0 && !fill(true)) {
+      fail();
+      break;
+    }
+    size_t n = kRingSize - _head;
+    if (n > _count) n = _count;
+    if (n > _remaining) n = _remaining;
+    if (n > length - copied) n = length - copied;
+    memcpy(buffer + copied, _ring + _head, n);
+    _head = (_head + n) % kRingSize;
+    _count -= n;
+    _remaining -= n;
+    _payload += n;
+    copied += n;
+  }
+  return copied;
+}
+
+bool ChunkedStream::drain() {
+  while (advance()) {
+    if (_count == 0 && !fill(true)) {
+      fail();
+      break;
+    }
+    size_t n = kRingSize - _head;
+    if (n > _count) n = _count;
+    if (n > _remaining) n = _remaining;
+    _head = (_head + n) % kRingSize;
+    _count -= n;
+    _remaining -= n;
+    _payload += n;
+  }
+  return _state == State::Done;
+}
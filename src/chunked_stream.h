@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+// HTTP/1.1 chunked transfer decoder over a response stream. Raw socket bytes
+// are pulled into a small ring buffer in bulk and payload is handed out with
+// memcpy through readBytes(), so JSON parsing does not pay a virtual call and
+// a TLS read per byte. Chunk extensions and trailer fields are skipped.
+
+class ChunkedStream : public Stream {
+public:
+  explicit ChunkedStream(Stream &src);
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char *buffer, size_t length) override;
+  void flush() override {}
+  size_t write(uint8_t) override { return 0; }
+
+  // Reads through the last chunk and trailers so the session can carry the
+  // next request. Returns false if the body ended early or was malformed.
+  bool drain();
+
+  bool done() const { return _state == State::Done; }
+  bool failed() const { return _state == State::Failed; }
+  uint32_t payloadBytes() const { return _payload; }
+
+private:
+  enum class State : uint8_t { Size, Extension, Data, DataEnd, Trailer, Done, Failed };
+
+  static constexpr size_t kRingSize = 512;
+
+  bool fill(bool wait);
+  int nextRaw();
+  bool advance();
+  void fail();
+
+  Stream &_src;
+  uint8_t _ring[kRingSize];
+  size_t _head = 0;
+  size_t _count = 0;
+  State _state = State::Size;
+  uint32_t _remaining = 0;
+  uint8_t _sizeDigits = 0;
+  uint16_t _lineLen = 0;
+  uint32_t _payload = 0;
+};
@@ -0,0 +1,337 @@
+#include "display_list.h"
+
+#include <string.h>
+
+#include "assets.h"
+#include "glyph_atlas.h"
+
+namespace {
+
+uint32_t mix(uint32_t h, uint32_t v) {
+  for (uint8_t i = 0; i < 4; ++i) {
+    h ^= (uint8_t)(v >> (i * 8));
+    h *= 16777619u;
+  }
+  return h;
+}
+
+bool intersects(int16_t ax, int16_t ay, int16_t aw, int16_t ah, int16_t bx, int16_t by, int16_t bw, int16_t bh) {
+  return ax < bx + bw && bx < ax + aw && ay < by + bh && by < ay + ah;
+}
+
+// Numeric text comes from the glyph atlas where it has the glyphs, anything
+// else from the font.
+void drawText(TFT_eSPI &tft, const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum,
+              uint16_t fg, uint16_t bg, bool numeric) {
+  if (numeric && GlyphAtlas::draw(tft, s, x, y, font, datum, fg, bg)) return;
+  tft.setTextFont(font);
+  tft.setTextDatum(datum);
+  tft.setTextColor(fg, bg);
+  tft.drawString(s, x, y);
+}
+
+}  // namespace
+
+void DisplayList::clear() {
+  _regionCount = 0;
+  _opCount = 0;
+  _textUsed = 0;
+}
+
+void DisplayList::overflow(const char *what) {
+  if (_overflowLogged) return;
+  _overflowLogged = true;
+  Serial.printf("DisplayList: out of %s, frame truncated\n", what);
+}
+
+void DisplayList::region(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg) {
+  if (_regionCount >= kMaxRegions) {
+    overflow("regions");
+    return;
+  }
+  Region &r = _regions[_regionCount++];
+  r.x = x;
+  r.y = y;
+  r.w = w;
+  r.h = h;
+  r.bg = bg;
+  r.firstOp = _opCount;
+  r.opCount = 0;
+  r.hash = 0;
+}
+
+DisplayList::Op *DisplayList::push(OpType type) {
+  if (_regionCount == 0) return nullptr;
+  if (_opCount >= kMaxOps) {
+    overflow("ops");
+    return nullptr;
+  }
+  Op *op = &_ops[_opCount++];
+  _regions[_regionCount - 1].opCount++;
+  op->type = type;
+  op->font = 0;
+  op->datum = 0;
+  op->team = Teams::kNone;
+  op->x = op->y = op->w = op->h = 0;
+  op->fg = op->bg = 0;
+  op->textAt = 0;
+  return op;
+}
+
+void DisplayList::fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+  Op *op = push(OpType::Fill);
+  if (!op) return;
+  op->x = x;
+  op->y = y;
+  op->w = w;
+  op->h = h;
+  op->fg = colour;
+}
+
+void DisplayList::drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour) {
+  Op *op = push(OpType::Frame);
+  if (!op) return;
+  op->x = x;
+  op->y = y;
+  op->w = w;
+  op->h = h;
+  op->fg = colour;
+}
+
+void DisplayList::fillCircle(int16_t x, int16_t y, int16_t r, uint16_t colour) {
+  Op *op = push(OpType::Circle);
+  if (!op) return;
+  op->x = x;
+  op->y = y;
+  op->w = r;
+  op->fg = colour;
+}
+
+int16_t DisplayList::text(const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg,
+                          uint16_t bg) {
+  return pushText(OpType::Text, s, x, y, font, datum, fg, bg);
+}
+
+int16_t DisplayList::numeric(const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg,
+                             uint16_t bg) {
+  return pushText(OpType::Numeric, s, x, y, font, datum, fg, bg);
+}
+
+int16_t DisplayList::pushText(OpType type, const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum,
+                              uint16_t fg, uint16_t bg) {
+  if (!s || !s[0]) return -1;
+  const size_t len = strlen(s) + 1;
+  if (_textUsed + len > kTextBytes) {
+    overflow("text space");
+    return -1;
+  }
+  Op *op = push(type);
+  if (!op) return -1;
+  memcpy(_text + _textUsed, s, len);
+  op->textAt = _textUsed;
+  _textUsed = (uint16_t)(_textUsed + len);
+  op->x = x;
+  op->y = y;
+  op->font = font;
+  op->datum = datum;
+  op->fg = fg;
+  op->bg = bg;
+  return (int16_t)(op - _ops);
+}
+
+void DisplayList::logo(Teams::TeamId team, int16_t x, int16_t y, int16_t size) {
+  if (team == Teams::kNone) return;
+  Op *op = push(OpType::Logo);
+  if (!op) return;
+  op->team = team;
+  op->x = x;
+  op->y = y;
+  op->w = size;
+}
+
+// FNV-1a over every field that affects the pixels. Text is hashed by content,
+// since its offset in _text depends on what came before it.
+uint32_t DisplayList::hashRegion(const Region &r) const {
+  uint32_t h = 2166136261u;
+  h = mix(h, r.bg);
+  for (uint8_t i = 0; i < r.opCount; ++i) {
+    const Op &op = _ops[r.firstOp + i];
+    h = mix(h, (uint32_t)op.type | ((uint32_t)op.font << 8) | ((uint32_t)op.datum << 16) | ((uint32_t)op.team << 24));
+    h = mix(h, (uint32_t)(uint16_t)op.x | ((uint32_t)(uint16_t)op.y << 16));
+    h = mix(h, (uint32_t)(uint16_t)op.w | ((uint32_t)(uint16_t)op.h << 16));
+    h = mix(h, (uint32_t)op.fg | ((uint32_t)op.bg << 16));
+    if (op.type == OpType::Logo) {
+      // A downloaded flag replaces the badge drawn while it was missing.
+      h = mix(h, Teams::assetVersion(op.team));
+    }
+    if (op.type == OpType::Text || op.type == OpType::Numeric) {
+      for (const char *p = _text + op.textAt; *p; ++p) {
+        h ^= (uint8_t)*p;
+        h *= 16777619u;
+      }
+    }
+  }
+  return h;
+}
+
+// Clears the region and replays its primitives. Returns the pixel bytes sent.
+uint32_t DisplayList::paint(TFT_eSPI &tft, const Region &r) const {
+  uint32_t pixels = (uint32_t)r.w * r.h;
+  tft.fillRect(r.x, r.y, r.w, r.h, r.bg);
+  for (uint8_t i = 0; i < r.opCount; ++i) {
+    const Op &op = _ops[r.firstOp + i];
+    switch (op.type) {
+      case OpType::Fill:
+        tft.fillRect(op.x, op.y, op.w, op.h, op.fg);
+        pixels += (uint32_t)op.w * op.h;
+        break;
+      case OpType::Frame:
+        tft.drawRect(op.x, op.y, op.w, op.h, op.fg);
+        pixels += 2u * (uint32_t)(op.w + op.h);
+        break;
+      case OpType::Circle:
+        tft.fillCircle(op.x, op.y, op.w, op.fg);
+        pixels += (uint32_t)(2 * op.w + 1) * (2 * op.w + 1) * 3 / 4;
+        break;
+      case OpType::Text:
+      case OpType::Numeric: {
+        const char *s = _text + op.textAt;
+        drawText(tft, s, op.x, op.y, op.font, op.datum, op.fg, op.bg, op.type == OpType::Numeric);
+        pixels += (uint32_t)tft.textWidth(s, op.font) * tft.fontHeight(op.font);
+        break;
+      }
+      case OpType::Logo:
+        Assets::drawLogo(tft, op.team, op.x, op.y, op.w);
+        pixels += (uint32_t)op.w * op.w;
+        break;
+    }
+  }
+  return pixels * 2;
+}
+
+DisplayList::FrameStats DisplayList::present(TFT_eSPI &tft) {
+  FrameStats stats;
+  stats.regions = _regionCount;
+
+  bool layoutChanged = (_regionCount != _shownCount);
+  for (uint8_t i = 0; i < _regionCount; ++i) {
+    Region &r = _regions[i];
+    r.hash = hashRegion(r);
+    if (!layoutChanged) {
+      const Shown &s = _shown[i];
+      layoutChanged = (s.x != r.x || s.y != r.y || s.w != r.w || s.h != r.h);
+    }
+  }
+
+  bool dirty[kMaxRegions];
+  for (uint8_t i = 0; i < _regionCount; ++i) {
+    const Region &r = _regions[i];
+    dirty[i] = layoutChanged || _shown[i].hash != r.hash;
+    // Painting an earlier region covers whatever of this one it overlaps.
+    for (uint8_t j = 0; j < i && !dirty[i]; ++j) {
+      const Region &e = _regions[j];
+      dirty[i] = dirty[j] && intersects(e.x, e.y, e.w, e.h, r.x, r.y, r.w, r.h);
+    }
+  }
+
+  for (uint8_t i = 0; i < _regionCount; ++i) {
+    const Region &r = _regions[i];
+    if (dirty[i]) {
+      stats.bytes += paint(tft, r);
+      stats.ops = (uint16_t)(stats.ops + r.opCount);
+      stats.dirty++;
+    }
+    Shown &s = _shown[i];
+    s.x = r.x;
+    s.y = r.y;
+    s.w = r.w;
+    s.h = r.h;
+    s.hash = r.hash;
+  }
+  _shownCount = _regionCount;
+  return stats;
+}
+
+// Redraws the glyphs of `to` that differ from `from`, each as its own
+// left-aligned string so its cell background covers the old glyph. Returns 0
+// when a glyph changes width, since the text would then shift.
+uint32_t DisplayList::paintGlyphs(TFT_eSPI &tft, const Op &op, const char *from, const char *to) const {
+  tft.setTextFont(op.font);
+  const int16_t width = (int16_t)tft.textWidth(to, op.font);
+  if (width != tft.textWidth(from, op.font)) return 0;
+
+  const uint8_t column = op.datum < 12 ? (uint8_t)(op.datum % 3) : 0;  // 0 left, 1 centre, 2 right
+  int16_t x = op.x;
+  if (column == 1) x = (int16_t)(x - width / 2);
+  if (column == 2) x = (int16_t)(x - width);
+
+  char was[2] = {0, 0};
+  char now[2] = {0, 0};
+  for (const char *p = from, *q = to; *q; ++p, ++q) {
+    was[0] = *p;
+    now[0] = *q;
+    if (tft.textWidth(was, op.font) != tft.textWidth(now, op.font)) return 0;
+  }
+
+  const uint8_t datum = (uint8_t)(op.datum - column);
+  const int16_t height = (int16_t)tft.fontHeight(op.font);
+  uint32_t pixels = 0;
+  for (const char *p = from, *q = to; *q; ++p, ++q) {
+    now[0] = *q;
+    const int16_t w = (int16_t)tft.textWidth(now, op.font);
+    if (*p != *q) {
+      drawText(tft, now, x, op.y, op.font, datum, op.fg, op.bg, op.type == OpType::Numeric);
+      pixels += (uint32_t)w * height;
+    }
+    x = (int16_t)(x + w);
+  }
+  return pixels * 2;
+}
+
+bool DisplayList::patchText(TFT_eSPI &tft, int16_t opIndex, const char *s, uint32_t &bytes) {
+  bytes = 0;
+  if (!s || !s[0] || opIndex < 0 || opIndex >= _opCount ||
+      (_ops[opIndex].type != OpType::Text && _ops[opIndex].type != OpType::Numeric)) {
+    return false;
+  }
+  Op &op = _ops[opIndex];
+  char *current = _text + op.textAt;
+
+  uint8_t index = 0;
+  while (index < _regionCount &&
+         !(opIndex >= _regions[index].firstOp && opIndex < _regions[index].firstOp + _regions[index].opCount)) {
+    ++index;
+  }
+  if (index >= _regionCount) return false;
+  Region &r = _regions[index];
+  if (index >= _shownCount || _shown[index].hash != r.hash) return false;
+  if (strcmp(current, s) == 0) return true;
+
+  const size_t oldLen = strlen(current);
+  const size_t newLen = strlen(s);
+  if (newLen == oldLen) {
+    bytes = paintGlyphs(tft, op, current, s);
+    memcpy(current, s, newLen);
+  } else if (newLen < oldLen) {
+    memcpy(current, s, newLen + 1);
+  } else if (_textUsed + newLen + 1 <= kTextBytes) {
+    memcpy(_text + _textUsed, s, newLen + 1);
+    op.textAt = _textUsed;
+    _textUsed = (uint16_t)(_textUsed + newLen + 1);
+  } else {
+    overflow("text space");
+    return false;
+  }
+
+  if (!bytes) {
+    bytes = paint(tft, r);
+    // As in present(), later regions on top of this one are painted again.
+    for (uint8_t j = (uint8_t)(index + 1); j < _regionCount; ++j) {
+      const Region &e = _regions[j];
+      if (intersects(r.x, r.y, r.w, r.h, e.x, e.y, e.w, e.h)) bytes += paint(tft, e);
+    }
+  }
+  r.hash = hashRegion(r);
+  _shown[index].hash = r.hash;
+  return true;
+}
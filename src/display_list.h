@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "teams.h"
+
+// Retained-mode drawing for Ui. A screen describes itself each frame as a list
+// of primitives (filled and outlined rects, dots, text, team logos) grouped into
+// rectangular regions. present() hashes every region and repaints only the ones
+// whose content differs from the frame on the panel, clearing each to its
+// background first. Regions are painted in order, so a later region sits on
+// top of an earlier one it overlaps and is repainted with it.
+//
+// When the set of region rectangles changes (a different screen layout) the
+// whole frame is repainted, so pixels of a region that no longer exists never
+// linger.
+
+class DisplayList {
+public:
+  static constexpr uint8_t kMaxRegions = 24;
+  static constexpr uint8_t kMaxOps = 192;
+  static constexpr uint16_t kTextBytes = 1536;
+
+  struct FrameStats {
+    uint8_t regions = 0;
+    uint8_t dirty = 0;
+    uint16_t ops = 0;    // primitives replayed, not counting region clears
+    uint32_t bytes = 0;  // RGB565 pixel data sent, estimated from primitive areas
+  };
+
+  DisplayList() { clear(); }
+
+  // Starts describing a new frame.
+  void clear();
+
+  // Starts a region. Primitives added until the next region() belong to it.
+  void region(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg);
+
+  void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+  void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t colour);
+  void fillCircle(int16_t x, int16_t y, int16_t r, uint16_t colour);
+  // text() and numeric() return the op's index for patchText(), or -1 when it
+  // was dropped.
+  int16_t text(const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg, uint16_t bg);
+  int16_t text(const String &s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg, uint16_t bg) {
+    return text(s.c_str(), x, y, font, datum, fg, bg);
+  }
+  // Text for scores, clocks and countdowns: drawn from the anti-aliased glyph
+  // atlas where it covers the font and characters, like text() otherwise.
+  int16_t numeric(const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg, uint16_t bg);
+  int16_t numeric(const String &s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg, uint16_t bg) {
+    return numeric(s.c_str(), x, y, font, datum, fg, bg);
+  }
+  void logo(Teams::TeamId team, int16_t x, int16_t y, int16_t size);
+
+  // Paints the regions that changed since the last present() and remembers
+  // this frame as the one on the panel.
+  FrameStats present(TFT_eSPI &tft);
+
+  // Changes the text of op `op` in the frame last presented and paints the
+  // change right away, without describing the frame again. When the old and
+  // new text have the same glyph widths, only the glyphs that differ are
+  // redrawn; otherwise the op's region is repainted. `bytes` gets the pixel
+  // data sent. Returns false, painting nothing, when the panel no longer
+  // shows that frame or the text does not fit; describe and present() the
+  // frame instead.
+  bool patchText(TFT_eSPI &tft, int16_t op, const char *s, uint32_t &bytes);
+
+  // Forgets what is on the panel (something else drew over it), so the next
+  // present() repaints every region.
+  void invalidate() { _shownCount = 0; }
+
+private:
+  enum class OpType : uint8_t { Fill, Frame, Circle, Text, Numeric, Logo };
+
+  struct Op {
+    OpType type;
+    uint8_t font;
+    uint8_t datum;
+    Teams::TeamId team;
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint16_t fg;
+    uint16_t bg;
+    uint16_t textAt;  // offset into _text
+  };
+
+  struct Region {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint16_t bg;
+    uint8_t firstOp;
+    uint8_t opCount;
+    uint32_t hash;
+  };
+
+  struct Shown {
+    int16_t x;
+    int16_t y;
+    int16_t w;
+    int16_t h;
+    uint32_t hash;
+  };
+
+  Op *push(OpType type);
+  int16_t pushText(OpType type, const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg,
+                   uint16_t bg);
+  uint32_t hashRegion(const Region &r) const;
+  uint32_t paint(TFT_eSPI &tft, const Region &r) const;
+  uint32_t paintGlyphs(TFT_eSPI &tft, const Op &op, const char *from, const char *to) const;
+  void overflow(const char *what);
+
+  Region _regions[kMaxRegions];
+  Op _ops[kMaxOps];
+  char _text[kTextBytes];
+  Shown _shown[kMaxRegions];
+  uint8_t _regionCount = 0;
+  uint8_t _opCount = 0;
+  uint16_t _textUsed = 0;
+  uint8_t _shownCount = 0;
+  bool _overflowLogged = false;
+};
@@ -1,49 +1,128 @@
 #include "espn_olympic_client.h"
 
-#include <HTTPClient.h>
-#include <WiFi.h>
-#include <WiFiClientSecure.h>
+#include "config.h"
+#include "http_body.h"
+#include "http_pool.h"
+#include "json_pull.h"
+#include "standings_table.h"
+#include "string_pool.h"
+#include "teams.h"
+
+#include <SPIFFS.h>
 
 #include <ctype.h>
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <utility>
 
 namespace {
 
-static const char *kEspnBase = "https://site.api.espn.com/apis/site/v2/sports/hockey/olympics-mens-ice-hockey";
+// ESPN_BASE_URL can point the client at tools/espn_standin.py (plain http:// is supported).
+#ifndef ESPN_BASE_URL
+#define ESPN_BASE_URL "https://site.api.espn.com/apis/site/v2/sports/hockey/olympics-mens-ice-hockey"
+#endif
+
+static const char *kEspnBase = ESPN_BASE_URL;
+static const char *kUserAgent = "olympic-scoreboard-esp32";
 static const char *kTournamentStart = "20260101";
 static const char *kTournamentEnd = "20260222";
 
+// Selection depends on the wall clock (next game vs past start), so the state
+// is re-derived at least this often even when no shard changed.
+static const uint32_t kScoreboardMaxUnchangedMs = 5UL * 60UL * 1000UL;
+
+// Per-day schedule shards. ESPN buckets scoreboard days in US Eastern time.
+static const char *kShardIndexPath = "/sched/index.json";
+static const int32_t kEspnDayOffsetSec = -5 * 3600;
+static const uint8_t kMaxShards = 24;
+static const uint8_t kMaxDayEvents = 16;
+// Later days cannot go live before they become today, so they are never
+// re-polled more often than this, however fast the schedule runs.
+static const uint32_t kShardFuturePollMs = 15UL * 60UL * 1000UL;
+// The caller's poll timer starts a moment before the shard timers do; a shard
+// this close to due counts as due.
+static const uint32_t kShardDueSlackMs = 1000;
+static const uint32_t kShardRebootstrapMs = 6UL * 3600UL * 1000UL; // full re-read of the open window
+
 static const uint8_t kMaxParsedEvents = 80;
 
+enum class EventState : uint8_t { Unknown, Pre, Live, Post };
+
+// Events are plain fixed-size records: teams are Teams ids, per-poll text
+// lives in fixed-width fields and repeating text (names, venues, headlines) is
+// interned in g_strings. Parsing, merging and copying them never allocates.
+struct EventTeam {
+  Teams::TeamId id = Teams::kNone;
+  StringPool::Ref name = StringPool::kEmpty;
+  int16_t score = 0;
+};
+
 struct ParsedEvent {
   bool valid = false;
-  String id;
+  char id[12] = "";
   time_t startEpoch = 0;
-  String state;
+  EventState state = EventState::Unknown;
   bool completed = false;
-  String detail;
-  String shortDetail;
-  String displayClock;
-  int period = 0;
-  String groupHeadline;
+  char detail[40] = "";
+  char shortDetail[32] = "";
+  char displayClock[8] = "";
+  int8_t period = 0;
+  StringPool::Ref groupHeadline = StringPool::kEmpty;
   char group = '?';
   bool preliminaryRound = false;
-  TeamLine home;
-  TeamLine away;
-  String venue;
-  String city;
+  EventTeam home;
+  EventTeam away;
+  StringPool::Ref venue = StringPool::kEmpty;
+  StringPool::Ref city = StringPool::kEmpty;
   bool hasCanada = false;
   bool isOvertime = false;
   bool hasOtIndicator = false;
+  int32_t shardDay = 0;  // ESPN schedule day (days since epoch) this event was fetched under
 };
 
 // Keep parsed-event storage out of the loop task stack to avoid watchdog resets
 // when handling ESPN's larger payloads.
 static ParsedEvent g_parsedEvents[kMaxParsedEvents];
 
+// Backs every interned ParsedEvent field. Cleared only when the event store is
+// rebuilt from scratch.
+static StringPool g_strings;
+
+template <size_t N>
+static void copyField(char (&dst)[N], const char *src) {
+  strlcpy(dst, src ? src : "", N);
+}
+
+static EventState parseEventState(const char *state) {
+  if (strcmp(state, "pre") == 0) return EventState::Pre;
+  if (strcmp(state, "in") == 0) return EventState::Live;
+  if (strcmp(state, "post") == 0) return EventState::Post;
+  return EventState::Unknown;
+}
+
+static const char *eventStateName(EventState state) {
+  switch (state) {
+    case EventState::Pre: return "pre";
+    case EventState::Live: return "in";
+    case EventState::Post: return "post";
+    default: return "";
+  }
+}
+
+static bool isFinalEvent(const ParsedEvent &ev) {
+  return ev.state == EventState::Post || ev.completed;
+}
+
+static TeamLine toTeamLine(const EventTeam &team) {
+  TeamLine line;
+  line.id = team.id;
+  line.name = g_strings.str(team.name);
+  line.score = team.score;
+  return line;
+}
+
 // ESP32 Arduino toolchains differ: some expose `timegm()`, some don't.
 // We only need a UTC ISO-8601 timestamp -> Unix epoch seconds converter.
 static int64_t daysFromCivil(int y, unsigned m, unsigned d) {
@@ -72,13 +151,18 @@ static bool parseIsoUtcToEpoch(const String &iso, time_t &outEpoch) {
   return true;
 }
 
-static bool strContainsIgnoreCase(const String &haystack, const char *needle) {
+static bool strContainsIgnoreCase(const char *haystack, const char *needle) {
   if (!needle || !needle[0]) return true;
-  String h = haystack;
-  String n = needle;
-  h.toLowerCase();
-  n.toLowerCase();
-  return h.indexOf(n) >= 0;
+  for (; *haystack; ++haystack) {
+    size_t i = 0;
+    while (needle[i] && tolower((unsigned char)haystack[i]) == tolower((unsigned char)needle[i])) i++;
+    if (!needle[i]) return true;
+  }
+  return false;
+}
+
+static bool strContainsIgnoreCase(const String &haystack, const char *needle) {
+  return strContainsIgnoreCase(haystack.c_str(), needle);
 }
 
 static String trimAndUpper(const String &in) {
@@ -88,12 +172,12 @@ static String trimAndUpper(const String &in) {
   return out;
 }
 
-static int parseIntLoose(const String &value) {
+static int parseIntLoose(const char *value) {
   bool hasDigit = false;
   int sign = 1;
   long out = 0;
-  for (size_t i = 0; i < value.length(); ++i) {
-    const char c = value.charAt(i);
+  for (size_t i = 0; value[i]; ++i) {
+    const char c = value[i];
     if (!hasDigit && c == '-') {
       sign = -1;
       continue;
@@ -108,7 +192,7 @@ static int parseIntLoose(const String &value) {
   return hasDigit ? (int)(out * sign) : -1;
 }
 
-static int parsePercentLoose(const String &value) {
+static int parsePercentLoose(const char *value) {
   const int v = parseIntLoose(value);
   if (v < 0) return -1;
   if (v > 100) return 100;
@@ -168,284 +252,234 @@ static void clearRecap(LastGameRecap &recap) {
   recap = LastGameRecap();
 }
 
-class ChunkedStream : public Stream {
-public:
-  explicit ChunkedStream(Stream &src) : _src(src) {}
-
-  int available() override {
-    if (_done) return 0;
-    if (_peeked >= 0) return 1;
-    if (_remaining > 0) {
-      int avail = _src.available();
-      if (avail > _remaining) avail = (int)_remaining;
-      return avail;
-    }
-    return _src.available();
-  }
+static bool httpGetJsonInternal(const String &url, JsonDocument &doc, const JsonDocument *filter) {
+  return HttpBody::getJson(url, kUserAgent, doc, filter, 24);
+}
 
-  int read() override {
-    if (_peeked >= 0) {
-      int c = _peeked;
-      _peeked = -1;
-      return c;
-    }
-    if (_done) return -1;
-    if (_remaining == 0) {
-      if (!readChunkHeader()) return -1;
+static String scoreboardUrl(const String &startYYYYMMDD, const String &endYYYYMMDD) {
+  return String(kEspnBase) + "/scoreboard?dates=" + startYYYYMMDD + "-" + endYYYYMMDD;
+}
+
+// Assembles ParsedEvents from a JsonPull walk of a scoreboard body, one event
+// at a time, so the feed is never held as a JsonDocument. Only competitions[0]
+// of each event is read, as ESPN lists exactly one.
+class ScoreboardEventReader {
+public:
+  explicit ScoreboardEventReader(Teams::TeamId focus) : _focus(focus) {}
+
+  // Feeds body bytes until an event is complete (ready()) or the input runs out.
+  size_t feed(const char *data, size_t len) {
+    size_t used = 0;
+    while (used < len && !_ready && !_json.done() && !_json.failed()) {
+      used += _json.feed(data + used, len - used);
+      if (_json.token() == JsonPull::Token::Value) {
+        onValue();
+      } else if (_json.token() == JsonPull::Token::EndObject) {
+        onEndObject();
+      }
     }
-    int c = _src.read();
-    if (c < 0) return -1;
-    _remaining--;
-    if (_remaining == 0) consumeCRLF();
-    return c;
+    return used;
   }
 
-  int peek() override {
-    if (_peeked < 0) _peeked = read();
-    return _peeked;
+  bool ready() const { return _ready; }
+  ParsedEvent &event() { return _event; }
+  void next() {
+    _ready = false;
+    _event = ParsedEvent();
   }
 
-  void flush() override {}
-  size_t write(uint8_t) override { return 0; }
+  bool done() const { return _json.done(); }
+  bool failed() const { return _json.failed(); }
 
 private:
-  Stream &_src;
-  int _peeked = -1;
-  int32_t _remaining = 0;
-  bool _done = false;
-
-  bool readChunkHeader() {
-    char line[24];
-    size_t n = _src.readBytesUntil('\n', line, sizeof(line) - 1);
-    if (n == 0) return false;
-    line[n] = '\0';
-    if (n && line[n - 1] == '\r') line[n - 1] = '\0';
-    char *semi = strchr(line, ';');
-    if (semi) *semi = '\0';
-    _remaining = (int32_t)strtol(line, nullptr, 16);
-    if (_remaining == 0) {
-      while (true) {
-        n = _src.readBytesUntil('\n', line, sizeof(line) - 1);
-        if (n == 0) break;
-        line[n] = '\0';
-        if (n == 1 && line[0] == '\r') break;
-        if (line[0] == '\r') break;
+  // Nesting levels: root object 0, events[] 1, event 2, competitions[] 3,
+  // competition 4, notes[] / competitors[] 5.
+  static constexpr uint8_t kCompetitionsLevel = 3;
+  static constexpr uint8_t kEntryListLevel = 5;
+
+  bool firstCompetition() const { return _json.index(kCompetitionsLevel) == 0; }
+
+  void onValue() {
+    const char *path = _json.path();
+    if (strncmp(path, "events.", 7) != 0) return;
+    path += 7;
+    const char *v = _json.value();
+
+    if (strcmp(path, "id") == 0) {
+      copyField(_event.id, v);
+      return;
+    }
+    if (strcmp(path, "date") == 0) {
+      parseIsoUtcToEpoch(String(v), _event.startEpoch);
+      return;
+    }
+    if (strncmp(path, "competitions.", 13) != 0 || !firstCompetition()) return;
+    path += 13;
+
+    if (strncmp(path, "competitors.", 12) == 0) {
+      path += 12;
+      if (strcmp(path, "homeAway") == 0) {
+        copyField(_side, v);
+      } else if (strcmp(path, "score") == 0) {
+        const int score = parseIntLoose(v);
+        _team.score = (int16_t)(score < 0 ? 0 : score);
+      } else if (strcmp(path, "team.abbreviation") == 0) {
+        _team.id = Teams::intern(v);
+      } else if (strcmp(path, "team.displayName") == 0) {
+        _team.name = g_strings.intern(v);
+      } else if (strcmp(path, "team.logo") == 0) {
+        _logoUrl = g_strings.intern(v);
       }
-      _done = true;
-      return false;
+    } else if (strcmp(path, "status.type.state") == 0) {
+      _event.state = parseEventState(v);
+    } else if (strcmp(path, "status.type.completed") == 0) {
+      _event.completed = (strcmp(v, "true") == 0);
+    } else if (strcmp(path, "status.type.detail") == 0) {
+      copyField(_event.detail, v);
+    } else if (strcmp(path, "status.type.shortDetail") == 0) {
+      copyField(_event.shortDetail, v);
+    } else if (strcmp(path, "status.displayClock") == 0) {
+      copyField(_event.displayClock, v);
+    } else if (strcmp(path, "status.period") == 0) {
+      _event.period = (int8_t)atoi(v);
+    } else if (strcmp(path, "notes.headline") == 0) {
+      if (_json.index(kEntryListLevel) == 0) _event.groupHeadline = g_strings.intern(v);
+    } else if (strcmp(path, "venue.fullName") == 0) {
+      _event.venue = g_strings.intern(v);
+    } else if (strcmp(path, "venue.address.city") == 0) {
+      _event.city = g_strings.intern(v);
     }
-    return true;
-  }
-
-  void consumeCRLF() {
-    (void)_src.read();
-    (void)_src.read();
-  }
-};
-
-static bool httpGetJsonInternal(const String &url, JsonDocument &doc, const JsonDocument *filter) {
-  WiFiClientSecure client;
-  client.setInsecure();
-  client.setTimeout(12000);
-
-  HTTPClient http;
-  const uint32_t timeoutMs = 12000;
-  http.setTimeout(timeoutMs);
-  http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
-  const char *headers[] = {"Location", "Content-Type", "Content-Length", "Transfer-Encoding"};
-  http.collectHeaders(headers, 4);
-
-  Serial.printf("HTTP GET: %s\n", url.c_str());
-
-  if (!http.begin(client, url)) return false;
-  http.addHeader("User-Agent", "olympic-scoreboard-esp32");
-  http.addHeader("Accept", "application/json");
-
-  const uint32_t started = millis();
-  const int code = http.GET();
-  const uint32_t elapsed = millis() - started;
-  if (code <= 0) {
-    Serial.printf("HTTP error: %s (%d) after %lums\n", http.errorToString(code).c_str(), code, (unsigned long)elapsed);
-    http.end();
-    return false;
   }
 
-  Serial.printf("HTTP status: %d in %lums\n", code, (unsigned long)elapsed);
-  if (code != 200) {
-    String location = http.header("Location");
-    if (location.length()) Serial.printf("Location: %s\n", location.c_str());
-    String body = http.getString();
-    if (body.length()) {
-      Serial.printf("Body (first 200): %s\n", body.substring(0, 200).c_str());
+  void onEndObject() {
+    const char *path = _json.path();
+    if (strcmp(path, "events.competitions.competitors") == 0) {
+      if (firstCompetition()) addCompetitor();
+    } else if (strcmp(path, "events.competitions") == 0) {
+      if (firstCompetition()) _hasCompetition = true;
+    } else if (strcmp(path, "events") == 0) {
+      finishEvent();
     }
-    http.end();
-    return false;
   }
 
-  const String transferEncoding = http.header("Transfer-Encoding");
-  Stream &stream = http.getStream();
-  const auto nesting = DeserializationOption::NestingLimit(24);
-  DeserializationError err;
-  if (transferEncoding.equalsIgnoreCase("chunked")) {
-    ChunkedStream chunked(stream);
-    err = filter ? deserializeJson(doc, chunked, DeserializationOption::Filter(*filter), nesting)
-                 : deserializeJson(doc, chunked, nesting);
-  } else {
-    err = filter ? deserializeJson(doc, stream, DeserializationOption::Filter(*filter), nesting)
-                 : deserializeJson(doc, stream, nesting);
-  }
-
-  http.end();
-  if (err) {
-    Serial.printf("JSON parse failed: %s\n", err.c_str());
+  void addCompetitor() {
+    if (strcasecmp(_side, "home") == 0) {
+      _event.home = _team;
+    } else if (strcasecmp(_side, "away") == 0) {
+      _event.away = _team;
+    } else if (_event.away.id == Teams::kNone) {
+      _event.away = _team;
+    } else {
+      _event.home = _team;
+    }
+    Teams::setLogoUrl(_team.id, g_strings.str(_logoUrl));
+    if (_team.id != Teams::kNone && _team.id == _focus) _event.hasCanada = true;
+    _team = EventTeam();
+    _logoUrl = StringPool::kEmpty;
+    _side[0] = '\0';
   }
-  return !err;
-}
 
-static int findGroupIndex(const OlympicStandings &standings, char group) {
-  for (uint8_t i = 0; i < standings.groupCount; ++i) {
-    if (standings.groups[i].group == group) return i;
+  void finishEvent() {
+    if (!_hasCompetition) {
+      _event = ParsedEvent();
+      return;
+    }
+    _hasCompetition = false;
+    _event.valid = true;
+    const String headline = g_strings.str(_event.groupHeadline);
+    _event.group = parseGroupLetter(headline);
+    _event.preliminaryRound = strContainsIgnoreCase(headline, "preliminary round");
+    bool hasOtIndicator = false;
+    _event.isOvertime = detectOvertime(_event, hasOtIndicator);
+    _event.hasOtIndicator = hasOtIndicator;
+    _ready = true;
   }
-  return -1;
-}
 
-struct StandingAcc {
-  bool used = false;
-  char group = '?';
-  String abbr;
-  uint8_t gp = 0;
-  uint8_t w = 0;
-  uint8_t otw = 0;
-  uint8_t otl = 0;
-  uint8_t l = 0;
-  uint8_t pts = 0;
-  int16_t gf = 0;
-  int16_t ga = 0;
+  JsonPull _json;
+  Teams::TeamId _focus;
+  ParsedEvent _event;
+  EventTeam _team;
+  StringPool::Ref _logoUrl = StringPool::kEmpty;
+  char _side[8] = "";
+  bool _hasCompetition = false;
+  bool _ready = false;
 };
 
-static StandingAcc *findOrCreateAcc(StandingAcc *acc,
-                                    uint8_t maxAcc,
-                                    uint8_t &count,
-                                    char group,
-                                    const String &abbr) {
-  for (uint8_t i = 0; i < count; ++i) {
-    if (acc[i].used && acc[i].group == group && acc[i].abbr == abbr) return &acc[i];
-  }
-  if (count >= maxAcc) return nullptr;
-  acc[count].used = true;
-  acc[count].group = group;
-  acc[count].abbr = abbr;
-  return &acc[count++];
-}
-
-static bool standingsRowBetter(const StandingsRow &a, const StandingsRow &b) {
-  if (a.pts != b.pts) return a.pts > b.pts;
-  const int diffA = a.gf - a.ga;
-  const int diffB = b.gf - b.ga;
-  if (diffA != diffB) return diffA > diffB;
-  if (a.gf != b.gf) return a.gf > b.gf;
-  return a.abbr < b.abbr;
-}
-
-static void sortGroupRows(GroupStandings &group) {
-  for (uint8_t i = 0; i < group.rowCount; ++i) {
-    for (uint8_t j = i + 1; j < group.rowCount; ++j) {
-      if (standingsRowBetter(group.rows[j], group.rows[i])) {
-        StandingsRow tmp = group.rows[i];
-        group.rows[i] = group.rows[j];
-        group.rows[j] = tmp;
-      }
-    }
-  }
-}
+// Destination for readScoreboardEvents().
+struct EventSink {
+  ParsedEvent *events;
+  uint8_t maxEvents;
+  const String &focusTeamAbbr;
+  uint8_t count;
+  uint16_t seen;             // events read, kept or not
+  uint32_t firstEventBytes;  // body bytes read when the first one was complete
+};
 
-static bool parseParsedEvents(JsonDocument &doc,
-                              ParsedEvent *events,
-                              uint8_t maxEvents,
-                              uint8_t &eventCount,
-                              const String &focusTeamAbbr) {
-  eventCount = 0;
-  JsonArrayConst all = doc["events"].as<JsonArrayConst>();
-  if (all.isNull()) return false;
-
-  for (JsonObjectConst ev : all) {
-    if (eventCount >= maxEvents) break;
-
-    JsonArrayConst competitions = ev["competitions"].as<JsonArrayConst>();
-    if (competitions.isNull() || competitions.size() == 0) continue;
-    JsonObjectConst comp = competitions[0];
-
-    ParsedEvent parsed;
-    parsed.valid = true;
-    parsed.id = String((const char *)(ev["id"] | ""));
-
-    const char *date_c = ev["date"] | "";
-    parseIsoUtcToEpoch(String(date_c ? date_c : ""), parsed.startEpoch);
-
-    const char *state_c = comp["status"]["type"]["state"] | "";
-    parsed.state = String(state_c ? state_c : "");
-    parsed.completed = comp["status"]["type"]["completed"] | false;
-
-    const char *detail_c = comp["status"]["type"]["detail"] | "";
-    const char *shortDetail_c = comp["status"]["type"]["shortDetail"] | "";
-    const char *clock_c = comp["status"]["displayClock"] | "";
-    parsed.detail = String(detail_c ? detail_c : "");
-    parsed.shortDetail = String(shortDetail_c ? shortDetail_c : "");
-    parsed.displayClock = String(clock_c ? clock_c : "");
-    parsed.period = comp["status"]["period"] | 0;
-
-    const char *headline_c = comp["notes"][0]["headline"] | "";
-    parsed.groupHeadline = String(headline_c ? headline_c : "");
-    parsed.group = parseGroupLetter(parsed.groupHeadline);
-    parsed.preliminaryRound = strContainsIgnoreCase(parsed.groupHeadline, "preliminary round");
-
-    const char *venue_c = comp["venue"]["fullName"] | "";
-    const char *city_c = comp["venue"]["address"]["city"] | "";
-    parsed.venue = String(venue_c ? venue_c : "");
-    parsed.city = String(city_c ? city_c : "");
-
-    JsonArrayConst competitors = comp["competitors"].as<JsonArrayConst>();
-    for (JsonObjectConst c : competitors) {
-      TeamLine team;
-      const char *abbr_c = c["team"]["abbreviation"] | "";
-      const char *name_c = c["team"]["displayName"] | "";
-      const char *logo_c = c["team"]["logo"] | "";
-      const char *score_c = c["score"] | "0";
-      const char *homeAway_c = c["homeAway"] | "";
-
-      team.abbr = String(abbr_c ? abbr_c : "");
-      team.name = String(name_c ? name_c : "");
-      team.logoUrl = String(logo_c ? logo_c : "");
-      team.score = parseIntLoose(String(score_c ? score_c : "0"));
-      if (team.score < 0) team.score = 0;
-
-      String side = String(homeAway_c ? homeAway_c : "");
-      side.toLowerCase();
-      if (side == "home") {
-        parsed.home = team;
-      } else if (side == "away") {
-        parsed.away = team;
-      } else if (parsed.away.abbr.isEmpty()) {
-        parsed.away = team;
-      } else {
-        parsed.home = team;
-      }
+static bool readScoreboardEvents(Stream &json, int32_t jsonBytes, void *ctx) {
+  EventSink &sink = *static_cast<EventSink *>(ctx);
+  sink.count = 0;
+  sink.seen = 0;
+  sink.firstEventBytes = 0;
+  ScoreboardEventReader reader(Teams::intern(sink.focusTeamAbbr));
 
-      if (team.abbr == focusTeamAbbr) {
-        parsed.hasCanada = true;
+  const uint32_t started = millis();
+  const uint32_t heapBefore = ESP.getFreeHeap();
+  uint32_t heapLow = heapBefore;
+  uint32_t firstEventMs = 0;
+  uint32_t bytesRead = 0;
+  int32_t left = jsonBytes;
+  char buf[256];
+
+  while (!reader.done() && !reader.failed()) {
+    size_t want = sizeof(buf);
+    if (left >= 0 && (size_t)left < want) want = (size_t)left;
+    if (want == 0) break;
+    const size_t n = json.readBytes(buf, want);
+    if (n == 0) break;
+    if (left >= 0) left -= (int32_t)n;
+    bytesRead += (uint32_t)n;
+
+    size_t used = 0;
+    while (used < n && !reader.done() && !reader.failed()) {
+      used += reader.feed(buf + used, n - used);
+      if (!reader.ready()) continue;
+
+      if (sink.seen++ == 0) {
+        firstEventMs = millis() - started;
+        sink.firstEventBytes = bytesRead - (uint32_t)(n - used);
       }
+      if (sink.count < sink.maxEvents) sink.events[sink.count++] = std::move(reader.event());
+      reader.next();
     }
-
-    bool hasOtIndicator = false;
-    parsed.isOvertime = detectOvertime(parsed, hasOtIndicator);
-    parsed.hasOtIndicator = hasOtIndicator;
-
-    events[eventCount++] = parsed;
+    const uint32_t heap = ESP.getFreeHeap();
+    if (heap < heapLow) heapLow = heap;
   }
 
+  Serial.printf("Scoreboard stream: %u events, first after %lums, %lums total, heap dip %lu B\n",
+                (unsigned)sink.count,
+                (unsigned long)firstEventMs,
+                (unsigned long)(millis() - started),
+                (unsigned long)(heapBefore - heapLow));
+  if (!reader.done()) {
+    Serial.println("Scoreboard stream: malformed or truncated JSON");
+    return false;
+  }
   return true;
 }
 
+// Streams a scoreboard response into `events`.
+static bool fetchScoreboardEvents(const String &url,
+                                  bool *notModified,
+                                  ParsedEvent *events,
+                                  uint8_t maxEvents,
+                                  uint8_t &eventCount,
+                                  const String &focusTeamAbbr) {
+  EventSink sink{events, maxEvents, focusTeamAbbr, 0, 0, 0};
+  const bool ok = HttpBody::get(url, kUserAgent, notModified, readScoreboardEvents, &sink);
+  eventCount = sink.count;
+  return ok;
+}
+
 static void applyEventToState(const ParsedEvent &ev, GameState &out) {
   out.hasGame = true;
   out.gameId = ev.id;
@@ -455,20 +489,21 @@ static void applyEventToState(const ParsedEvent &ev, GameState &out) {
   out.statusShortDetail = ev.shortDetail;
   out.clock = ev.displayClock;
   out.period = ev.period;
-  out.groupHeadline = ev.groupHeadline;
+  out.groupHeadline = g_strings.str(ev.groupHeadline);
   out.group = ev.group;
 
-  out.home = ev.home;
-  out.away = ev.away;
+  out.home = toTeamLine(ev.home);
+  out.away = toTeamLine(ev.away);
 
-  out.isPre = (ev.state == "pre");
-  out.isLive = (ev.state == "in");
-  out.isFinal = (ev.state == "post") || ev.completed;
+  out.isPre = (ev.state == EventState::Pre);
+  out.isLive = (ev.state == EventState::Live);
+  out.isFinal = (ev.state == EventState::Post) || ev.completed;
   out.isIntermission = false;
   if (out.isLive) {
     const bool detailIntermission = strContainsIgnoreCase(ev.detail, "intermission") ||
                                     strContainsIgnoreCase(ev.detail, "end of");
-    const bool clockIntermission = ((ev.displayClock == "0:00") || (ev.displayClock == "00:00")) && ev.period > 0;
+    const bool clockIntermission =
+      (strcmp(ev.displayClock, "0:00") == 0 || strcmp(ev.displayClock, "00:00") == 0) && ev.period > 0;
     out.isIntermission = detailIntermission || clockIntermission;
   }
 
@@ -486,7 +521,7 @@ static void populateNextGame(const ParsedEvent *events,
   for (uint8_t i = 0; i < eventCount; ++i) {
     const ParsedEvent &ev = events[i];
     if (!ev.hasCanada) continue;
-    if (ev.state != "pre") continue;
+    if (ev.state != EventState::Pre) continue;
 
     if (bestIdx < 0) {
       bestIdx = i;
@@ -508,9 +543,7 @@ static void populateNextGame(const ParsedEvent *events,
   }
 
   out.hasNextGame = false;
-  out.nextOppAbbr = "";
-  out.nextOppLogoUrl = "";
-  out.nextFocusLogoUrl = "";
+  out.nextOpp = Teams::kNone;
   out.nextIsHome = false;
   out.nextVenue = "";
   out.nextCity = "";
@@ -523,22 +556,13 @@ static void populateNextGame(const ParsedEvent *events,
   const ParsedEvent &next = events[bestIdx];
   out.hasNextGame = true;
   out.nextStartEpoch = next.startEpoch;
-  out.nextVenue = next.venue;
-  out.nextCity = next.city;
+  out.nextVenue = g_strings.str(next.venue);
+  out.nextCity = g_strings.str(next.city);
   out.nextGroup = next.group;
-  out.nextGroupHeadline = next.groupHeadline;
+  out.nextGroupHeadline = g_strings.str(next.groupHeadline);
 
-  if (next.home.abbr == focusTeamAbbr) {
-    out.nextIsHome = true;
-    out.nextOppAbbr = next.away.abbr;
-    out.nextOppLogoUrl = next.away.logoUrl;
-    out.nextFocusLogoUrl = next.home.logoUrl;
-  } else {
-    out.nextIsHome = false;
-    out.nextOppAbbr = next.home.abbr;
-    out.nextOppLogoUrl = next.home.logoUrl;
-    out.nextFocusLogoUrl = next.away.logoUrl;
-  }
+  out.nextIsHome = (next.home.id == Teams::intern(focusTeamAbbr));
+  out.nextOpp = out.nextIsHome ? next.away.id : next.home.id;
 }
 
 static void populateLastGame(const ParsedEvent *events,
@@ -552,7 +576,7 @@ static void populateLastGame(const ParsedEvent *events,
   for (uint8_t i = 0; i < eventCount; ++i) {
     const ParsedEvent &ev = events[i];
     if (!ev.hasCanada) continue;
-    if (!(ev.state == "post" || ev.completed)) continue;
+    if (!isFinalEvent(ev)) continue;
 
     if (bestIdx < 0 || ev.startEpoch > events[bestIdx].startEpoch) {
       bestIdx = i;
@@ -564,10 +588,10 @@ static void populateLastGame(const ParsedEvent *events,
     recap.hasGame = true;
     recap.gameId = last.id;
     recap.startEpoch = last.startEpoch;
-    recap.away = last.away;
-    recap.home = last.home;
-    recap.venue = last.venue;
-    recap.city = last.city;
+    recap.away = toTeamLine(last.away);
+    recap.home = toTeamLine(last.home);
+    recap.venue = g_strings.str(last.venue);
+    recap.city = g_strings.str(last.city);
 
     // Minimal recap requirement: final score + date + opponent.
     recap.periodCount = 0;
@@ -580,111 +604,65 @@ static void populateLastGame(const ParsedEvent *events,
   out.last = recap;
 }
 
+// ESPN event ids are decimal and fit in 32 bits; anything else is hashed.
+static uint32_t eventKey(const char *id) {
+  char *end = nullptr;
+  const unsigned long v = strtoul(id, &end, 10);
+  if (end != id && *end == '\0') return (uint32_t)v;
+  uint32_t h = 2166136261u;  // FNV-1a
+  while (*id) {
+    h ^= (uint8_t)*id++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static StandingsTable g_standings;
+
+// Only games whose final result is new or corrected touch the table.
 static void buildStandings(const ParsedEvent *events,
                            uint8_t eventCount,
                            const String &focusTeamAbbr,
                            GameState &out) {
-  out.standings = OlympicStandings();
-
-  StandingAcc acc[kMaxStandingsGroups * kMaxStandingsRows];
-  uint8_t accCount = 0;
-  bool usedFallback = false;
-
+  uint8_t changed = 0;
   for (uint8_t i = 0; i < eventCount; ++i) {
     const ParsedEvent &ev = events[i];
     if (!ev.preliminaryRound) continue;
     if (ev.group == '?') continue;
-    if (!(ev.state == "post" || ev.completed)) continue;
-    if (ev.home.abbr.isEmpty() || ev.away.abbr.isEmpty()) continue;
-
-    StandingAcc *home = findOrCreateAcc(acc, (uint8_t)(kMaxStandingsGroups * kMaxStandingsRows), accCount, ev.group, ev.home.abbr);
-    StandingAcc *away = findOrCreateAcc(acc, (uint8_t)(kMaxStandingsGroups * kMaxStandingsRows), accCount, ev.group, ev.away.abbr);
-    if (!home || !away) continue;
-
-    home->gp++;
-    away->gp++;
-    home->gf += ev.home.score;
-    home->ga += ev.away.score;
-    away->gf += ev.away.score;
-    away->ga += ev.home.score;
-
-    const bool homeWon = ev.home.score > ev.away.score;
-    const bool awayWon = ev.away.score > ev.home.score;
-    if (!homeWon && !awayWon) continue;
-
-    const bool hasIndicator = ev.hasOtIndicator;
-    const bool overtime = ev.isOvertime;
-    if (!hasIndicator) {
-      // Requirement fallback: if OT/SO detection cannot be trusted, treat as regulation for points.
-      usedFallback = true;
-    }
+    if (ev.home.id == Teams::kNone || ev.away.id == Teams::kNone || ev.home.id == ev.away.id) continue;
 
-    StandingAcc *winner = homeWon ? home : away;
-    StandingAcc *loser = homeWon ? away : home;
-
-    if (overtime) {
-      winner->otw++;
-      loser->otl++;
-      winner->pts = (uint8_t)(winner->pts + 2);
-      loser->pts = (uint8_t)(loser->pts + 1);
-    } else {
-      winner->w++;
-      loser->l++;
-      winner->pts = (uint8_t)(winner->pts + 3);
+    const uint32_t key = eventKey(ev.id);
+    if (!isFinalEvent(ev)) {
+      if (g_standings.remove(key)) changed++;
+      continue;
     }
-  }
-
-  out.standings.usedRegulationFallback = usedFallback;
 
-  for (uint8_t i = 0; i < accCount; ++i) {
-    const char group = acc[i].group;
-    int groupIdx = findGroupIndex(out.standings, group);
-    if (groupIdx < 0) {
-      if (out.standings.groupCount >= kMaxStandingsGroups) continue;
-      groupIdx = out.standings.groupCount++;
-      out.standings.groups[groupIdx] = GroupStandings();
-      out.standings.groups[groupIdx].group = group;
-    }
+    StandingsTable::Game game;
+    game.key = key;
+    game.group = ev.group;
+    game.home = ev.home.id;
+    game.away = ev.away.id;
+    game.homeScore = ev.home.score;
+    game.awayScore = ev.away.score;
+    game.overtime = ev.isOvertime;
+    game.hasOtIndicator = ev.hasOtIndicator;
+    if (g_standings.apply(game)) changed++;
+  }
 
-    GroupStandings &g = out.standings.groups[groupIdx];
-    if (g.rowCount >= kMaxStandingsRows) continue;
-
-    StandingsRow &row = g.rows[g.rowCount++];
-    row.abbr = acc[i].abbr;
-    row.gp = acc[i].gp;
-    row.w = acc[i].w;
-    row.otw = acc[i].otw;
-    row.otl = acc[i].otl;
-    row.l = acc[i].l;
-    row.pts = acc[i].pts;
-    row.gf = acc[i].gf;
-    row.ga = acc[i].ga;
-  }
-
-  for (uint8_t i = 0; i < out.standings.groupCount; ++i) {
-    sortGroupRows(out.standings.groups[i]);
-  }
-
-  out.standings.canadaGroup = '?';
-  out.standings.canadaRank = -1;
-  out.standings.canadaPts = 0;
-  for (uint8_t g = 0; g < out.standings.groupCount; ++g) {
-    GroupStandings &group = out.standings.groups[g];
-    for (uint8_t r = 0; r < group.rowCount; ++r) {
-      if (group.rows[r].abbr == focusTeamAbbr) {
-        out.standings.canadaGroup = group.group;
-        out.standings.canadaRank = (int8_t)(r + 1);
-        out.standings.canadaPts = group.rows[r].pts;
-      }
-    }
+  if (changed) {
+    Serial.printf("Standings: %u game(s) updated, %u games / %u teams tallied\n",
+                  (unsigned)changed,
+                  (unsigned)g_standings.gameCount(),
+                  (unsigned)g_standings.rowCount());
   }
+  g_standings.exportTo(out.standings, Teams::intern(focusTeamAbbr));
 }
 
 static int selectInProgress(const ParsedEvent *events, uint8_t eventCount) {
   int best = -1;
   for (uint8_t i = 0; i < eventCount; ++i) {
     if (!events[i].hasCanada) continue;
-    if (events[i].state != "in") continue;
+    if (events[i].state != EventState::Live) continue;
     if (best < 0 || (events[i].startEpoch > 0 && events[i].startEpoch < events[best].startEpoch)) {
       best = i;
     }
@@ -699,7 +677,7 @@ static int selectNextScheduled(const ParsedEvent *events, uint8_t eventCount) {
 
   for (uint8_t i = 0; i < eventCount; ++i) {
     if (!events[i].hasCanada) continue;
-    if (events[i].state != "pre") continue;
+    if (events[i].state != EventState::Pre) continue;
 
     if (bestAny < 0 || (events[i].startEpoch > 0 && events[i].startEpoch < events[bestAny].startEpoch)) {
       bestAny = i;
@@ -719,7 +697,7 @@ static int selectMostRecentFinal(const ParsedEvent *events, uint8_t eventCount)
   int best = -1;
   for (uint8_t i = 0; i < eventCount; ++i) {
     if (!events[i].hasCanada) continue;
-    if (!(events[i].state == "post" || events[i].completed)) continue;
+    if (!isFinalEvent(events[i])) continue;
     if (best < 0 || events[i].startEpoch > events[best].startEpoch) {
       best = i;
     }
@@ -727,23 +705,21 @@ static int selectMostRecentFinal(const ParsedEvent *events, uint8_t eventCount)
   return best;
 }
 
-static bool applyStatToTeam(TeamLine &team, const String &key, const String &value) {
-  if (team.abbr.isEmpty()) return false;
-
-  String lower = key;
-  lower.toLowerCase();
+static bool applyStatToTeam(TeamLine &team, const char *key, const char *value) {
+  if (team.id == Teams::kNone) return false;
 
-  if (lower.indexOf("shot") >= 0) {
+  if (strContainsIgnoreCase(key, "shot")) {
     const int v = parseIntLoose(value);
     if (v >= 0) team.sog = v;
     return true;
   }
-  if (lower == "hits" || lower.indexOf("hit") >= 0) {
+  if (strContainsIgnoreCase(key, "hit")) {
     const int v = parseIntLoose(value);
     if (v >= 0) team.hits = v;
     return true;
   }
-  if (lower.indexOf("faceoff") >= 0 || lower.indexOf("face off") >= 0 || lower.indexOf("fo%") >= 0) {
+  if (strContainsIgnoreCase(key, "faceoff") || strContainsIgnoreCase(key, "face off") ||
+      strContainsIgnoreCase(key, "fo%")) {
     const int v = parsePercentLoose(value);
     if (v >= 0) team.foPct = v;
     return true;
@@ -752,103 +728,7 @@ static bool applyStatToTeam(TeamLine &team, const String &key, const String &val
   return false;
 }
 
-}  // namespace
-
-bool EspnOlympicClient::httpGetJson(const String &url, JsonDocument &doc) {
-  return httpGetJsonInternal(url, doc, nullptr);
-}
-
-bool EspnOlympicClient::httpGetJson(const String &url, JsonDocument &doc, const JsonDocument &filter) {
-  return httpGetJsonInternal(url, doc, &filter);
-}
-
-bool EspnOlympicClient::fetchScoreboardNow(GameState &out, const String &focusTeamAbbr) {
-  return fetchScoreboardForRange(out, focusTeamAbbr, kTournamentStart, kTournamentEnd);
-}
-
-bool EspnOlympicClient::fetchScoreboardForRange(GameState &out,
-                                                const String &focusTeamAbbr,
-                                                const String &startYYYYMMDD,
-                                                const String &endYYYYMMDD) {
-  out = GameState();
-
-  JsonDocument filter;
-  filter["events"][0]["id"] = true;
-  filter["events"][0]["date"] = true;
-  filter["events"][0]["competitions"][0]["status"]["type"]["state"] = true;
-  filter["events"][0]["competitions"][0]["status"]["type"]["completed"] = true;
-  filter["events"][0]["competitions"][0]["status"]["type"]["detail"] = true;
-  filter["events"][0]["competitions"][0]["status"]["type"]["shortDetail"] = true;
-  filter["events"][0]["competitions"][0]["status"]["displayClock"] = true;
-  filter["events"][0]["competitions"][0]["status"]["period"] = true;
-  filter["events"][0]["competitions"][0]["notes"][0]["headline"] = true;
-  filter["events"][0]["competitions"][0]["venue"]["fullName"] = true;
-  filter["events"][0]["competitions"][0]["venue"]["address"]["city"] = true;
-  filter["events"][0]["competitions"][0]["competitors"][0]["homeAway"] = true;
-  filter["events"][0]["competitions"][0]["competitors"][0]["score"] = true;
-  filter["events"][0]["competitions"][0]["competitors"][0]["team"]["abbreviation"] = true;
-  filter["events"][0]["competitions"][0]["competitors"][0]["team"]["displayName"] = true;
-  filter["events"][0]["competitions"][0]["competitors"][0]["team"]["logo"] = true;
-
-  JsonDocument doc;
-  const String url = String(kEspnBase) + "/scoreboard?dates=" + startYYYYMMDD + "-" + endYYYYMMDD;
-  if (!httpGetJson(url, doc, filter)) {
-    return false;
-  }
-
-  uint8_t eventCount = 0;
-  if (!parseParsedEvents(doc, g_parsedEvents, kMaxParsedEvents, eventCount, focusTeamAbbr)) {
-    return false;
-  }
-
-  buildStandings(g_parsedEvents, eventCount, focusTeamAbbr, out);
-  populateNextGame(g_parsedEvents, eventCount, focusTeamAbbr, out);
-  populateLastGame(g_parsedEvents, eventCount, focusTeamAbbr, out);
-
-  int selected = selectInProgress(g_parsedEvents, eventCount);
-  if (selected < 0) selected = selectNextScheduled(g_parsedEvents, eventCount);
-  if (selected < 0) selected = selectMostRecentFinal(g_parsedEvents, eventCount);
-
-  if (selected >= 0) {
-    applyEventToState(g_parsedEvents[selected], out);
-  } else {
-    out.hasGame = false;
-    out.isPre = false;
-    out.isLive = false;
-    out.isIntermission = false;
-    out.isFinal = false;
-  }
-
-  return true;
-}
-
-bool EspnOlympicClient::fetchNextCanadaGame(GameState &io, const String &focusTeamAbbr) {
-  GameState next;
-  if (!fetchScoreboardNow(next, focusTeamAbbr)) return false;
-  io.hasNextGame = next.hasNextGame;
-  io.nextOppAbbr = next.nextOppAbbr;
-  io.nextOppLogoUrl = next.nextOppLogoUrl;
-  io.nextFocusLogoUrl = next.nextFocusLogoUrl;
-  io.nextIsHome = next.nextIsHome;
-  io.nextVenue = next.nextVenue;
-  io.nextCity = next.nextCity;
-  io.nextStartEpoch = next.nextStartEpoch;
-  io.nextGroup = next.nextGroup;
-  io.nextGroupHeadline = next.nextGroupHeadline;
-  return true;
-}
-
-bool EspnOlympicClient::fetchLastCanadaGame(GameState &io, const String &focusTeamAbbr) {
-  GameState next;
-  if (!fetchScoreboardNow(next, focusTeamAbbr)) return false;
-  io.last = next.last;
-  return true;
-}
-
-bool EspnOlympicClient::fetchGameSummaryStats(GameState &io) {
-  if (io.gameId.isEmpty()) return false;
-
-  JsonDocument filter;
+static void addSummaryStatusFilter(JsonDocument &filter) {
   filter["header"]["competitions"][0]["status"]["displayClock"] = true;
   filter["header"]["competitions"][0]["status"]["period"] = true;
   filter["header"]["competitions"][0]["status"]["type"]["state"] = true;
@@ -857,45 +737,53 @@ bool EspnOlympicClient::fetchGameSummaryStats(GameState &io) {
   filter["boxscore"]["teams"][0]["statistics"][0]["name"] = true;
   filter["boxscore"]["teams"][0]["statistics"][0]["displayName"] = true;
   filter["boxscore"]["teams"][0]["statistics"][0]["displayValue"] = true;
+}
 
-  JsonDocument doc;
-  const String url = String(kEspnBase) + "/summary?event=" + io.gameId;
-  if (!httpGetJson(url, doc, filter)) return false;
+static void addSummaryPlaysFilter(JsonDocument &filter) {
+  filter["plays"][0]["id"] = true;
+  filter["plays"][0]["text"] = true;
+  filter["plays"][0]["scoringPlay"] = true;
+  filter["plays"][0]["team"]["abbreviation"] = true;
+  filter["plays"][0]["type"]["text"] = true;
+  filter["plays"][0]["participants"][0]["athlete"]["displayName"] = true;
+}
 
-  const char *clock_c = doc["header"]["competitions"][0]["status"]["displayClock"] | "";
-  io.clock = String(clock_c ? clock_c : io.clock.c_str());
-  io.period = doc["header"]["competitions"][0]["status"]["period"] | io.period;
+// Clock/status and boxscore team stats from a /summary document.
+// Writes straight into `io`: String assignment from const char* reuses the
+// existing buffer, so a steady-state detail poll allocates nothing here.
+static void applySummaryStatus(JsonDocument &doc, GameState &io) {
+  JsonObjectConst status = doc["header"]["competitions"][0]["status"];
+  io.clock = (const char *)(status["displayClock"] | "");
+  io.period = status["period"] | io.period;
 
-  const char *state_c = doc["header"]["competitions"][0]["status"]["type"]["state"] | "";
-  const String state = String(state_c ? state_c : "");
-  io.isLive = (state == "in");
-  io.isPre = (state == "pre");
-  io.isFinal = (state == "post");
+  const char *state = status["type"]["state"] | "";
+  io.isLive = (strcmp(state, "in") == 0);
+  io.isPre = (strcmp(state, "pre") == 0);
+  io.isFinal = (strcmp(state, "post") == 0);
 
-  const char *detail_c = doc["header"]["competitions"][0]["status"]["type"]["detail"] | "";
-  io.statusDetail = String(detail_c ? detail_c : io.statusDetail.c_str());
+  io.statusDetail = (const char *)(status["type"]["detail"] | "");
   io.isIntermission = io.isLive && (strContainsIgnoreCase(io.statusDetail, "intermission") ||
                                     strContainsIgnoreCase(io.statusDetail, "end of"));
 
   JsonArrayConst teams = doc["boxscore"]["teams"].as<JsonArrayConst>();
   if (!teams.isNull()) {
     for (JsonObjectConst team : teams) {
-      const String abbr = String((const char *)(team["team"]["abbreviation"] | ""));
+      const Teams::TeamId id = Teams::intern((const char *)(team["team"]["abbreviation"] | ""));
       TeamLine *line = nullptr;
-      if (abbr == io.home.abbr) line = &io.home;
-      if (abbr == io.away.abbr) line = &io.away;
+      if (id == io.home.id) line = &io.home;
+      if (id == io.away.id) line = &io.away;
       if (!line) continue;
 
       JsonArrayConst stats = team["statistics"].as<JsonArrayConst>();
       for (JsonObjectConst stat : stats) {
-        const String name = String((const char *)(stat["name"] | ""));
-        const String displayName = String((const char *)(stat["displayName"] | ""));
-        const String value = String((const char *)(stat["displayValue"] | ""));
+        const char *name = stat["name"] | "";
+        const char *displayName = stat["displayName"] | "";
+        const char *value = stat["displayValue"] | "";
 
-        if (!name.isEmpty()) {
+        if (name[0]) {
           applyStatToTeam(*line, name, value);
         }
-        if (!displayName.isEmpty()) {
+        if (displayName[0]) {
           applyStatToTeam(*line, displayName, value);
         }
       }
@@ -903,31 +791,17 @@ bool EspnOlympicClient::fetchGameSummaryStats(GameState &io) {
   }
 
   if (io.strengthLabel.isEmpty()) io.strengthLabel = "EVEN STRENGTH";
-  return true;
 }
 
-bool EspnOlympicClient::fetchLatestGoal(GameState &io, const String &focusTeamAbbr) {
-  if (io.gameId.isEmpty()) return false;
-
-  JsonDocument filter;
-  filter["plays"][0]["id"] = true;
-  filter["plays"][0]["text"] = true;
-  filter["plays"][0]["scoringPlay"] = true;
-  filter["plays"][0]["team"]["abbreviation"] = true;
-  filter["plays"][0]["type"]["text"] = true;
-  filter["plays"][0]["participants"][0]["athlete"]["displayName"] = true;
-
-  JsonDocument doc;
-  const String url = String(kEspnBase) + "/summary?event=" + io.gameId;
-  if (!httpGetJson(url, doc, filter)) return false;
-
+// Latest scoring play from a /summary document. Returns false when none found.
+static bool applyLatestGoal(JsonDocument &doc, GameState &io, const String &focusTeamAbbr) {
   JsonArrayConst plays = doc["plays"].as<JsonArrayConst>();
   if (plays.isNull() || plays.size() == 0) return false;
 
   for (int i = (int)plays.size() - 1; i >= 0; --i) {
     JsonObjectConst play = plays[(size_t)i];
     const bool scoringPlay = play["scoringPlay"] | false;
-    const String playType = String((const char *)(play["type"]["text"] | ""));
+    const char *playType = play["type"]["text"] | "";
     const bool looksLikeGoal = scoringPlay || strContainsIgnoreCase(playType, "goal");
     if (!looksLikeGoal) continue;
 
@@ -939,19 +813,17 @@ bool EspnOlympicClient::fetchLatestGoal(GameState &io, const String &focusTeamAb
     }
     if (!eventId) continue;
 
-    const String owner = String((const char *)(play["team"]["abbreviation"] | ""));
-    const String text = String((const char *)(play["text"] | ""));
-    const String scorer = String((const char *)(play["participants"][0]["athlete"]["displayName"] | ""));
+    const Teams::TeamId owner = Teams::intern((const char *)(play["team"]["abbreviation"] | ""));
+    const char *text = play["text"] | "";
 
     io.lastGoalEventId = eventId;
-    io.goalTeamAbbr = owner;
-    io.goalTeamLogoUrl = (owner == io.home.abbr) ? io.home.logoUrl : ((owner == io.away.abbr) ? io.away.logoUrl : "");
+    io.goalTeam = owner;
     io.goalText = text;
-    io.goalScorer = scorer;
-    io.focusJustScored = (owner == focusTeamAbbr);
+    io.goalScorer = (const char *)(play["participants"][0]["athlete"]["displayName"] | "");
+    io.focusJustScored = (owner != Teams::kNone && owner == Teams::intern(focusTeamAbbr));
 
     if (strContainsIgnoreCase(text, "power play")) {
-      io.strengthLabel = owner + " POWER PLAY";
+      io.strengthLabel = String(Teams::code(owner)) + " POWER PLAY";
     } else if (!io.strengthLabel.endsWith("POWER PLAY")) {
       io.strengthLabel = "EVEN STRENGTH";
     }
@@ -960,6 +832,510 @@ bool EspnOlympicClient::fetchLatestGoal(GameState &io, const String &focusTeamAb
   }
 
   return false;
-}
-
-
+}
+
+static void deriveGameState(const ParsedEvent *events,
+                            uint8_t eventCount,
+                            const String &focusTeamAbbr,
+                            GameState &out) {
+  out = GameState();
+
+  buildStandings(events, eventCount, focusTeamAbbr, out);
+  populateNextGame(events, eventCount, focusTeamAbbr, out);
+  populateLastGame(events, eventCount, focusTeamAbbr, out);
+
+  int selected = selectInProgress(events, eventCount);
+  if (selected < 0) selected = selectNextScheduled(events, eventCount);
+  if (selected < 0) selected = selectMostRecentFinal(events, eventCount);
+
+  if (selected >= 0) {
+    applyEventToState(events[selected], out);
+  } else {
+    out.hasGame = false;
+    out.isPre = false;
+    out.isLive = false;
+    out.isIntermission = false;
+    out.isFinal = false;
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Per-day schedule shards
+// -----------------------------------------------------------------------------
+// The merged event set lives in g_parsedEvents, each event tagged with the ESPN
+// day it was fetched under. Past days whose games are all final are frozen:
+// persisted to SPIFFS and never polled again. Only today and days that still
+// have scheduled/live games are re-polled, each with its own conditional GET.
+
+struct ScheduleShard {
+  int32_t day = 0;
+  bool complete = false;    // frozen; persisted in SPIFFS
+  bool hasLive = false;     // an event is "in"
+  bool hasPending = false;  // an event is "pre" or "in"
+  uint32_t lastPollMs = 0;
+};
+
+static ScheduleShard g_shards[kMaxShards];
+static uint8_t g_shardCount = 0;
+static uint8_t g_mergedCount = 0;
+static ParsedEvent g_dayEvents[kMaxDayEvents];
+static bool g_shardsLoaded = false;
+static bool g_shardsBootstrapped = false;
+static bool g_shardsDirty = false;
+static uint32_t g_lastBootstrapMs = 0;
+static uint32_t g_todayPollMs = 0;
+static int32_t g_completeThrough = 0;  // every day up to this one is final (or empty)
+static bool g_indexStale = false;      // the last index write failed
+
+static int32_t espnDayFromEpoch(time_t epoch) {
+  const int64_t shifted = (int64_t)epoch + kEspnDayOffsetSec;
+  int64_t days = shifted / 86400;
+  if (shifted < 0 && (shifted % 86400) != 0) days--;
+  return (int32_t)days;
+}
+
+static int32_t dayFromYmd(uint32_t ymd) {
+  return (int32_t)daysFromCivil((int)(ymd / 10000), (unsigned)((ymd / 100) % 100), (unsigned)(ymd % 100));
+}
+
+// Inverse of daysFromCivil().
+static uint32_t ymdFromDay(int32_t day) {
+  const int64_t z = (int64_t)day + 719468;
+  const int64_t era = (z >= 0 ? z : z - 146096) / 146097;
+  const unsigned doe = (unsigned)(z - era * 146097);
+  const unsigned yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  const unsigned doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  const unsigned mp = (5 * doy + 2) / 153;
+  const unsigned d = doy - (153 * mp + 2) / 5 + 1;
+  const unsigned m = (mp < 10) ? mp + 3 : mp - 9;
+  const int y = (int)((int64_t)yoe + era * 400) + (m <= 2 ? 1 : 0);
+  return (uint32_t)(y * 10000 + (int)m * 100 + (int)d);
+}
+
+static String ymdString(int32_t day) {
+  return String((unsigned long)ymdFromDay(day));
+}
+
+static String shardPath(int32_t day) {
+  return String("/sched/") + ymdString(day) + ".json";
+}
+
+static int32_t tournamentFirstDay() {
+  return dayFromYmd((uint32_t)atol(kTournamentStart));
+}
+
+static int32_t tournamentLastDay() {
+  return dayFromYmd((uint32_t)atol(kTournamentEnd));
+}
+
+static String isoFromEpoch(time_t epoch) {
+  struct tm ut;
+  gmtime_r(&epoch, &ut);
+  char buf[24];
+  strftime(buf, sizeof(buf), "%Y-%m-%dT%H:%MZ", &ut);
+  return String(buf);
+}
+
+// Writes an event back in the filtered ESPN scoreboard shape, so persisted
+// shards load through readScoreboardEvents() exactly like a live response.
+static void writeEventJson(JsonObject ev, const ParsedEvent &p) {
+  ev["id"] = (const char *)p.id;
+  ev["date"] = isoFromEpoch(p.startEpoch);
+  JsonObject comp = ev["competitions"].add<JsonObject>();
+  comp["status"]["type"]["state"] = eventStateName(p.state);
+  comp["status"]["type"]["completed"] = p.completed;
+  comp["status"]["type"]["detail"] = (const char *)p.detail;
+  comp["status"]["type"]["shortDetail"] = (const char *)p.shortDetail;
+  comp["status"]["displayClock"] = (const char *)p.displayClock;
+  comp["status"]["period"] = p.period;
+  comp["notes"][0]["headline"] = g_strings.str(p.groupHeadline);
+  comp["venue"]["fullName"] = g_strings.str(p.venue);
+  comp["venue"]["address"]["city"] = g_strings.str(p.city);
+
+  const EventTeam *teams[2] = {&p.home, &p.away};
+  const char *sides[2] = {"home", "away"};
+  for (uint8_t i = 0; i < 2; ++i) {
+    JsonObject c = comp["competitors"].add<JsonObject>();
+    c["homeAway"] = sides[i];
+    c["score"] = String(teams[i]->score);
+    c["team"]["abbreviation"] = Teams::code(teams[i]->id);
+    c["team"]["displayName"] = g_strings.str(teams[i]->name);
+    c["team"]["logo"] = Teams::logoUrl(teams[i]->id);
+  }
+}
+
+static ScheduleShard *findShard(int32_t day) {
+  for (uint8_t i = 0; i < g_shardCount; ++i) {
+    if (g_shards[i].day == day) return &g_shards[i];
+  }
+  return nullptr;
+}
+
+static ScheduleShard *findOrAddShard(int32_t day) {
+  ScheduleShard *shard = findShard(day);
+  if (shard || g_shardCount >= kMaxShards) return shard;
+  shard = &g_shards[g_shardCount++];
+  *shard = ScheduleShard();
+  shard->day = day;
+  shard->lastPollMs = millis();
+  return shard;
+}
+
+static bool persistShard(int32_t day) {
+  JsonDocument doc;
+  JsonArray events = doc["events"].to<JsonArray>();
+  for (uint8_t i = 0; i < g_mergedCount; ++i) {
+    if (g_parsedEvents[i].shardDay == day) writeEventJson(events.add<JsonObject>(), g_parsedEvents[i]);
+  }
+
+  File f = SPIFFS.open(shardPath(day), "w");
+  if (!f) return false;
+  const size_t written = serializeJson(doc, f);
+  f.close();
+  if (written == measureJson(doc)) return true;
+  SPIFFS.remove(shardPath(day));
+  return false;
+}
+
+static bool persistShardIndex() {
+  JsonDocument doc;
+  doc["through"] = ymdFromDay(g_completeThrough);
+  JsonArray days = doc["days"].to<JsonArray>();
+  for (uint8_t i = 0; i < g_shardCount; ++i) {
+    if (g_shards[i].complete) days.add(ymdFromDay(g_shards[i].day));
+  }
+
+  File f = SPIFFS.open(kShardIndexPath, "w");
+  if (!f) return false;
+  const size_t written = serializeJson(doc, f);
+  f.close();
+  return written == measureJson(doc);
+}
+
+// Restores frozen days from SPIFFS into the front of g_parsedEvents.
+static void loadPersistedShards(const String &focusTeamAbbr) {
+  g_shardsLoaded = true;
+  g_mergedCount = 0;
+  g_strings.clear();
+  g_shardCount = 0;
+  g_completeThrough = tournamentFirstDay() - 1;
+
+  File f = SPIFFS.open(kShardIndexPath, "r");
+  if (!f) return;
+  JsonDocument index;
+  const DeserializationError indexErr = deserializeJson(index, f);
+  f.close();
+  if (indexErr) return;
+
+  const uint32_t through = index["through"] | 0UL;
+  if (through) g_completeThrough = dayFromYmd(through);
+
+  for (JsonVariantConst v : index["days"].as<JsonArrayConst>()) {
+    const int32_t day = dayFromYmd(v.as<uint32_t>());
+    bool ok = false;
+    File sf = SPIFFS.open(shardPath(day), "r");
+    if (sf) {
+      EventSink sink{g_parsedEvents + g_mergedCount,
+                     (uint8_t)(kMaxParsedEvents - g_mergedCount),
+                     focusTeamAbbr,
+                     0,
+                     0,
+                     0};
+      const bool read = readScoreboardEvents(sf, (int32_t)sf.size(), &sink);
+      sf.close();
+      const uint8_t count = sink.count;
+      if (read) {
+        for (uint8_t i = 0; i < count; ++i) g_parsedEvents[g_mergedCount + i].shardDay = day;
+        g_mergedCount = (uint8_t)(g_mergedCount + count);
+        ScheduleShard *shard = findOrAddShard(day);
+        if (shard) shard->complete = true;
+        ok = true;
+      }
+    }
+    // A missing or unreadable day pulls the watermark back so it is fetched again.
+    if (!ok && day <= g_completeThrough) g_completeThrough = day - 1;
+  }
+
+  Serial.printf("Schedule: restored %u final days (%u events) through %lu\n",
+                (unsigned)g_shardCount,
+                (unsigned)g_mergedCount,
+                (unsigned long)ymdFromDay(g_completeThrough));
+}
+
+// Rebuilds per-shard flags from the merged events and freezes finished past days.
+static void refreshShards(int32_t today) {
+  for (uint8_t i = 0; i < g_mergedCount; ++i) {
+    findOrAddShard(g_parsedEvents[i].shardDay);
+  }
+
+  bool indexDirty = g_indexStale;
+  uint8_t kept = 0;
+  for (uint8_t si = 0; si < g_shardCount; ++si) {
+    ScheduleShard shard = g_shards[si];
+    uint8_t count = 0;
+    bool allFinal = true;
+    shard.hasLive = false;
+    shard.hasPending = false;
+    for (uint8_t i = 0; i < g_mergedCount; ++i) {
+      const ParsedEvent &ev = g_parsedEvents[i];
+      if (ev.shardDay != shard.day) continue;
+      count++;
+      if (ev.state == EventState::Live) shard.hasLive = true;
+      if (!isFinalEvent(ev)) {
+        allFinal = false;
+        shard.hasPending = true;
+      }
+    }
+    if (count == 0) continue;
+
+    // A day only counts as frozen once its file is written; otherwise it is
+    // tried again on the next refresh and holds the watermark back meanwhile.
+    if (!shard.complete && allFinal && shard.day < today) {
+      if (persistShard(shard.day)) {
+        shard.complete = true;
+        indexDirty = true;
+        Serial.printf("Schedule: %lu is final, frozen\n", (unsigned long)ymdFromDay(shard.day));
+      } else {
+        Serial.printf("Schedule: %lu is final but could not be saved\n", (unsigned long)ymdFromDay(shard.day));
+      }
+    }
+    g_shards[kept++] = shard;
+  }
+  g_shardCount = kept;
+
+  // Every day before today and before the earliest unfinished shard is final.
+  int32_t through = today - 1;
+  for (uint8_t i = 0; i < g_shardCount; ++i) {
+    if (!g_shards[i].complete && g_shards[i].day <= through) through = g_shards[i].day - 1;
+  }
+  if (through > g_completeThrough) {
+    g_completeThrough = through;
+    indexDirty = true;
+  }
+  if (indexDirty) g_indexStale = !persistShardIndex();
+}
+
+// Replaces everything stored for `day` with a fresh single-day response.
+static void replaceDayEvents(int32_t day, const ParsedEvent *incoming, uint8_t count) {
+  uint8_t kept = 0;
+  for (uint8_t r = 0; r < g_mergedCount; ++r) {
+    const ParsedEvent &ev = g_parsedEvents[r];
+    bool drop = (ev.shardDay == day);
+    for (uint8_t i = 0; !drop && i < count; ++i) {
+      drop = (strcmp(incoming[i].id, ev.id) == 0);
+    }
+    if (drop) continue;
+    if (kept != r) g_parsedEvents[kept] = g_parsedEvents[r];
+    kept++;
+  }
+  g_mergedCount = kept;
+
+  for (uint8_t i = 0; i < count && g_mergedCount < kMaxParsedEvents; ++i) {
+    g_parsedEvents[g_mergedCount] = incoming[i];
+    g_parsedEvents[g_mergedCount].shardDay = day;
+    g_mergedCount++;
+  }
+}
+
+// One ranged read of every day that is not frozen yet.
+static bool bootstrapShards(const String &focusTeamAbbr, int32_t today) {
+  int32_t first = g_completeThrough + 1;
+  if (first < tournamentFirstDay()) first = tournamentFirstDay();
+  const int32_t last = tournamentLastDay();
+
+  if (first <= last) {
+    // Events stream in behind the merged set, which is only replaced once the
+    // whole response has arrived; a failed read leaves it as it was.
+    uint8_t count = 0;
+    if (!fetchScoreboardEvents(scoreboardUrl(ymdString(first), ymdString(last)),
+                               nullptr,
+                               g_parsedEvents + g_mergedCount,
+                               (uint8_t)(kMaxParsedEvents - g_mergedCount),
+                               count,
+                               focusTeamAbbr)) {
+      return false;
+    }
+
+    uint8_t kept = 0;
+    for (uint8_t r = 0; r < g_mergedCount; ++r) {
+      if (g_parsedEvents[r].shardDay >= first) continue;
+      if (kept != r) g_parsedEvents[kept] = std::move(g_parsedEvents[r]);
+      kept++;
+    }
+    for (uint8_t i = 0; i < count; ++i) {
+      ParsedEvent &ev = g_parsedEvents[kept + i];
+      ev = std::move(g_parsedEvents[g_mergedCount + i]);
+      ev.shardDay = (ev.startEpoch > 0) ? espnDayFromEpoch(ev.startEpoch) : first;
+    }
+    g_mergedCount = (uint8_t)(kept + count);
+  }
+
+  refreshShards(today);
+  const uint32_t now = millis();
+  for (uint8_t i = 0; i < g_shardCount; ++i) g_shards[i].lastPollMs = now;
+  g_todayPollMs = now;
+  g_lastBootstrapMs = now;
+  g_shardsBootstrapped = true;
+  g_shardsDirty = true;
+
+  Serial.printf("Schedule: bootstrap %u events in %u days, frozen through %lu, strings %u (%u/%u B)\n",
+                (unsigned)g_mergedCount,
+                (unsigned)g_shardCount,
+                (unsigned long)ymdFromDay(g_completeThrough),
+                (unsigned)g_strings.count(),
+                (unsigned)g_strings.bytesUsed(),
+                (unsigned)StringPool::kBytes);
+  return true;
+}
+
+// Conditional single-day poll. Returns 1 when the day changed, 0 when the
+// feed answered 304, -1 on failure.
+static int pollShardDay(int32_t day, const String &focusTeamAbbr) {
+  bool notModified = false;
+  uint8_t count = 0;
+  const String ymd = ymdString(day);
+  // A day without games can come back with no events array at all; that is
+  // simply an empty day.
+  if (!fetchScoreboardEvents(scoreboardUrl(ymd, ymd), &notModified, g_dayEvents, kMaxDayEvents, count, focusTeamAbbr)) {
+    return -1;
+  }
+  if (notModified) return 0;
+  replaceDayEvents(day, g_dayEvents, count);
+  return 1;
+}
+
+// Polls today plus every unfinished shard whose interval has elapsed. Today
+// follows the schedule's interval, so the pregame curve and the live rate
+// apply to it directly.
+static bool pollDueShards(const String &focusTeamAbbr, int32_t today, uint32_t intervalMs) {
+  const uint32_t now = millis();
+  int32_t due[kMaxShards + 1];
+  uint8_t dueCount = 0;
+
+  const ScheduleShard *todayShard = findShard(today);
+  const uint32_t todayInterval = (todayShard && todayShard->hasLive) ? 0 : intervalMs;
+  if (today >= tournamentFirstDay() && today <= tournamentLastDay() &&
+      now - g_todayPollMs + kShardDueSlackMs >= todayInterval) {
+    due[dueCount++] = today;
+  }
+  for (uint8_t i = 0; i < g_shardCount; ++i) {
+    const ScheduleShard &shard = g_shards[i];
+    if (shard.complete || !shard.hasPending || shard.day == today) continue;
+    const uint32_t interval = shard.hasLive ? 0 : (intervalMs > kShardFuturePollMs ? intervalMs : kShardFuturePollMs);
+    if (now - shard.lastPollMs + kShardDueSlackMs >= interval) due[dueCount++] = shard.day;
+  }
+
+  bool ok = true;
+  for (uint8_t i = 0; i < dueCount; ++i) {
+    const int32_t day = due[i];
+    const int result = pollShardDay(day, focusTeamAbbr);
+    if (result < 0) {
+      ok = false;
+      continue;
+    }
+    if (result > 0) g_shardsDirty = true;
+    if (day == today) g_todayPollMs = now;
+    ScheduleShard *shard = findShard(day);
+    if (shard) shard->lastPollMs = now;
+  }
+
+  if (g_shardsDirty) refreshShards(today);
+  return ok;
+}
+
+}  // namespace
+
+bool EspnOlympicClient::httpGetJson(const String &url, JsonDocument &doc) {
+  return httpGetJsonInternal(url, doc, nullptr);
+}
+
+bool EspnOlympicClient::httpGetJson(const String &url, JsonDocument &doc, const JsonDocument &filter) {
+  return httpGetJsonInternal(url, doc, &filter);
+}
+
+bool EspnOlympicClient::scoreboardHealth(HttpPool::EndpointHealth &out) const {
+  return HttpPool::health(String(kEspnBase) + "/scoreboard", out);
+}
+
+bool EspnOlympicClient::scanScoreboard(Stream &body,
+                                       int32_t bytes,
+                                       const String &focusTeamAbbr,
+                                       uint16_t &events,
+                                       uint32_t &firstEventBytes) {
+  EventSink sink{nullptr, 0, focusTeamAbbr, 0, 0, 0};
+  const bool ok = readScoreboardEvents(body, bytes, &sink);
+  events = sink.seen;
+  firstEventBytes = sink.firstEventBytes;
+  return ok;
+}
+
+bool EspnOlympicClient::fetchScoreboardNow(GameState &out, const String &focusTeamAbbr) {
+  return fetchScoreboardForRange(out, focusTeamAbbr, kTournamentStart, kTournamentEnd);
+}
+
+bool EspnOlympicClient::fetchScoreboardIfChanged(GameState &out,
+                                                 const String &focusTeamAbbr,
+                                                 uint32_t pollIntervalMs,
+                                                 bool &changed) {
+  changed = true;
+  const time_t nowEpoch = time(nullptr);
+  if (nowEpoch <= 1577836800) {
+    // No wall clock yet, so no "today" to shard around: read the whole range.
+    return fetchScoreboardNow(out, focusTeamAbbr);
+  }
+
+  const int32_t today = espnDayFromEpoch(nowEpoch);
+  const uint32_t now = millis();
+  if (!g_shardsLoaded) loadPersistedShards(focusTeamAbbr);
+  if (!g_shardsBootstrapped || now - g_lastBootstrapMs >= kShardRebootstrapMs) {
+    if (!bootstrapShards(focusTeamAbbr, today)) return false;
+  } else if (!pollDueShards(focusTeamAbbr, today, pollIntervalMs)) {
+    return false;
+  }
+
+  if (!g_shardsDirty && _lastScoreboardDeriveMs != 0 && now - _lastScoreboardDeriveMs < kScoreboardMaxUnchangedMs) {
+    changed = false;
+    return true;
+  }
+
+  deriveGameState(g_parsedEvents, g_mergedCount, focusTeamAbbr, out);
+  g_shardsDirty = false;
+  _lastScoreboardDeriveMs = now ? now : 1;
+  return true;
+}
+
+bool EspnOlympicClient::fetchScoreboardForRange(GameState &out,
+                                                const String &focusTeamAbbr,
+                                                const String &startYYYYMMDD,
+                                                const String &endYYYYMMDD) {
+  // Ranged reads share g_parsedEvents with the shard store; rebuild it next poll.
+  g_shardsLoaded = false;
+  g_shardsBootstrapped = false;
+  g_strings.clear();
+
+  uint8_t eventCount = 0;
+  const String url = scoreboardUrl(startYYYYMMDD, endYYYYMMDD);
+  if (!fetchScoreboardEvents(url, nullptr, g_parsedEvents, kMaxParsedEvents, eventCount, focusTeamAbbr)) {
+    return false;
+  }
+
+  deriveGameState(g_parsedEvents, eventCount, focusTeamAbbr, out);
+  return true;
+}
+
+bool EspnOlympicClient::fetchGameDetail(GameState &io, const String &focusTeamAbbr, bool &gotGoal) {
+  gotGoal = false;
+  if (io.gameId.isEmpty()) return false;
+
+  JsonDocument filter;
+  addSummaryStatusFilter(filter);
+  addSummaryPlaysFilter(filter);
+
+  JsonDocument doc;
+  const String url = String(kEspnBase) + "/summary?event=" + io.gameId;
+  if (!httpGetJson(url, doc, filter)) return false;
+
+  applySummaryStatus(doc, io);
+  gotGoal = applyLatestGoal(doc, io, focusTeamAbbr);
+  return true;
+}
@@ -3,26 +3,45 @@
 #include <Arduino.h>
 #include <ArduinoJson.h>
 
+#include "http_pool.h"
 #include "types.h"
 
 class EspnOlympicClient {
 public:
   // Tournament feed fetch + selection (in-progress > next scheduled > most recent final).
   bool fetchScoreboardNow(GameState &out, const String &focusTeamAbbr);
+  // Polling variant backed by per-day schedule shards: finished past days are
+  // frozen in SPIFFS, and only today and days with pending games are re-polled
+  // (conditionally). Today is re-polled once `pollIntervalMs` (the
+  // PollSchedule scoreboard interval) has passed; later days at most that
+  // often. `changed` is false when no day changed, in which case `out` is left
+  // untouched.
+  bool fetchScoreboardIfChanged(GameState &out, const String &focusTeamAbbr, uint32_t pollIntervalMs, bool &changed);
   bool fetchScoreboardForRange(GameState &out,
                                const String &focusTeamAbbr,
                                const String &startYYYYMMDD,
                                const String &endYYYYMMDD);
 
-  // Convenience wrappers for explicit next/last selection from the same endpoint.
-  bool fetchNextCanadaGame(GameState &io, const String &focusTeamAbbr);
-  bool fetchLastCanadaGame(GameState &io, const String &focusTeamAbbr);
-
   // Optional detail endpoint for stats/plays. App still runs if these fail.
-  bool fetchGameSummaryStats(GameState &io);
-  bool fetchLatestGoal(GameState &io, const String &focusTeamAbbr);
+  // fetchGameDetail fills clock/status, team stats, strength and the latest
+  // goal from one /summary request; `gotGoal` reports whether a goal was found.
+  bool fetchGameDetail(GameState &io, const String &focusTeamAbbr, bool &gotGoal);
+
+  // Backoff/circuit state of the scoreboard endpoint, for explaining stale data.
+  bool scoreboardHealth(HttpPool::EndpointHealth &out) const;
+
+  // Reads a scoreboard body the way every poll does but keeps no events:
+  // `events` gets how many it held and `firstEventBytes` how much of the body
+  // had been read when the first was complete. For the native benchmarks.
+  static bool scanScoreboard(Stream &body,
+                             int32_t bytes,
+                             const String &focusTeamAbbr,
+                             uint16_t &events,
+                             uint32_t &firstEventBytes);
 
 private:
   bool httpGetJson(const String &url, JsonDocument &doc);
   bool httpGetJson(const String &url, JsonDocument &doc, const JsonDocument &filter);
-};
+
+  uint32_t _lastScoreboardDeriveMs = 0;
+};
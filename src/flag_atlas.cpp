@@ -0,0 +1,111 @@
+#include "flag_atlas.h"
+
+#include <esp_partition.h>
+#include <string.h>
+
+#include "flag_cache.h"
+
+namespace {
+
+// Layout written by tools/fetch_flags.py; all fields little-endian.
+static const char kMagic[4] = {'F', 'L', 'A', '1'};
+static const uint16_t kVersion = 1;
+static const uint8_t kPartitionSubtype = 0x40;
+static const uint16_t kFlagRle = 0x0001;
+
+struct Header {
+  char magic[4];
+  uint16_t version;
+  uint16_t count;
+};
+
+struct Entry {
+  char code[4];
+  uint16_t size;
+  uint16_t w;
+  uint16_t h;
+  uint16_t flags;
+  uint32_t offset;
+  uint32_t bytes;
+};
+
+static_assert(sizeof(Header) == 8, "atlas header layout");
+static_assert(sizeof(Entry) == 20, "atlas entry layout");
+
+static const uint8_t *sBase = nullptr;
+static const Entry *sEntries = nullptr;
+static uint16_t sCount = 0;
+static spi_flash_mmap_handle_t sHandle = 0;
+
+static const Entry *find(const char *code, int16_t size) {
+  if (!sBase || !code || !code[0]) return nullptr;
+  for (uint16_t i = 0; i < sCount; ++i) {
+    const Entry &e = sEntries[i];
+    if (e.size == (uint16_t)size && strncmp(e.code, code, sizeof(e.code)) == 0) return &e;
+  }
+  return nullptr;
+}
+
+}  // namespace
+
+namespace FlagAtlas {
+
+bool begin() {
+  if (sBase) return true;
+
+  const esp_partition_t *part =
+      esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)kPartitionSubtype, "flags");
+  if (!part) {
+    Serial.println("Flag atlas: no partition");
+    return false;
+  }
+
+  const void *mapped = nullptr;
+  if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &mapped, &sHandle) != ESP_OK) {
+    Serial.println("Flag atlas: mmap failed");
+    return false;
+  }
+
+  const uint8_t *base = (const uint8_t *)mapped;
+  const Header *header = (const Header *)base;
+  const size_t tableEnd = sizeof(Header) + (size_t)header->count * sizeof(Entry);
+  bool ok = memcmp(header->magic, kMagic, sizeof(kMagic)) == 0 && header->version == kVersion &&
+            tableEnd <= part->size;
+  const Entry *entries = (const Entry *)(base + sizeof(Header));
+  for (uint16_t i = 0; ok && i < header->count; ++i) {
+    const Entry &e = entries[i];
+    ok = e.offset >= tableEnd && (e.offset & 3) == 0 && e.offset + e.bytes <= part->size &&
+         ((e.flags & kFlagRle) || e.bytes == (uint32_t)e.w * e.h * 2);
+  }
+  if (!ok) {
+    spi_flash_munmap(sHandle);
+    sHandle = 0;
+    Serial.println("Flag atlas: partition empty or invalid");
+    return false;
+  }
+
+  sBase = base;
+  sEntries = entries;
+  sCount = header->count;
+  Serial.printf("Flag atlas: %u flags mapped\n", (unsigned)sCount);
+  return true;
+}
+
+bool contains(const char *code, int16_t size) {
+  return find(code, size) != nullptr;
+}
+
+bool draw(TFT_eSPI &tft, const char *code, int16_t size, int16_t x, int16_t y, uint16_t bg) {
+  const Entry *e = find(code, size);
+  if (!e) return false;
+  if (e->w < size || e->h < size) tft.fillRect(x, y, size, size, bg);
+  FlagCache::blit(tft, x, y, (int16_t)e->w, (int16_t)e->h, (e->flags & kFlagRle) != 0,
+                  (const uint16_t *)(sBase + e->offset), e->bytes / 2);
+  return true;
+}
+
+uint16_t count() {
+  return sCount;
+}
+
+}  // namespace FlagAtlas
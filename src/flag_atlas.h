@@ -0,0 +1,28 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Pre-converted RGB565 flags packed by tools/fetch_flags.py into the `flags`
+// flash partition (see partitions.csv). The partition is memory-mapped once and
+// bitmaps are pushed to the panel straight from flash: no filesystem, no PNG
+// inflate and no RAM copy. Teams or sizes missing from the atlas fall back to
+// the PNGs in SPIFFS.
+
+namespace FlagAtlas {
+
+// Maps the partition and checks its header. Returns false, leaving the atlas
+// empty, when the partition is missing, blank or not a valid atlas.
+bool begin();
+
+// Draws the flag for `code` at `size` with its top-left at x,y, over a `bg`
+// fill when the bitmap is smaller than the box. Returns false when the atlas
+// has no such flag.
+bool draw(TFT_eSPI &tft, const char *code, int16_t size, int16_t x, int16_t y, uint16_t bg);
+
+// Whether the atlas holds the flag for `code` at `size`. Safe from either core.
+bool contains(const char *code, int16_t size);
+
+uint16_t count();
+
+}  // namespace FlagAtlas
@@ -0,0 +1,142 @@
+#include "flag_cache.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+// PNGdec writes big-endian pixels for pushImage with swap-bytes off;
+// pushColor takes the colour as a plain value.
+inline uint16_t toColour(uint16_t px) { return (uint16_t)((px >> 8) | (px << 8)); }
+
+// Number of {count, colour} pairs the bitmap encodes to.
+size_t countRuns(const uint16_t *pixels, size_t n) {
+  size_t runs = 0;
+  size_t i = 0;
+  while (i < n) {
+    size_t j = i + 1;
+    while (j < n && pixels[j] == pixels[i] && j - i < 0xFFFF) ++j;
+    ++runs;
+    i = j;
+  }
+  return runs;
+}
+
+void encodeRuns(const uint16_t *pixels, size_t n, uint16_t *out) {
+  size_t i = 0;
+  while (i < n) {
+    size_t j = i + 1;
+    while (j < n && pixels[j] == pixels[i] && j - i < 0xFFFF) ++j;
+    *out++ = (uint16_t)(j - i);
+    *out++ = toColour(pixels[i]);
+    i = j;
+  }
+}
+
+}  // namespace
+
+int FlagCache::find(Teams::TeamId team, int16_t size) const {
+  for (uint8_t i = 0; i < kMaxEntries; ++i) {
+    if (_entries[i].data && _entries[i].team == team && _entries[i].size == size) return i;
+  }
+  return -1;
+}
+
+bool FlagCache::draw(TFT_eSPI &tft, Teams::TeamId team, int16_t size, int16_t x, int16_t y, uint16_t bg) {
+  const int index = find(team, size);
+  if (index < 0) {
+    _stats.misses++;
+    return false;
+  }
+  Entry &e = _entries[index];
+  e.lastUse = ++_clock;
+  _stats.hits++;
+
+  if (e.w < size || e.h < size) tft.fillRect(x, y, size, size, bg);
+  blit(tft, x, y, e.w, e.h, e.rle, e.data, e.bytes / 2);
+  return true;
+}
+
+void FlagCache::blit(TFT_eSPI &tft, int16_t x, int16_t y, int16_t w, int16_t h, bool rle, const uint16_t *data,
+                     size_t words) {
+  if (!rle) {
+    tft.pushImage(x, y, w, h, data);
+    return;
+  }
+  tft.startWrite();
+  tft.setAddrWindow(x, y, w, h);
+  const uint16_t *end = data + words;
+  for (const uint16_t *run = data; run + 1 < end; run += 2) {
+    tft.pushColor(run[1], run[0]);
+  }
+  tft.endWrite();
+}
+
+void FlagCache::evict(uint8_t index) {
+  Entry &e = _entries[index];
+  free(e.data);
+  _stats.bytes -= e.bytes;
+  _stats.entries--;
+  _stats.evictions++;
+  e = Entry();
+}
+
+bool FlagCache::makeRoom(uint32_t bytes) {
+  if (bytes > _budget) return false;
+  for (;;) {
+    int oldest = -1;
+    bool haveSlot = false;
+    for (uint8_t i = 0; i < kMaxEntries; ++i) {
+      if (!_entries[i].data) {
+        haveSlot = true;
+        continue;
+      }
+      if (oldest < 0 || _entries[i].lastUse < _entries[oldest].lastUse) oldest = i;
+    }
+    if (haveSlot && _stats.bytes + bytes <= _budget) return true;
+    if (oldest < 0) return false;
+    evict((uint8_t)oldest);
+  }
+}
+
+bool FlagCache::store(Teams::TeamId team, int16_t size, int16_t w, int16_t h, const uint16_t *pixels) {
+  if (team == Teams::kNone || !pixels || w <= 0 || h <= 0) return false;
+
+  // The limit is on the stored size: a 96 px flag is 18 KB raw but only a
+  // few KB of runs.
+  const size_t n = (size_t)w * h;
+  const size_t runs = countRuns(pixels, n);
+  const bool rle = runs * 2 < n;
+  const uint32_t bytes = (uint32_t)(rle ? runs * 4 : n * 2);
+  if (bytes > _budget / 2) return false;
+
+  const int existing = find(team, size);
+  if (existing >= 0) evict((uint8_t)existing);
+  if (!makeRoom(bytes)) return false;
+
+  uint16_t *data = (uint16_t *)malloc(bytes);
+  if (!data) return false;
+  if (rle) {
+    encodeRuns(pixels, n, data);
+  } else {
+    memcpy(data, pixels, bytes);
+  }
+
+  for (uint8_t i = 0; i < kMaxEntries; ++i) {
+    Entry &e = _entries[i];
+    if (e.data) continue;
+    e.team = team;
+    e.size = size;
+    e.w = w;
+    e.h = h;
+    e.rle = rle;
+    e.lastUse = ++_clock;
+    e.bytes = bytes;
+    e.data = data;
+    _stats.bytes += bytes;
+    _stats.entries++;
+    return true;
+  }
+  free(data);
+  return false;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+#include "teams.h"
+
+// Decoded flags kept in RAM, keyed by team and badge size, so drawing a flag
+// that was drawn before skips SPIFFS and the PNG inflate. Bitmaps are stored
+// run-length encoded when that is smaller (flags are mostly flat colour) and
+// raw otherwise; either way a hit is one address window on the panel. Entries
+// are evicted least recently drawn first to stay within a byte budget.
+
+class FlagCache {
+public:
+  static constexpr uint8_t kMaxEntries = 32;
+
+  struct Stats {
+    uint32_t hits = 0;
+    uint32_t misses = 0;
+    uint32_t evictions = 0;
+    uint32_t bytes = 0;
+    uint8_t entries = 0;
+  };
+
+  explicit FlagCache(size_t budgetBytes) : _budget(budgetBytes) {}
+
+  // Draws the cached flag for (team, size) with its top-left at x,y. A bitmap
+  // smaller than the size x size box is drawn over a `bg` fill of the box.
+  // Returns false on a miss.
+  bool draw(TFT_eSPI &tft, Teams::TeamId team, int16_t size, int16_t x, int16_t y, uint16_t bg);
+
+  // Keeps a decoded bitmap, pixels in panel byte order as PNGdec writes them
+  // for TFT_eSPI. Evicts older entries as needed; returns false when it
+  // cannot be kept, including when it would take more than half the budget
+  // once encoded.
+  bool store(Teams::TeamId team, int16_t size, int16_t w, int16_t h, const uint16_t *pixels);
+
+  const Stats &stats() const { return _stats; }
+  size_t budget() const { return _budget; }
+
+  // Draws a bitmap in either storage format: raw pixels in panel byte order,
+  // or `words` uint16s of {count, colour} runs. Shared with FlagAtlas.
+  static void blit(TFT_eSPI &tft, int16_t x, int16_t y, int16_t w, int16_t h, bool rle, const uint16_t *data,
+                   size_t words);
+
+private:
+  struct Entry {
+    Teams::TeamId team = Teams::kNone;
+    int16_t size = 0;
+    int16_t w = 0;
+    int16_t h = 0;
+    bool rle = false;
+    uint32_t lastUse = 0;
+    uint32_t bytes = 0;
+    uint16_t *data = nullptr;  // raw: w*h pixels; rle: {count, colour} pairs
+  };
+
+  int find(Teams::TeamId team, int16_t size) const;
+  void evict(uint8_t index);
+  bool makeRoom(uint32_t bytes);
+
+  Entry _entries[kMaxEntries];
+  size_t _budget;
+  uint32_t _clock = 0;
+  Stats _stats;
+};
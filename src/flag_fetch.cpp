@@ -0,0 +1,348 @@
+#include "flag_fetch.h"
+
+#include <HTTPClient.h>
+#include <SPIFFS.h>
+#include <WiFi.h>
+#include <atomic>
+
+#include "flag_atlas.h"
+#include "http_pool.h"
+
+namespace {
+
+static const int16_t kSizes[] = {56, 64, 96};
+static const uint8_t kSizeCount = sizeof(kSizes) / sizeof(kSizes[0]);
+static const size_t kFlagMaxBytes = 120 * 1024;
+// SPIFFS.exists() walks the filesystem, so a run stops after this many probes
+// and lets the network task get back to its polls.
+static const uint8_t kMaxProbesPerRun = 6;
+static const uint32_t kRetryBaseMs = 60UL * 1000UL;
+static const uint32_t kRetryMaxMs = 30UL * 60UL * 1000UL;
+
+struct Job {
+  std::atomic<uint8_t> state{(uint8_t)FlagFetch::State::Unknown};
+  uint8_t failures = 0;    // network task only
+  uint32_t retryAtMs = 0;  // network task only
+};
+
+static Job sJobs[Teams::kMaxTeams + 1][kSizeCount];  // [0] is kNone
+static bool sSpiffsReady = false;
+static std::atomic<uint32_t> sLanded{0};
+
+enum class Outcome : uint8_t { Present, Fetched, NoUrl, Failed };
+
+static int sizeSlot(int16_t size) {
+  for (uint8_t i = 0; i < kSizeCount; ++i) {
+    if (kSizes[i] == size) return i;
+  }
+  return -1;
+}
+
+static Job *job(Teams::TeamId team, int16_t size) {
+  const int slot = sizeSlot(size);
+  if (team == Teams::kNone || team > Teams::kMaxTeams || slot < 0) return nullptr;
+  return &sJobs[team][slot];
+}
+
+static bool ensureSpiffsDir(const String &dirPath) {
+  if (!sSpiffsReady) return false;
+  if (dirPath.length() == 0 || dirPath == "/") return true;
+
+  int slash = 1;
+  while (slash > 0) {
+    slash = dirPath.indexOf('/', slash);
+    String segment = (slash >= 0) ? dirPath.substring(0, slash) : dirPath;
+    if (segment.length() > 1 && !SPIFFS.exists(segment)) {
+      if (!SPIFFS.mkdir(segment) && !SPIFFS.exists(segment)) {
+        return false;
+      }
+    }
+    if (slash >= 0) slash++;
+  }
+  return true;
+}
+
+static String rewriteEspnLogoUrlForSize(const String &url, int16_t size) {
+  if (!url.length()) return url;
+
+  String path = url;
+  const int scheme = path.indexOf("://");
+  if (scheme >= 0) {
+    const int slash = path.indexOf('/', scheme + 3);
+    if (slash >= 0) {
+      path = path.substring(slash);
+    }
+  }
+
+  const int query = path.indexOf('?');
+  if (query >= 0) {
+    path = path.substring(0, query);
+  }
+
+  return String("https://a.espncdn.com/combiner/i?img=") + path +
+         "&w=" + String(size) + "&h=" + String(size);
+}
+
+// The UI task may open a flag at any moment, so files are written under a
+// temporary name and renamed into place once complete.
+static String partPath(const String &destPath) {
+  return destPath + ".part";
+}
+
+static bool commitPart(const String &part, const String &destPath) {
+  if (SPIFFS.rename(part, destPath)) return true;
+  SPIFFS.remove(part);
+  return false;
+}
+
+static bool downloadToSpiffs(const String &url, const String &destPath, size_t maxBytes) {
+  if (!sSpiffsReady) return false;
+  if (url.isEmpty()) return false;
+  if (WiFi.status() != WL_CONNECTED) return false;
+
+  const int slash = destPath.lastIndexOf('/');
+  if (slash > 0) {
+    const String dir = destPath.substring(0, slash);
+    if (!ensureSpiffsDir(dir)) return false;
+  }
+
+  HTTPClient *http = nullptr;
+  const int code = HttpPool::get(url, "olympic-scoreboard-esp32", "image/png", http);
+  if (!http) return false;
+  if (code != 200) {
+    HttpPool::end(http, false);
+    return false;
+  }
+
+  const int len = http->getSize();
+  if (len > 0 && (size_t)len > maxBytes) {
+    HttpPool::end(http, false);
+    return false;
+  }
+
+  const String part = partPath(destPath);
+  File out = SPIFFS.open(part, "w");
+  if (!out) {
+    HttpPool::end(http, false);
+    return false;
+  }
+
+  size_t total = 0;
+  bool complete = false;
+  if (len < 0) {
+    // Unknown length (chunked): let HTTPClient de-chunk into the file.
+    const int written = http->writeToStream(&out);
+    complete = written > 0;
+    total = (written > 0) ? (size_t)written : 0;
+  } else {
+    Stream &stream = http->getStream();
+    uint8_t buf[1024];
+    int remaining = len;
+
+    while (http->connected() && remaining > 0) {
+      size_t avail = (size_t)stream.available();
+      if (!avail) {
+        delay(1);
+        continue;
+      }
+
+      const size_t want = (avail > sizeof(buf)) ? sizeof(buf) : avail;
+      const int readN = stream.readBytes((char *)buf, want);
+      if (readN <= 0) break;
+
+      total += (size_t)readN;
+      if (total > maxBytes) {
+        out.close();
+        SPIFFS.remove(part);
+        HttpPool::end(http, false);
+        return false;
+      }
+
+      if (out.write(buf, (size_t)readN) != (size_t)readN) {
+        out.close();
+        SPIFFS.remove(part);
+        HttpPool::end(http, false);
+        return false;
+      }
+
+      remaining -= readN;
+    }
+    complete = (remaining == 0);
+  }
+
+  out.close();
+  HttpPool::end(http, complete);
+
+  if (!complete || total == 0 || total > maxBytes) {
+    SPIFFS.remove(part);
+    return false;
+  }
+
+  return commitPart(part, destPath);
+}
+
+static bool copySpiffsFile(const String &src, const String &dst) {
+  if (!SPIFFS.exists(src)) return false;
+
+  const int slash = dst.lastIndexOf('/');
+  if (slash > 0) {
+    const String dir = dst.substring(0, slash);
+    if (!ensureSpiffsDir(dir)) return false;
+  }
+
+  const String part = partPath(dst);
+  File in = SPIFFS.open(src, "r");
+  if (!in) return false;
+  File out = SPIFFS.open(part, "w");
+  if (!out) {
+    in.close();
+    return false;
+  }
+
+  uint8_t buf[1024];
+  while (in.available()) {
+    const size_t n = in.read(buf, sizeof(buf));
+    if (!n) break;
+    if (out.write(buf, n) != n) {
+      in.close();
+      out.close();
+      SPIFFS.remove(part);
+      return false;
+    }
+  }
+
+  in.close();
+  out.close();
+  return commitPart(part, dst);
+}
+
+// Makes sure the flag for (team, size) is on the device. `probes` counts the
+// SPIFFS lookups made; `sent` is set once a download was attempted.
+static Outcome fetchFlag(Teams::TeamId team, int16_t size, uint8_t &probes, bool &sent) {
+  const char *abbr = Teams::code(team);
+  if (FlagAtlas::contains(abbr, size)) return Outcome::Present;
+
+  // Without a URL there is nothing to fetch; the UI still finds a flag that
+  // was uploaded with the filesystem image by itself.
+  const String logoUrl = Teams::logoUrl(team);
+  if (!logoUrl.length()) return Outcome::NoUrl;
+
+  const String sizedPath = FlagFetch::sizedPath(size, abbr);
+  const String flatPath = FlagFetch::flatPath(abbr);
+  probes++;
+  if (SPIFFS.exists(sizedPath)) return Outcome::Present;
+
+  // Every size is fetched on its own; the size-less file only stands in when
+  // the resized image cannot be had.
+  const String sizedUrl = rewriteEspnLogoUrlForSize(logoUrl, size);
+  sent = true;
+  if (downloadToSpiffs(sizedUrl, sizedPath, kFlagMaxBytes)) {
+    if (!SPIFFS.exists(flatPath)) {
+      copySpiffsFile(sizedPath, flatPath);
+    }
+    return Outcome::Fetched;
+  }
+
+  if (SPIFFS.exists(flatPath)) return Outcome::Present;
+  if (downloadToSpiffs(logoUrl, flatPath, kFlagMaxBytes)) {
+    copySpiffsFile(flatPath, sizedPath);
+    return Outcome::Fetched;
+  }
+
+  return Outcome::Failed;
+}
+
+static void finish(Job &j, Teams::TeamId team, int16_t size, Outcome outcome, uint32_t nowMs) {
+  switch (outcome) {
+    case Outcome::Present:
+      j.failures = 0;
+      j.state.store((uint8_t)FlagFetch::State::Ready);
+      break;
+    case Outcome::Fetched:
+      j.failures = 0;
+      j.state.store((uint8_t)FlagFetch::State::Ready);
+      // Forget a size-less stand-in the UI may have settled on.
+      Teams::setFlagFile(team, size, Teams::FlagFile::Unknown);
+      Teams::bumpAssetVersion(team);
+      sLanded.fetch_add(1);
+      Serial.printf("Flags: fetched %s@%d\n", Teams::code(team), (int)size);
+      break;
+    case Outcome::NoUrl:
+      break;
+    case Outcome::Failed: {
+      if (j.failures < 255) j.failures++;
+      const uint8_t shift = (j.failures > 5) ? 5 : (uint8_t)(j.failures - 1);
+      uint32_t waitMs = kRetryBaseMs << shift;
+      if (waitMs > kRetryMaxMs) waitMs = kRetryMaxMs;
+      j.retryAtMs = nowMs + waitMs;
+      j.state.store((uint8_t)FlagFetch::State::Failed);
+      Serial.printf("Flags: %s@%d failed (%u in a row), retry in %lus\n",
+                    Teams::code(team), (int)size, (unsigned)j.failures, (unsigned long)(waitMs / 1000));
+      break;
+    }
+  }
+}
+
+}  // namespace
+
+namespace FlagFetch {
+
+void begin(bool spiffsReady) {
+  sSpiffsReady = spiffsReady;
+  if (!sSpiffsReady) return;
+  ensureSpiffsDir("/flags");
+  for (uint8_t i = 0; i < kSizeCount; ++i) {
+    ensureSpiffsDir(String("/flags/") + String(kSizes[i]));
+  }
+}
+
+String sizedPath(int16_t size, const char *code) {
+  return String("/flags/") + String(size) + "/" + code + ".png";
+}
+
+String flatPath(const char *code) {
+  return String("/flags/") + code + ".png";
+}
+
+State state(Teams::TeamId team, int16_t size) {
+  const Job *j = job(team, size);
+  return j ? (State)j->state.load() : State::Unknown;
+}
+
+void request(Teams::TeamId team, int16_t size) {
+  Job *j = job(team, size);
+  if (!j) return;
+  uint8_t current = j->state.load();
+  while (current == (uint8_t)State::Unknown || current == (uint8_t)State::Ready) {
+    if (j->state.compare_exchange_weak(current, (uint8_t)State::Queued)) return;
+  }
+}
+
+bool runOne(uint32_t nowMs) {
+  if (!sSpiffsReady) return false;
+  const uint8_t teams = Teams::count();
+  const State passes[] = {State::Queued, State::Unknown, State::Failed};
+  uint8_t probes = 0;
+  for (const State pass : passes) {
+    for (Teams::TeamId team = 1; team <= teams; ++team) {
+      for (uint8_t slot = 0; slot < kSizeCount; ++slot) {
+        Job &j = sJobs[team][slot];
+        if (j.state.load() != (uint8_t)pass) continue;
+        if (pass == State::Failed && (int32_t)(nowMs - j.retryAtMs) < 0) continue;
+
+        bool sent = false;
+        const Outcome outcome = fetchFlag(team, kSizes[slot], probes, sent);
+        finish(j, team, kSizes[slot], outcome, nowMs);
+        if (sent) return true;
+        if (probes >= kMaxProbesPerRun) return false;
+      }
+    }
+  }
+  return false;
+}
+
+uint32_t landed() {
+  return sLanded.load();
+}
+
+}  // namespace FlagFetch
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "teams.h"
+
+// Background acquisition of flag PNGs into SPIFFS. Drawing never downloads: a
+// flag that is not on the device is drawn as a badge and requested here, and
+// the network task works through the jobs while it is idle between polls.
+// Besides requested flags, every team seen in the scoreboard (every team with a
+// logo URL) is prefetched at each cached flag size, so most flags are already
+// on the device before a screen needs them. A failed download is not retried
+// before its retry-after time, which backs off per flag.
+
+namespace FlagFetch {
+
+enum class State : uint8_t {
+  Unknown,  // not looked at yet
+  Queued,   // a draw found it missing; fetched ahead of prefetch work
+  Ready,    // in the flag atlas or SPIFFS
+  Failed,   // download failed; retried after a backoff
+};
+
+// Call once from Assets::begin(), after mounting SPIFFS.
+void begin(bool spiffsReady);
+
+// SPIFFS paths of a team's flag: per size, and the size-less fallback.
+String sizedPath(int16_t size, const char *code);
+String flatPath(const char *code);
+
+// State of the flag for (team, size). Sizes other than the cached flag sizes
+// have no job and always report Unknown. Safe from either core.
+State state(Teams::TeamId team, int16_t size);
+
+// Marks a flag a draw could not find as wanted. Does nothing while the flag is
+// already queued or waiting out a failure. Safe from either core.
+void request(Teams::TeamId team, int16_t size);
+
+// Network task only. Works on pending jobs (requested flags first, then
+// prefetch, then failures whose retry time has come) until one download was
+// attempted or a few files were probed. Returns true when it downloaded.
+bool runOne(uint32_t nowMs);
+
+// Number of flags downloaded since boot. A change means a badge on screen may
+// now have a flag to show.
+uint32_t landed();
+
+}  // namespace FlagFetch
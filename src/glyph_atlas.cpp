@@ -0,0 +1,266 @@
+#include "glyph_atlas.h"
+
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+
+#include "config.h"
+#include "glyph_masters.h"
+#include "palette.h"
+
+// Draw scores, clocks and countdowns from the anti-aliased atlas instead of
+// the 1-bit fonts.
+#ifndef GLYPH_ATLAS
+#define GLYPH_ATLAS 1
+#endif
+
+namespace {
+
+// The space has no master and stays blank; the rest match tools/glyph_masters.py.
+static const char kCharset[] = "0123456789:-dP ";
+static const uint8_t kCharCount = sizeof(kCharset) - 1;
+static const uint8_t kFonts[] = {2, 4, 6};
+static const uint8_t kFontCount = sizeof(kFonts);
+static const uint8_t kMaxRamps = 12;
+// Largest cell, a font 6 digit, is well under this.
+static const size_t kMaxCellPixels = 40 * 48;
+// Longest master row or glyph column resampled at boot.
+static const uint16_t kMaxSpan = 64;
+
+struct Glyph {
+  uint8_t w = 0;
+  uint8_t h = 0;
+  uint32_t offset = 0;  // into sMasks, two pixels per byte, high nibble first
+};
+
+struct Ramp {
+  uint16_t fg = 0;
+  uint16_t bg = 0;
+  uint16_t colour[16];  // panel byte order, as pushImage takes it
+};
+
+static Glyph sGlyphs[kFontCount][kCharCount];
+static uint8_t *sMasks = nullptr;
+static size_t sMaskBytes = 0;
+static Ramp sRamps[kMaxRamps];
+static uint8_t sRampCount = 0;
+static uint8_t sRampNext = 0;
+static uint16_t sCell[kMaxCellPixels];
+
+static int fontSlot(uint8_t font) {
+  for (uint8_t i = 0; i < kFontCount; ++i) {
+    if (kFonts[i] == font) return i;
+  }
+  return -1;
+}
+
+static int charSlot(char c) {
+  const char *p = strchr(kCharset, c);
+  return (p && c) ? (int)(p - kCharset) : -1;
+}
+
+static uint16_t blend(uint16_t fg, uint16_t bg, uint8_t alpha) {
+  const uint16_t r = (uint16_t)((((fg >> 11) & 0x1F) * alpha + ((bg >> 11) & 0x1F) * (15 - alpha) + 7) / 15);
+  const uint16_t g = (uint16_t)((((fg >> 5) & 0x3F) * alpha + ((bg >> 5) & 0x3F) * (15 - alpha) + 7) / 15);
+  const uint16_t b = (uint16_t)(((fg & 0x1F) * alpha + (bg & 0x1F) * (15 - alpha) + 7) / 15);
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+static const Ramp &ramp(uint16_t fg, uint16_t bg) {
+  for (uint8_t i = 0; i < sRampCount; ++i) {
+    if (sRamps[i].fg == fg && sRamps[i].bg == bg) return sRamps[i];
+  }
+  Ramp &r = sRamps[sRampNext];
+  sRampNext = (uint8_t)((sRampNext + 1) % kMaxRamps);
+  if (sRampCount < kMaxRamps) sRampCount++;
+  r.fg = fg;
+  r.bg = bg;
+  for (uint8_t a = 0; a < 16; ++a) {
+    const uint16_t c = blend(fg, bg, a);
+    r.colour[a] = (uint16_t)((c >> 8) | (c << 8));
+  }
+  return r;
+}
+
+static uint8_t maskAt(const uint8_t *mask, uint16_t i) {
+  return (uint8_t)((mask[i / 2] >> ((i & 1) ? 0 : 4)) & 0x0F);
+}
+
+static const GlyphMasters::Master *masterFor(char c) {
+  for (uint8_t i = 0; i < GlyphMasters::kCount; ++i) {
+    if (GlyphMasters::kMasters[i].c == c) return &GlyphMasters::kMasters[i];
+  }
+  return nullptr;
+}
+
+// Box filter along one axis: `dstN` outputs from `srcN` inputs, each output the
+// average of the inputs it overlaps, weighted by overlap. Lengths are measured
+// in units of 1/(srcN * dstN) so the weights are exact integers.
+static void resample(const uint16_t *src, uint16_t srcN, uint16_t srcStep, uint16_t *dst, uint16_t dstN,
+                     uint16_t dstStep) {
+  for (uint16_t d = 0; d < dstN; ++d) {
+    const uint32_t lo = (uint32_t)d * srcN;
+    const uint32_t hi = lo + srcN;
+    uint32_t sum = 0;
+    for (uint16_t s = (uint16_t)(lo / dstN); s < srcN && (uint32_t)s * dstN < hi; ++s) {
+      const uint32_t from = std::max(lo, (uint32_t)s * dstN);
+      const uint32_t to = std::min(hi, (uint32_t)(s + 1) * dstN);
+      sum += (to - from) * src[s * srcStep];
+    }
+    dst[d * dstStep] = (uint16_t)((sum + srcN / 2) / srcN);
+  }
+}
+
+// Cell size from the built-in font, so widths and layout stay those of
+// drawString; coverage from the master scaled into the glyph's ink box.
+static bool rasterise(TFT_eSPI &tft, TFT_eSprite &sprite, uint8_t font, char c, Glyph &g, uint8_t *out) {
+  const char s[2] = {c, 0};
+  const int16_t w = (int16_t)tft.textWidth(s, font);
+  const int16_t h = (int16_t)tft.fontHeight(font);
+  if (w <= 0 || h <= 0 || (size_t)w * h > kMaxCellPixels || w > 255 || h > 255) return false;
+  g.w = (uint8_t)w;
+  g.h = (uint8_t)h;
+  if (!out) return true;
+
+  if (!sprite.createSprite(w, h)) return false;
+  sprite.fillSprite(TFT_BLACK);
+  sprite.setTextFont(font);
+  sprite.setTextDatum(TL_DATUM);
+  sprite.setTextColor(TFT_WHITE, TFT_BLACK);
+  sprite.drawString(s, 0, 0);
+  int16_t x0 = w, y0 = h, x1 = -1, y1 = -1;
+  for (int16_t y = 0; y < h; ++y) {
+    for (int16_t x = 0; x < w; ++x) {
+      if (sprite.readPixel(x, y) == TFT_BLACK) continue;
+      x0 = std::min(x0, x);
+      y0 = std::min(y0, y);
+      x1 = std::max(x1, x);
+      y1 = std::max(y1, y);
+    }
+  }
+  sprite.deleteSprite();
+
+  memset(out, 0, ((size_t)w * h + 1) / 2);
+  const GlyphMasters::Master *m = masterFor(c);
+  if (!m || x1 < 0) return true;
+  const uint16_t bw = (uint16_t)(x1 - x0 + 1);
+  const uint16_t bh = (uint16_t)(y1 - y0 + 1);
+  if ((size_t)m->h * bw > kMaxCellPixels || m->w > kMaxSpan || bh > kMaxSpan) return false;
+
+  // Rows first into sCell (free at boot), at 16x the 4-bit coverage to keep
+  // the fraction for the column pass.
+  uint16_t row[kMaxSpan];
+  for (uint16_t y = 0; y < m->h; ++y) {
+    for (uint16_t x = 0; x < m->w; ++x) {
+      const uint16_t i = (uint16_t)(y * m->w + x);
+      const uint8_t packed = GlyphMasters::kBits[m->offset + i / 2];
+      row[x] = (uint16_t)(16 * ((packed >> ((i & 1) ? 0 : 4)) & 0x0F));
+    }
+    resample(row, m->w, 1, sCell + y * bw, bw, 1);
+  }
+  uint16_t column[kMaxSpan];
+  for (uint16_t x = 0; x < bw; ++x) {
+    resample(sCell + x, m->h, bw, column, bh, 1);
+    for (uint16_t y = 0; y < bh; ++y) {
+      const uint16_t i = (uint16_t)((y0 + y) * w + x0 + x);
+      const uint8_t a = (uint8_t)std::min(15, (column[y] + 8) / 16);
+      out[i / 2] = (uint8_t)(out[i / 2] | ((i & 1) ? a : (a << 4)));
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+namespace GlyphAtlas {
+
+bool begin(TFT_eSPI &tft) {
+#if GLYPH_ATLAS
+  if (sMasks) return true;
+  TFT_eSprite sprite(&tft);
+  sprite.setColorDepth(8);
+
+  // Sizes first, then one allocation for every mask.
+  size_t total = 0;
+  for (uint8_t f = 0; f < kFontCount; ++f) {
+    for (uint8_t c = 0; c < kCharCount; ++c) {
+      Glyph &g = sGlyphs[f][c];
+      g = Glyph();
+      if (!rasterise(tft, sprite, kFonts[f], kCharset[c], g, nullptr)) continue;
+      g.offset = (uint32_t)total;
+      total += ((size_t)g.w * g.h + 1) / 2;
+    }
+  }
+  sMasks = total ? (uint8_t *)malloc(total) : nullptr;
+  if (!sMasks) {
+    for (uint8_t f = 0; f < kFontCount; ++f) {
+      for (uint8_t c = 0; c < kCharCount; ++c) sGlyphs[f][c] = Glyph();
+    }
+    Serial.println("Glyphs: no memory for the atlas");
+    return false;
+  }
+  for (uint8_t f = 0; f < kFontCount; ++f) {
+    for (uint8_t c = 0; c < kCharCount; ++c) {
+      Glyph &g = sGlyphs[f][c];
+      if (!g.w) continue;
+      const uint32_t offset = g.offset;
+      if (!rasterise(tft, sprite, kFonts[f], kCharset[c], g, sMasks + offset)) g = Glyph();
+      g.offset = offset;
+    }
+  }
+  sMaskBytes = total;
+
+  const uint16_t backgrounds[] = {Palette::BG, Palette::PANEL, Palette::PANEL_2};
+  for (const uint16_t bg : backgrounds) {
+    ramp(Palette::WHITE, bg);
+    ramp(Palette::GREY, bg);
+  }
+  Serial.printf("Glyphs: %u B of masks for fonts 2/4/6 from %u B of masters\n", (unsigned)sMaskBytes,
+                (unsigned)sizeof(GlyphMasters::kBits));
+  return true;
+#else
+  (void)tft;
+  return false;
+#endif
+}
+
+bool draw(TFT_eSPI &tft, const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg,
+          uint16_t bg) {
+  if (!sMasks || !s || !s[0] || datum > BR_DATUM || fg == bg) return false;
+  const int f = fontSlot(font);
+  if (f < 0) return false;
+
+  int16_t width = 0;
+  int16_t height = 0;
+  for (const char *p = s; *p; ++p) {
+    const int c = charSlot(*p);
+    if (c < 0 || !sGlyphs[f][c].w) return false;
+    width = (int16_t)(width + sGlyphs[f][c].w);
+    height = sGlyphs[f][c].h;
+  }
+
+  // Same anchoring as drawString for the built-in fonts.
+  const uint8_t column = (uint8_t)(datum % 3);
+  const uint8_t row = (uint8_t)(datum / 3);
+  if (column == 1) x = (int16_t)(x - width / 2);
+  if (column == 2) x = (int16_t)(x - width);
+  if (row == 1) y = (int16_t)(y - height / 2);
+  if (row == 2) y = (int16_t)(y - height);
+
+  const Ramp &r = ramp(fg, bg);
+  for (const char *p = s; *p; ++p) {
+    const Glyph &g = sGlyphs[f][charSlot(*p)];
+    const uint8_t *mask = sMasks + g.offset;
+    const uint16_t n = (uint16_t)(g.w * g.h);
+    for (uint16_t i = 0; i < n; ++i) sCell[i] = r.colour[maskAt(mask, i)];
+    tft.pushImage(x, y, g.w, g.h, sCell);
+    x = (int16_t)(x + g.w);
+  }
+  return true;
+}
+
+size_t bytes() {
+  return sMaskBytes;
+}
+
+}  // namespace GlyphAtlas
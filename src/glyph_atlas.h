@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+#include <TFT_eSPI.h>
+
+// Digits and clock punctuation of the built-in fonts 2, 4 and 6 as 4-bit
+// coverage masks, for DisplayList's numeric ops (scores, the game clock and
+// countdowns). The coverage comes from anti-aliased masters rendered offline
+// from a TrueType font (tools/glyph_masters.py, src/glyph_masters.h); at boot
+// each master is box-filtered into the ink box of the built-in glyph, so cell
+// widths and layout match drawString. A glyph is drawn by mapping its mask
+// through a 16-colour ramp from the background to the text colour (built for
+// each Palette background up front, other pairs on first use) and pushing the
+// cell in one address window: one small blit per changed digit.
+
+namespace GlyphAtlas {
+
+// Builds the masks. Call once after the panel is initialised; false when
+// disabled or out of memory, in which case draw() always declines.
+bool begin(TFT_eSPI &tft);
+
+// Draws `s` like TFT_eSPI::drawString with a background colour set. Returns
+// false, drawing nothing, when the font, a character or the datum (baseline
+// datums) is not covered; fall back to drawString then.
+bool draw(TFT_eSPI &tft, const char *s, int16_t x, int16_t y, uint8_t font, uint8_t datum, uint16_t fg,
+          uint16_t bg);
+
+// Bytes held by the masks.
+size_t bytes();
+
+}  // namespace GlyphAtlas
@@ -0,0 +1,191 @@
+#include "gzip_stream.h"
+
+#include "esp32/rom/miniz.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+constexpr size_t kInBufSize = 512;
+constexpr size_t kDictSize = TINFL_LZ_DICT_SIZE;
+
+// RFC 1952 header flags.
+constexpr uint8_t kFlagHcrc = 0x02;
+constexpr uint8_t kFlagExtra = 0x04;
+constexpr uint8_t kFlagName = 0x08;
+constexpr uint8_t kFlagComment = 0x10;
+
+}  // namespace
+
+struct GzipStream::Workspace {
+  tinfl_decompressor decomp;
+  uint8_t dict[kDictSize];
+  uint8_t in[kInBufSize];
+};
+
+GzipStream::~GzipStream() {
+  free(_ws);
+}
+
+bool GzipStream::fits() {
+  return ESP.getMaxAllocHeap() >= sizeof(Workspace);
+}
+
+bool GzipStream::begin(Stream &src, int32_t limit) {
+  if (!_ws) {
+    _ws = (Workspace *)malloc(sizeof(Workspace));
+    if (!_ws) Serial.printf("gzip: no heap for %u byte inflater\n", (unsigned)sizeof(Workspace));
+  }
+  _src = &src;
+  _limit = limit;
+  _inPos = _inLen = 0;
+  _outPos = _outEnd = 0;
+  _compressed = _inflated = 0;
+  _state = _ws ? State::Header : State::Failed;
+  if (_ws) tinfl_init(&_ws->decomp);
+  return _ws != nullptr;
+}
+
+bool GzipStream::finish() {
+  if (!_src || _limit < 0) return true;
+  while (_limit != 0) {
+    _inPos = _inLen = 0;
+    if (!fill()) return false;
+  }
+  return true;
+}
+
+// Refills the input buffer with whatever the source has ready, waiting (with
+// the source's timeout) for at least one byte.
+bool GzipStream::fill() {
+  if (_inPos < _inLen) return true;
+  if (_limit == 0) return false;
+
+  size_t want = kInBufSize;
+  if (_limit > 0 && (size_t)_limit < want) want = (size_t)_limit;
+  const int ready = _src->available();
+  if (ready > 0 && (size_t)ready < want) want = (size_t)ready;
+  if (ready <= 0) want = 1;
+
+  const size_t n = _src->readBytes((char *)_ws->in, want);
+  if (n == 0) return false;
+  _inPos = 0;
+  _inLen = n;
+  _compressed += n;
+  if (_limit > 0) _limit -= (int32_t)n;
+  return true;
+}
+
+int GzipStream::nextInputByte() {
+  if (!fill()) return -1;
+  return _ws->in[_inPos++];
+}
+
+bool GzipStream::skipHeader() {
+  uint8_t h[10];
+  for (uint8_t i = 0; i < sizeof(h); ++i) {
+    const int c = nextInputByte();
+    if (c < 0) return false;
+    h[i] = (uint8_t)c;
+  }
+  if (h[0] != 0x1f || h[1] != 0x8b || h[2] != 8) {
+    Serial.println("gzip: bad header");
+    return false;
+  }
+
+  const uint8_t flags = h[3];
+  if (flags & kFlagExtra) {
+    const int lo = nextInputByte();
+    const int hi = nextInputByte();
+    if (lo < 0 || hi < 0) return false;
+    for (uint16_t n = (uint16_t)(lo | (hi << 8)); n > 0; --n) {
+      if (nextInputByte() < 0) return false;
+    }
+  }
+  const uint8_t zeroTerminated[] = {kFlagName, kFlagComment};
+  for (uint8_t i = 0; i < sizeof(zeroTerminated); ++i) {
+    if (!(flags & zeroTerminated[i])) continue;
+    int c;
+    do {
+      c = nextInputByte();
+    } while (c > 0);
+    if (c < 0) return false;
+  }
+  if (flags & kFlagHcrc) {
+    if (nextInputByte() < 0 || nextInputByte() < 0) return false;
+  }
+  return true;
+}
+
+// Produces the next run of output into the dictionary window. The 8-byte
+// CRC/size trailer is not checked: TLS already guarantees integrity and a
+// damaged body fails JSON parsing anyway.
+bool GzipStream::inflateMore() {
+  while (_outPos == _outEnd) {
+    if (_state == State::Header) {
+      if (!skipHeader()) {
+        _state = State::Failed;
+        return false;
+      }
+      _state = State::Body;
+    }
+    if (_state != State::Body) return false;
+
+    if (_inPos == _inLen && !fill()) {
+      Serial.println("gzip: body ended early");
+      _state = State::Failed;
+      return false;
+    }
+
+    if (_outEnd == kDictSize) _outPos = _outEnd = 0;
+    size_t inBytes = _inLen - _inPos;
+    size_t outBytes = kDictSize - _outEnd;
+    const tinfl_status status = tinfl_decompress(&_ws->decomp,
+                                                 _ws->in + _inPos,
+                                                 &inBytes,
+                                                 _ws->dict,
+                                                 _ws->dict + _outEnd,
+                                                 &outBytes,
+                                                 TINFL_FLAG_HAS_MORE_INPUT);
+    _inPos += inBytes;
+    _outEnd += outBytes;
+    _inflated += outBytes;
+
+    if (status == TINFL_STATUS_DONE) {
+      _state = State::Done;
+    } else if (status < 0) {
+      Serial.printf("gzip: inflate error %d\n", (int)status);
+      _state = State::Failed;
+      return false;
+    }
+  }
+  return true;
+}
+
+int GzipStream::available() {
+  return (int)(_outEnd - _outPos);
+}
+
+int GzipStream::read() {
+  if (_outPos == _outEnd && !inflateMore()) return -1;
+  return _ws->dict[_outPos++];
+}
+
+int GzipStream::peek() {
+  if (_outPos == _outEnd && !inflateMore()) return -1;
+  return _ws->dict[_outPos];
+}
+
+size_t GzipStream::readBytes(char *buffer, size_t length) {
+  size_t copied = 0;
+  while (copied < length) {
+    if (_outPos == _outEnd && !inflateMore()) break;
+    size_t n = _outEnd - _outPos;
+    if (n > length - copied) n = length - copied;
+    memcpy(buffer + copied, _ws->dict + _outPos, n);
+    _outPos += n;
+    copied += n;
+  }
+  return copied;
+}
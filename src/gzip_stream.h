@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Streaming gzip decoder that sits between an HTTP body stream (raw or
+// ChunkedStream) and deserializeJson(). Uses the ROM tinfl inflater with its
+// 32KB dictionary doubling as the output buffer, so the footprint is fixed at
+// ~44KB for any body size. The workspace is only allocated by begin(), i.e.
+// for a body that actually arrived gzipped, and is released when the object
+// goes away; 304s and plain bodies never touch it.
+
+class GzipStream : public Stream {
+public:
+  GzipStream() = default;
+  ~GzipStream();
+
+  GzipStream(const GzipStream &) = delete;
+  GzipStream &operator=(const GzipStream &) = delete;
+
+  // Whether the heap currently has a block large enough for the workspace.
+  // Checked before advertising gzip, so a server is only offered it when the
+  // response can be decoded.
+  static bool fits();
+
+  // Allocates the workspace (first call only) and starts decoding `src`.
+  // `limit` caps the compressed bytes taken from `src` (the Content-Length of
+  // an unchunked body); -1 reads until the gzip member ends. False when the
+  // workspace cannot be allocated.
+  bool begin(Stream &src, int32_t limit = -1);
+
+  // Discards whatever is left of a Content-Length bounded body so the session
+  // can carry the next request. Unbounded (chunked) sources are drained by the
+  // caller through the underlying stream. False if the body ended early.
+  bool finish();
+
+  bool failed() const { return _state == State::Failed; }
+  uint32_t compressedBytes() const { return _compressed; }
+  uint32_t inflatedBytes() const { return _inflated; }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char *buffer, size_t length) override;
+  void flush() override {}
+  size_t write(uint8_t) override { return 0; }
+
+private:
+  enum class State : uint8_t { Idle, Header, Body, Done, Failed };
+
+  struct Workspace;
+
+  bool fill();
+  int nextInputByte();
+  bool skipHeader();
+  bool inflateMore();
+
+  Workspace *_ws = nullptr;
+  Stream *_src = nullptr;
+  int32_t _limit = -1;
+  State _state = State::Idle;
+  size_t _inPos = 0;
+  size_t _inLen = 0;
+  size_t _outPos = 0;
+  size_t _outEnd = 0;
+  uint32_t _compressed = 0;
+  uint32_t _inflated = 0;
+};
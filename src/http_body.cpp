@@ -0,0 +1,131 @@
+#include "http_body.h"
+
+#include <HTTPClient.h>
+
+#include "chunked_stream.h"
+#include "gzip_stream.h"
+#include "http_pool.h"
+
+namespace {
+
+struct JsonDocReader {
+  JsonDocument *doc;
+  const JsonDocument *filter;
+  uint8_t nestingLimit;
+};
+
+bool readJsonDocument(Stream &body, int32_t, void *ctx) {
+  JsonDocReader &r = *static_cast<JsonDocReader *>(ctx);
+  const auto nesting = DeserializationOption::NestingLimit(r.nestingLimit);
+  const DeserializationError err = r.filter
+    ? deserializeJson(*r.doc, body, DeserializationOption::Filter(*r.filter), nesting)
+    : deserializeJson(*r.doc, body, nesting);
+  if (err) {
+    Serial.printf("JSON parse failed: %s\n", err.c_str());
+    return false;
+  }
+  return true;
+}
+
+void logErrorResponse(HTTPClient *http) {
+  const char *names[] = {"Location", "Content-Type", "Content-Length"};
+  for (const char *name : names) {
+    const String value = http->header(name);
+    if (value.length()) Serial.printf("%s: %s\n", name, value.c_str());
+  }
+  const String body = http->getString();
+  if (body.length()) Serial.printf("Body (first 200): %s\n", body.substring(0, 200).c_str());
+}
+
+}  // namespace
+
+namespace HttpBody {
+
+bool get(const String &url, const char *userAgent, bool *notModified, Reader reader, void *ctx) {
+  Serial.printf("HTTP GET: %s\n", url.c_str());
+  if (notModified) *notModified = false;
+
+  const uint32_t reusedBefore = HttpPool::stats().reused;
+  const uint32_t started = millis();
+  HTTPClient *http = nullptr;
+  const int code = HttpPool::get(url, userAgent, "application/json", http, notModified != nullptr, GzipStream::fits());
+  const uint32_t elapsed = millis() - started;
+  if (!http) {
+    if (code == HttpPool::kBackingOff) {
+      Serial.println("HTTP skipped: endpoint backing off");
+    } else {
+      Serial.printf("HTTP error: connect failed (%d) after %lums\n", code, (unsigned long)elapsed);
+    }
+    return false;
+  }
+  if (code <= 0) {
+    Serial.printf("HTTP error: %s (%d) after %lums\n", http->errorToString(code).c_str(), code, (unsigned long)elapsed);
+    HttpPool::end(http, false);
+    return false;
+  }
+
+  const bool reused = HttpPool::stats().reused != reusedBefore;
+  Serial.printf("HTTP status: %d in %lums (%s)\n", code, (unsigned long)elapsed, reused ? "reused" : "new TLS");
+  if (code == HTTP_CODE_NOT_MODIFIED && notModified) {
+    *notModified = true;
+    HttpPool::end(http, true);
+    return true;
+  }
+  if (code != HTTP_CODE_OK) {
+    logErrorResponse(http);
+    HttpPool::end(http, true);
+    return false;
+  }
+
+  const String encoding = HttpPool::contentEncoding(http);
+  const bool gzipped = (encoding == "gzip");
+  if (encoding.length() && !gzipped) {
+    Serial.printf("HTTP error: unsupported Content-Encoding %s\n", encoding.c_str());
+    HttpPool::end(http, false);
+    return false;
+  }
+
+  const bool chunked = http->header("Transfer-Encoding").equalsIgnoreCase("chunked");
+  Stream &raw = http->getStream();
+  ChunkedStream chunkedBody(raw);
+  Stream &wire = chunked ? static_cast<Stream &>(chunkedBody) : raw;
+  GzipStream gzip;
+  if (gzipped && !gzip.begin(wire, chunked ? -1 : http->getSize())) {
+    HttpPool::end(http, false);
+    return false;
+  }
+  Stream &body = gzipped ? static_cast<Stream &>(gzip) : wire;
+
+  const uint32_t readStarted = millis();
+  const bool ok = reader(body, (gzipped || chunked) ? -1 : http->getSize(), ctx);
+  // Consume the gzip trailer and terminating chunk so the session can carry
+  // the next request. A body that ended early or malformed leaves unknown
+  // bytes on the socket, which the next response would be read from, so the
+  // session is dropped even though the reader got what it needed.
+  const bool reusable = ok && (!gzipped || gzip.finish()) && (!chunked || chunkedBody.drain()) && !gzip.failed();
+  // Body throughput, read + parse: wire bytes (after de-chunking) and decoded bytes.
+  const uint32_t readMs = millis() - readStarted;
+  const uint32_t wireBytes = gzipped ? gzip.compressedBytes()
+                                     : (chunked ? chunkedBody.payloadBytes() : (uint32_t)max(http->getSize(), 0));
+  const uint32_t bodyBytes = gzipped ? gzip.inflatedBytes() : wireBytes;
+  Serial.printf("HTTP body: %lu B%s -> %lu B JSON in %lums (%lu KB/s)\n",
+                (unsigned long)wireBytes,
+                gzipped ? " gzip" : (chunked ? " chunked" : ""),
+                (unsigned long)bodyBytes,
+                (unsigned long)readMs,
+                (unsigned long)(readMs ? bodyBytes / readMs : 0));
+
+  HttpPool::end(http, reusable);
+  return ok;
+}
+
+bool getJson(const String &url,
+             const char *userAgent,
+             JsonDocument &doc,
+             const JsonDocument *filter,
+             uint8_t nestingLimit) {
+  JsonDocReader reader{&doc, filter, nestingLimit};
+  return get(url, userAgent, nullptr, readJsonDocument, &reader);
+}
+
+}  // namespace HttpBody
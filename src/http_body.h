@@ -0,0 +1,31 @@
+#pragma once
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+
+// GET with the response body decoded on the way to the reader: pooled
+// session -> ChunkedStream (chunked bodies) -> GzipStream (gzip bodies) ->
+// reader. Shared by the ESPN and NHL clients, with one log format for status
+// and body throughput.
+
+namespace HttpBody {
+
+// Reads the decoded body to its end. `bytes` is its length when known up
+// front (plain Content-Length body), -1 otherwise. Returns false if the body
+// was malformed or truncated; the session is then dropped.
+typedef bool (*Reader)(Stream &body, int32_t bytes, void *ctx);
+
+// Fetches `url` and hands a 200 body to `reader`. When `notModified` is given
+// the request is conditional: a 304 returns true with `*notModified` set and
+// the reader never runs. False on transport errors, other statuses and a
+// failed reader.
+bool get(const String &url, const char *userAgent, bool *notModified, Reader reader, void *ctx);
+
+// get() deserialising the body into `doc`, through `filter` when given.
+bool getJson(const String &url,
+             const char *userAgent,
+             JsonDocument &doc,
+             const JsonDocument *filter,
+             uint8_t nestingLimit = 10);
+
+}  // namespace HttpBody
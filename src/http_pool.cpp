@@ -0,0 +1,451 @@
+#include "http_pool.h"
+
+#include <WiFi.h>
+#include <WiFiClientSecure.h>
+
+namespace {
+
+// Two sessions covers site.api.espn.com plus the flag CDN; each TLS session
+// costs ~40KB of heap while open, so keep this small.
+constexpr uint8_t kMaxSlots = 2;
+constexpr uint32_t kIdleCloseMs = 45000;
+constexpr uint16_t kTimeoutMs = 12000;
+constexpr uint8_t kMaxRedirects = 3;
+constexpr uint8_t kMaxValidators = 6;
+
+// Per-endpoint backoff and circuit breaker. A failure is a transport error,
+// 5xx or 429; after kTripFailures in a row the circuit opens and requests are
+// refused locally until a single half-open probe is let through.
+constexpr uint8_t kMaxEndpoints = 6;
+constexpr uint8_t kTripFailures = 3;
+constexpr uint32_t kBackoffBaseMs = 2000;
+constexpr uint32_t kBackoffMaxMs = 60000;
+constexpr uint32_t kOpenBaseMs = 30000;
+constexpr uint32_t kOpenMaxMs = 300000;
+
+const char *kCollectHeaders[] = {"Location", "Content-Type", "Content-Length", "Transfer-Encoding", "Connection",
+                                 "ETag", "Last-Modified", "Content-Encoding", "Retry-After"};
+
+struct Validator {
+  String url;
+  String etag;
+  String lastModified;
+  uint32_t lastUsedMs = 0;
+};
+
+struct Slot {
+  bool used = false;
+  String host;  // "host[:port]", prefixed with "http://" for plain-HTTP slots
+  bool plain = false;
+  uint32_t lastUsedMs = 0;
+  WiFiClientSecure client;
+  WiFiClient plainClient;  // only for http:// URLs (e.g. a local stand-in server)
+  HTTPClient http;
+  // Validators from a conditional 200, committed by end() once the body is read.
+  String pendingUrl;
+  String pendingEtag;
+  String pendingLastModified;
+};
+
+struct Endpoint {
+  String key;  // host + path, no query
+  uint32_t lastUsedMs = 0;
+  HttpPool::EndpointHealth health;
+};
+
+Slot g_slots[kMaxSlots];
+Validator g_validators[kMaxValidators];
+Endpoint g_endpoints[kMaxEndpoints];
+HttpPool::Stats g_stats;
+
+Validator *findValidator(const String &url) {
+  for (uint8_t i = 0; i < kMaxValidators; ++i) {
+    if (g_validators[i].url.length() && g_validators[i].url == url) return &g_validators[i];
+  }
+  return nullptr;
+}
+
+void storeValidator(const String &url, const String &etag, const String &lastModified) {
+  Validator *v = findValidator(url);
+  if (!v) {
+    v = &g_validators[0];
+    for (uint8_t i = 0; i < kMaxValidators; ++i) {
+      if (g_validators[i].url.isEmpty()) {
+        v = &g_validators[i];
+        break;
+      }
+      if (g_validators[i].lastUsedMs < v->lastUsedMs) v = &g_validators[i];
+    }
+    v->url = url;
+  }
+  v->etag = etag;
+  v->lastModified = lastModified;
+  v->lastUsedMs = millis();
+}
+
+bool isPlainHttp(const String &url) {
+  return url.startsWith("http://");
+}
+
+String hostFromUrl(const String &url) {
+  int start = url.indexOf("://");
+  start = (start < 0) ? 0 : start + 3;
+  int end = start;
+  while (end < (int)url.length()) {
+    const char c = url.charAt(end);
+    if (c == '/' || c == '?') break;
+    end++;
+  }
+  String host = url.substring(start, end);
+  host.toLowerCase();
+  if (host.endsWith(":443")) host.remove(host.length() - 4);
+  return isPlainHttp(url) ? String("http://") + host : host;
+}
+
+WiFiClient &transport(Slot &slot) {
+  return slot.plain ? slot.plainClient : static_cast<WiFiClient &>(slot.client);
+}
+
+String endpointKey(const String &url) {
+  int start = url.indexOf("://");
+  start = (start < 0) ? 0 : start + 3;
+  const int query = url.indexOf('?', start);
+  String key = (query < 0) ? url.substring(start) : url.substring(start, query);
+  key.toLowerCase();
+  return key;
+}
+
+Endpoint &endpointFor(const String &url) {
+  const String key = endpointKey(url);
+  Endpoint *victim = nullptr;  // first free entry, else least recently used
+  for (uint8_t i = 0; i < kMaxEndpoints; ++i) {
+    Endpoint &e = g_endpoints[i];
+    if (e.key == key) {
+      e.lastUsedMs = millis();
+      return e;
+    }
+    if (!victim || (victim->key.length() && (e.key.isEmpty() || e.lastUsedMs < victim->lastUsedMs))) {
+      victim = &e;
+    }
+  }
+  *victim = Endpoint();
+  victim->key = key;
+  victim->lastUsedMs = millis();
+  return *victim;
+}
+
+// Spreads retries over [0.75, 1.25) of `ms` so several endpoints do not retry in lockstep.
+uint32_t withJitter(uint32_t ms) {
+  return ms - ms / 4 + (esp_random() % (ms / 2 + 1));
+}
+
+bool isFailure(int code) {
+  return code <= 0 || code >= 500 || code == HTTP_CODE_TOO_MANY_REQUESTS;
+}
+
+bool allowRequest(Endpoint &e, uint32_t nowMs) {
+  HttpPool::EndpointHealth &h = e.health;
+  const bool due = (int32_t)(nowMs - h.retryAtMs) >= 0;
+  switch (h.state) {
+    case HttpPool::CircuitState::Closed:
+      return h.failures == 0 || due;
+    case HttpPool::CircuitState::Open:
+      if (!due) return false;
+      h.state = HttpPool::CircuitState::HalfOpen;
+      Serial.printf("HTTP pool: %s half-open, probing\n", e.key.c_str());
+      return true;
+    case HttpPool::CircuitState::HalfOpen:
+      return true;
+  }
+  return true;
+}
+
+void recordResult(Endpoint &e, int code, uint32_t retryAfterSec, uint32_t nowMs) {
+  HttpPool::EndpointHealth &h = e.health;
+  h.lastCode = code;
+  if (!isFailure(code)) {
+    if (h.state != HttpPool::CircuitState::Closed || h.failures) {
+      Serial.printf("HTTP pool: %s recovered after %u failures\n", e.key.c_str(), (unsigned)h.failures);
+    }
+    h.state = HttpPool::CircuitState::Closed;
+    h.failures = 0;
+    h.trips = 0;
+    return;
+  }
+
+  if (h.failures < 255) h.failures++;
+  uint32_t waitMs;
+  if (h.state == HttpPool::CircuitState::HalfOpen || h.failures >= kTripFailures) {
+    if (h.trips < 255) h.trips++;
+    const uint8_t shift = (h.trips > 4) ? 4 : (uint8_t)(h.trips - 1);
+    waitMs = kOpenBaseMs << shift;
+    if (waitMs > kOpenMaxMs) waitMs = kOpenMaxMs;
+    h.state = HttpPool::CircuitState::Open;
+    g_stats.circuitTrips++;
+  } else {
+    waitMs = kBackoffBaseMs << (h.failures - 1);
+    if (waitMs > kBackoffMaxMs) waitMs = kBackoffMaxMs;
+  }
+  waitMs = withJitter(waitMs);
+  if (retryAfterSec && retryAfterSec * 1000UL > waitMs) {
+    waitMs = (retryAfterSec > kOpenMaxMs / 1000) ? kOpenMaxMs : retryAfterSec * 1000UL;
+  }
+  h.retryAtMs = nowMs + waitMs;
+  Serial.printf("HTTP pool: %s failed (%d), %s, retry in %lums\n",
+                e.key.c_str(),
+                code,
+                h.state == HttpPool::CircuitState::Open ? "circuit open" : "backing off",
+                (unsigned long)waitMs);
+}
+
+String resolveLocation(const String &base, const String &location) {
+  if (location.startsWith("http://") || location.startsWith("https://")) return location;
+  if (!location.startsWith("/")) return String("");
+  const int scheme = base.indexOf("://");
+  const int pathStart = base.indexOf('/', scheme < 0 ? 0 : scheme + 3);
+  return (pathStart < 0 ? base : base.substring(0, pathStart)) + location;
+}
+
+void closeSlot(Slot &slot) {
+  transport(slot).stop();
+  slot.used = false;
+  slot.host = "";
+}
+
+// Every request is end()ed before the next get(), so no slot is in use here.
+Slot &slotForHost(const String &host) {
+  Slot *free = nullptr;
+  Slot *oldest = nullptr;
+  for (uint8_t i = 0; i < kMaxSlots; ++i) {
+    Slot &s = g_slots[i];
+    if (s.used && s.host == host) return s;
+    if (!s.used) {
+      if (!free) free = &s;
+    } else if (!oldest || s.lastUsedMs < oldest->lastUsedMs) {
+      oldest = &s;
+    }
+  }
+
+  Slot *slot = free;
+  if (!slot) {
+    Serial.printf("HTTP pool: evicting %s for %s\n", oldest->host.c_str(), host.c_str());
+    closeSlot(*oldest);
+    g_stats.evictions++;
+    slot = oldest;
+  }
+
+  slot->used = true;
+  slot->host = host;
+  slot->plain = host.startsWith("http://");
+  if (!slot->plain) slot->client.setInsecure();
+  transport(*slot).setTimeout(kTimeoutMs);
+  return *slot;
+}
+
+Slot *slotForClient(const HTTPClient *http) {
+  for (uint8_t i = 0; i < kMaxSlots; ++i) {
+    if (&g_slots[i].http == http) return &g_slots[i];
+  }
+  return nullptr;
+}
+
+// Transport failures that mean a kept-alive socket was closed by the peer.
+bool isBrokenSocket(int code) {
+  return code == HTTPC_ERROR_CONNECTION_LOST ||
+         code == HTTPC_ERROR_SEND_HEADER_FAILED ||
+         code == HTTPC_ERROR_SEND_PAYLOAD_FAILED ||
+         code == HTTPC_ERROR_NOT_CONNECTED;
+}
+
+bool isRedirect(int code) {
+  return code == HTTP_CODE_MOVED_PERMANENTLY || code == HTTP_CODE_FOUND ||
+         code == HTTP_CODE_SEE_OTHER || code == HTTP_CODE_TEMPORARY_REDIRECT ||
+         code == HTTP_CODE_PERMANENT_REDIRECT;
+}
+
+// One request on the slot for `url`'s host, retrying once on a stale socket.
+int getOnSlot(const String &url,
+              const char *userAgent,
+              const char *accept,
+              const Validator *validator,
+              bool acceptGzip,
+              Slot *&outSlot) {
+  outSlot = nullptr;
+  Slot *slot = &slotForHost(hostFromUrl(url));
+
+  for (uint8_t attempt = 0; attempt < 2; ++attempt) {
+    const bool warm = transport(*slot).connected();
+    if (!slot->http.begin(transport(*slot), url)) {
+      closeSlot(*slot);
+      return HTTPC_ERROR_CONNECTION_REFUSED;
+    }
+    // Redirects are followed here, not by HTTPClient, so every hop goes
+    // through the session of its own host.
+    slot->http.setReuse(true);
+    slot->http.setTimeout(kTimeoutMs);
+    slot->http.setFollowRedirects(HTTPC_DISABLE_FOLLOW_REDIRECTS);
+    slot->http.collectHeaders(kCollectHeaders, sizeof(kCollectHeaders) / sizeof(kCollectHeaders[0]));
+    slot->http.addHeader("User-Agent", userAgent);
+    slot->http.addHeader("Accept", accept);
+    if (acceptGzip) slot->http.addHeader("Accept-Encoding", "gzip");
+    if (validator) {
+      if (validator->etag.length()) slot->http.addHeader("If-None-Match", validator->etag);
+      if (validator->lastModified.length()) slot->http.addHeader("If-Modified-Since", validator->lastModified);
+    }
+
+    const int code = slot->http.GET();
+    slot->lastUsedMs = millis();
+
+    if (code <= 0 && warm && attempt == 0 && isBrokenSocket(code)) {
+      Serial.printf("HTTP pool: %s session dropped, reconnecting\n", slot->host.c_str());
+      slot->http.end();
+      transport(*slot).stop();
+      g_stats.reconnects++;
+      continue;
+    }
+
+    if (warm) {
+      g_stats.reused++;
+    } else {
+      g_stats.handshakes++;
+    }
+    outSlot = slot;
+    return code;
+  }
+  return HTTPC_ERROR_CONNECTION_LOST;
+}
+
+void finishSlot(Slot &slot, HTTPClient *http, bool reusable) {
+  if (reusable && slot.pendingUrl.length()) {
+    if (slot.pendingEtag.length() || slot.pendingLastModified.length()) {
+      storeValidator(slot.pendingUrl, slot.pendingEtag, slot.pendingLastModified);
+    } else {
+      HttpPool::forget(slot.pendingUrl);
+    }
+  }
+  slot.pendingUrl = "";
+  slot.pendingEtag = "";
+  slot.pendingLastModified = "";
+  http->end();
+  if (!reusable) transport(slot).stop();
+  slot.lastUsedMs = millis();
+}
+
+}  // namespace
+
+namespace HttpPool {
+
+int get(const String &url,
+        const char *userAgent,
+        const char *accept,
+        HTTPClient *&out,
+        bool conditional,
+        bool acceptGzip) {
+  out = nullptr;
+  if (WiFi.status() != WL_CONNECTED) return HTTPC_ERROR_NOT_CONNECTED;
+
+  Endpoint &endpoint = endpointFor(url);
+  if (!allowRequest(endpoint, millis())) {
+    g_stats.skipped++;
+    return kBackingOff;
+  }
+  g_stats.requests++;
+
+  Validator *validator = conditional ? findValidator(url) : nullptr;
+  if (validator) validator->lastUsedMs = millis();
+
+  String target = url;
+  for (uint8_t hop = 0; hop <= kMaxRedirects; ++hop) {
+    Slot *slot = nullptr;
+    const int code = getOnSlot(target, userAgent, accept, validator, acceptGzip, slot);
+    if (!slot) {
+      recordResult(endpoint, code, 0, millis());
+      return code;
+    }
+
+    if (isRedirect(code) && hop < kMaxRedirects) {
+      const String next = resolveLocation(target, slot->http.header("Location"));
+      if (next.length()) {
+        finishSlot(*slot, &slot->http, false);
+        target = next;
+        continue;
+      }
+    }
+
+    recordResult(endpoint, code, (uint32_t)slot->http.header("Retry-After").toInt(), millis());
+    if (code == HTTP_CODE_NOT_MODIFIED) g_stats.notModified++;
+    if (conditional && code == HTTP_CODE_OK) {
+      slot->pendingUrl = url;
+      slot->pendingEtag = slot->http.header("ETag");
+      slot->pendingLastModified = slot->http.header("Last-Modified");
+    }
+
+    out = &slot->http;
+    return code;
+  }
+  recordResult(endpoint, HTTPC_ERROR_CONNECTION_REFUSED, 0, millis());
+  return HTTPC_ERROR_CONNECTION_REFUSED;
+}
+
+void end(HTTPClient *http, bool reusable) {
+  Slot *slot = slotForClient(http);
+  if (!slot) return;
+  finishSlot(*slot, http, reusable);
+}
+
+String contentEncoding(HTTPClient *http) {
+  String encoding = http->header("Content-Encoding");
+  encoding.trim();
+  encoding.toLowerCase();
+  if (encoding == "identity") encoding = "";
+  return encoding;
+}
+
+void tick(uint32_t nowMs) {
+  for (uint8_t i = 0; i < kMaxSlots; ++i) {
+    Slot &s = g_slots[i];
+    if (!s.used) continue;
+    if (nowMs - s.lastUsedMs < kIdleCloseMs) continue;
+    Serial.printf("HTTP pool: closing idle %s\n", s.host.c_str());
+    closeSlot(s);
+    g_stats.evictions++;
+  }
+}
+
+void forget(const String &url) {
+  Validator *v = findValidator(url);
+  if (v) *v = Validator();
+}
+
+bool health(const String &url, EndpointHealth &out) {
+  const String key = endpointKey(url);
+  for (uint8_t i = 0; i < kMaxEndpoints; ++i) {
+    if (g_endpoints[i].key == key) {
+      out = g_endpoints[i].health;
+      return true;
+    }
+  }
+  return false;
+}
+
+const Stats &stats() {
+  return g_stats;
+}
+
+void logStats() {
+  const uint32_t served = g_stats.handshakes + g_stats.reused;
+  const unsigned reusePct = served ? (unsigned)((g_stats.reused * 100UL) / served) : 0;
+  Serial.printf("HTTP pool: req=%lu handshakes=%lu reused=%lu (%u%%) reconnects=%lu evictions=%lu 304=%lu "
+                "skipped=%lu trips=%lu\n",
+                (unsigned long)g_stats.requests,
+                (unsigned long)g_stats.handshakes,
+                (unsigned long)g_stats.reused,
+                reusePct,
+                (unsigned long)g_stats.reconnects,
+                (unsigned long)g_stats.evictions,
+                (unsigned long)g_stats.notModified,
+                (unsigned long)g_stats.skipped,
+                (unsigned long)g_stats.circuitTrips);
+}
+
+}  // namespace HttpPool
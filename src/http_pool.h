@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Arduino.h>
+#include <HTTPClient.h>
+
+// Keep-alive HTTPS connections shared by the ESPN/NHL clients and flag downloads.
+// One TLS session is kept per host; idle sessions are closed by tick().
+// Not thread-safe: every caller runs on the network task.
+// Failing endpoints back off with jitter and, after repeated failures, are
+// cut off by a circuit breaker that lets one half-open probe through.
+
+namespace HttpPool {
+
+struct Stats {
+  uint32_t requests = 0;
+  uint32_t handshakes = 0;   // requests that had to open a new TLS session
+  uint32_t reused = 0;       // requests served on an already-open session
+  uint32_t reconnects = 0;   // reused sessions found broken and reopened
+  uint32_t evictions = 0;    // sessions closed for idling or to free a slot
+  uint32_t notModified = 0;  // conditional requests answered with 304
+  uint32_t skipped = 0;      // requests refused locally while an endpoint backs off
+  uint32_t circuitTrips = 0; // times an endpoint circuit opened
+};
+
+enum class CircuitState : uint8_t { Closed, Open, HalfOpen };
+
+// Failure tracking for one endpoint (host + path, query ignored).
+struct EndpointHealth {
+  CircuitState state = CircuitState::Closed;
+  uint8_t failures = 0;    // consecutive transport errors, 5xx or 429
+  uint8_t trips = 0;       // consecutive times the circuit opened
+  int lastCode = 0;
+  uint32_t retryAtMs = 0;  // millis() before which requests are refused
+};
+
+// get() result when the endpoint is backing off or its circuit is open; no
+// request was sent and `out` is null.
+constexpr int kBackingOff = -100;
+
+// Sends a GET for `url` on the pooled session for its host. Returns the HTTP
+// status code (<= 0 on transport error). When a connection was obtained, `out`
+// points at the client to read the response from; always pair with end()
+// before the next get().
+// With `conditional`, the ETag/Last-Modified last seen for `url` are sent back
+// and an unchanged resource answers HTTP_CODE_NOT_MODIFIED with no body.
+// With `acceptGzip`, the request advertises gzip; check contentEncoding() of
+// the response, since servers are free to ignore it.
+int get(const String &url,
+        const char *userAgent,
+        const char *accept,
+        HTTPClient *&out,
+        bool conditional = false,
+        bool acceptGzip = false);
+
+// Content-Encoding of the response on `http`, lowercased ("" for identity).
+String contentEncoding(HTTPClient *http);
+
+// Finishes the request started by get(). Pass `reusable = false` when the
+// response body was not fully consumed so the session is closed instead.
+// Validators of a conditional 200 are only remembered when `reusable` is set,
+// so a body that failed to parse is fetched in full next time.
+void end(HTTPClient *http, bool reusable);
+
+// Drops the remembered validators for `url` so the next request is a full GET.
+void forget(const String &url);
+
+// Current health of the endpoint `url` belongs to. Returns false if it has
+// not been requested yet.
+bool health(const String &url, EndpointHealth &out);
+
+// Closes sessions that have been idle too long. Call from the network task.
+void tick(uint32_t nowMs);
+
+const Stats &stats();
+void logStats();
+
+}  // namespace HttpPool
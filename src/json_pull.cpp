@@ -0,0 +1,295 @@
+#include "json_pull.h"
+
+namespace {
+
+bool isSpace(char c) {
+  return c == ' ' || c == '\n' || c == '\r' || c == '\t';
+}
+
+bool isLiteralChar(char c) {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || c == '-' || c == '+' || c == '.' || c == 'E';
+}
+
+int hexValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+}  // namespace
+
+void JsonPull::reset() {
+  _state = State::Value;
+  _token = Token::None;
+  _depth = 0;
+  _popPending = false;
+  _inKey = false;
+  _valueIsString = false;
+  _pathLen = 0;
+  _valueLen = 0;
+  _path[0] = '\0';
+  _value[0] = '\0';
+}
+
+int JsonPull::index(uint8_t level) const {
+  if (level >= _depth || !_frames[level].array) return -1;
+  return _frames[level].index;
+}
+
+void JsonPull::fail() {
+  _state = State::Failed;
+  _token = Token::None;
+}
+
+bool JsonPull::push(bool array) {
+  if (_depth >= kMaxDepth) {
+    fail();
+    return false;
+  }
+  _frames[_depth++] = Frame{(uint8_t)_pathLen, array, 0};
+  _state = array ? State::ArrayFirst : State::ObjectFirst;
+  return true;
+}
+
+// The frame itself is popped at the start of the next feed(), so depth() and
+// index() still describe the closed container while its token is current.
+void JsonPull::close(bool array) {
+  if (_depth == 0 || _frames[_depth - 1].array != array) {
+    fail();
+    return;
+  }
+  _pathLen = _frames[_depth - 1].base;
+  _path[_pathLen] = '\0';
+  _token = array ? Token::EndArray : Token::EndObject;
+  _popPending = true;
+  _state = (_depth == 1) ? State::Done : State::AfterValue;
+}
+
+void JsonPull::startKey() {
+  _pathLen = _frames[_depth - 1].base;
+  _path[_pathLen] = '\0';
+  _inKey = true;
+  if (_pathLen) appendKey('.');
+}
+
+// Over-long paths end in '~' so they cannot match a real member path.
+void JsonPull::appendKey(char c) {
+  if (_pathLen < kMaxPath - 2) {
+    _path[_pathLen++] = c;
+  } else {
+    _path[kMaxPath - 2] = '~';
+    _pathLen = kMaxPath - 1;
+  }
+  _path[_pathLen] = '\0';
+}
+
+void JsonPull::appendValue(char c) {
+  if (_valueLen < kMaxValue - 1) _value[_valueLen++] = c;
+  _value[_valueLen] = '\0';
+}
+
+// Unpaired surrogates and astral characters come out as '?'.
+void JsonPull::appendUtf8(uint16_t cp) {
+  char out[3];
+  uint8_t n = 0;
+  if (cp < 0x80) {
+    out[n++] = (char)cp;
+  } else if (cp < 0x800) {
+    out[n++] = (char)(0xC0 | (cp >> 6));
+    out[n++] = (char)(0x80 | (cp & 0x3F));
+  } else if (cp >= 0xD800 && cp <= 0xDFFF) {
+    out[n++] = '?';
+  } else {
+    out[n++] = (char)(0xE0 | (cp >> 12));
+    out[n++] = (char)(0x80 | ((cp >> 6) & 0x3F));
+    out[n++] = (char)(0x80 | (cp & 0x3F));
+  }
+  for (uint8_t i = 0; i < n; ++i) {
+    if (_inKey) {
+      appendKey(out[i]);
+    } else {
+      appendValue(out[i]);
+    }
+  }
+}
+
+void JsonPull::finishString() {
+  if (_inKey) {
+    _inKey = false;
+    _state = State::Colon;
+    return;
+  }
+  _valueIsString = true;
+  _token = Token::Value;
+  _state = _depth ? State::AfterValue : State::Done;
+}
+
+size_t JsonPull::feed(const char *data, size_t len) {
+  if (_state == State::Done || _state == State::Failed) return len;
+  _token = Token::None;
+  if (_popPending) {
+    _depth--;
+    _popPending = false;
+  }
+
+  size_t i = 0;
+  while (i < len && _token == Token::None && _state != State::Failed) {
+    const char c = data[i];
+    switch (_state) {
+      case State::String:
+        if (c == '"') {
+          finishString();
+        } else if (c == '\\') {
+          _state = State::Escape;
+        } else if (_inKey) {
+          appendKey(c);
+        } else {
+          appendValue(c);
+        }
+        i++;
+        break;
+
+      case State::Escape: {
+        char out = c;
+        switch (c) {
+          case 'b': out = '\b'; break;
+          case 'f': out = '\f'; break;
+          case 'n': out = '\n'; break;
+          case 'r': out = '\r'; break;
+          case 't': out = '\t'; break;
+          case 'u':
+            _unicode = 0;
+            _unicodeDigits = 0;
+            _state = State::Unicode;
+            break;
+          default: break;  // '"', '\\', '/'
+        }
+        if (_state == State::Escape) {
+          if (_inKey) {
+            appendKey(out);
+          } else {
+            appendValue(out);
+          }
+          _state = State::String;
+        }
+        i++;
+        break;
+      }
+
+      case State::Unicode: {
+        const int v = hexValue(c);
+        if (v < 0) {
+          fail();
+          break;
+        }
+        _unicode = (uint16_t)((_unicode << 4) | v);
+        if (++_unicodeDigits == 4) {
+          appendUtf8(_unicode);
+          _state = State::String;
+        }
+        i++;
+        break;
+      }
+
+      case State::Literal:
+        if (isLiteralChar(c)) {
+          appendValue(c);
+          i++;
+        } else {
+          // The delimiter is left for AfterValue.
+          _valueIsString = false;
+          _token = Token::Value;
+          _state = _depth ? State::AfterValue : State::Done;
+        }
+        break;
+
+      case State::Done:
+      case State::Failed:
+        i = len;
+        break;
+
+      default:
+        if (isSpace(c)) {
+          i++;
+          break;
+        }
+        switch (_state) {
+          case State::ArrayFirst:
+            if (c == ']') {
+              close(true);
+              i++;
+            } else {
+              _state = State::Value;
+            }
+            break;
+
+          case State::Value:
+            if (c == '{') {
+              push(false);
+            } else if (c == '[') {
+              push(true);
+            } else if (c == '"') {
+              _inKey = false;
+              _valueLen = 0;
+              _value[0] = '\0';
+              _state = State::String;
+            } else if (isLiteralChar(c)) {
+              _valueLen = 0;
+              appendValue(c);
+              _state = State::Literal;
+            } else {
+              fail();
+            }
+            i++;
+            break;
+
+          case State::ObjectFirst:
+          case State::ObjectKey:
+            if (c == '"') {
+              startKey();
+              _state = State::String;
+            } else if (c == '}' && _state == State::ObjectFirst) {
+              close(false);
+            } else {
+              fail();
+            }
+            i++;
+            break;
+
+          case State::Colon:
+            if (c == ':') {
+              _state = State::Value;
+            } else {
+              fail();
+            }
+            i++;
+            break;
+
+          case State::AfterValue: {
+            Frame &top = _frames[_depth - 1];
+            if (c == ',') {
+              if (top.array) {
+                top.index++;
+                _state = State::Value;
+              } else {
+                _state = State::ObjectKey;
+              }
+            } else if (c == '}' || c == ']') {
+              close(c == ']');
+            } else {
+              fail();
+            }
+            i++;
+            break;
+          }
+
+          default:
+            fail();
+            break;
+        }
+        break;
+    }
+  }
+  return i;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Resumable pull tokenizer for JSON that arrives in pieces. feed() consumes
+// bytes until a scalar value or the end of a container is ready and returns
+// how many it took; the caller looks at the token and feeds the rest. State is
+// a fixed path buffer and one value buffer, so a feed of any size can be walked
+// without building a JsonDocument for it.
+//
+// Paths are member names joined with '.', array positions left out
+// ("events.competitions.status.period"); index() gives the position inside an
+// array that is open at a given nesting level (0 = the root container).
+
+class JsonPull {
+public:
+  enum class Token : uint8_t { None, Value, EndObject, EndArray };
+
+  static constexpr uint8_t kMaxDepth = 24;
+  static constexpr size_t kMaxPath = 160;
+  static constexpr size_t kMaxValue = 128;
+
+  JsonPull() { reset(); }
+
+  void reset();
+
+  // Consumes up to `len` bytes, stopping right after a token is produced.
+  size_t feed(const char *data, size_t len);
+
+  Token token() const { return _token; }
+  // For Value, the member the value sits under. For EndObject/EndArray, the
+  // member the closed container sat under; nesting level of that container is
+  // depth() - 1.
+  const char *path() const { return _path; }
+  uint8_t depth() const { return _depth; }
+  int index(uint8_t level) const;
+
+  // Text of the last Value: string contents (unescaped) or the literal as
+  // written (number, true, false, null). Clipped at kMaxValue - 1 bytes.
+  const char *value() const { return _value; }
+  bool isString() const { return _valueIsString; }
+
+  bool done() const { return _state == State::Done; }
+  bool failed() const { return _state == State::Failed; }
+
+private:
+  enum class State : uint8_t {
+    Value, ArrayFirst, ObjectFirst, ObjectKey, Colon, AfterValue,
+    String, Escape, Unicode, Literal, Done, Failed
+  };
+
+  struct Frame {
+    uint8_t base;  // path length of the member this container sits under
+    bool array;
+    uint16_t index;
+  };
+
+  bool push(bool array);
+  void close(bool array);
+  void startKey();
+  void appendKey(char c);
+  void appendValue(char c);
+  void appendUtf8(uint16_t cp);
+  void finishString();
+  void fail();
+
+  State _state = State::Value;
+  Token _token = Token::None;
+  Frame _frames[kMaxDepth];
+  uint8_t _depth = 0;
+  bool _popPending = false;
+  bool _inKey = false;
+  bool _valueIsString = false;
+  uint8_t _unicodeDigits = 0;
+  uint16_t _unicode = 0;
+  size_t _pathLen = 0;
+  size_t _valueLen = 0;
+  char _path[kMaxPath];
+  char _value[kMaxValue];
+};
@@ -2,20 +2,24 @@
 #include <WiFi.h>
 #include <TFT_eSPI.h>
 #include <time.h>
+#include <utility>
 #include "ui.h"
-#include "espn_olympic_client.h"
 #include "types.h"
 #include "assets.h"
-#include "wifi_fallback.h"
 #include "anthem.h"
+#include "flag_fetch.h"
+#include "net_task.h"
+#include "state_cache.h"
 #include "config.h"
 
 SET_LOOP_TASK_STACK_SIZE(16 * 1024);
 
 static TFT_eSPI tft;
 static Ui ui;
-static EspnOlympicClient olympic;
 static GameState g;
+static NetTask::Snapshot netSnapshot;
+static StateMerge::Versions seenVersions;
+static bool netStateShown = false;
 static ScreenMode mode = ScreenMode::NEXT_GAME;
 static bool manualOverride = false;
 static uint8_t manualIndex = 0;
@@ -29,22 +33,21 @@ static uint32_t bootBtnLastChange = 0;
 static uint32_t bootBtnPressedAt = 0;
 static bool bootBtnLongPressHandled = false;
 static const uint32_t kBootBtnLongPressMs = 1400;
-static uint32_t lastScoreboardPoll = 0;
-static uint32_t lastDetailPoll = 0;
 static uint32_t goalBannerUntil = 0;
 static uint32_t lastSeenGoalEvent = 0;
-static uint32_t lastGoodFetchMs = 0;
 static bool lastStaleShown = true;
 static bool lastWifiShown = false;
+static StaleReason lastStaleReasonShown = StaleReason::NONE;
 static const uint32_t DATA_STALE_MS = 60000;
 static bool timeConfigured = false;
 static uint32_t lastTimeConfigAttempt = 0;
-static uint32_t lastNextGameRedraw = 0;
+static time_t lastCountdownSecond = 0;
+static uint32_t flagsShown = 0;
+static bool restoredSnapshot = false;
 struct GoalEvent {
   uint32_t eventId = 0;
   String goalText;
-  String goalTeamAbbr;
-  String goalTeamLogoUrl;
+  Teams::TeamId goalTeam = Teams::kNone;
   String goalScorer;
   bool focusJustScored = false;
 }
@@ -88,8 +91,23 @@ static void logModeChange(ScreenMode from, ScreenMode to, const char *reason) {
 }
 static void refreshMeta(uint32_t now) {
   g.wifiConnected = (WiFi.status() == WL_CONNECTED);
-  g.dataStale = (lastGoodFetchMs == 0) || (now - lastGoodFetchMs > DATA_STALE_MS);
+  // Data only counts as stale once a scheduled poll is overdue by DATA_STALE_MS.
+  const uint32_t lastGoodFetchMs = NetTask::lastGoodFetchMs();
+  const uint32_t staleAfterMs = NetTask::scoreboardIntervalMs() + DATA_STALE_MS;
+  g.dataStale = (lastGoodFetchMs == 0) || (now - lastGoodFetchMs > staleAfterMs);
   g.lastGoodFetchMs = lastGoodFetchMs;
+  if (restoredSnapshot && lastGoodFetchMs == 0) {
+    g.staleReason = StaleReason::RESTORED;
+  }
+  else if (!g.wifiConnected) {
+    g.staleReason = StaleReason::OFFLINE;
+  }
+  else if (g.dataStale) {
+    g.staleReason = NetTask::failureReason();
+  }
+  else {
+    g.staleReason = StaleReason::NONE;
+  }
 }
 static ScreenMode computeMode(const GameState &st) {
   if (!st.hasGame) {
@@ -103,6 +121,21 @@ static ScreenMode computeMode(const GameState &st) {
   if (st.isFinal) return ScreenMode::FINAL;
   return ScreenMode::NEXT_GAME;
 }
+// Field groups each screen draws from; a merge that touches none of them
+// leaves the screen as it is.
+static StateMerge::Mask screenFields(ScreenMode m) {
+  using namespace StateMerge;
+  switch (m) {
+    case ScreenMode::LIVE:
+    case ScreenMode::INTERMISSION:
+    case ScreenMode::FINAL:
+      return bit(Game) | bit(Status) | bit(Score) | bit(Stats) | bit(Strength);
+    case ScreenMode::LAST_GAME:    return bit(LastGame);
+    case ScreenMode::GOAL:         return bit(Goal);
+    case ScreenMode::STANDINGS:    return bit(Standings);
+    default:                       return bit(Game) | bit(Status) | bit(NextGame) | bit(Standings);
+  }
+}
 static void render(ScreenMode m, const GameState &st) {
   switch (m) {
     case ScreenMode::NEXT_GAME:    ui.drawNextGame(st, FOCUS_TEAM_ABBR);
@@ -148,29 +181,28 @@ static bool goalQueueContains(uint32_t eventId) {
   }
   return false;
 }
-static void enqueueGoalEvent(const GoalEvent &ev) {
+static void enqueueGoalEvent(GoalEvent &&ev) {
   if (ev.eventId == 0) return;
   if (goalQueueContains(ev.eventId)) return;
   if (goalCount >= kGoalQueueSize) {
     goalHead = (uint8_t)((goalHead + 1) % kGoalQueueSize);
     goalCount--;
   }
-  goalQueue[goalTail] = ev;
+  goalQueue[goalTail] = std::move(ev);
   goalTail = (uint8_t)((goalTail + 1) % kGoalQueueSize);
   goalCount++;
 }
 static bool dequeueGoalEvent(GoalEvent &out) {
   if (goalCount == 0) return false;
-  out = goalQueue[goalHead];
+  out = std::move(goalQueue[goalHead]);
   goalHead = (uint8_t)((goalHead + 1) % kGoalQueueSize);
   goalCount--;
   return true;
 }
-static void showGoalEvent(const GoalEvent &ev, uint32_t now) {
-  g.goalText = ev.goalText;
-  g.goalTeamAbbr = ev.goalTeamAbbr;
-  g.goalTeamLogoUrl = ev.goalTeamLogoUrl;
-  g.goalScorer = ev.goalScorer;
+static void showGoalEvent(GoalEvent &ev, uint32_t now) {
+  g.goalText = std::move(ev.goalText);
+  g.goalTeam = ev.goalTeam;
+  g.goalScorer = std::move(ev.goalScorer);
   g.focusJustScored = ev.focusJustScored;
   g.lastGoalEventId = ev.eventId;
   logModeChange(mode, ScreenMode::GOAL, "goal");
@@ -241,94 +273,92 @@ void setup() {
   ui.setBacklight(85);
   Assets::begin(tft);
   Anthem::begin();
-  ui.drawBootSplash("MILANO CORTINA 2026", "MEN'S ICE HOCKEY - CONNECTING WIFI");
-  wifiConnectWithFallback();
+  ui.drawBootSplash("MILANO CORTINA 2026", "MEN'S ICE HOCKEY - CONNECTING WIFI");
+  // Primed with the empty state as before, so a game that ended while powered
+  // off does not play the anthem when the first poll reports it.
+  Anthem::prime(g);
+  time_t savedAt = 0;
+  restoredSnapshot = StateCache::restore(g, &savedAt);
   const uint32_t now = millis();
-  ensureTimeConfigured(now);
-  lastScoreboardPoll = now - POLL_SCOREBOARD_MS;
-  lastDetailPoll = now - POLL_GAMEDETAIL_MS;
   refreshMeta(now);
-  render(ScreenMode::NEXT_GAME, g);
-  Anthem::prime(g);
+  lastStaleShown = g.dataStale;
+  lastWifiShown = g.wifiConnected;
+  lastStaleReasonShown = g.staleReason;
+  if (restoredSnapshot) {
+    Serial.printf("BOOT: cached state (saved at %ld) on screen after %lu ms\n", (long)savedAt, (unsigned long)now);
+    mode = computeMode(g);
+    render(mode, g);
+  }
+  // Wi-Fi connects inside the network task. Without a snapshot the splash
+  // stays up until loop() sees the connection.
+  NetTask::begin();
 }
 void loop() {
-  wifiTick();
   const uint32_t now = millis();
   handleBootButton(now);
   if (WiFi.status() == WL_CONNECTED) {
     ensureTimeConfigured(now);
   }
   refreshMeta(now);
-  if (g.dataStale != lastStaleShown || g.wifiConnected != lastWifiShown) {
+  if (g.dataStale != lastStaleShown || g.wifiConnected != lastWifiShown || g.staleReason != lastStaleReasonShown) {
     lastStaleShown = g.dataStale;
     lastWifiShown = g.wifiConnected;
+    lastStaleReasonShown = g.staleReason;
     if (!(mode == ScreenMode::GOAL && goalBannerUntil > now)) {
       applyManualScreen();
     }
   }
-  const bool wifiConnected = (WiFi.status() == WL_CONNECTED);
-  if (wifiConnected && now - lastScoreboardPoll >= POLL_SCOREBOARD_MS) {
-    lastScoreboardPoll = now;
-    GameState next;
-    if (olympic.fetchScoreboardNow(next, FOCUS_TEAM_ABBR)) {
-      const String prevGameId = g.gameId;
-      const String prevHomeAbbr = g.home.abbr;
-      const String prevAwayAbbr = g.away.abbr;
-      const TeamLine prevHome = g.home;
-      const TeamLine prevAway = g.away;
-      if (!prevGameId.isEmpty() &&          next.gameId == prevGameId &&          next.home.abbr == prevHomeAbbr &&          next.away.abbr == prevAwayAbbr) {
-        if (next.home.sog < 0) next.home.sog = prevHome.sog;
-        if (next.home.hits < 0) next.home.hits = prevHome.hits;
-        if (next.home.foPct < 0) next.home.foPct = prevHome.foPct;
-        if (next.away.sog < 0) next.away.sog = prevAway.sog;
-        if (next.away.hits < 0) next.away.hits = prevAway.hits;
-        if (next.away.foPct < 0) next.away.foPct = prevAway.foPct;
-      }
-      g = next;
-      lastGoodFetchMs = now;
-      refreshMeta(now);
+  if (NetTask::consume(netSnapshot)) {
+    // Swap rather than copy; netSnapshot now holds the previous state and is
+    // only ever overwritten by the next consume().
+    std::swap(g, netSnapshot.state);
+    refreshMeta(now);
+    // The first snapshot replaces a restored or empty state wholesale.
+    const StateMerge::Mask changed = netStateShown ? StateMerge::changedSince(seenVersions, netSnapshot.versions)
+                                                   : (StateMerge::Mask)~0u;
+    seenVersions = netSnapshot.versions;
+    netStateShown = true;
+    if ((changed & StateMerge::bit(StateMerge::Goal)) &&
+        g.lastGoalEventId != 0 && g.lastGoalEventId != lastSeenGoalEvent) {
+      lastSeenGoalEvent = g.lastGoalEventId;
+      GoalEvent ev;
+      ev.eventId = g.lastGoalEventId;
+      ev.goalText = g.goalText;
+      ev.goalTeam = g.goalTeam;
+      ev.goalScorer = g.goalScorer;
+      ev.focusJustScored = g.focusJustScored;
+      enqueueGoalEvent(std::move(ev));
+    }
+    if (changed & (StateMerge::bit(StateMerge::Game) | StateMerge::bit(StateMerge::Status))) {
       Anthem::tick(g);
-      if (goalBannerUntil <= now && !manualOverride) {
-        ScreenMode nextMode = computeMode(g);
-        logModeChange(mode, nextMode, "scoreboard");
+    }
+    if (changed && goalBannerUntil <= now && !manualOverride) {
+      ScreenMode nextMode = computeMode(g);
+      if (nextMode != mode || (changed & screenFields(nextMode))) {
+        logModeChange(mode, nextMode, "update");
         mode = nextMode;
         render(mode, g);
       }
     }
-    else {
-      Serial.println("Scoreboard fetch failed");
-    }
   }
-  if (wifiConnected && g.hasGame && !g.isFinal && !g.isPre && (now - lastDetailPoll >= POLL_GAMEDETAIL_MS)) {
-    lastDetailPoll = now;
-    olympic.fetchGameSummaryStats(g);
-    GameState tmp = g;
-    const bool gotGoal = olympic.fetchLatestGoal(tmp, FOCUS_TEAM_ABBR);
-    if (tmp.home.foPct >= 0) g.home.foPct = tmp.home.foPct;
-    if (tmp.away.foPct >= 0) g.away.foPct = tmp.away.foPct;
-    if (tmp.home.sog >= 0) g.home.sog = tmp.home.sog;
-    if (tmp.away.sog >= 0) g.away.sog = tmp.away.sog;
-    if (tmp.home.hits >= 0) g.home.hits = tmp.home.hits;
-    if (tmp.away.hits >= 0) g.away.hits = tmp.away.hits;
-    if (tmp.strengthLabel.length()) g.strengthLabel = tmp.strengthLabel;
-    if (gotGoal && tmp.lastGoalEventId != 0 && tmp.lastGoalEventId != lastSeenGoalEvent) {
-      lastSeenGoalEvent = tmp.lastGoalEventId;
-      GoalEvent ev;
-      ev.eventId = tmp.lastGoalEventId;
-      ev.goalText = tmp.goalText;
-      ev.goalTeamAbbr = tmp.goalTeamAbbr;
-      ev.goalTeamLogoUrl = tmp.goalTeamLogoUrl;
-      ev.goalScorer = tmp.goalScorer;
-      ev.focusJustScored = tmp.focusJustScored;
-      enqueueGoalEvent(ev);
-    }
+  // A flag the network task just downloaded replaces its placeholder badge;
+  // only the logo regions are repainted.
+  const uint32_t flagsLanded = FlagFetch::landed();
+  if (flagsLanded != flagsShown && !(mode == ScreenMode::GOAL && goalBannerUntil > now)) {
+    flagsShown = flagsLanded;
+    render(mode, g);
   }
   if (!manualOverride) {
     maybeShowQueuedGoal(now);
   }
-  if (mode == ScreenMode::NEXT_GAME && (g.hasNextGame || g.isPre) && now - lastNextGameRedraw >= 1000) {
-    lastNextGameRedraw = now;
-    ui.drawNextGame(g, FOCUS_TEAM_ABBR);
+  // The countdown follows the wall clock: one tick per new second of time(),
+  // which the 10 ms loop sees within a frame of the boundary.
+  const time_t second = time(nullptr);
+  if (mode == ScreenMode::NEXT_GAME && (g.hasNextGame || g.isPre) && second != lastCountdownSecond) {
+    lastCountdownSecond = second;
+    if (!ui.tickCountdown()) {
+      ui.drawNextGame(g, FOCUS_TEAM_ABBR);
+    }
   }
   if (!manualOverride && goalBannerUntil > 0 && goalBannerUntil <= now && mode == ScreenMode::GOAL) {
     goalBannerUntil = 0;
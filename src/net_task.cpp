@@ -0,0 +1,199 @@
+#include "net_task.h"
+
+#include <WiFi.h>
+#include <atomic>
+#include <utility>
+
+#include "config.h"
+#include "espn_olympic_client.h"
+#include "flag_fetch.h"
+#include "http_pool.h"
+#include "poll_schedule.h"
+#include "state_cache.h"
+#include "state_merge.h"
+#include "wifi_fallback.h"
+
+// Log HTTP pool counters and heap figures after every scoreboard poll.
+#ifndef NET_STATS_LOG
+#define NET_STATS_LOG 0
+#endif
+
+namespace {
+
+static const uint32_t kTaskStackBytes = 16 * 1024;
+static const UBaseType_t kTaskPriority = 1;
+static const BaseType_t kTaskCore = 0;
+static const uint32_t kIdleDelayMs = 50;
+// Flag downloads only start when no poll is due for at least this long, so a
+// slow flag host does not hold up the scoreboard.
+static const uint32_t kFlagFetchHeadroomMs = 3000;
+
+static EspnOlympicClient sOlympic;
+static StateMerge::Merger sMerger;
+
+// Owned by the network task only.
+static NetTask::Snapshot sWorking;
+static uint32_t sLastScoreboardPoll = 0;
+static uint32_t sLastDetailPoll = 0;
+static bool sScoreboardOk = false;  // last scoreboard poll succeeded
+static GameState sDetail;  // /summary scratch, reused so its Strings keep their buffers
+
+static std::atomic<uint32_t> sLastGoodFetchMs{0};
+static std::atomic<uint32_t> sScoreboardIntervalMs{POLL_SCOREBOARD_MS};
+static std::atomic<uint8_t> sFailureReason{(uint8_t)StaleReason::NONE};
+
+// Triple buffer: the writer fills its own slot and swaps it with the shared
+// middle slot; the reader swaps the middle slot with its own when the fresh
+// bit is set. Each slot is only ever touched by the side that holds its index,
+// so GameState (which owns Strings) never needs a lock or a torn-read retry.
+static const uint8_t kSlotMask = 0x03;
+static const uint8_t kFreshBit = 0x04;
+static NetTask::Snapshot sSlots[3];
+static std::atomic<uint8_t> sMiddle{1};
+static uint8_t sWriteSlot = 0;  // network task
+static uint8_t sReadSlot = 2;   // loop()
+
+// Copy-assigns into a slot whose Strings already hold the previous state, so
+// their buffers are reused and only text that grew allocates.
+static void publish() {
+  sWorking.versions = sMerger.versions();
+  sSlots[sWriteSlot] = sWorking;
+  const uint8_t prev = sMiddle.exchange((uint8_t)(sWriteSlot | kFreshBit), std::memory_order_acq_rel);
+  sWriteSlot = prev & kSlotMask;
+}
+
+static bool pollScoreboard(uint32_t now, uint32_t intervalMs) {
+  GameState next;
+  bool changed = true;
+  const bool fetched = sOlympic.fetchScoreboardIfChanged(next, FOCUS_TEAM_ABBR, intervalMs, changed);
+  if (fetched && !changed) {
+    // 304: nothing to parse, merge or publish; the data is simply confirmed fresh.
+    sLastGoodFetchMs.store(now);
+  }
+  else if (fetched) {
+    const StateMerge::Mask changedFields = sMerger.mergeScoreboard(sWorking.state, next, now);
+    sLastGoodFetchMs.store(now);
+    // Published even when no group changed, so loop() sees a first poll that
+    // merely confirms the restored snapshot.
+    publish();
+    if (changedFields) Serial.printf("Scoreboard: fields changed 0x%03x\n", (unsigned)changedFields);
+  }
+  else {
+    Serial.println("Scoreboard fetch failed");
+  }
+  if (fetched) StateCache::save(sWorking.state, now);
+
+  StaleReason reason = StaleReason::NONE;
+  HttpPool::EndpointHealth health;
+  if (!fetched) {
+    reason = StaleReason::FETCH_FAILED;
+    if (sOlympic.scoreboardHealth(health)) {
+      if (health.state != HttpPool::CircuitState::Closed) {
+        reason = StaleReason::SERVICE_DOWN;
+      } else if (health.failures > 0) {
+        reason = StaleReason::BACKING_OFF;
+      }
+    }
+  }
+  sFailureReason.store((uint8_t)reason);
+#if NET_STATS_LOG
+  HttpPool::logStats();
+  Serial.printf("Heap: free %lu B, low %lu B, largest block %lu B\n",
+                (unsigned long)ESP.getFreeHeap(),
+                (unsigned long)ESP.getMinFreeHeap(),
+                (unsigned long)ESP.getMaxAllocHeap());
+#endif
+  return fetched;
+}
+
+// The /summary result is parsed into a scratch state seeded with the current
+// game and status, then merged, so stale or missing values in it cannot
+// overwrite what the scoreboard already reported.
+static void pollDetail(uint32_t now) {
+  const GameState &g = sWorking.state;
+  sDetail.hasGame = g.hasGame;
+  sDetail.gameId = g.gameId;
+  sDetail.home.id = g.home.id;
+  sDetail.away.id = g.away.id;
+  sDetail.isPre = g.isPre;
+  sDetail.isLive = g.isLive;
+  sDetail.isFinal = g.isFinal;
+  sDetail.isIntermission = g.isIntermission;
+  sDetail.period = g.period;
+  sDetail.statusShortDetail = g.statusShortDetail;
+  sDetail.home.sog = sDetail.home.hits = sDetail.home.foPct = -1;
+  sDetail.away.sog = sDetail.away.hits = sDetail.away.foPct = -1;
+  sDetail.strengthLabel = "";
+  sDetail.lastGoalEventId = 0;
+
+  bool gotGoal = false;
+  if (!sOlympic.fetchGameDetail(sDetail, FOCUS_TEAM_ABBR, gotGoal)) return;
+  if (sMerger.mergeSummary(sWorking.state, sDetail, gotGoal, now)) publish();
+}
+
+static void taskMain(void *) {
+  sLastDetailPoll = millis() - POLL_GAMEDETAIL_MS;
+  // The first connect happens here rather than in setup(), so the restored
+  // snapshot stays on screen while it runs.
+  wifiConnectWithFallback();
+
+  for (;;) {
+    wifiTick();
+    const uint32_t now = millis();
+    if (WiFi.status() == WL_CONNECTED) {
+      HttpPool::tick(now);
+      const PollSchedule::Plan plan = PollSchedule::plan(sWorking.state, now);
+      sScoreboardIntervalMs.store(plan.scoreboardMs);
+      // Until a poll succeeds, retry at the live rate rather than a slow curve step.
+      uint32_t scoreboardMs = plan.scoreboardMs;
+      if (!sScoreboardOk && scoreboardMs > POLL_SCOREBOARD_MS) scoreboardMs = POLL_SCOREBOARD_MS;
+      bool polled = false;
+      if (sLastScoreboardPoll == 0 || now - sLastScoreboardPoll >= scoreboardMs) {
+        sLastScoreboardPoll = now ? now : 1;
+        sScoreboardOk = pollScoreboard(now, scoreboardMs);
+        polled = true;
+      }
+      if (plan.detailMs && millis() - sLastDetailPoll >= plan.detailMs) {
+        sLastDetailPoll = millis();
+        pollDetail(sLastDetailPoll);
+        polled = true;
+      }
+      const bool scoreboardSoon = now - sLastScoreboardPoll + kFlagFetchHeadroomMs >= scoreboardMs;
+      const bool detailSoon = plan.detailMs && now - sLastDetailPoll + kFlagFetchHeadroomMs >= plan.detailMs;
+      if (!polled && !scoreboardSoon && !detailSoon) {
+        FlagFetch::runOne(now);
+      }
+    }
+    vTaskDelay(pdMS_TO_TICKS(kIdleDelayMs));
+  }
+}
+
+}  // namespace
+
+namespace NetTask {
+
+void begin() {
+  xTaskCreatePinnedToCore(taskMain, "net", kTaskStackBytes, nullptr, kTaskPriority, nullptr, kTaskCore);
+}
+
+bool consume(Snapshot &out) {
+  if (!(sMiddle.load(std::memory_order_acquire) & kFreshBit)) return false;
+  const uint8_t prev = sMiddle.exchange(sReadSlot, std::memory_order_acq_rel);
+  sReadSlot = prev & kSlotMask;
+  std::swap(out, sSlots[sReadSlot]);
+  return true;
+}
+
+uint32_t lastGoodFetchMs() {
+  return sLastGoodFetchMs.load();
+}
+
+uint32_t scoreboardIntervalMs() {
+  return sScoreboardIntervalMs.load();
+}
+
+StaleReason failureReason() {
+  return (StaleReason)sFailureReason.load();
+}
+
+}  // namespace NetTask
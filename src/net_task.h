@@ -0,0 +1,41 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "state_merge.h"
+#include "types.h"
+
+// All Wi-Fi upkeep and HTTP fetching runs in a FreeRTOS task pinned to core 0,
+// so a slow or hung request never blocks rendering, the BOOT button or the goal
+// banner in loop(). Finished GameState snapshots are handed to loop() through a
+// lock-free triple buffer.
+
+namespace NetTask {
+
+struct Snapshot {
+  GameState state;
+  // Per field group change counters as of this snapshot. Compare with the last
+  // consumed ones (StateMerge::changedSince) to see what moved, even when
+  // intermediate snapshots were never consumed.
+  StateMerge::Versions versions;
+};
+
+// Starts the network task, which makes the first Wi-Fi connection itself.
+// Call once from setup().
+void begin();
+
+// Swaps the newest published snapshot into `out` (no copy). Returns false when
+// nothing was published since the previous call, leaving `out` untouched.
+bool consume(Snapshot &out);
+
+// millis() of the last successful scoreboard fetch (including 304s), 0 if none.
+uint32_t lastGoodFetchMs();
+
+// Scoreboard poll interval currently chosen by the adaptive schedule.
+uint32_t scoreboardIntervalMs();
+
+// Why the last scoreboard poll failed (backoff, open circuit, plain failure);
+// NONE after a successful poll.
+StaleReason failureReason();
+
+}  // namespace NetTask
@@ -1,7 +1,6 @@
 #include "nhl_client.h"
-#include <HTTPClient.h>
+#include "http_body.h"
 #include <WiFi.h>
-#include <WiFiClientSecure.h>
 #include <math.h>
 #include <time.h>
 
@@ -147,158 +146,9 @@ static void applyStrengthFromSituation(GameState &io,
   io.strengthLabel = "EVEN STRENGTH";
 }
 
-class ChunkedStream : public Stream {
-public:
-  explicit ChunkedStream(Stream &src) : _src(src) {}
-
-  int available() override {
-    if (_done) return 0;
-    if (_peeked >= 0) return 1;
-    if (_remaining > 0) {
-      int avail = _src.available();
-      if (avail > _remaining) avail = (int)_remaining;
-      return avail;
-    }
-    return _src.available();
-  }
-
-  int read() override {
-    if (_peeked >= 0) {
-      int c = _peeked;
-      _peeked = -1;
-      return c;
-    }
-    if (_done) return -1;
-    if (_remaining == 0) {
-      if (!readChunkHeader()) return -1;
-    }
-    int c = _src.read();
-    if (c < 0) return -1;
-    _remaining--;
-    if (_remaining == 0) {
-      consumeCRLF();
-    }
-    return c;
-  }
-
-  int peek() override {
-    if (_peeked < 0) {
-      _peeked = read();
-    }
-    return _peeked;
-  }
-
-  void flush() override {}
-
-  size_t write(uint8_t) override { return 0; }
-
-private:
-  Stream &_src;
-  int _peeked = -1;
-  int32_t _remaining = 0;
-  bool _done = false;
-
-  bool readChunkHeader() {
-    char line[24];
-    size_t n = _src.readBytesUntil('\n', line, sizeof(line) - 1);
-    if (n == 0) return false;
-    line[n] = '\0';
-    if (n && line[n - 1] == '\r') line[n - 1] = '\0';
-    char *semi = strchr(line, ';');
-    if (semi) *semi = '\0';
-    _remaining = (int32_t)strtol(line, nullptr, 16);
-    if (_remaining == 0) {
-      // Consume trailing headers until a blank line.
-      while (true) {
-        n = _src.readBytesUntil('\n', line, sizeof(line) - 1);
-        if (n == 0) break;
-        line[n] = '\0';
-        if (n == 1 && line[0] == '\r') break;
-        if (n == 0) break;
-        if (line[0] == '\r') break;
-      }
-      _done = true;
-      return false;
-    }
-    return true;
-  }
-
-  void consumeCRLF() {
-    int c1 = _src.read();
-    int c2 = _src.read();
-    (void)c1;
-    (void)c2;
-  }
-};
-
 static bool httpGetJsonInternal(const String &url, JsonDocument &doc, const JsonDocument *filter) {
-  // Ensure HTTPS works reliably without bundling CA roots.
-  WiFiClientSecure client;
-  client.setInsecure();
-  client.setTimeout(12000);
-
-  HTTPClient http;
-  const uint32_t timeoutMs = 12000;
-  http.setTimeout(timeoutMs);
-  http.setFollowRedirects(HTTPC_FORCE_FOLLOW_REDIRECTS);
-  const char *headers[] = { "Location", "Content-Type", "Content-Length", "Transfer-Encoding" };
-  http.collectHeaders(headers, 4);
-
-  Serial.printf("HTTP GET: %s\n", url.c_str());
   logWifiState();
-
-  if (!http.begin(client, url)) return false;
-  http.addHeader("User-Agent", "nhlscoreboard-esp32");
-  http.addHeader("Accept", "application/json");
-  const uint32_t started = millis();
-  int code = http.GET();
-  const uint32_t elapsed = millis() - started;
-
-  if (code <= 0) {
-    Serial.printf("HTTP error: %s (%d) after %lums\n", http.errorToString(code).c_str(), code, (unsigned long)elapsed);
-    if (elapsed >= timeoutMs) {
-      Serial.printf("HTTP timeout after %lums\n", (unsigned long)elapsed);
-    }
-    http.end();
-    return false;
-  }
-
-  Serial.printf("HTTP status: %d in %lums\n", code, (unsigned long)elapsed);
-
-  if (code != 200) {
-    String location = http.header("Location");
-    String contentType = http.header("Content-Type");
-    String contentLength = http.header("Content-Length");
-    if (location.length()) Serial.printf("Location: %s\n", location.c_str());
-    if (contentType.length()) Serial.printf("Content-Type: %s\n", contentType.c_str());
-    if (contentLength.length()) Serial.printf("Content-Length: %s\n", contentLength.c_str());
-    String payload = http.getString();
-    if (payload.length()) {
-      String preview = payload.substring(0, 200);
-      Serial.printf("Body (first 200): %s\n", preview.c_str());
-    }
-    http.end();
-    return false;
-  }
-
-  const String transferEncoding = http.header("Transfer-Encoding");
-  Stream &stream = http.getStream();
-  DeserializationError err;
-  if (transferEncoding.equalsIgnoreCase("chunked")) {
-    ChunkedStream chunked(stream);
-    err = filter
-      ? deserializeJson(doc, chunked, DeserializationOption::Filter(*filter))
-      : deserializeJson(doc, chunked);
-  } else {
-    err = filter
-      ? deserializeJson(doc, stream, DeserializationOption::Filter(*filter))
-      : deserializeJson(doc, stream);
-  }
-  http.end();
-  if (err) {
-    Serial.printf("JSON parse failed: %s\n", err.c_str());
-  }
-  return !err;
+  return HttpBody::getJson(url, "nhlscoreboard-esp32", doc, filter);
 }
 
 bool NhlClient::httpGetJson(const String &url, JsonDocument &doc) {
@@ -346,22 +196,20 @@ bool NhlClient::fetchScoreboardNow(GameState &out, const String &focusTeamAbbr)
   filter["gamesByDate"][0]["games"][0]["clock"]["inIntermission"] = true;
   filter["gamesByDate"][0]["games"][0]["periodDescriptor"]["number"] = true;
 
+  const Teams::TeamId focus = Teams::intern(focusTeamAbbr);
   auto applyFromGames = [&](JsonArray games, bool &matched) -> bool {
     if (games.isNull()) return false;
     matched = false;
 
     for (JsonObject g : games) {
-      const char *awayAbbr_c = g["awayTeam"]["abbrev"] | "";
-      const char *homeAbbr_c = g["homeTeam"]["abbrev"] | "";
-      String awayAbbr = awayAbbr_c ? awayAbbr_c : "";
-      String homeAbbr = homeAbbr_c ? homeAbbr_c : "";
-
-      if (awayAbbr != focusTeamAbbr && homeAbbr != focusTeamAbbr) continue;
+      const Teams::TeamId away = Teams::intern((const char *)(g["awayTeam"]["abbrev"] | ""));
+      const Teams::TeamId home = Teams::intern((const char *)(g["homeTeam"]["abbrev"] | ""));
+      if (focus == Teams::kNone || (away != focus && home != focus)) continue;
 
       out.hasGame = true;
       out.gameId = String((int)(g["id"] | 0));
-      out.away.abbr = awayAbbr;
-      out.home.abbr = homeAbbr;
+      out.away.id = away;
+      out.home.id = home;
 
       out.away.score = g["awayTeam"]["score"] | 0;
       out.home.score = g["homeTeam"]["score"] | 0;
@@ -549,8 +397,8 @@ bool NhlClient::fetchLatestGoal(GameState &io, const String &focusTeamAbbr) {
       if (scoringTeamId && scoringTeamId == homeId) owner = homeAbbr;
       if (scoringTeamId && scoringTeamId == awayId) owner = awayAbbr;
     }
-    io.focusJustScored = (owner == focusTeamAbbr);
-    io.goalTeamAbbr = owner;
+    io.goalTeam = Teams::intern(owner);
+    io.focusJustScored = io.goalTeam != Teams::kNone && io.goalTeam == Teams::intern(focusTeamAbbr);
 
     const char *scorer_c = p["details"]["scoringPlayerName"] | "";
     const char *a1_c = p["details"]["assist1PlayerName"] | "";
@@ -578,7 +426,7 @@ bool NhlClient::fetchLatestGoal(GameState &io, const String &focusTeamAbbr) {
 bool NhlClient::fetchNextGame(GameState &io, const String &focusTeamAbbr) {
   // Reset next-game fields but keep any existing current-game fields.
   io.hasNextGame = false;
-  io.nextOppAbbr = "";
+  io.nextOpp = Teams::kNone;
   io.nextIsHome = false;
   io.nextVenue = "";
   io.nextCity = "";
@@ -591,8 +439,9 @@ bool NhlClient::fetchNextGame(GameState &io, const String &focusTeamAbbr) {
   JsonArray games = doc["games"].as<JsonArray>();
   if (games.isNull()) return true;
 
+  const Teams::TeamId focus = Teams::intern(focusTeamAbbr);
   time_t bestEpoch = 0;
-  String bestOpp;
+  Teams::TeamId bestOpp = Teams::kNone;
   bool bestIsHome = false;
   String bestVenue;
   String bestCity;
@@ -604,12 +453,9 @@ bool NhlClient::fetchNextGame(GameState &io, const String &focusTeamAbbr) {
     // We only want upcoming games.
     if (state != "FUT" && state != "PRE") continue;
 
-    const char *homeAbbr_c = g["homeTeam"]["abbrev"] | "";
-    const char *awayAbbr_c = g["awayTeam"]["abbrev"] | "";
-    const String homeAbbr = homeAbbr_c ? homeAbbr_c : "";
-    const String awayAbbr = awayAbbr_c ? awayAbbr_c : "";
-
-    if (homeAbbr != focusTeamAbbr && awayAbbr != focusTeamAbbr) continue;
+    const Teams::TeamId home = Teams::intern((const char *)(g["homeTeam"]["abbrev"] | ""));
+    const Teams::TeamId away = Teams::intern((const char *)(g["awayTeam"]["abbrev"] | ""));
+    if (focus == Teams::kNone || (home != focus && away != focus)) continue;
 
     const char *start_c = g["startTimeUTC"] | "";
     const String startIso = start_c ? start_c : "";
@@ -618,18 +464,18 @@ bool NhlClient::fetchNextGame(GameState &io, const String &focusTeamAbbr) {
 
     if (bestEpoch == 0 || epoch < bestEpoch) {
       bestEpoch = epoch;
-      bestIsHome = (homeAbbr == focusTeamAbbr);
-      bestOpp = bestIsHome ? awayAbbr : homeAbbr;
+      bestIsHome = (home == focus);
+      bestOpp = bestIsHome ? away : home;
       bestVenue = (const char *)(g["venue"]["default"] | "");
       // Use the HOME team's place name as the city context.
       bestCity = (const char *)(g["homeTeam"]["placeName"]["default"] | "");
     }
   }
 
-  if (bestEpoch == 0 || bestOpp.isEmpty()) return true;
+  if (bestEpoch == 0 || bestOpp == Teams::kNone) return true;
 
   io.hasNextGame = true;
-  io.nextOppAbbr = bestOpp;
+  io.nextOpp = bestOpp;
   io.nextIsHome = bestIsHome;
   io.nextVenue = bestVenue;
   io.nextCity = bestCity;
@@ -653,6 +499,7 @@ bool NhlClient::fetchLastGameRecap(GameState &io, const String &focusTeamAbbr) {
   scheduleFilter["games"][0]["venue"]["default"] = true;
   scheduleFilter["games"][0]["homeTeam"]["placeName"]["default"] = true;
 
+  const Teams::TeamId focus = Teams::intern(focusTeamAbbr);
   auto applySchedule = [&](JsonDocument &doc) -> bool {
     JsonArray games = doc["games"].as<JsonArray>();
     if (games.isNull()) return false;
@@ -664,9 +511,9 @@ bool NhlClient::fetchLastGameRecap(GameState &io, const String &focusTeamAbbr) {
       const String state = state_c ? state_c : "";
       if (state != "FINAL" && state != "OFF") continue;
 
-      const String homeAbbr = String((const char *)(g["homeTeam"]["abbrev"] | ""));
-      const String awayAbbr = String((const char *)(g["awayTeam"]["abbrev"] | ""));
-      if (homeAbbr != focusTeamAbbr && awayAbbr != focusTeamAbbr) continue;
+      const Teams::TeamId home = Teams::intern((const char *)(g["homeTeam"]["abbrev"] | ""));
+      const Teams::TeamId away = Teams::intern((const char *)(g["awayTeam"]["abbrev"] | ""));
+      if (focus == Teams::kNone || (home != focus && away != focus)) continue;
 
       const char *start_c = g["startTimeUTC"] | "";
       const String startIso = start_c ? start_c : "";
@@ -683,8 +530,8 @@ bool NhlClient::fetchLastGameRecap(GameState &io, const String &focusTeamAbbr) {
     recap.hasGame = true;
     recap.gameId = String((int)(best["id"] | 0));
     recap.startEpoch = bestEpoch;
-    recap.home.abbr = String((const char *)(best["homeTeam"]["abbrev"] | ""));
-    recap.away.abbr = String((const char *)(best["awayTeam"]["abbrev"] | ""));
+    recap.home.id = Teams::intern((const char *)(best["homeTeam"]["abbrev"] | ""));
+    recap.away.id = Teams::intern((const char *)(best["awayTeam"]["abbrev"] | ""));
     recap.home.score = best["homeTeam"]["score"] | 0;
     recap.away.score = best["awayTeam"]["score"] | 0;
     recap.venue = String((const char *)(best["venue"]["default"] | ""));
@@ -730,8 +577,8 @@ bool NhlClient::fetchLastGameRecap(GameState &io, const String &focusTeamAbbr) {
   const String landingUrl = String(kBase) + "/gamecenter/" + recap.gameId + "/landing";
   JsonDocument landing;
   if (httpGetJson(landingUrl, landing, landingFilter)) {
-    recap.home.abbr = String((const char *)(landing["homeTeam"]["abbrev"] | recap.home.abbr.c_str()));
-    recap.away.abbr = String((const char *)(landing["awayTeam"]["abbrev"] | recap.away.abbr.c_str()));
+    recap.home.id = Teams::intern((const char *)(landing["homeTeam"]["abbrev"] | Teams::code(recap.home.id)));
+    recap.away.id = Teams::intern((const char *)(landing["awayTeam"]["abbrev"] | Teams::code(recap.away.id)));
     recap.home.score = landing["homeTeam"]["score"] | recap.home.score;
     recap.away.score = landing["awayTeam"]["score"] | recap.away.score;
 
@@ -746,15 +593,15 @@ bool NhlClient::fetchLastGameRecap(GameState &io, const String &focusTeamAbbr) {
 
         JsonArray goals = p["goals"].as<JsonArray>();
         for (JsonObject g : goals) {
-          const String team = jsonStringOrDefault(g["teamAbbrev"]);
+          const Teams::TeamId team = Teams::intern(jsonStringOrDefault(g["teamAbbrev"]));
           const String lastName = jsonStringOrDefault(g["lastName"]);
           String name = lastName;
           if (name.isEmpty()) name = jsonStringOrDefault(g["name"]);
 
-          if (team == recap.home.abbr) {
+          if (team != Teams::kNone && team == recap.home.id) {
             entry.home++;
             addScorer(recap.homeScorers, recap.homeScorerCount, name);
-          } else if (team == recap.away.abbr) {
+          } else if (team != Teams::kNone && team == recap.away.id) {
             entry.away++;
             addScorer(recap.awayScorers, recap.awayScorerCount, name);
           }
@@ -766,4 +613,4 @@ bool NhlClient::fetchLastGameRecap(GameState &io, const String &focusTeamAbbr) {
   io.last = recap;
   return true;
 }
-
+
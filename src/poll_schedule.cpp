@@ -0,0 +1,147 @@
+#include "poll_schedule.h"
+
+#include <stdlib.h>
+#include <time.h>
+
+#include "config.h"
+
+#ifndef POLL_CLUTCH_DETAIL_MS
+#define POLL_CLUTCH_DETAIL_MS 4000
+#endif
+
+#ifndef POLL_INTERMISSION_MS
+#define POLL_INTERMISSION_MS 60000
+#endif
+
+#ifndef POLL_FINAL_COOLDOWN_MS
+#define POLL_FINAL_COOLDOWN_MS 60000
+#endif
+
+#ifndef POLL_FINAL_COOLDOWN_WINDOW_MS
+#define POLL_FINAL_COOLDOWN_WINDOW_MS 600000
+#endif
+
+#ifndef POLL_FINAL_RECENT_SEC
+#define POLL_FINAL_RECENT_SEC 14400
+#endif
+
+#ifndef POLL_IDLE_MS
+#define POLL_IDLE_MS 1800000
+#endif
+
+#ifndef POLL_PREGAME_CURVE
+#define POLL_PREGAME_CURVE { {86400, 1800000}, {10800, 600000}, {1800, 120000}, {0, 30000} }
+#endif
+
+namespace {
+
+struct PregameStep {
+  uint32_t beforeStartSec;
+  uint32_t intervalMs;
+};
+
+static const PregameStep kPregameCurve[] = POLL_PREGAME_CURVE;
+static const uint8_t kPregameSteps = sizeof(kPregameCurve) / sizeof(kPregameCurve[0]);
+
+static String sLiveGameId;
+static String sFinalGameId;
+static uint32_t sFinalSeenMs = 0;
+
+static uint32_t sLoggedScoreboardMs = 0;
+static uint32_t sLoggedDetailMs = 0;
+static const char *sLoggedReason = nullptr;
+
+// Earliest known start of a game that has not begun yet, 0 if none.
+static time_t upcomingStart(const GameState &g) {
+  time_t start = 0;
+  if (g.hasGame && g.isPre && g.startEpoch > 0) start = g.startEpoch;
+  if (g.hasNextGame && g.nextStartEpoch > 0 && (start == 0 || g.nextStartEpoch < start)) {
+    start = g.nextStartEpoch;
+  }
+  return start;
+}
+
+static uint32_t pregameInterval(time_t untilStartSec) {
+  for (uint8_t i = 0; i < kPregameSteps; ++i) {
+    if (untilStartSec > (time_t)kPregameCurve[i].beforeStartSec) return kPregameCurve[i].intervalMs;
+  }
+  return kPregameCurve[kPregameSteps - 1].intervalMs;
+}
+
+// A final just ended if this device saw it live, or if it started recently.
+// One picked at boot, restored from the snapshot or selected between games is
+// usually hours or days old and gets no cooldown.
+static bool justEnded(const GameState &g, time_t nowEpoch, bool clockValid) {
+  if (g.gameId == sLiveGameId) return true;
+  return clockValid && g.startEpoch > 0 && nowEpoch - g.startEpoch < (time_t)POLL_FINAL_RECENT_SEC;
+}
+
+// Third period or overtime with the game within one goal.
+static bool isLateAndClose(const GameState &g) {
+  return g.period >= 3 && abs(g.home.score - g.away.score) <= 1;
+}
+
+}  // namespace
+
+namespace PollSchedule {
+
+Plan plan(const GameState &g, uint32_t nowMs) {
+  const time_t nowEpoch = time(nullptr);
+  const bool clockValid = nowEpoch > 1577836800;
+
+  if (g.hasGame && g.gameId.length() && !g.isPre && !g.isFinal) sLiveGameId = g.gameId;
+  // Without a clock an unseen final stays undecided until time is set.
+  if (g.hasGame && g.isFinal && g.gameId.length() && g.gameId != sFinalGameId &&
+      (clockValid || g.gameId == sLiveGameId)) {
+    sFinalGameId = g.gameId;
+    sFinalSeenMs = justEnded(g, nowEpoch, clockValid) ? (nowMs ? nowMs : 1) : 0;
+  }
+  const time_t start = upcomingStart(g);
+  time_t untilStart = 0;
+
+  Plan p;
+  if (g.hasGame && g.isIntermission) {
+    p.scoreboardMs = POLL_INTERMISSION_MS;
+    p.detailMs = POLL_INTERMISSION_MS;
+    p.reason = "intermission";
+  } else if (g.hasGame && !g.isFinal && !g.isPre) {
+    const bool clutch = isLateAndClose(g);
+    p.scoreboardMs = POLL_SCOREBOARD_MS;
+    p.detailMs = clutch ? POLL_CLUTCH_DETAIL_MS : POLL_GAMEDETAIL_MS;
+    p.reason = clutch ? "live, late and close" : "live";
+  } else if (sFinalSeenMs != 0 && nowMs - sFinalSeenMs < POLL_FINAL_COOLDOWN_WINDOW_MS) {
+    p.scoreboardMs = POLL_FINAL_COOLDOWN_MS;
+    p.reason = "final cooldown";
+  } else if (!clockValid) {
+    p.scoreboardMs = POLL_SCOREBOARD_MS;
+    p.reason = "no clock";
+  } else if (start > 0) {
+    untilStart = start - nowEpoch;
+    p.scoreboardMs = pregameInterval(untilStart);
+    p.reason = "pregame";
+  } else {
+    p.scoreboardMs = POLL_IDLE_MS;
+    p.reason = "idle";
+  }
+
+  if (p.scoreboardMs != sLoggedScoreboardMs || p.detailMs != sLoggedDetailMs || p.reason != sLoggedReason) {
+    sLoggedScoreboardMs = p.scoreboardMs;
+    sLoggedDetailMs = p.detailMs;
+    sLoggedReason = p.reason;
+    if (untilStart > 0) {
+      Serial.printf("POLL: scoreboard %lus, detail %lus (%s, %ldm to start)\n",
+                    (unsigned long)(p.scoreboardMs / 1000),
+                    (unsigned long)(p.detailMs / 1000),
+                    p.reason,
+                    (long)(untilStart / 60));
+    } else {
+      Serial.printf("POLL: scoreboard %lus, detail %lus (%s)\n",
+                    (unsigned long)(p.scoreboardMs / 1000),
+                    (unsigned long)(p.detailMs / 1000),
+                    p.reason);
+    }
+  }
+  return p;
+}
+
+}  // namespace PollSchedule
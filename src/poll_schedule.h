@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "types.h"
+
+// Derives scoreboard/detail poll intervals from the current GameState: slow
+// while the next game is days away, fast in the moments that matter. Curves
+// are configured in include/config.h (POLL_*).
+
+namespace PollSchedule {
+
+struct Plan {
+  uint32_t scoreboardMs = 0;
+  uint32_t detailMs = 0;  // 0 = no detail polling
+  const char *reason = "";
+};
+
+// Picks the intervals for `g`. Logs over serial whenever the choice changes.
+Plan plan(const GameState &g, uint32_t nowMs);
+
+}  // namespace PollSchedule
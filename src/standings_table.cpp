@@ -0,0 +1,223 @@
+#include "standings_table.h"
+
+#include <string.h>
+
+namespace {
+
+bool rowBetter(const StandingsRow &a, const StandingsRow &b) {
+  if (a.pts != b.pts) return a.pts > b.pts;
+  const int diffA = a.gf - a.ga;
+  const int diffB = b.gf - b.ga;
+  if (diffA != diffB) return diffA > diffB;
+  if (a.gf != b.gf) return a.gf > b.gf;
+  return strcmp(Teams::code(a.team), Teams::code(b.team)) < 0;
+}
+
+bool sameResult(const StandingsTable::Game &a, const StandingsTable::Game &b) {
+  return a.group == b.group && a.home == b.home && a.away == b.away && a.homeScore == b.homeScore &&
+         a.awayScore == b.awayScore && a.overtime == b.overtime && a.hasOtIndicator == b.hasOtIndicator;
+}
+
+uint8_t step(uint8_t v, int sign, uint8_t by = 1) {
+  return (uint8_t)(v + sign * by);
+}
+
+}  // namespace
+
+void StandingsTable::clear() {
+  _rowCount = 0;
+  _gameCount = 0;
+  _fallbackGames = 0;
+  _overflowLogged = false;
+}
+
+// Lower bound on the sorted key list; `found` says whether the slot holds `key`.
+int StandingsTable::findGame(uint32_t key, bool &found) const {
+  int lo = 0;
+  int hi = _gameCount;
+  while (lo < hi) {
+    const int mid = (lo + hi) / 2;
+    if (_games[mid].key < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  found = (lo < _gameCount && _games[lo].key == key);
+  return lo;
+}
+
+int StandingsTable::findRow(char group, Teams::TeamId team) const {
+  for (uint8_t i = 0; i < _rowCount; ++i) {
+    if (_rows[i].stats.team == team && _rows[i].group == group) return i;
+  }
+  return -1;
+}
+
+// New rows start with no points, so they go in at the end of their group.
+void StandingsTable::addRow(char group, Teams::TeamId team) {
+  uint8_t at = 0;
+  while (at < _rowCount && _rows[at].group <= group) at++;
+  memmove(&_rows[at + 1], &_rows[at], (_rowCount - at) * sizeof(Row));
+  _rows[at].group = group;
+  _rows[at].stats = StandingsRow();
+  _rows[at].stats.team = team;
+  _rowCount++;
+  settle(at);
+}
+
+void StandingsTable::eraseRow(uint8_t index) {
+  memmove(&_rows[index], &_rows[index + 1], (_rowCount - index - 1) * sizeof(Row));
+  _rowCount--;
+}
+
+// Moves one changed row up or down to its place; the rest are already sorted.
+void StandingsTable::settle(uint8_t index) {
+  auto before = [](const Row &a, const Row &b) {
+    if (a.group != b.group) return a.group < b.group;
+    return rowBetter(a.stats, b.stats);
+  };
+  while (index > 0 && before(_rows[index], _rows[index - 1])) {
+    const Row tmp = _rows[index];
+    _rows[index] = _rows[index - 1];
+    _rows[--index] = tmp;
+  }
+  while (index + 1 < _rowCount && before(_rows[index + 1], _rows[index])) {
+    const Row tmp = _rows[index];
+    _rows[index] = _rows[index + 1];
+    _rows[++index] = tmp;
+  }
+}
+
+// Adds (sign 1) or takes back (sign -1) one game's result. Returns false only
+// when a new team does not fit, in which case nothing was changed.
+bool StandingsTable::tally(const Game &game, int sign) {
+  int home = findRow(game.group, game.home);
+  int away = findRow(game.group, game.away);
+  if (sign > 0 && (home < 0 || away < 0)) {
+    if (_rowCount + (home < 0) + (away < 0) > kMaxRows) return false;
+    if (home < 0) addRow(game.group, game.home);
+    if (away < 0) addRow(game.group, game.away);
+    home = findRow(game.group, game.home);
+    away = findRow(game.group, game.away);
+  }
+  if (home < 0 || away < 0) return false;
+
+  StandingsRow &h = _rows[home].stats;
+  StandingsRow &a = _rows[away].stats;
+  h.gp = step(h.gp, sign);
+  a.gp = step(a.gp, sign);
+  h.gf = (int16_t)(h.gf + sign * game.homeScore);
+  h.ga = (int16_t)(h.ga + sign * game.awayScore);
+  a.gf = (int16_t)(a.gf + sign * game.awayScore);
+  a.ga = (int16_t)(a.ga + sign * game.homeScore);
+
+  if (game.homeScore != game.awayScore) {
+    // Without an OT/SO indicator the game counts as regulation for points.
+    if (!game.hasOtIndicator) _fallbackGames = step(_fallbackGames, sign);
+
+    StandingsRow &winner = (game.homeScore > game.awayScore) ? h : a;
+    StandingsRow &loser = (game.homeScore > game.awayScore) ? a : h;
+    if (game.overtime) {
+      winner.otw = step(winner.otw, sign);
+      loser.otl = step(loser.otl, sign);
+      winner.pts = step(winner.pts, sign, 2);
+      loser.pts = step(loser.pts, sign, 1);
+    } else {
+      winner.w = step(winner.w, sign);
+      loser.l = step(loser.l, sign);
+      winner.pts = step(winner.pts, sign, 3);
+    }
+  }
+
+  const Teams::TeamId teams[2] = {game.home, game.away};
+  for (Teams::TeamId team : teams) {
+    const int row = findRow(game.group, team);
+    if (row < 0) continue;
+    if (_rows[row].stats.gp == 0) {
+      eraseRow((uint8_t)row);
+    } else {
+      settle((uint8_t)row);
+    }
+  }
+  return true;
+}
+
+bool StandingsTable::apply(const Game &game) {
+  bool found = false;
+  const int at = findGame(game.key, found);
+  if (found) {
+    if (sameResult(_games[at], game)) return false;
+    tally(_games[at], -1);
+    if (!tally(game, 1)) {
+      memmove(&_games[at], &_games[at + 1], (_gameCount - at - 1) * sizeof(Game));
+      _gameCount--;
+      return true;
+    }
+    _games[at] = game;
+    return true;
+  }
+
+  if (_gameCount >= kMaxGames || !tally(game, 1)) {
+    if (!_overflowLogged) {
+      Serial.printf("Standings: table full (%u games, %u teams), skipping results\n",
+                    (unsigned)_gameCount,
+                    (unsigned)_rowCount);
+      _overflowLogged = true;
+    }
+    return false;
+  }
+  memmove(&_games[at + 1], &_games[at], (_gameCount - at) * sizeof(Game));
+  _games[at] = game;
+  _gameCount++;
+  return true;
+}
+
+bool StandingsTable::remove(uint32_t key) {
+  bool found = false;
+  const int at = findGame(key, found);
+  if (!found) return false;
+  tally(_games[at], -1);
+  memmove(&_games[at], &_games[at + 1], (_gameCount - at - 1) * sizeof(Game));
+  _gameCount--;
+  return true;
+}
+
+void StandingsTable::exportTo(OlympicStandings &out, Teams::TeamId focus) const {
+  out = OlympicStandings();
+  out.usedRegulationFallback = (_fallbackGames > 0);
+
+  // Groups are contiguous runs of rows; pick the first ones that fit, swapping
+  // the focus group in for the last pick when it would not make the cut.
+  uint8_t starts[kMaxStandingsGroups];
+  uint8_t picked = 0;
+  uint8_t start = 0;
+  while (start < _rowCount) {
+    uint8_t end = start;
+    bool hasFocus = false;
+    while (end < _rowCount && _rows[end].group == _rows[start].group) {
+      if (focus != Teams::kNone && _rows[end].stats.team == focus) {
+        hasFocus = true;
+        out.canadaGroup = _rows[end].group;
+        out.canadaRank = (int8_t)(end - start + 1);
+        out.canadaPts = _rows[end].stats.pts;
+      }
+      end++;
+    }
+    if (picked < kMaxStandingsGroups) {
+      starts[picked++] = start;
+    } else if (hasFocus) {
+      starts[kMaxStandingsGroups - 1] = start;
+    }
+    start = end;
+  }
+
+  for (uint8_t g = 0; g < picked; ++g) {
+    GroupStandings &dst = out.groups[out.groupCount++];
+    dst.group = _rows[starts[g]].group;
+    for (uint8_t r = starts[g]; r < _rowCount && _rows[r].group == dst.group; ++r) {
+      if (dst.rowCount >= kMaxStandingsRows) break;
+      dst.rows[dst.rowCount++] = _rows[r].stats;
+    }
+  }
+}
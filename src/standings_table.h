@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "teams.h"
+#include "types.h"
+
+// Group standings kept across scoreboard polls. Each completed game is tallied
+// once and remembered by event key, so a poll with no newly finished games
+// costs one lookup per final event. A game whose score or overtime flag
+// changes after the fact is reverted and tallied again; a game that is no
+// longer final is taken back out. Rows stay sorted by group, then rank.
+//
+// Capacity is per team and per game rather than per group, so the table can
+// hold larger tournaments than the OlympicStandings snapshot it is exported
+// into.
+
+class StandingsTable {
+public:
+  static constexpr uint8_t kMaxRows = Teams::kMaxTeams;
+  static constexpr uint8_t kMaxGames = 96;
+
+  struct Game {
+    uint32_t key = 0;  // event id
+    char group = '?';
+    Teams::TeamId home = Teams::kNone;
+    Teams::TeamId away = Teams::kNone;
+    int16_t homeScore = 0;
+    int16_t awayScore = 0;
+    bool overtime = false;
+    bool hasOtIndicator = false;
+  };
+
+  StandingsTable() { clear(); }
+
+  void clear();
+
+  // Tallies `game` if its key is new or its result differs from the tallied
+  // one. Returns true when the table changed.
+  bool apply(const Game &game);
+
+  // Reverts the game with `key` if it was tallied. Returns true when it was.
+  bool remove(uint32_t key);
+
+  // Copies the first groups (by letter) and their top rows into `out`. The
+  // focus team's group is always included and its rank comes from the full
+  // table.
+  void exportTo(OlympicStandings &out, Teams::TeamId focus) const;
+
+  uint8_t rowCount() const { return _rowCount; }
+  uint8_t gameCount() const { return _gameCount; }
+
+private:
+  struct Row {
+    char group;
+    StandingsRow stats;
+  };
+
+  int findGame(uint32_t key, bool &found) const;
+  int findRow(char group, Teams::TeamId team) const;
+  void addRow(char group, Teams::TeamId team);
+  void eraseRow(uint8_t index);
+  void settle(uint8_t index);
+  bool tally(const Game &game, int sign);
+
+  Row _rows[kMaxRows];
+  Game _games[kMaxGames];  // sorted by key
+  uint8_t _rowCount = 0;
+  uint8_t _gameCount = 0;
+  uint8_t _fallbackGames = 0;  // decided games without an OT/SO indicator
+  bool _overflowLogged = false;
+};
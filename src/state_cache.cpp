@@ -0,0 +1,387 @@
+#include "state_cache.h"
+
+#include <SPIFFS.h>
+#include <string.h>
+#include <utility>
+
+#include "config.h"
+
+#ifndef STATE_SNAPSHOT_MIN_INTERVAL_MS
+#define STATE_SNAPSHOT_MIN_INTERVAL_MS 60000
+#endif
+
+namespace {
+
+static const char *kPath = "/state.bin";
+static const char *kTempPath = "/state.tmp";
+static const uint32_t kMagic = 0x31535347;  // "GSS1"
+static const uint16_t kVersion = 1;
+static const size_t kHeaderBytes = 12;       // magic, version, length, checksum
+static const size_t kMaxBytes = 2048;
+// The leading save time is left out of change detection so an unchanged state
+// is never rewritten just because the clock moved.
+static const size_t kSavedAtBytes = sizeof(int64_t);
+
+// Encode buffer; only the network task saves, and restore() runs before it starts.
+static uint8_t sBuf[kMaxBytes];
+static uint32_t sLastContentSum = 0;
+static uint32_t sLastWriteMs = 0;
+static bool sWritten = false;
+
+uint32_t checksum(const uint8_t *data, size_t len) {
+  uint32_t h = 2166136261u;  // FNV-1a
+  for (size_t i = 0; i < len; ++i) {
+    h ^= data[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+class Writer {
+public:
+  Writer(uint8_t *buf, size_t cap) : _buf(buf), _cap(cap) {}
+
+  void u8(uint8_t v) { raw(&v, 1); }
+  void i16(int16_t v) { raw(&v, sizeof(v)); }
+  void epoch(time_t v) {
+    const int64_t wide = (int64_t)v;
+    raw(&wide, sizeof(wide));
+  }
+  void str(const char *s) {
+    size_t len = strlen(s);
+    if (len > 255) len = 255;
+    u8((uint8_t)len);
+    raw(s, len);
+  }
+  void str(const String &s) { str(s.c_str()); }
+  void team(Teams::TeamId id, bool withLogo) {
+    str(Teams::code(id));
+    if (withLogo) str(Teams::logoUrl(id));
+  }
+
+  size_t size() const { return _len; }
+  bool ok() const { return !_overflow; }
+
+private:
+  void raw(const void *data, size_t len) {
+    if (_len + len > _cap) {
+      _overflow = true;
+      return;
+    }
+    memcpy(_buf + _len, data, len);
+    _len += len;
+  }
+
+  uint8_t *_buf;
+  size_t _cap;
+  size_t _len = 0;
+  bool _overflow = false;
+};
+
+class Reader {
+public:
+  Reader(const uint8_t *buf, size_t len) : _buf(buf), _len(len) {}
+
+  uint8_t u8() {
+    uint8_t v = 0;
+    raw(&v, 1);
+    return v;
+  }
+  int16_t i16() {
+    int16_t v = 0;
+    raw(&v, sizeof(v));
+    return v;
+  }
+  time_t epoch() {
+    int64_t v = 0;
+    raw(&v, sizeof(v));
+    return (time_t)v;
+  }
+  String str() {
+    char tmp[256];
+    const uint8_t len = u8();
+    raw(tmp, len);
+    tmp[_failed ? 0 : len] = '\0';
+    return String(tmp);
+  }
+  Teams::TeamId team(bool withLogo) {
+    const String code = str();
+    const Teams::TeamId id = Teams::intern(code);
+    if (withLogo) Teams::setLogoUrl(id, str().c_str());
+    return id;
+  }
+
+  bool ok() const { return !_failed && _pos == _len; }
+
+private:
+  void raw(void *out, size_t len) {
+    if (_failed || _pos + len > _len) {
+      _failed = true;
+      return;
+    }
+    memcpy(out, _buf + _pos, len);
+    _pos += len;
+  }
+
+  const uint8_t *_buf;
+  size_t _len;
+  size_t _pos = 0;
+  bool _failed = false;
+};
+
+void writeTeamLine(Writer &w, const TeamLine &t) {
+  w.team(t.id, true);
+  w.str(t.name);
+  w.i16((int16_t)t.score);
+}
+
+void readTeamLine(Reader &r, TeamLine &t) {
+  t.id = r.team(true);
+  t.name = r.str();
+  t.score = r.i16();
+}
+
+void encode(Writer &w, const GameState &g) {
+  const time_t nowEpoch = time(nullptr);
+  w.epoch(nowEpoch > 1577836800 ? nowEpoch : 0);
+
+  w.u8((uint8_t)(g.hasGame | (g.isFinal << 1) | (g.isIntermission << 2) | (g.isLive << 3) | (g.isPre << 4)));
+  w.str(g.gameId);
+  w.str(g.startTimeHHMM);
+  w.epoch(g.startEpoch);
+  // Live status text moves with the clock; it is re-fetched on the first poll.
+  w.str(g.isLive ? String("") : g.statusDetail);
+  w.str(g.isLive ? String("") : g.statusShortDetail);
+  w.str(g.groupHeadline);
+  w.u8((uint8_t)g.group);
+  writeTeamLine(w, g.away);
+  writeTeamLine(w, g.home);
+
+  w.u8(g.hasNextGame);
+  w.team(g.nextOpp, true);
+  w.u8(g.nextIsHome);
+  w.str(g.nextVenue);
+  w.str(g.nextCity);
+  w.u8((uint8_t)g.nextGroup);
+  w.str(g.nextGroupHeadline);
+  w.epoch(g.nextStartEpoch);
+
+  const LastGameRecap &last = g.last;
+  w.u8(last.hasGame);
+  w.str(last.gameId);
+  writeTeamLine(w, last.away);
+  writeTeamLine(w, last.home);
+  w.epoch(last.startEpoch);
+  w.str(last.venue);
+  w.str(last.city);
+  w.u8(last.awayScorerCount);
+  for (uint8_t i = 0; i < last.awayScorerCount; ++i) {
+    w.str(last.awayScorers[i].name);
+    w.u8(last.awayScorers[i].goals);
+  }
+  w.u8(last.homeScorerCount);
+  for (uint8_t i = 0; i < last.homeScorerCount; ++i) {
+    w.str(last.homeScorers[i].name);
+    w.u8(last.homeScorers[i].goals);
+  }
+  w.u8(last.periodCount);
+  for (uint8_t i = 0; i < last.periodCount; ++i) {
+    w.str(last.periods[i].label);
+    w.u8(last.periods[i].home);
+    w.u8(last.periods[i].away);
+  }
+
+  const OlympicStandings &st = g.standings;
+  w.u8(st.groupCount);
+  for (uint8_t gi = 0; gi < st.groupCount; ++gi) {
+    const GroupStandings &group = st.groups[gi];
+    w.u8((uint8_t)group.group);
+    w.u8(group.rowCount);
+    for (uint8_t ri = 0; ri < group.rowCount; ++ri) {
+      const StandingsRow &row = group.rows[ri];
+      w.team(row.team, false);
+      w.u8(row.gp);
+      w.u8(row.w);
+      w.u8(row.otw);
+      w.u8(row.otl);
+      w.u8(row.l);
+      w.u8(row.pts);
+      w.i16(row.gf);
+      w.i16(row.ga);
+    }
+  }
+  w.u8((uint8_t)st.canadaGroup);
+  w.u8((uint8_t)st.canadaRank);
+  w.u8(st.canadaPts);
+  w.u8(st.usedRegulationFallback);
+}
+
+bool decode(Reader &r, GameState &g, time_t &savedAt) {
+  savedAt = r.epoch();
+
+  const uint8_t flags = r.u8();
+  g.hasGame = flags & 0x01;
+  g.isFinal = flags & 0x02;
+  g.isIntermission = flags & 0x04;
+  g.isLive = flags & 0x08;
+  g.isPre = flags & 0x10;
+  g.gameId = r.str();
+  g.startTimeHHMM = r.str();
+  g.startEpoch = r.epoch();
+  g.statusDetail = r.str();
+  g.statusShortDetail = r.str();
+  g.groupHeadline = r.str();
+  g.group = (char)r.u8();
+  readTeamLine(r, g.away);
+  readTeamLine(r, g.home);
+
+  g.hasNextGame = r.u8();
+  g.nextOpp = r.team(true);
+  g.nextIsHome = r.u8();
+  g.nextVenue = r.str();
+  g.nextCity = r.str();
+  g.nextGroup = (char)r.u8();
+  g.nextGroupHeadline = r.str();
+  g.nextStartEpoch = r.epoch();
+
+  LastGameRecap &last = g.last;
+  last.hasGame = r.u8();
+  last.gameId = r.str();
+  readTeamLine(r, last.away);
+  readTeamLine(r, last.home);
+  last.startEpoch = r.epoch();
+  last.venue = r.str();
+  last.city = r.str();
+  last.awayScorerCount = r.u8();
+  if (last.awayScorerCount > kRecapMaxScorers) return false;
+  for (uint8_t i = 0; i < last.awayScorerCount; ++i) {
+    last.awayScorers[i].name = r.str();
+    last.awayScorers[i].goals = r.u8();
+  }
+  last.homeScorerCount = r.u8();
+  if (last.homeScorerCount > kRecapMaxScorers) return false;
+  for (uint8_t i = 0; i < last.homeScorerCount; ++i) {
+    last.homeScorers[i].name = r.str();
+    last.homeScorers[i].goals = r.u8();
+  }
+  last.periodCount = r.u8();
+  if (last.periodCount > kRecapMaxPeriods) return false;
+  for (uint8_t i = 0; i < last.periodCount; ++i) {
+    last.periods[i].label = r.str();
+    last.periods[i].home = r.u8();
+    last.periods[i].away = r.u8();
+  }
+
+  OlympicStandings &st = g.standings;
+  st.groupCount = r.u8();
+  if (st.groupCount > kMaxStandingsGroups) return false;
+  for (uint8_t gi = 0; gi < st.groupCount; ++gi) {
+    GroupStandings &group = st.groups[gi];
+    group.group = (char)r.u8();
+    group.rowCount = r.u8();
+    if (group.rowCount > kMaxStandingsRows) return false;
+    for (uint8_t ri = 0; ri < group.rowCount; ++ri) {
+      StandingsRow &row = group.rows[ri];
+      row.team = r.team(false);
+      row.gp = r.u8();
+      row.w = r.u8();
+      row.otw = r.u8();
+      row.otl = r.u8();
+      row.l = r.u8();
+      row.pts = r.u8();
+      row.gf = r.i16();
+      row.ga = r.i16();
+    }
+  }
+  st.canadaGroup = (char)r.u8();
+  st.canadaRank = (int8_t)r.u8();
+  st.canadaPts = r.u8();
+  st.usedRegulationFallback = r.u8();
+
+  return r.ok();
+}
+
+void putHeader(uint8_t *buf, uint16_t len, uint32_t sum) {
+  memcpy(buf, &kMagic, 4);
+  memcpy(buf + 4, &kVersion, 2);
+  memcpy(buf + 6, &len, 2);
+  memcpy(buf + 8, &sum, 4);
+}
+
+}  // namespace
+
+namespace StateCache {
+
+bool restore(GameState &out, time_t *savedAt) {
+  if (!SPIFFS.exists(kPath)) return false;
+  File f = SPIFFS.open(kPath, "r");
+  if (!f) return false;
+  const size_t len = f.read(sBuf, sizeof(sBuf));
+  f.close();
+
+  uint32_t magic = 0;
+  uint16_t version = 0;
+  uint16_t payload = 0;
+  uint32_t sum = 0;
+  if (len >= kHeaderBytes) {
+    memcpy(&magic, sBuf, 4);
+    memcpy(&version, sBuf + 4, 2);
+    memcpy(&payload, sBuf + 6, 2);
+    memcpy(&sum, sBuf + 8, 4);
+  }
+  if (magic != kMagic || version != kVersion || kHeaderBytes + payload != len ||
+      checksum(sBuf + kHeaderBytes, payload) != sum) {
+    Serial.println("State cache: snapshot invalid, ignored");
+    return false;
+  }
+
+  GameState state;
+  time_t at = 0;
+  Reader r(sBuf + kHeaderBytes, payload);
+  if (!decode(r, state, at)) {
+    Serial.println("State cache: snapshot does not decode, ignored");
+    return false;
+  }
+
+  out = std::move(state);
+  if (savedAt) *savedAt = at;
+  sLastContentSum = checksum(sBuf + kHeaderBytes + kSavedAtBytes, payload - kSavedAtBytes);
+  sWritten = true;
+  Serial.printf("State cache: restored %u B snapshot\n", (unsigned)len);
+  return true;
+}
+
+void save(const GameState &g, uint32_t now) {
+  Writer w(sBuf + kHeaderBytes, sizeof(sBuf) - kHeaderBytes);
+  encode(w, g);
+  if (!w.ok()) {
+    Serial.println("State cache: snapshot too large, not saved");
+    return;
+  }
+
+  const uint32_t contentSum = checksum(sBuf + kHeaderBytes + kSavedAtBytes, w.size() - kSavedAtBytes);
+  if (sWritten && contentSum == sLastContentSum) return;
+  if (sWritten && now - sLastWriteMs < STATE_SNAPSHOT_MIN_INTERVAL_MS) return;
+
+  const uint16_t len = (uint16_t)w.size();
+  const uint32_t sum = checksum(sBuf + kHeaderBytes, len);
+  putHeader(sBuf, len, sum);
+
+  File f = SPIFFS.open(kTempPath, "w");
+  if (!f) return;
+  const size_t written = f.write(sBuf, kHeaderBytes + len);
+  f.close();
+  if (written != kHeaderBytes + len) {
+    SPIFFS.remove(kTempPath);
+    return;
+  }
+  SPIFFS.remove(kPath);
+  if (!SPIFFS.rename(kTempPath, kPath)) return;
+
+  sLastContentSum = contentSum;
+  sLastWriteMs = now;
+  sWritten = true;
+  Serial.printf("State cache: saved %u B snapshot\n", (unsigned)(kHeaderBytes + len));
+}
+
+}  // namespace StateCache
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Arduino.h>
+#include <time.h>
+
+#include "types.h"
+
+// Last-known GameState kept in SPIFFS so the first screen after a reboot can be
+// drawn before Wi-Fi and the first scoreboard poll. Only the slow-moving parts
+// are kept: the current game's header and score, next game, last recap and
+// standings. Live clock, stats and goal details are left out, so a running game
+// does not rewrite the file every poll. Teams are stored by code, since ids are
+// handed out afresh each boot.
+
+namespace StateCache {
+
+// Loads the snapshot into `out`. Returns false, leaving `out` untouched, when
+// there is none or it fails its checksum. `savedAt` gets the wall-clock time
+// it was written (0 if the clock was not set then).
+bool restore(GameState &out, time_t *savedAt = nullptr);
+
+// Rewrites the snapshot when the kept fields differ from the last one written,
+// at most once per STATE_SNAPSHOT_MIN_INTERVAL_MS; a change inside that window
+// is written by a later call. Call from the network task after each poll.
+void save(const GameState &g, uint32_t now);
+
+}  // namespace StateCache
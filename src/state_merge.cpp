@@ -0,0 +1,290 @@
+#include "state_merge.h"
+
+#include <stdlib.h>
+#include <utility>
+
+namespace {
+
+using StateMerge::Field;
+using StateMerge::Mask;
+using StateMerge::bit;
+
+// Seconds left on a "MM:SS" game clock, or -1 when it does not parse.
+int32_t clockRemaining(const String &clock) {
+  const char *s = clock.c_str();
+  char *end = nullptr;
+  const long mins = strtol(s, &end, 10);
+  if (end == s || *end != ':') return -1;
+  const char *secStart = end + 1;
+  const long secs = strtol(secStart, &end, 10);
+  if (end == secStart) return -1;
+  return (int32_t)(mins * 60 + secs);
+}
+
+// Orders states by how far the game has got: pre < live (by period, then by
+// clock running down) < final. A live state without a readable clock counts
+// as the start of its period.
+int32_t statusProgress(const GameState &g) {
+  if (g.isFinal) return 3000000;
+  if (!g.isLive) return 0;
+  int32_t remaining = clockRemaining(g.clock);
+  if (remaining < 0 || remaining > 9999) remaining = 9999;
+  return 1000000 + g.period * 10000 + (9999 - remaining);
+}
+
+bool sameGame(const GameState &a, const GameState &b) {
+  return a.hasGame == b.hasGame && a.gameId == b.gameId && a.home.id == b.home.id && a.away.id == b.away.id;
+}
+
+bool sameHeader(const GameState &a, const GameState &b) {
+  return sameGame(a, b) && a.startEpoch == b.startEpoch && a.startTimeHHMM == b.startTimeHHMM &&
+         a.groupHeadline == b.groupHeadline && a.group == b.group && a.home.name == b.home.name &&
+         a.away.name == b.away.name;
+}
+
+bool sameStatus(const GameState &a, const GameState &b) {
+  return a.isPre == b.isPre && a.isLive == b.isLive && a.isFinal == b.isFinal &&
+         a.isIntermission == b.isIntermission && a.period == b.period && a.clock == b.clock &&
+         a.statusDetail == b.statusDetail && a.statusShortDetail == b.statusShortDetail;
+}
+
+bool sameNextGame(const GameState &a, const GameState &b) {
+  return a.hasNextGame == b.hasNextGame && a.nextOpp == b.nextOpp && a.nextIsHome == b.nextIsHome &&
+         a.nextStartEpoch == b.nextStartEpoch && a.nextGroup == b.nextGroup && a.nextVenue == b.nextVenue &&
+         a.nextCity == b.nextCity && a.nextGroupHeadline == b.nextGroupHeadline;
+}
+
+bool sameTeamLine(const TeamLine &a, const TeamLine &b) {
+  return a.id == b.id && a.score == b.score && a.name == b.name;
+}
+
+bool sameRecap(const LastGameRecap &a, const LastGameRecap &b) {
+  if (a.hasGame != b.hasGame || a.gameId != b.gameId || a.startEpoch != b.startEpoch ||
+      !sameTeamLine(a.away, b.away) || !sameTeamLine(a.home, b.home) || a.venue != b.venue || a.city != b.city ||
+      a.awayScorerCount != b.awayScorerCount || a.homeScorerCount != b.homeScorerCount ||
+      a.periodCount != b.periodCount) {
+    return false;
+  }
+  for (uint8_t i = 0; i < a.awayScorerCount; ++i) {
+    if (a.awayScorers[i].name != b.awayScorers[i].name || a.awayScorers[i].goals != b.awayScorers[i].goals) return false;
+  }
+  for (uint8_t i = 0; i < a.homeScorerCount; ++i) {
+    if (a.homeScorers[i].name != b.homeScorers[i].name || a.homeScorers[i].goals != b.homeScorers[i].goals) return false;
+  }
+  for (uint8_t i = 0; i < a.periodCount; ++i) {
+    const PeriodEntry &pa = a.periods[i];
+    const PeriodEntry &pb = b.periods[i];
+    if (pa.label != pb.label || pa.home != pb.home || pa.away != pb.away) return false;
+  }
+  return true;
+}
+
+bool sameStandings(const OlympicStandings &a, const OlympicStandings &b) {
+  if (a.groupCount != b.groupCount || a.canadaGroup != b.canadaGroup || a.canadaRank != b.canadaRank ||
+      a.canadaPts != b.canadaPts || a.usedRegulationFallback != b.usedRegulationFallback) {
+    return false;
+  }
+  for (uint8_t g = 0; g < a.groupCount; ++g) {
+    const GroupStandings &ga = a.groups[g];
+    const GroupStandings &gb = b.groups[g];
+    if (ga.group != gb.group || ga.rowCount != gb.rowCount) return false;
+    for (uint8_t r = 0; r < ga.rowCount; ++r) {
+      const StandingsRow &ra = ga.rows[r];
+      const StandingsRow &rb = gb.rows[r];
+      if (ra.team != rb.team || ra.gp != rb.gp || ra.w != rb.w || ra.otw != rb.otw || ra.otl != rb.otl ||
+          ra.l != rb.l || ra.pts != rb.pts || ra.gf != rb.gf || ra.ga != rb.ga) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Stats of -1 mean "not reported" and never replace a known value.
+bool mergeStat(int &into, int from) {
+  if (from < 0 || from == into) return false;
+  into = from;
+  return true;
+}
+
+bool mergeStats(TeamLine &into, const TeamLine &from) {
+  bool changed = mergeStat(into.sog, from.sog);
+  changed |= mergeStat(into.hits, from.hits);
+  changed |= mergeStat(into.foPct, from.foPct);
+  return changed;
+}
+
+void copyStatus(GameState &into, const GameState &from) {
+  into.isPre = from.isPre;
+  into.isLive = from.isLive;
+  into.isFinal = from.isFinal;
+  into.isIntermission = from.isIntermission;
+  into.period = from.period;
+  into.clock = from.clock;
+  into.statusDetail = from.statusDetail;
+  into.statusShortDetail = from.statusShortDetail;
+}
+
+}  // namespace
+
+namespace StateMerge {
+
+Mask changedSince(const Versions &seen, const Versions &now) {
+  Mask mask = 0;
+  for (uint8_t f = 0; f < kFieldCount; ++f) {
+    if (seen.seq[f] != now.seq[f]) mask |= bit((Field)f);
+  }
+  return mask;
+}
+
+// A source never overwrites its own newer data; whether another source may
+// overwrite is decided per group by the caller.
+bool Merger::accepts(Field f, Source source, uint32_t fetchMs) const {
+  const Stamp &s = _stamps[f];
+  if (s.source == Source::None || s.source != source) return true;
+  return (int32_t)(fetchMs - s.fetchMs) >= 0;
+}
+
+void Merger::stamp(Field f, Source source, uint32_t fetchMs) {
+  _stamps[f].source = source;
+  _stamps[f].fetchMs = fetchMs;
+}
+
+Mask Merger::commit(Mask mask) {
+  for (uint8_t f = 0; f < kFieldCount; ++f) {
+    if (mask & bit((Field)f)) _versions.seq[f]++;
+  }
+  return mask;
+}
+
+Mask Merger::mergeScoreboard(GameState &into, GameState &from, uint32_t fetchMs) {
+  const Source src = Source::Scoreboard;
+  Mask mask = 0;
+
+  // A different game starts from the scoreboard's view of everything.
+  const bool newGame = !sameGame(into, from);
+  if (newGame) {
+    for (Field f : {Status, Score, Stats, Strength}) _stamps[f] = Stamp();
+  }
+
+  if (!sameHeader(into, from)) {
+    into.hasGame = from.hasGame;
+    into.gameId = std::move(from.gameId);
+    into.startEpoch = from.startEpoch;
+    into.startTimeHHMM = std::move(from.startTimeHHMM);
+    into.groupHeadline = std::move(from.groupHeadline);
+    into.group = from.group;
+    into.home.id = from.home.id;
+    into.home.name = std::move(from.home.name);
+    into.away.id = from.away.id;
+    into.away.name = std::move(from.away.name);
+    mask |= bit(Game);
+  }
+  stamp(Game, src, fetchMs);
+
+  // Another source's status only loses to this one when it is not ahead.
+  if (accepts(Status, src, fetchMs) &&
+      (_stamps[Status].source != Source::Summary || statusProgress(from) >= statusProgress(into))) {
+    if (!sameStatus(into, from)) {
+      copyStatus(into, from);
+      mask |= bit(Status);
+    }
+    stamp(Status, src, fetchMs);
+  }
+
+  if (into.home.score != from.home.score || into.away.score != from.away.score) {
+    into.home.score = from.home.score;
+    into.away.score = from.away.score;
+    mask |= bit(Score);
+  }
+  stamp(Score, src, fetchMs);
+
+  if (newGame) {
+    // The scoreboard carries no stats, so a new game starts unknown.
+    const bool had = into.home.sog >= 0 || into.home.hits >= 0 || into.home.foPct >= 0 || into.away.sog >= 0 ||
+                     into.away.hits >= 0 || into.away.foPct >= 0;
+    into.home.sog = into.home.hits = into.home.foPct = -1;
+    into.away.sog = into.away.hits = into.away.foPct = -1;
+    if (had) mask |= bit(Stats);
+  } else if (mergeStats(into.home, from.home) | mergeStats(into.away, from.away)) {
+    mask |= bit(Stats);
+  }
+
+  // The scoreboard's strength is a placeholder; it only fills an empty slot.
+  if (_stamps[Strength].source != Source::Summary &&
+      (into.strengthLabel != from.strengthLabel || into.strengthColour != from.strengthColour)) {
+    into.strengthLabel = std::move(from.strengthLabel);
+    into.strengthColour = from.strengthColour;
+    stamp(Strength, src, fetchMs);
+    mask |= bit(Strength);
+  }
+
+  if (!sameNextGame(into, from)) {
+    into.hasNextGame = from.hasNextGame;
+    into.nextOpp = from.nextOpp;
+    into.nextIsHome = from.nextIsHome;
+    into.nextVenue = std::move(from.nextVenue);
+    into.nextCity = std::move(from.nextCity);
+    into.nextGroup = from.nextGroup;
+    into.nextGroupHeadline = std::move(from.nextGroupHeadline);
+    into.nextStartEpoch = from.nextStartEpoch;
+    mask |= bit(NextGame);
+  }
+  stamp(NextGame, src, fetchMs);
+
+  if (!sameRecap(into.last, from.last)) {
+    into.last = std::move(from.last);
+    mask |= bit(LastGame);
+  }
+  stamp(LastGame, src, fetchMs);
+
+  if (!sameStandings(into.standings, from.standings)) {
+    into.standings = from.standings;
+    mask |= bit(Standings);
+  }
+  stamp(Standings, src, fetchMs);
+
+  return commit(mask);
+}
+
+Mask Merger::mergeSummary(GameState &into, const GameState &from, bool gotGoal, uint32_t fetchMs) {
+  const Source src = Source::Summary;
+  if (!sameGame(into, from)) return 0;  // the scoreboard moved on mid-fetch
+  Mask mask = 0;
+
+  if (accepts(Status, src, fetchMs) &&
+      (_stamps[Status].source != Source::Scoreboard || statusProgress(from) >= statusProgress(into))) {
+    if (!sameStatus(into, from)) {
+      copyStatus(into, from);
+      mask |= bit(Status);
+    }
+    stamp(Status, src, fetchMs);
+  }
+
+  if (mergeStats(into.home, from.home) | mergeStats(into.away, from.away)) {
+    mask |= bit(Stats);
+    stamp(Stats, src, fetchMs);
+  }
+
+  if (from.strengthLabel.length() && accepts(Strength, src, fetchMs)) {
+    if (into.strengthLabel != from.strengthLabel) {
+      into.strengthLabel = from.strengthLabel;
+      mask |= bit(Strength);
+    }
+    stamp(Strength, src, fetchMs);
+  }
+
+  if (gotGoal && from.lastGoalEventId != 0 && from.lastGoalEventId != into.lastGoalEventId) {
+    into.lastGoalEventId = from.lastGoalEventId;
+    into.goalTeam = from.goalTeam;
+    into.goalText = from.goalText;
+    into.goalScorer = from.goalScorer;
+    into.focusJustScored = from.focusJustScored;
+    stamp(Goal, src, fetchMs);
+    mask |= bit(Goal);
+  }
+
+  return commit(mask);
+}
+
+}  // namespace StateMerge
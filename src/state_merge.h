@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include "types.h"
+
+// Merges scoreboard and /summary results into one GameState. Fields are
+// handled in groups; each group remembers which source last wrote it and when,
+// so a lagging source cannot walk the game clock or status backwards, and a
+// source's "unknown" values (stats of -1, the scoreboard's placeholder
+// strength) never replace real ones. Every merge reports which groups actually
+// changed, and a per-group change counter travels with each published snapshot
+// so the UI can redraw only what moved.
+
+namespace StateMerge {
+
+enum class Source : uint8_t { None, Scoreboard, Summary };
+
+enum Field : uint8_t {
+  Game,       // game id, teams, start time, headline
+  Status,     // pre/live/final/intermission, status text, clock, period
+  Score,
+  Stats,      // SOG, hits, FO%
+  Strength,
+  Goal,       // latest goal event
+  NextGame,
+  LastGame,
+  Standings,
+  kFieldCount
+};
+
+typedef uint16_t Mask;
+inline Mask bit(Field f) { return (Mask)(1u << f); }
+
+// Bumped once per change of each group; compare two to get a Mask.
+struct Versions {
+  uint16_t seq[kFieldCount] = {};
+};
+
+Mask changedSince(const Versions &seen, const Versions &now);
+
+class Merger {
+public:
+  // Merges a freshly derived scoreboard state. `from` is consumed.
+  Mask mergeScoreboard(GameState &into, GameState &from, uint32_t fetchMs);
+
+  // Merges a /summary result for the game in `into`. Only the groups the
+  // summary feeds are read from `from`; the goal group only when `gotGoal`.
+  Mask mergeSummary(GameState &into, const GameState &from, bool gotGoal, uint32_t fetchMs);
+
+  const Versions &versions() const { return _versions; }
+
+private:
+  struct Stamp {
+    Source source = Source::None;
+    uint32_t fetchMs = 0;
+  };
+
+  bool accepts(Field f, Source source, uint32_t fetchMs) const;
+  void stamp(Field f, Source source, uint32_t fetchMs);
+  Mask commit(Mask mask);
+
+  Stamp _stamps[kFieldCount];
+  Versions _versions;
+};
+
+}  // namespace StateMerge
@@ -0,0 +1,52 @@
+#include "string_pool.h"
+
+#include <string.h>
+
+namespace {
+
+uint32_t hashString(const char *s) {
+  uint32_t h = 2166136261u;  // FNV-1a
+  while (*s) {
+    h ^= (uint8_t)*s++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+}  // namespace
+
+void StringPool::clear() {
+  _buf[0] = '\0';
+  _used = 1;
+  _count = 0;
+  _overflowed = false;
+  memset(_table, 0, sizeof(_table));
+}
+
+StringPool::Ref StringPool::intern(const char *s) {
+  if (!s || !s[0]) return kEmpty;
+
+  uint16_t slot = (uint16_t)(hashString(s) % kBuckets);
+  for (uint16_t probe = 0; probe < kBuckets; ++probe) {
+    const Ref ref = _table[slot];
+    if (ref == kEmpty) break;
+    if (strcmp(_buf + ref, s) == 0) return ref;
+    slot = (uint16_t)((slot + 1) % kBuckets);
+  }
+
+  // Keep the table at most 3/4 full so probes stay short.
+  const size_t len = strlen(s) + 1;
+  if (_count >= (kBuckets * 3) / 4 || _used + len > kBytes) {
+    if (!_overflowed) Serial.printf("StringPool: full (%u strings, %u B), dropping \"%s\"\n",
+                                    (unsigned)_count, (unsigned)_used, s);
+    _overflowed = true;
+    return kEmpty;
+  }
+
+  const Ref ref = (Ref)_used;
+  memcpy(_buf + _used, s, len);
+  _used = (uint16_t)(_used + len);
+  _table[slot] = ref;
+  _count++;
+  return ref;
+}
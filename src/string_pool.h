@@ -0,0 +1,38 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Interned strings in one fixed block. Each distinct string is stored once and
+// referred to by a 16-bit offset, so venue names, headlines and logo URLs that
+// repeat across dozens of events cost two bytes per use and never touch the
+// heap. Entries are only ever dropped all together by clear().
+
+class StringPool {
+public:
+  typedef uint16_t Ref;
+
+  static constexpr Ref kEmpty = 0;
+  static constexpr size_t kBytes = 3072;
+  static constexpr uint16_t kBuckets = 128;
+
+  StringPool() { clear(); }
+
+  void clear();
+
+  // Returns the ref of `s`, adding it if new. "" and strings that no longer
+  // fit come back as kEmpty; overflowed() then stays set until clear().
+  Ref intern(const char *s);
+
+  const char *str(Ref ref) const { return _buf + ref; }
+
+  size_t bytesUsed() const { return _used; }
+  uint16_t count() const { return _count; }
+  bool overflowed() const { return _overflowed; }
+
+private:
+  char _buf[kBytes];
+  Ref _table[kBuckets];  // open addressing on the string hash; kEmpty = free
+  uint16_t _used = 0;
+  uint16_t _count = 0;
+  bool _overflowed = false;
+};
@@ -0,0 +1,137 @@
+#include "teams.h"
+
+#include <atomic>
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+namespace {
+
+static const int16_t kFlagSizes[] = {56, 64, 96};
+static const uint8_t kFlagSizeCount = sizeof(kFlagSizes) / sizeof(kFlagSizes[0]);
+
+struct Entry {
+  uint32_t key = 0;  // upper-case code packed into 4 bytes
+  char code[Teams::kMaxCodeLen + 1] = "";
+  std::atomic<const char *> logoUrl{nullptr};
+  uint8_t flagFiles = 0;  // 2 bits (FlagFile) per kFlagSizes slot
+  std::atomic<uint8_t> assetVersion{0};
+};
+
+static Entry sEntries[Teams::kMaxTeams + 1];  // [0] is kNone
+static std::atomic<uint8_t> sCount{0};
+static portMUX_TYPE sLock = portMUX_INITIALIZER_UNLOCKED;
+
+static uint32_t packCode(const char *code, char *upper) {
+  uint32_t key = 0;
+  uint8_t len = 0;
+  for (; code[len]; ++len) {
+    if (len == Teams::kMaxCodeLen) return 0;
+    const char c = (char)toupper((unsigned char)code[len]);
+    upper[len] = c;
+    key = (key << 8) | (uint8_t)c;
+  }
+  upper[len] = '\0';
+  return key;
+}
+
+static Teams::TeamId findKey(uint32_t key, uint8_t count) {
+  for (uint8_t i = 1; i <= count; ++i) {
+    if (sEntries[i].key == key) return i;
+  }
+  return Teams::kNone;
+}
+
+static int flagSlot(int16_t size) {
+  for (uint8_t i = 0; i < kFlagSizeCount; ++i) {
+    if (kFlagSizes[i] == size) return i;
+  }
+  return -1;
+}
+
+}  // namespace
+
+namespace Teams {
+
+TeamId intern(const char *code) {
+  if (!code || !code[0]) return kNone;
+  char upper[kMaxCodeLen + 1];
+  const uint32_t key = packCode(code, upper);
+  if (!key) {
+    Serial.printf("Teams: code \"%s\" too long\n", code);
+    return kNone;
+  }
+
+  TeamId id = findKey(key, sCount.load(std::memory_order_acquire));
+  if (id != kNone) return id;
+
+  bool full = false;
+  portENTER_CRITICAL(&sLock);
+  const uint8_t count = sCount.load(std::memory_order_relaxed);
+  id = findKey(key, count);
+  if (id == kNone) {
+    if (count < kMaxTeams) {
+      id = (TeamId)(count + 1);
+      Entry &e = sEntries[id];
+      e.key = key;
+      memcpy(e.code, upper, sizeof(upper));
+      sCount.store(id, std::memory_order_release);
+    } else {
+      full = true;
+    }
+  }
+  portEXIT_CRITICAL(&sLock);
+
+  if (full) Serial.printf("Teams: table full, \"%s\" dropped\n", upper);
+  return id;
+}
+
+const char *code(TeamId id) {
+  if (id == kNone || id > sCount.load(std::memory_order_acquire)) return "";
+  return sEntries[id].code;
+}
+
+uint8_t count() {
+  return sCount.load(std::memory_order_acquire);
+}
+
+void setLogoUrl(TeamId id, const char *url) {
+  if (id == kNone || !url || !url[0] || id > sCount.load(std::memory_order_acquire)) return;
+  Entry &e = sEntries[id];
+  if (e.logoUrl.load(std::memory_order_acquire)) return;
+  char *copy = strdup(url);
+  if (!copy) return;
+  const char *expected = nullptr;
+  if (!e.logoUrl.compare_exchange_strong(expected, copy, std::memory_order_acq_rel)) free(copy);
+}
+
+const char *logoUrl(TeamId id) {
+  if (id == kNone || id > sCount.load(std::memory_order_acquire)) return "";
+  const char *url = sEntries[id].logoUrl.load(std::memory_order_acquire);
+  return url ? url : "";
+}
+
+FlagFile flagFile(TeamId id, int16_t size) {
+  const int slot = flagSlot(size);
+  if (id == kNone || slot < 0) return FlagFile::Unknown;
+  return (FlagFile)((sEntries[id].flagFiles >> (slot * 2)) & 0x03);
+}
+
+void setFlagFile(TeamId id, int16_t size, FlagFile file) {
+  const int slot = flagSlot(size);
+  if (id == kNone || slot < 0) return;
+  uint8_t &bits = sEntries[id].flagFiles;
+  bits = (uint8_t)((bits & ~(0x03 << (slot * 2))) | ((uint8_t)file << (slot * 2)));
+}
+
+uint8_t assetVersion(TeamId id) {
+  if (id == kNone || id > kMaxTeams) return 0;
+  return sEntries[id].assetVersion.load(std::memory_order_acquire);
+}
+
+void bumpAssetVersion(TeamId id) {
+  if (id == kNone || id > kMaxTeams) return;
+  sEntries[id].assetVersion.fetch_add(1, std::memory_order_acq_rel);
+}
+
+}  // namespace Teams
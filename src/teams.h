@@ -0,0 +1,47 @@
+#pragma once
+
+#include <Arduino.h>
+
+// Interned team codes (NOC country codes, NHL abbreviations). Each code gets a
+// one-byte id the first time it is seen, so the pipeline stores and compares
+// teams as integers; the code text, the feed's logo URL and where the flag was
+// found in SPIFFS are kept here once per team. Ids are never reused. Interning
+// is safe from either core; lookups by id take no lock.
+
+namespace Teams {
+
+typedef uint8_t TeamId;
+
+static const TeamId kNone = 0;
+static const uint8_t kMaxTeams = 63;
+static const uint8_t kMaxCodeLen = 4;
+
+// Id for `code` (case-insensitive, up to kMaxCodeLen characters), adding it if
+// new. kNone for an empty or over-long code, or when the table is full.
+TeamId intern(const char *code);
+inline TeamId intern(const String &code) { return intern(code.c_str()); }
+
+// Upper-case code text; "" for kNone.
+const char *code(TeamId id);
+
+// Number of teams interned so far; valid ids are 1..count().
+uint8_t count();
+
+// Logo URL from the feed, used for first-use flag downloads. The first
+// non-empty URL sticks; "" until one is seen.
+void setLogoUrl(TeamId id, const char *url);
+const char *logoUrl(TeamId id);
+
+// Which SPIFFS file holds the team's flag for a draw size, so repeat draws can
+// skip the exists() probes. Only hits are remembered; sizes other than the
+// cached flag sizes always report Unknown.
+enum class FlagFile : uint8_t { Unknown, Sized, Flat };
+FlagFile flagFile(TeamId id, int16_t size);
+void setFlagFile(TeamId id, int16_t size, FlagFile file);
+
+// Bumped whenever new art for the team lands on the device, so anything drawn
+// from the team's flag can tell it is out of date. Safe from either core.
+uint8_t assetVersion(TeamId id);
+void bumpAssetVersion(TeamId id);
+
+}  // namespace Teams
@@ -3,6 +3,8 @@
 #include <stdint.h>
 #include <time.h>
 
+#include "teams.h"
+
 enum class ScreenMode : uint8_t {
   NEXT_GAME,
   LIVE,
@@ -15,10 +17,19 @@ enum class ScreenMode : uint8_t {
   NO_GAME    // legacy alias, not used in Olympic flow
 };
 
+// Why the shown data may be out of date.
+enum class StaleReason : uint8_t {
+  NONE,
+  OFFLINE,       // no Wi-Fi
+  FETCH_FAILED,  // last scoreboard poll failed
+  BACKING_OFF,   // scoreboard endpoint is waiting out a retry delay
+  SERVICE_DOWN,  // scoreboard endpoint circuit is open
+  RESTORED       // boot snapshot from SPIFFS, no poll has succeeded yet
+};
+
 struct TeamLine {
-  String abbr;
+  Teams::TeamId id = Teams::kNone;  // code and logo URL live in the Teams table
   String name;
-  String logoUrl;
   int score = 0;
   int sog = -1;
   int hits = -1;
@@ -43,7 +54,7 @@ static const uint8_t kMaxStandingsGroups = 3;
 static const uint8_t kMaxStandingsRows = 6;
 
 struct StandingsRow {
-  String abbr;
+  Teams::TeamId team = Teams::kNone;
   uint8_t gp = 0;
   uint8_t w = 0;
   uint8_t otw = 0;
@@ -110,16 +121,13 @@ struct GameState {
 
   uint32_t lastGoalEventId = 0;
   bool focusJustScored = false;
-  String goalTeamAbbr;
-  String goalTeamLogoUrl;
+  Teams::TeamId goalTeam = Teams::kNone;
   String goalScorer;
   String goalText;
 
   // Next game fallback.
   bool hasNextGame = false;
-  String nextOppAbbr;
-  String nextOppLogoUrl;
-  String nextFocusLogoUrl;
+  Teams::TeamId nextOpp = Teams::kNone;
   bool nextIsHome = false;
   String nextVenue;
   String nextCity;
@@ -131,6 +139,7 @@ struct GameState {
   bool dataStale = false;
   bool wifiConnected = false;
   uint32_t lastGoodFetchMs = 0;
+  StaleReason staleReason = StaleReason::NONE;
 
   // Last game recap.
   LastGameRecap last;
@@ -2,9 +2,15 @@
 #include "palette.h"
 #include "assets.h"
 #include "config.h"
+#include "glyph_atlas.h"
 
 #include <time.h>
 
+// Log the regions and bytes each screen update pushed to the panel.
+#ifndef UI_FRAME_LOG
+#define UI_FRAME_LOG 0
+#endif
+
 static inline void drawCentered(TFT_eSPI &tft,
                                 const String &s,
                                 int x,
@@ -56,26 +62,23 @@ static Layout layoutFor(TFT_eSPI &tft) {
   return l;
 }
 
-static void drawHeaderBar(TFT_eSPI &tft,
-                          int16_t x,
-                          int16_t y,
-                          int16_t w,
-                          int16_t h,
-                          const String &label,
-                          uint16_t fg,
-                          uint16_t bg,
-                          bool showDot,
-                          uint16_t dotCol) {
-  tft.fillRect(x, y, w, h, bg);
+static void headerBar(DisplayList &dl,
+                      int16_t x,
+                      int16_t y,
+                      int16_t w,
+                      int16_t h,
+                      const String &label,
+                      uint16_t fg,
+                      uint16_t bg,
+                      bool showDot,
+                      uint16_t dotCol) {
+  dl.fillRect(x, y, w, h, bg);
   if (showDot) {
     const int16_t dotX = (int16_t)(x + 10);
     const int16_t dotY = (int16_t)(y + h / 2);
-    tft.fillCircle(dotX, dotY, 4, dotCol);
+    dl.fillCircle(dotX, dotY, 4, dotCol);
   }
-  tft.setTextDatum(MC_DATUM);
-  tft.setTextColor(fg, bg);
-  tft.setTextFont(2);
-  tft.drawString(label, (int16_t)(x + w / 2), (int16_t)(y + h / 2));
+  dl.text(label, (int16_t)(x + w / 2), (int16_t)(y + h / 2), 2, MC_DATUM, fg, bg);
 }
 
 static int16_t pickLogoSize(int16_t panelW, int16_t maxLogo, int16_t padding) {
@@ -90,17 +93,17 @@ static int16_t pickLogoSize(int16_t panelW, int16_t maxLogo, int16_t padding) {
   return (maxLogo < 48) ? maxLogo : 48;
 }
 
-// Forward declaration of drawScoreboardRow
-static void drawScoreboardRow(TFT_eSPI &tft,
-                              const TeamLine &away,
-                              const TeamLine &home,
-                              int16_t panelX,
-                              int16_t panelW,
-                              int16_t rowTop,
-                              int16_t logoSize,
-                              bool showAbbr,
-                              bool showScores,
-                              const String &midLabel);
+// Forward declaration of scoreboardRow
+static void scoreboardRow(DisplayList &dl,
+                          const TeamLine &away,
+                          const TeamLine &home,
+                          int16_t panelX,
+                          int16_t panelW,
+                          int16_t rowTop,
+                          int16_t logoSize,
+                          bool showAbbr,
+                          bool showScores,
+                          const String &midLabel);
 
 static bool timeLooksValid() {
   // If SNTP has not set the clock, time(nullptr) will be close to 0.
@@ -135,7 +138,14 @@ static String fmtLocalClock(time_t epoch) {
   return String(buf);
 }
 
-static String fmtCountdown(int64_t seconds) {
+// Countdown to `startEpoch` into `buf`; "--:--:--" until both the start time
+// and the clock are known.
+static void fmtCountdown(time_t startEpoch, char *buf, size_t len) {
+  if (startEpoch <= 0 || !timeLooksValid()) {
+    snprintf(buf, len, "--:--:--");
+    return;
+  }
+  int64_t seconds = (int64_t)difftime(startEpoch, time(nullptr));
   if (seconds < 0) seconds = 0;
 
   const int64_t days = seconds / 86400;
@@ -145,15 +155,25 @@ static String fmtCountdown(int64_t seconds) {
   const int64_t mins = seconds / 60;
   const int64_t secs = seconds % 60;
 
-  char buf[32];
   if (days > 0) {
     // Dd HH:MM
-    snprintf(buf, sizeof(buf), "%lldd %02lld:%02lld", (long long)days, (long long)hours, (long long)mins);
+    snprintf(buf, len, "%lldd %02lld:%02lld", (long long)days, (long long)hours, (long long)mins);
   } else {
     // HH:MM:SS
-    snprintf(buf, sizeof(buf), "%02lld:%02lld:%02lld", (long long)hours, (long long)mins, (long long)secs);
+    snprintf(buf, len, "%02lld:%02lld:%02lld", (long long)hours, (long long)mins, (long long)secs);
   }
-  return String(buf);
+}
+
+// Within six hours of puck drop the NEXT_GAME screen is retitled.
+static bool isGameDay(time_t startEpoch) {
+  if (startEpoch <= 0 || !timeLooksValid()) return false;
+  const int64_t seconds = (int64_t)difftime(startEpoch, time(nullptr));
+  return seconds >= 0 && seconds <= 6LL * 3600LL;
+}
+
+// A countdown of ten days or more does not fit the large font.
+static uint8_t countdownFontFor(uint8_t font, const char *countdown) {
+  return (strlen(countdown) > 8 && font > 2) ? 2 : font;
 }
 
 static String elideText(const String &s, size_t maxLen) {
@@ -182,10 +202,20 @@ static String fmtStatPair(int away, int home) {
   return a + "-" + h;
 }
 
-static String staleRightLabel(const GameState &g, const String &normal) {
+static String staleLabel(const GameState &g) {
+  if (g.staleReason == StaleReason::RESTORED) return String("CACHED");
   if (!g.wifiConnected) return String("OFFLINE");
-  if (g.dataStale) return String("DATA STALE");
-  return normal;
+  if (!g.dataStale) return String("");
+  switch (g.staleReason) {
+    case StaleReason::SERVICE_DOWN: return String("ESPN DOWN");
+    case StaleReason::BACKING_OFF: return String("RETRYING");
+    default: return String("DATA STALE");
+  }
+}
+
+static String staleRightLabel(const GameState &g, const String &normal) {
+  const String stale = staleLabel(g);
+  return stale.length() ? stale : normal;
 }
 
 void Ui::begin(TFT_eSPI &tft, uint8_t rotation) {
@@ -206,7 +236,9 @@ void Ui::begin(TFT_eSPI &tft, uint8_t rotation) {
   Serial.print("x");
   Serial.println(_tft->height());
 
-  resetCaches();
+  GlyphAtlas::begin(*_tft);
+  _list.invalidate();
+  _countdownOp = -1;
 }
 
 void Ui::setRotation(uint8_t rotation) {
@@ -214,8 +246,8 @@ void Ui::setRotation(uint8_t rotation) {
   _rotation = (uint8_t)(rotation & 3);
   _tft->setRotation(_rotation);
   clearScreenWithRotation(*_tft, _rotation);
-  _hasLastMode = false;
-  resetCaches();
+  _list.invalidate();
+  _countdownOp = -1;
 }
 
 void Ui::setBacklight(uint8_t pct) {
@@ -224,8 +256,11 @@ void Ui::setBacklight(uint8_t pct) {
 
 void Ui::drawBootSplash(const String &line1, const String &line2) {
   if (!_tft) return;
+  // Drawn straight to the panel; the next screen repaints in full.
+  _list.invalidate();
+  _countdownOp = -1;
   clearScreenWithRotation(*_tft, _rotation);
-  drawFrame();
+  _tft->drawRect(0, 0, _tft->width(), _tft->height(), Palette::FRAME);
 
   const int16_t W = _tft->width();
   const int16_t H = _tft->height();
@@ -242,7 +277,7 @@ void Ui::drawBootSplash(const String &line1, const String &line2) {
 
   // Fallback vector splash: Canada flag + Olympic rings.
   _tft->fillRect(0, 0, W, 24, Palette::PANEL_2);
-  drawCentered(*_tft, "CANADIAN MEN'S ICE HOCKEY TEAM", W / 2, 12, 2, Palette::WHITE, Palette::PANEL_2);
+  drawCentered(*_tft, "CANADIAN MEN'S ICE HOCKEY TEAM", W / 2, 12, 2, Palette::WHITE, Palette::PANEL_2);
 
   const int16_t fx = (int16_t)(W / 2 - 66);
   const int16_t fy = 42;
@@ -274,153 +309,123 @@ void Ui::drawBootSplash(const String &line1, const String &line2) {
   }
 }
 
-bool Ui::ensureScreen(ScreenMode mode) {
-  if (!_hasLastMode || _lastMode != mode) {
-    clearScreenWithRotation(*_tft, _rotation);
-    drawFrame();
-    _lastMode = mode;
-    _hasLastMode = true;
-    return true;
-  }
-  return false;
-}
-
-void Ui::resetCaches() {
-  _liveScore.valid = false;
-  _liveStats.valid = false;
-  _liveStatus.valid = false;
-
-  _interScore.valid = false;
-  _interStats.valid = false;
-  _interStatus.valid = false;
-
-  _finalScore.valid = false;
-  _finalStats.valid = false;
-  _finalStatus.valid = false;
-
-  _preScore.valid = false;
-  _preStatus.valid = false;
-  _preInfo.valid = false;
-
-  _lastGameKey = "";
-  _noGameKey = "";
-  _preKey = "";
-  _standingsKey = "";
-  _countdownKey = "";
-  _countdownValue = "";
-  _countdownDate = "";
-  _countdownLocation = "";
+// Every screen starts with a full-screen background region; the panels and
+// cells that change on their own get regions of their own on top of it.
+void Ui::beginFrame(uint16_t bg, bool framed) {
+  _list.clear();
+  _countdownOp = -1;
+  _list.region(0, 0, _tft->width(), _tft->height(), bg);
+  if (framed) _list.drawRect(0, 0, _tft->width(), _tft->height(), Palette::FRAME);
 }
 
-void Ui::drawFrame() {
-  if (!_tft) return;
-  _tft->drawRect(0, 0, _tft->width(), _tft->height(), Palette::FRAME);
+void Ui::present(const char *screen) {
+  _lastFrame = _list.present(*_tft);
+#if UI_FRAME_LOG
+  if (_lastFrame.dirty) {
+    Serial.printf("UI: %s %u/%u regions, %u ops, %lu B\n", screen, (unsigned)_lastFrame.dirty,
+                  (unsigned)_lastFrame.regions, (unsigned)_lastFrame.ops, (unsigned long)_lastFrame.bytes);
+  }
+#else
+  (void)screen;
+#endif
 }
 
-void Ui::framePanel(int16_t x, int16_t y, int16_t w, int16_t h) {
-  _tft->fillRect(x, y, w, h, Palette::PANEL);
-  _tft->drawRect(x, y, w, h, Palette::PANEL_2);
+void Ui::panel(int16_t x, int16_t y, int16_t w, int16_t h) {
+  _list.region(x, y, w, h, Palette::PANEL);
+  _list.drawRect(x, y, w, h, Palette::PANEL_2);
 }
 
-void Ui::drawTopScorePanel(const GameState &g,
-                           const String &label,
-                           bool showScores,
-                           const String &midLabel) {
+void Ui::topScorePanel(const GameState &g,
+                       const String &label,
+                       bool showScores,
+                       const String &midLabel) {
   const Layout l = layoutFor(*_tft);
   const int16_t x = l.margin;
   const int16_t y = l.topY;
   const int16_t w = (int16_t)(l.w - l.margin * 2);
   const int16_t h = l.topH;
 
-  framePanel(x, y, w, h);
+  panel(x, y, w, h);
 
   const int16_t barH = l.landscape ? 20 : 18;
   const bool showDot = (label == "LIVE");
-  drawHeaderBar(*_tft, (int16_t)(x + 1), (int16_t)(y + 1), (int16_t)(w - 2), barH,
-                label, Palette::WHITE, Palette::PANEL_2, showDot, Palette::GOLD);
+  headerBar(_list, (int16_t)(x + 1), (int16_t)(y + 1), (int16_t)(w - 2), barH,
+            label, Palette::WHITE, Palette::PANEL_2, showDot, Palette::GOLD);
 
   const int16_t padding = (w >= 300) ? 6 : 5;
   const int16_t maxLogo = (int16_t)(h - barH - 12);
   const int16_t logoSize = pickLogoSize(w, maxLogo, padding);
   const int16_t rowTop = (int16_t)(y + barH + ((h - barH - logoSize) / 2));
 
-  drawScoreboardRow(*_tft,
-                    g.home,
-                    g.away,
-                    x,
-                    w,
-                    rowTop,
-                    logoSize,
-                    true,
-                    showScores,
-                    midLabel);
+  scoreboardRow(_list,
+                g.home,
+                g.away,
+                x,
+                w,
+                rowTop,
+                logoSize,
+                true,
+                showScores,
+                midLabel);
 }
 
-void Ui::drawStatsBand(const GameState &g) {
+void Ui::statsBand(const GameState &g) {
   const Layout l = layoutFor(*_tft);
   const int16_t x = l.margin;
   const int16_t y = l.statsY;
   const int16_t w = (int16_t)(l.w - l.margin * 2);
   const int16_t h = l.statsH;
 
-  framePanel(x, y, w, h);
+  panel(x, y, w, h);
 
   const int16_t colW = (int16_t)(w / 3);
   const int16_t labelY = (int16_t)(y + 6);
   const int16_t valueY = (int16_t)(y + h / 2 + 6);
 
-  _tft->setTextFont(2);
-  _tft->setTextDatum(MC_DATUM);
-  _tft->setTextColor(Palette::GREY, Palette::PANEL);
-
-  _tft->drawString("SOG", (int16_t)(x + colW / 2), labelY);
-  _tft->drawString("HITS", (int16_t)(x + colW + colW / 2), labelY);
-  _tft->drawString("FO%", (int16_t)(x + 2 * colW + colW / 2), labelY);
+  _list.text("SOG", (int16_t)(x + colW / 2), labelY, 2, MC_DATUM, Palette::GREY, Palette::PANEL);
+  _list.text("HITS", (int16_t)(x + colW + colW / 2), labelY, 2, MC_DATUM, Palette::GREY, Palette::PANEL);
+  _list.text("FO%", (int16_t)(x + 2 * colW + colW / 2), labelY, 2, MC_DATUM, Palette::GREY, Palette::PANEL);
 
-  const int16_t valueFont = (h >= 48) ? 4 : 2;
-  _tft->setTextFont(valueFont);
-  _tft->setTextColor(Palette::WHITE, Palette::PANEL);
-
-  _tft->drawString(fmtStatPair(g.away.sog, g.home.sog), (int16_t)(x + colW / 2), valueY);
-  _tft->drawString(fmtStatPair(g.away.hits, g.home.hits), (int16_t)(x + colW + colW / 2), valueY);
-  _tft->drawString(fmtStatPair(g.away.foPct, g.home.foPct), (int16_t)(x + 2 * colW + colW / 2), valueY);
+  const uint8_t valueFont = (h >= 48) ? 4 : 2;
+  _list.text(fmtStatPair(g.away.sog, g.home.sog), (int16_t)(x + colW / 2), valueY,
+             valueFont, MC_DATUM, Palette::WHITE, Palette::PANEL);
+  _list.text(fmtStatPair(g.away.hits, g.home.hits), (int16_t)(x + colW + colW / 2), valueY,
+             valueFont, MC_DATUM, Palette::WHITE, Palette::PANEL);
+  _list.text(fmtStatPair(g.away.foPct, g.home.foPct), (int16_t)(x + 2 * colW + colW / 2), valueY,
+             valueFont, MC_DATUM, Palette::WHITE, Palette::PANEL);
 }
 
-void Ui::drawStatusBar(const String &left,
-                       const String &right,
-                       uint16_t dotCol,
-                       bool showDot) {
+void Ui::statusBar(const String &left,
+                   const String &right,
+                   uint16_t dotCol,
+                   bool showDot,
+                   bool leftIsClock) {
   const Layout l = layoutFor(*_tft);
   const int16_t x = l.margin;
   const int16_t y = l.statusY;
   const int16_t w = (int16_t)(l.w - l.margin * 2);
   const int16_t h = l.statusH;
 
-  framePanel(x, y, w, h);
+  panel(x, y, w, h);
 
   const int16_t midY = (int16_t)(y + h / 2);
   if (showDot) {
     const int16_t dotX = (int16_t)(x + 10);
-    _tft->fillCircle(dotX, midY, 4, dotCol);
+    _list.fillCircle(dotX, midY, 4, dotCol);
   }
 
-  _tft->setTextColor(Palette::WHITE, Palette::PANEL);
-
-  const int16_t valueFont = (h >= 48) ? 4 : 2;
-  _tft->setTextFont(valueFont);
-  _tft->setTextDatum(ML_DATUM);
-  _tft->drawString(left, (int16_t)(x + 20), midY);
-
-  _tft->setTextFont(2);
-  _tft->setTextDatum(MR_DATUM);
-  _tft->drawString(right, (int16_t)(x + w - 8), midY);
+  const uint8_t valueFont = (h >= 48) ? 4 : 2;
+  if (leftIsClock) {
+    _list.numeric(left, (int16_t)(x + 20), midY, valueFont, ML_DATUM, Palette::WHITE, Palette::PANEL);
+  } else {
+    _list.text(left, (int16_t)(x + 20), midY, valueFont, ML_DATUM, Palette::WHITE, Palette::PANEL);
+  }
+  _list.text(right, (int16_t)(x + w - 8), midY, 2, MR_DATUM, Palette::WHITE, Palette::PANEL);
 }
 
 struct NextGameView {
-  String leftAbbr;
-  String rightAbbr;
-  String leftLogoUrl;
-  String rightLogoUrl;
+  Teams::TeamId left = Teams::kNone;
+  Teams::TeamId right = Teams::kNone;
   time_t startEpoch = 0;
   String venue;
   String city;
@@ -503,26 +508,16 @@ static String buildCanadaGroupSummary(const GameState &g) {
 static bool buildNextGameView(const GameState &g, const String &focusTeamAbbr, NextGameView &out) {
   out.groupSummary = buildCanadaGroupSummary(g);
 
-  if (g.hasNextGame && g.nextOppAbbr.length()) {
-    if (g.nextIsHome) {
-      out.leftAbbr = focusTeamAbbr;
-      out.rightAbbr = g.nextOppAbbr;
-      out.leftLogoUrl = g.nextFocusLogoUrl;
-      out.rightLogoUrl = g.nextOppLogoUrl;
-    } else {
-      out.leftAbbr = g.nextOppAbbr;
-      out.rightAbbr = focusTeamAbbr;
-      out.leftLogoUrl = g.nextOppLogoUrl;
-      out.rightLogoUrl = g.nextFocusLogoUrl;
-    }
+  if (g.hasNextGame && g.nextOpp != Teams::kNone) {
+    const Teams::TeamId focus = Teams::intern(focusTeamAbbr);
+    out.left = g.nextIsHome ? focus : g.nextOpp;
+    out.right = g.nextIsHome ? g.nextOpp : focus;
     out.startEpoch = g.nextStartEpoch;
     out.venue = g.nextVenue;
     out.city = g.nextCity;
-  } else if (g.hasGame && g.isPre && g.away.abbr.length() && g.home.abbr.length()) {
-    out.leftAbbr = g.home.abbr;
-    out.rightAbbr = g.away.abbr;
-    out.leftLogoUrl = g.home.logoUrl;
-    out.rightLogoUrl = g.away.logoUrl;
+  } else if (g.hasGame && g.isPre && g.away.id != Teams::kNone && g.home.id != Teams::kNone) {
+    out.left = g.home.id;
+    out.right = g.away.id;
     out.startEpoch = (g.nextStartEpoch > 0) ? g.nextStartEpoch : g.startEpoch;
     out.venue = g.nextVenue.length() ? g.nextVenue : g.statusDetail;
     out.city = g.nextCity;
@@ -530,79 +525,55 @@ static bool buildNextGameView(const GameState &g, const String &focusTeamAbbr, N
     return false;
   }
 
-  out.gameDay = false;
-  if (out.startEpoch > 0 && timeLooksValid()) {
-    const int64_t seconds = (int64_t)difftime(out.startEpoch, time(nullptr));
-    out.gameDay = (seconds >= 0 && seconds <= 6LL * 3600LL);
-  }
-
+  out.gameDay = isGameDay(out.startEpoch);
   return true;
 }
 
-static void drawCountdownScreen(TFT_eSPI &tft,
-                                const Layout &l,
-                                const NextGameView &view,
-                                const GameState &g,
-                                bool fullRedraw,
-                                const char *title,
-                                const char *subtitle,
-                                const char *dateLabel,
-                                String *countdownCache,
-                                String *dateCache,
-                                String *locationCache) {
+// Team row, titles and logos sit in the background region; the stale badge,
+// countdown, info lines and group table are regions of their own, so a change
+// to the countdown repaints only the countdown box. Returns the countdown's
+// text op, for Ui::tickCountdown().
+static int16_t countdownScreen(DisplayList &dl,
+                               const Layout &l,
+                               const NextGameView &view,
+                               const GameState &g,
+                               const char *countdown,
+                               const char *title,
+                               const char *subtitle,
+                               const char *dateLabel) {
   const NextGameLayout ng = nextGameLayoutFor(l);
 
-  tft.setTextDatum(MC_DATUM);
-
-  if (fullRedraw) {
-    String subtitleLine = subtitle ? String(subtitle) : String("");
-    if (view.gameDay) subtitleLine = "GAME DAY | MEN'S TOURNAMENT";
-    if (subtitleLine.length()) {
-      tft.setTextColor(Palette::GREY, Palette::BG);
-      tft.setTextFont(2);
-      tft.drawString(subtitleLine, (int16_t)(l.w / 2), ng.seasonY);
-    }
-
-    tft.setTextColor(Palette::WHITE, Palette::BG);
-    tft.setTextFont(4);
-    tft.drawString(title ? title : "NEXT GAME", (int16_t)(l.w / 2), ng.titleY);
+  String subtitleLine = subtitle ? String(subtitle) : String("");
+  if (view.gameDay) subtitleLine = "GAME DAY | MEN'S TOURNAMENT";
+  dl.text(subtitleLine, (int16_t)(l.w / 2), ng.seasonY, 2, MC_DATUM, Palette::GREY, Palette::BG);
+  dl.text(title ? title : "NEXT GAME", (int16_t)(l.w / 2), ng.titleY, 4, MC_DATUM, Palette::WHITE, Palette::BG);
 
-    if (view.leftAbbr.length()) {
-      Assets::drawLogo(tft, view.leftAbbr, view.leftLogoUrl, ng.leftLogoX, ng.rowY, ng.logoSize);
-    }
-    if (view.rightAbbr.length()) {
-      Assets::drawLogo(tft, view.rightAbbr, view.rightLogoUrl, ng.rightLogoX, ng.rowY, ng.logoSize);
-    }
-
-    tft.setTextColor(Palette::GREY, Palette::BG);
-    tft.setTextFont(2);
-    if (view.leftAbbr.length()) {
-      tft.drawString(view.leftAbbr, (int16_t)(ng.leftLogoX + ng.logoSize / 2), ng.abbrY);
-    }
-    if (view.rightAbbr.length()) {
-      tft.drawString(view.rightAbbr, (int16_t)(ng.rightLogoX + ng.logoSize / 2), ng.abbrY);
-    }
+  dl.logo(view.left, ng.leftLogoX, ng.rowY, ng.logoSize);
+  dl.logo(view.right, ng.rightLogoX, ng.rowY, ng.logoSize);
+  if (view.left != Teams::kNone) {
+    dl.text(Teams::code(view.left), (int16_t)(ng.leftLogoX + ng.logoSize / 2), ng.abbrY,
+            2, MC_DATUM, Palette::GREY, Palette::BG);
+  }
+  if (view.right != Teams::kNone) {
+    dl.text(Teams::code(view.right), (int16_t)(ng.rightLogoX + ng.logoSize / 2), ng.abbrY,
+            2, MC_DATUM, Palette::GREY, Palette::BG);
   }
 
-  const String staleLabel = !g.wifiConnected ? String("OFFLINE") : (g.dataStale ? String("DATA STALE") : String(""));
   const int16_t badgeW = (l.w >= 300) ? 110 : 92;
   const int16_t badgeH = 16;
   const int16_t badgeX = (int16_t)(l.w - l.margin - badgeW);
   const int16_t badgeY = (int16_t)(l.margin + 2);
-  tft.fillRect(badgeX, badgeY, badgeW, badgeH, Palette::BG);
-  if (staleLabel.length()) {
-    tft.setTextDatum(MR_DATUM);
-    tft.setTextFont(2);
-    tft.setTextColor(Palette::GREY, Palette::BG);
-    tft.drawString(staleLabel, (int16_t)(l.w - l.margin - 2), (int16_t)(badgeY + badgeH / 2));
-    tft.setTextDatum(MC_DATUM);
-  }
+  dl.region(badgeX, badgeY, badgeW, badgeH, Palette::BG);
+  dl.text(staleLabel(g), (int16_t)(l.w - l.margin - 2), (int16_t)(badgeY + badgeH / 2),
+          2, MR_DATUM, Palette::GREY, Palette::BG);
 
-  String countdown = "--:--:--";
-  if (view.startEpoch > 0 && timeLooksValid()) {
-    const int64_t seconds = (int64_t)difftime(view.startEpoch, time(nullptr));
-    countdown = fmtCountdown(seconds);
+  if (ng.centerW > 0) {
+    dl.region(ng.centerLeft, (int16_t)(ng.countdownY - ng.countdownBoxH / 2), ng.centerW, ng.countdownBoxH,
+              Palette::BG);
   }
+  const int16_t countdownOp = dl.numeric(countdown, (int16_t)(l.w / 2), ng.countdownY,
+                                         countdownFontFor((uint8_t)ng.countdownFont, countdown), MC_DATUM,
+                                         Palette::WHITE, Palette::BG);
 
   String dateLine = String(dateLabel && dateLabel[0] ? dateLabel : "GAME DATE");
   dateLine += ": ";
@@ -632,79 +603,47 @@ static void drawCountdownScreen(TFT_eSPI &tft,
   const size_t maxLocLen = (l.w >= 300) ? 28 : 24;
   locationLine = elideText(locationLine, maxLocLen);
 
-  bool infoChanged = fullRedraw;
-  if (dateCache && *dateCache != dateLine) infoChanged = true;
-  if (locationCache && *locationCache != locationLine) infoChanged = true;
-
-  if (infoChanged) {
-    tft.fillRect(l.margin, ng.infoTop, (int16_t)(l.w - l.margin * 2), ng.infoH, Palette::BG);
-    tft.setTextFont(2);
-    tft.setTextColor(Palette::WHITE, Palette::BG);
-    tft.drawString(dateLine, (int16_t)(l.w / 2), ng.infoY1);
-    tft.setTextColor(Palette::GREY, Palette::BG);
-    tft.drawString(locationLine, (int16_t)(l.w / 2), ng.infoY2);
-    if (dateCache) *dateCache = dateLine;
-    if (locationCache) *locationCache = locationLine;
-  }
+  dl.region(l.margin, ng.infoTop, (int16_t)(l.w - l.margin * 2), ng.infoH, Palette::BG);
+  dl.text(dateLine, (int16_t)(l.w / 2), ng.infoY1, 2, MC_DATUM, Palette::WHITE, Palette::BG);
+  dl.text(locationLine, (int16_t)(l.w / 2), ng.infoY2, 2, MC_DATUM, Palette::GREY, Palette::BG);
 
-  if (fullRedraw || infoChanged) {
-    const bool canFitMiniTable = (l.h >= 270);
-    if (canFitMiniTable && g.standings.canadaGroup != '?') {
-      tft.fillRect(l.margin, (int16_t)(l.h - 62), (int16_t)(l.w - l.margin * 2), 58, Palette::BG);
-
-      const GroupStandings *group = nullptr;
-      for (uint8_t gi = 0; gi < g.standings.groupCount; ++gi) {
-        if (g.standings.groups[gi].group == g.standings.canadaGroup) {
-          group = &g.standings.groups[gi];
-          break;
-        }
-      }
+  const bool canFitMiniTable = (l.h >= 270);
+  if (canFitMiniTable && g.standings.canadaGroup != '?') {
+    dl.region(l.margin, (int16_t)(l.h - 62), (int16_t)(l.w - l.margin * 2), 58, Palette::BG);
 
-      if (group) {
-        tft.setTextFont(1);
-        tft.setTextColor(Palette::GREY, Palette::BG);
-        String gLabel = "GROUP ";
-        gLabel += group->group;
-        tft.drawString(gLabel, (int16_t)(l.w / 2), (int16_t)(l.h - 56));
-        tft.drawString("TM W OTW OTL L PTS", (int16_t)(l.w / 2), (int16_t)(l.h - 46));
-
-        const uint8_t rows = (group->rowCount < 4) ? group->rowCount : 4;
-        for (uint8_t r = 0; r < rows; ++r) {
-          const StandingsRow &row = group->rows[r];
-          String line = row.abbr + " " + String(row.w) + " " + String(row.otw) + " " +
-                        String(row.otl) + " " + String(row.l) + " " + String(row.pts);
-          const int16_t y = (int16_t)(l.h - 35 + r * 10);
-          tft.setTextColor((row.abbr == FOCUS_TEAM_ABBR) ? Palette::WHITE : Palette::GREY, Palette::BG);
-          tft.drawString(line, (int16_t)(l.w / 2), y);
-        }
-      }
-    } else {
-      tft.fillRect(l.margin, (int16_t)(l.h - 18), (int16_t)(l.w - l.margin * 2), 14, Palette::BG);
-      if (view.groupSummary.length()) {
-        tft.setTextFont(2);
-        tft.setTextColor(Palette::GREY, Palette::BG);
-        tft.drawString(elideText(view.groupSummary, (l.w >= 300) ? 30 : 24), (int16_t)(l.w / 2), (int16_t)(l.h - 10));
+    const GroupStandings *group = nullptr;
+    for (uint8_t gi = 0; gi < g.standings.groupCount; ++gi) {
+      if (g.standings.groups[gi].group == g.standings.canadaGroup) {
+        group = &g.standings.groups[gi];
+        break;
       }
     }
-  }
 
-  if (!countdownCache || *countdownCache != countdown) {
-    if (ng.centerW > 0) {
-      tft.fillRect(ng.centerLeft,
-                   (int16_t)(ng.countdownY - ng.countdownBoxH / 2),
-                   ng.centerW,
-                   ng.countdownBoxH,
-                   Palette::BG);
+    if (group) {
+      String gLabel = "GROUP ";
+      gLabel += group->group;
+      dl.text(gLabel, (int16_t)(l.w / 2), (int16_t)(l.h - 56), 1, MC_DATUM, Palette::GREY, Palette::BG);
+      dl.text("TM W OTW OTL L PTS", (int16_t)(l.w / 2), (int16_t)(l.h - 46), 1, MC_DATUM, Palette::GREY, Palette::BG);
+
+      const Teams::TeamId focus = Teams::intern(FOCUS_TEAM_ABBR);
+      const uint8_t rows = (group->rowCount < 4) ? group->rowCount : 4;
+      for (uint8_t r = 0; r < rows; ++r) {
+        const StandingsRow &row = group->rows[r];
+        String line = String(Teams::code(row.team)) + " " + String(row.w) + " " + String(row.otw) + " " +
+                      String(row.otl) + " " + String(row.l) + " " + String(row.pts);
+        const int16_t y = (int16_t)(l.h - 35 + r * 10);
+        dl.text(line, (int16_t)(l.w / 2), y, 1, MC_DATUM, (row.team == focus) ? Palette::WHITE : Palette::GREY,
+                Palette::BG);
+      }
     }
-    tft.setTextColor(Palette::WHITE, Palette::BG);
-    int16_t countdownFont = ng.countdownFont;
-    if (countdown.length() > 8 && countdownFont > 2) {
-      countdownFont = 2;
+  } else {
+    dl.region(l.margin, (int16_t)(l.h - 18), (int16_t)(l.w - l.margin * 2), 14, Palette::BG);
+    if (view.groupSummary.length()) {
+      dl.text(elideText(view.groupSummary, (l.w >= 300) ? 30 : 24), (int16_t)(l.w / 2), (int16_t)(l.h - 10),
+              2, MC_DATUM, Palette::GREY, Palette::BG);
     }
-    tft.setTextFont(countdownFont);
-    tft.drawString(countdown, (int16_t)(l.w / 2), ng.countdownY);
-    if (countdownCache) *countdownCache = countdown;
   }
+  return countdownOp;
 }
 
 // -----------------------------------------------------------------------------
@@ -712,42 +651,52 @@ static void drawCountdownScreen(TFT_eSPI &tft,
 // -----------------------------------------------------------------------------
 
 void Ui::drawNextGame(const GameState &g, const String &focusTeamAbbr) {
-  const bool modeChanged = ensureScreen(ScreenMode::NEXT_GAME);
   NextGameView view;
   const bool hasNext = buildNextGameView(g, focusTeamAbbr, view);
-  const String key = hasNext ? (view.leftAbbr + "|" + view.rightAbbr) : String("NONE");
-  bool fullRedraw = modeChanged;
-  if (key != _noGameKey) {
-    _noGameKey = key;
-    fullRedraw = true;
-  }
-  if (fullRedraw && !modeChanged) {
-    clearScreenWithRotation(*_tft, _rotation);
-    drawFrame();
-  }
-
   const Layout l = layoutFor(*_tft);
 
+  beginFrame(Palette::BG, true);
   if (hasNext) {
-    if (_countdownKey != key) {
-      _countdownKey = key;
-      _countdownValue = "";
-      _countdownDate = "";
-      _countdownLocation = "";
-      fullRedraw = true;
-    }
-    drawCountdownScreen(*_tft, l, view, g, fullRedraw, "NEXT CANADA GAME", "2026 OLYMPICS | MEN'S TOURNAMENT", "PUCK DROP",
-                        &_countdownValue, &_countdownDate, &_countdownLocation);
-  } else if (fullRedraw) {
+    fmtCountdown(view.startEpoch, _countdownText, sizeof(_countdownText));
+    _countdownOp = countdownScreen(_list, l, view, g, _countdownText, "NEXT CANADA GAME",
+                                   "2026 OLYMPICS | MEN'S TOURNAMENT", "PUCK DROP");
+    _countdownStart = view.startEpoch;
+    _countdownGameDay = view.gameDay;
+    _countdownFont = (uint8_t)nextGameLayoutFor(l).countdownFont;
+  } else {
     const int16_t panelX2 = l.margin;
     const int16_t panelW2 = (int16_t)(l.w - l.margin * 2);
-    framePanel(panelX2, l.topY, panelW2, l.topH);
-    drawCentered(*_tft, "NO CANADA GAME", l.w / 2, (int16_t)(l.topY + l.topH / 2 - 10), 4, Palette::WHITE, Palette::PANEL);
-    drawCentered(*_tft, "CHECKING MEN'S FEED", l.w / 2, (int16_t)(l.topY + l.topH / 2 + 18), 2, Palette::GREY, Palette::PANEL);
-    framePanel(panelX2, l.statsY, panelW2, l.statsH);
-    drawCentered(*_tft, "CONNECTING...", l.w / 2, (int16_t)(l.statsY + l.statsH / 2), 2, Palette::WHITE, Palette::PANEL);
-    framePanel(panelX2, l.statusY, panelW2, l.statusH);
+    panel(panelX2, l.topY, panelW2, l.topH);
+    _list.text("NO CANADA GAME", l.w / 2, (int16_t)(l.topY + l.topH / 2 - 10), 4, MC_DATUM, Palette::WHITE, Palette::PANEL);
+    _list.text("CHECKING MEN'S FEED", l.w / 2, (int16_t)(l.topY + l.topH / 2 + 18), 2, MC_DATUM, Palette::GREY, Palette::PANEL);
+    panel(panelX2, l.statsY, panelW2, l.statsH);
+    _list.text("CONNECTING...", l.w / 2, (int16_t)(l.statsY + l.statsH / 2), 2, MC_DATUM, Palette::WHITE, Palette::PANEL);
+    panel(panelX2, l.statusY, panelW2, l.statusH);
+  }
+  present("NEXT_GAME");
+}
+
+bool Ui::tickCountdown() {
+  if (_countdownOp < 0) return false;
+  char text[sizeof(_countdownText)];
+  fmtCountdown(_countdownStart, text, sizeof(text));
+  if (strcmp(text, _countdownText) == 0) return true;
+  // Game day retitles the screen and a long countdown changes font; both
+  // need the whole screen described again.
+  if (isGameDay(_countdownStart) != _countdownGameDay ||
+      countdownFontFor(_countdownFont, text) != countdownFontFor(_countdownFont, _countdownText)) {
+    return false;
   }
+
+  uint32_t bytes = 0;
+  if (!_list.patchText(*_tft, _countdownOp, text, bytes)) return false;
+  memcpy(_countdownText, text, sizeof(text));
+#if UI_FRAME_LOG
+  Serial.printf("UI: countdown %s, %lu B\n", text, (unsigned long)bytes);
+#else
+  (void)bytes;
+#endif
+  return true;
 }
 
 // -----------------------------------------------------------------------------
@@ -778,27 +727,21 @@ static String buildPeriodLine(const LastGameRecap &recap, int16_t w) {
 }
 
 void Ui::drawLastGame(const GameState &g) {
-  const bool modeChanged = ensureScreen(ScreenMode::LAST_GAME);
-  const String key = g.last.hasGame ? g.last.gameId : String("NONE");
-  bool fullRedraw = modeChanged || key != _lastGameKey;
-  if (fullRedraw && !modeChanged) {
-    clearScreenWithRotation(*_tft, _rotation);
-    drawFrame();
-  }
-  _lastGameKey = key;
-
   const Layout l = layoutFor(*_tft);
   const int16_t x = l.margin;
   const int16_t w = (int16_t)(l.w - l.margin * 2);
 
+  beginFrame(Palette::BG, true);
+
   // Top score panel
-  framePanel(x, l.topY, w, l.topH);
+  panel(x, l.topY, w, l.topH);
   const int16_t barH = l.landscape ? 20 : 18;
-  drawHeaderBar(*_tft, (int16_t)(x + 1), (int16_t)(l.topY + 1), (int16_t)(w - 2), barH,
-                "LAST GAME", Palette::WHITE, Palette::PANEL_2, false, Palette::GOLD);
+  headerBar(_list, (int16_t)(x + 1), (int16_t)(l.topY + 1), (int16_t)(w - 2), barH,
+            "LAST GAME", Palette::WHITE, Palette::PANEL_2, false, Palette::GOLD);
 
   if (!g.last.hasGame) {
-    drawCentered(*_tft, "NO RECENT GAME", l.w / 2, (int16_t)(l.topY + l.topH / 2), 4, Palette::WHITE, Palette::PANEL);
+    _list.text("NO RECENT GAME", l.w / 2, (int16_t)(l.topY + l.topH / 2), 4, MC_DATUM, Palette::WHITE, Palette::PANEL);
+    present("LAST_GAME");
     return;
   }
 
@@ -807,24 +750,21 @@ void Ui::drawLastGame(const GameState &g) {
   const int16_t logoSize = pickLogoSize(w, maxLogo, padding);
   const int16_t rowTop = (int16_t)(l.topY + barH + ((l.topH - barH - logoSize) / 2));
 
-  // drawScoreboardRow expects left=away; pass home first so home is on the left.
-  drawScoreboardRow(*_tft,
-                    g.last.home,
-                    g.last.away,
-                    x,
-                    w,
-                    rowTop,
-                    logoSize,
-                    true,
-                    true,
-                    "-");
+  // scoreboardRow expects left=away; pass home first so home is on the left.
+  scoreboardRow(_list,
+                g.last.home,
+                g.last.away,
+                x,
+                w,
+                rowTop,
+                logoSize,
+                true,
+                true,
+                "-");
 
   // Scorers panel
-  framePanel(x, l.statsY, w, l.statsH);
-  _tft->setTextDatum(MC_DATUM);
-  _tft->setTextFont(2);
-  _tft->setTextColor(Palette::GREY, Palette::PANEL);
-  _tft->drawString("SCORERS", l.w / 2, (int16_t)(l.statsY + 8));
+  panel(x, l.statsY, w, l.statsH);
+  _list.text("SCORERS", l.w / 2, (int16_t)(l.statsY + 8), 2, MC_DATUM, Palette::GREY, Palette::PANEL);
 
   const int16_t colPad = 10;
   const int16_t leftX = (int16_t)(x + colPad);
@@ -836,10 +776,7 @@ void Ui::drawLastGame(const GameState &g) {
   const int16_t lineH = (maxLines > 0) ? (int16_t)(listH / maxLines) : 16;
   const int16_t startY = (int16_t)(listTop + lineH / 2);
   const int16_t colW = (int16_t)(w / 2 - colPad * 2);
-  const int scorerFont = (lineH < 16) ? 1 : 2;
-
-  _tft->setTextColor(Palette::WHITE, Palette::PANEL);
-  _tft->setTextFont(scorerFont);
+  const uint8_t scorerFont = (lineH < 16) ? 1 : 2;
 
   for (uint8_t i = 0; i < maxLines; ++i) {
     String leftLine = "-";
@@ -849,19 +786,15 @@ void Ui::drawLastGame(const GameState &g) {
     if (i < g.last.awayScorerCount) rightLine = formatScorer(g.last.awayScorers[i]);
     rightLine = elideToWidth(*_tft, rightLine, colW, scorerFont);
     const int16_t y = (int16_t)(startY + i * lineH);
-    _tft->setTextDatum(ML_DATUM);
-    _tft->drawString(leftLine, leftX, y);
-    _tft->setTextDatum(MR_DATUM);
-    _tft->drawString(rightLine, rightX, y);
+    _list.text(leftLine, leftX, y, scorerFont, ML_DATUM, Palette::WHITE, Palette::PANEL);
+    _list.text(rightLine, rightX, y, scorerFont, MR_DATUM, Palette::WHITE, Palette::PANEL);
   }
-  _tft->setTextDatum(MC_DATUM);
 
   // Period stats panel
-  framePanel(x, l.statusY, w, l.statusH);
+  panel(x, l.statusY, w, l.statusH);
   String periodLine = buildPeriodLine(g.last, l.w);
-  _tft->setTextColor(Palette::WHITE, Palette::PANEL);
-  _tft->setTextFont(2);
-  _tft->drawString(periodLine, l.w / 2, (int16_t)(l.statusY + l.statusH / 2));
+  _list.text(periodLine, l.w / 2, (int16_t)(l.statusY + l.statusH / 2), 2, MC_DATUM, Palette::WHITE, Palette::PANEL);
+  present("LAST_GAME");
 }
 
 // -----------------------------------------------------------------------------
@@ -877,39 +810,9 @@ void Ui::drawPregame(const GameState &g, const String &focusTeamAbbr) {
 }
 
 void Ui::drawLive(const GameState &g) {
-  const bool modeChanged = ensureScreen(ScreenMode::LIVE);
-
-  bool scoreChanged = modeChanged || !_liveScore.valid
-    || _liveScore.homeAbbr != g.home.abbr
-    || _liveScore.awayAbbr != g.away.abbr
-    || _liveScore.homeScore != g.home.score
-    || _liveScore.awayScore != g.away.score;
-  if (scoreChanged) {
-    drawTopScorePanel(g, "LIVE", true, "-");
-    _liveScore.valid = true;
-    _liveScore.homeAbbr = g.home.abbr;
-    _liveScore.awayAbbr = g.away.abbr;
-    _liveScore.homeScore = g.home.score;
-    _liveScore.awayScore = g.away.score;
-  }
-
-  bool statsChanged = modeChanged || !_liveStats.valid
-    || _liveStats.homeSog != g.home.sog
-    || _liveStats.awaySog != g.away.sog
-    || _liveStats.homeHits != g.home.hits
-    || _liveStats.awayHits != g.away.hits
-    || _liveStats.homeFo != g.home.foPct
-    || _liveStats.awayFo != g.away.foPct;
-  if (statsChanged) {
-    drawStatsBand(g);
-    _liveStats.valid = true;
-    _liveStats.homeSog = g.home.sog;
-    _liveStats.awaySog = g.away.sog;
-    _liveStats.homeHits = g.home.hits;
-    _liveStats.awayHits = g.away.hits;
-    _liveStats.homeFo = g.home.foPct;
-    _liveStats.awayFo = g.away.foPct;
-  }
+  beginFrame(Palette::BG, true);
+  topScorePanel(g, "LIVE", true, "-");
+  statsBand(g);
 
   String clockLine = g.clock.length() ? g.clock : String("IN PLAY");
   if (g.period > 0) {
@@ -918,177 +821,66 @@ void Ui::drawLive(const GameState &g) {
   }
   String strength = g.strengthLabel.length() ? g.strengthLabel : String("EVEN STRENGTH");
   strength = staleRightLabel(g, strength);
-
-  const bool statusChanged = modeChanged || !_liveStatus.valid
-    || _liveStatus.left != clockLine
-    || _liveStatus.right != strength
-    || _liveStatus.showDot != true
-    || _liveStatus.dotCol != Palette::STATUS_PK;
-  if (statusChanged) {
-    drawStatusBar(clockLine, strength, Palette::STATUS_PK, true);
-    _liveStatus.valid = true;
-    _liveStatus.left = clockLine;
-    _liveStatus.right = strength;
-    _liveStatus.dotCol = Palette::STATUS_PK;
-    _liveStatus.showDot = true;
-  }
+  statusBar(clockLine, strength, Palette::STATUS_PK, true, true);
+  present("LIVE");
 }
 
 void Ui::drawIntermission(const GameState &g) {
-  const bool modeChanged = ensureScreen(ScreenMode::INTERMISSION);
-
-  bool scoreChanged = modeChanged || !_interScore.valid
-    || _interScore.homeAbbr != g.home.abbr
-    || _interScore.awayAbbr != g.away.abbr
-    || _interScore.homeScore != g.home.score
-    || _interScore.awayScore != g.away.score;
-  if (scoreChanged) {
-    drawTopScorePanel(g, "INTERMISSION", true, "-");
-    _interScore.valid = true;
-    _interScore.homeAbbr = g.home.abbr;
-    _interScore.awayAbbr = g.away.abbr;
-    _interScore.homeScore = g.home.score;
-    _interScore.awayScore = g.away.score;
-  }
-
-  bool statsChanged = modeChanged || !_interStats.valid
-    || _interStats.homeSog != g.home.sog
-    || _interStats.awaySog != g.away.sog
-    || _interStats.homeHits != g.home.hits
-    || _interStats.awayHits != g.away.hits
-    || _interStats.homeFo != g.home.foPct
-    || _interStats.awayFo != g.away.foPct;
-  if (statsChanged) {
-    drawStatsBand(g);
-    _interStats.valid = true;
-    _interStats.homeSog = g.home.sog;
-    _interStats.awaySog = g.away.sog;
-    _interStats.homeHits = g.home.hits;
-    _interStats.awayHits = g.away.hits;
-    _interStats.homeFo = g.home.foPct;
-    _interStats.awayFo = g.away.foPct;
-  }
+  beginFrame(Palette::BG, true);
+  topScorePanel(g, "INTERMISSION", true, "-");
+  statsBand(g);
 
   String left = "INTERMISSION";
   if (g.period > 0) {
     left = "END P";
     left += String(g.period);
   }
-  String right = staleRightLabel(g, "BREAK");
-
-  const bool statusChanged = modeChanged || !_interStatus.valid
-    || _interStatus.left != left
-    || _interStatus.right != right
-    || _interStatus.showDot != false
-    || _interStatus.dotCol != Palette::STATUS_EVEN;
-  if (statusChanged) {
-    drawStatusBar(left, right, Palette::STATUS_EVEN, false);
-    _interStatus.valid = true;
-    _interStatus.left = left;
-    _interStatus.right = right;
-    _interStatus.dotCol = Palette::STATUS_EVEN;
-    _interStatus.showDot = false;
-  }
+  statusBar(left, staleRightLabel(g, "BREAK"), Palette::STATUS_EVEN, false);
+  present("INTERMISSION");
 }
 
 void Ui::drawFinal(const GameState &g) {
-  const bool modeChanged = ensureScreen(ScreenMode::FINAL);
-
-  bool scoreChanged = modeChanged || !_finalScore.valid
-    || _finalScore.homeAbbr != g.home.abbr
-    || _finalScore.awayAbbr != g.away.abbr
-    || _finalScore.homeScore != g.home.score
-    || _finalScore.awayScore != g.away.score;
-  if (scoreChanged) {
-    drawTopScorePanel(g, "FINAL", true, "-");
-    _finalScore.valid = true;
-    _finalScore.homeAbbr = g.home.abbr;
-    _finalScore.awayAbbr = g.away.abbr;
-    _finalScore.homeScore = g.home.score;
-    _finalScore.awayScore = g.away.score;
-  }
-
-  bool statsChanged = modeChanged || !_finalStats.valid
-    || _finalStats.homeSog != g.home.sog
-    || _finalStats.awaySog != g.away.sog
-    || _finalStats.homeHits != g.home.hits
-    || _finalStats.awayHits != g.away.hits
-    || _finalStats.homeFo != g.home.foPct
-    || _finalStats.awayFo != g.away.foPct;
-  if (statsChanged) {
-    drawStatsBand(g);
-    _finalStats.valid = true;
-    _finalStats.homeSog = g.home.sog;
-    _finalStats.awaySog = g.away.sog;
-    _finalStats.homeHits = g.home.hits;
-    _finalStats.awayHits = g.away.hits;
-    _finalStats.homeFo = g.home.foPct;
-    _finalStats.awayFo = g.away.foPct;
-  }
-
-  String right = staleRightLabel(g, "FULL TIME");
-  const bool statusChanged = modeChanged || !_finalStatus.valid
-    || _finalStatus.left != "FINAL"
-    || _finalStatus.right != right
-    || _finalStatus.showDot != false
-    || _finalStatus.dotCol != Palette::STATUS_EVEN;
-  if (statusChanged) {
-    drawStatusBar("FINAL", right, Palette::STATUS_EVEN, false);
-    _finalStatus.valid = true;
-    _finalStatus.left = "FINAL";
-    _finalStatus.right = right;
-    _finalStatus.dotCol = Palette::STATUS_EVEN;
-    _finalStatus.showDot = false;
-  }
+  beginFrame(Palette::BG, true);
+  topScorePanel(g, "FINAL", true, "-");
+  statsBand(g);
+  statusBar("FINAL", staleRightLabel(g, "FULL TIME"), Palette::STATUS_EVEN, false);
+  present("FINAL");
 }
 
 void Ui::drawGoal(const GameState &g) {
-  ensureScreen(ScreenMode::GOAL);
   const uint16_t bg = g.focusJustScored ? Palette::FOCUS_BLUE : Palette::PANEL_2;
-  _tft->fillScreen(bg);
+  const int16_t w = _tft->width();
+  beginFrame(bg, false);
 
-  drawCentered(*_tft, "GOAL!", _tft->width() / 2, 54, 4, Palette::WHITE, bg);
+  _list.text("GOAL!", w / 2, 54, 4, MC_DATUM, Palette::WHITE, bg);
 
-  if (g.goalTeamAbbr.length()) {
-    const int16_t logoSize = 96;
-    const int16_t logoX = (int16_t)(_tft->width() / 2 - logoSize / 2);
-    const int16_t logoY = 78;
-    Assets::drawLogo(*_tft, g.goalTeamAbbr, g.goalTeamLogoUrl, logoX, logoY, logoSize);
-  }
+  const int16_t logoSize = 96;
+  _list.logo(g.goalTeam, (int16_t)(w / 2 - logoSize / 2), 78, logoSize);
 
-  const int16_t textWidth = (int16_t)(_tft->width() - 16);
+  const int16_t textWidth = (int16_t)(w - 16);
   if (g.goalScorer.length()) {
-    String scorerLine = elideToWidth(*_tft, g.goalScorer, textWidth, 2);
-    drawCentered(*_tft, scorerLine, _tft->width() / 2, 186, 2, Palette::WHITE, bg);
+    _list.text(elideToWidth(*_tft, g.goalScorer, textWidth, 2), w / 2, 186, 2, MC_DATUM, Palette::WHITE, bg);
   }
-
   if (g.goalText.length()) {
-    String detailLine = elideToWidth(*_tft, g.goalText, textWidth, 2);
-    drawCentered(*_tft, detailLine, _tft->width() / 2, 206, 2, Palette::WHITE, bg);
+    _list.text(elideToWidth(*_tft, g.goalText, textWidth, 2), w / 2, 206, 2, MC_DATUM, Palette::WHITE, bg);
   }
+  present("GOAL");
 }
 
+// Each group is its own region, so a result only repaints its group's table.
 void Ui::drawStandings(const GameState &g, const String &focusTeamAbbr) {
-  (void)ensureScreen(ScreenMode::STANDINGS);
-  clearScreenWithRotation(*_tft, _rotation);
-  drawFrame();
-
+  const Teams::TeamId focus = Teams::intern(focusTeamAbbr);
   const int16_t w = _tft->width();
   const int16_t h = _tft->height();
 
-  _tft->fillRect(0, 0, w, 22, Palette::PANEL_2);
-  _tft->setTextDatum(MC_DATUM);
-  _tft->setTextColor(Palette::WHITE, Palette::PANEL_2);
-  _tft->setTextFont(2);
-  _tft->drawString("GROUP STANDINGS", w / 2, 11);
+  beginFrame(Palette::BG, true);
+  _list.fillRect(0, 0, w, 22, Palette::PANEL_2);
+  _list.text("GROUP STANDINGS", w / 2, 11, 2, MC_DATUM, Palette::WHITE, Palette::PANEL_2);
 
   if (g.standings.groupCount == 0) {
-    _tft->setTextColor(Palette::WHITE, Palette::BG);
-    _tft->setTextFont(4);
-    _tft->drawString("NO STANDINGS", w / 2, h / 2 - 8);
-    _tft->setTextColor(Palette::GREY, Palette::BG);
-    _tft->setTextFont(2);
-    _tft->drawString("Waiting for completed group games", w / 2, h / 2 + 16);
+    _list.text("NO STANDINGS", w / 2, h / 2 - 8, 4, MC_DATUM, Palette::WHITE, Palette::BG);
+    _list.text("Waiting for completed group games", w / 2, h / 2 + 16, 2, MC_DATUM, Palette::GREY, Palette::BG);
+    present("STANDINGS");
     return;
   }
 
@@ -1101,23 +893,19 @@ void Ui::drawStandings(const GameState &g, const String &focusTeamAbbr) {
     const int16_t y = (int16_t)(top + gi * sectionH);
     const int16_t secH = (gi == g.standings.groupCount - 1) ? (int16_t)(h - y - 1) : sectionH;
 
-    _tft->fillRect(2, y, w - 4, secH - 1, Palette::PANEL);
-    _tft->drawRect(2, y, w - 4, secH - 1, Palette::PANEL_2);
+    _list.region(2, y, w - 4, secH - 1, Palette::PANEL);
+    _list.drawRect(2, y, w - 4, secH - 1, Palette::PANEL_2);
 
-    _tft->setTextColor(Palette::WHITE, Palette::PANEL);
-    _tft->setTextFont(2);
     String title = "GROUP ";
     title += group.group;
-    _tft->drawString(title, 36, (int16_t)(y + 9));
+    _list.text(title, 36, (int16_t)(y + 9), 2, MC_DATUM, Palette::WHITE, Palette::PANEL);
 
-    _tft->setTextColor(Palette::GREY, Palette::PANEL);
-    _tft->setTextFont(1);
-    _tft->drawString("TM", 18, (int16_t)(y + 22));
-    _tft->drawString("W", 92, (int16_t)(y + 22));
-    _tft->drawString("OTW", 124, (int16_t)(y + 22));
-    _tft->drawString("OTL", 164, (int16_t)(y + 22));
-    _tft->drawString("L", 204, (int16_t)(y + 22));
-    _tft->drawString("PTS", 230, (int16_t)(y + 22));
+    _list.text("TM", 18, (int16_t)(y + 22), 1, MC_DATUM, Palette::GREY, Palette::PANEL);
+    _list.text("W", 92, (int16_t)(y + 22), 1, MC_DATUM, Palette::GREY, Palette::PANEL);
+    _list.text("OTW", 124, (int16_t)(y + 22), 1, MC_DATUM, Palette::GREY, Palette::PANEL);
+    _list.text("OTL", 164, (int16_t)(y + 22), 1, MC_DATUM, Palette::GREY, Palette::PANEL);
+    _list.text("L", 204, (int16_t)(y + 22), 1, MC_DATUM, Palette::GREY, Palette::PANEL);
+    _list.text("PTS", 230, (int16_t)(y + 22), 1, MC_DATUM, Palette::GREY, Palette::PANEL);
 
     const uint8_t maxRows = (uint8_t)((secH - 28) / 12);
     const uint8_t rowsToDraw = (group.rowCount < maxRows) ? group.rowCount : maxRows;
@@ -1125,46 +913,45 @@ void Ui::drawStandings(const GameState &g, const String &focusTeamAbbr) {
     for (uint8_t ri = 0; ri < rowsToDraw; ++ri) {
       const StandingsRow &row = group.rows[ri];
       const int16_t ry = (int16_t)(y + 34 + ri * 12);
-      const bool isCanada = (row.abbr == focusTeamAbbr);
+      const bool isCanada = (row.team == focus);
       if (isCanada) {
-        _tft->fillRect(6, (int16_t)(ry - 5), w - 12, 11, Palette::PANEL_2);
+        _list.fillRect(6, (int16_t)(ry - 5), w - 12, 11, Palette::PANEL_2);
       }
 
-      _tft->setTextColor(isCanada ? Palette::WHITE : Palette::GREY, isCanada ? Palette::PANEL_2 : Palette::PANEL);
-      _tft->setTextFont(1);
-      _tft->setTextDatum(ML_DATUM);
-      _tft->drawString(row.abbr, 10, ry);
-      _tft->setTextDatum(MC_DATUM);
-      _tft->drawString(String(row.w), 92, ry);
-      _tft->drawString(String(row.otw), 128, ry);
-      _tft->drawString(String(row.otl), 168, ry);
-      _tft->drawString(String(row.l), 204, ry);
-      _tft->drawString(String(row.pts), 232, ry);
+      const uint16_t fg = isCanada ? Palette::WHITE : Palette::GREY;
+      const uint16_t bg = isCanada ? Palette::PANEL_2 : Palette::PANEL;
+      _list.text(Teams::code(row.team), 10, ry, 1, ML_DATUM, fg, bg);
+      _list.text(String(row.w), 92, ry, 1, MC_DATUM, fg, bg);
+      _list.text(String(row.otw), 128, ry, 1, MC_DATUM, fg, bg);
+      _list.text(String(row.otl), 168, ry, 1, MC_DATUM, fg, bg);
+      _list.text(String(row.l), 204, ry, 1, MC_DATUM, fg, bg);
+      _list.text(String(row.pts), 232, ry, 1, MC_DATUM, fg, bg);
     }
   }
 
+  // Drawn over the last group's panel, so it belongs to that region.
   if (g.standings.usedRegulationFallback) {
-    _tft->setTextDatum(MR_DATUM);
-    _tft->setTextColor(Palette::GREY, Palette::BG);
-    _tft->setTextFont(1);
-    _tft->drawString("* OT/SO inferred fallback", (int16_t)(w - 4), (int16_t)(h - 4));
+    _list.text("* OT/SO inferred fallback", (int16_t)(w - 4), (int16_t)(h - 4), 1, MR_DATUM, Palette::GREY, Palette::BG);
   }
+  present("STANDINGS");
 }
 
 // -----------------------------------------------------------------------------
 // Helpers
 // -----------------------------------------------------------------------------
 
-static void drawScoreboardRow(TFT_eSPI &tft,
-                              const TeamLine &away,
-                              const TeamLine &home,
-                              int16_t panelX,
-                              int16_t panelW,
-                              int16_t rowTop,
-                              int16_t logoSize,
-                              bool showAbbr,
-                              bool showScores,
-                              const String &midLabel) {
+// Emits the logo row into the current region, then one region per score box,
+// so a goal repaints the two numbers rather than the logos.
+static void scoreboardRow(DisplayList &dl,
+                          const TeamLine &away,
+                          const TeamLine &home,
+                          int16_t panelX,
+                          int16_t panelW,
+                          int16_t rowTop,
+                          int16_t logoSize,
+                          bool showAbbr,
+                          bool showScores,
+                          const String &midLabel) {
   const int16_t padding = (panelW >= 300) ? 6 : 5;
   const int16_t logoY = rowTop;
   const int16_t logoYMid = (int16_t)(logoY + logoSize / 2);
@@ -1181,48 +968,33 @@ static void drawScoreboardRow(TFT_eSPI &tft,
   const int16_t scoreY = (int16_t)(logoYMid + 2);
 
   const bool bigScores = (scoreAreaW >= 120);
-  const int16_t scoreFont = bigScores ? 6 : 4;
+  const uint8_t scoreFont = bigScores ? 6 : 4;
   const int16_t scoreBoxW = bigScores ? 56 : 44;
   const int16_t scoreBoxH = bigScores ? 36 : 28;
 
-  tft.fillRect(leftLogoX, logoY, logoSize, logoSize, Palette::BG);
-  tft.fillRect(rightLogoX, logoY, logoSize, logoSize, Palette::BG);
-  if (showScores) {
-    tft.fillRect((int16_t)(leftScoreX - scoreBoxW / 2), (int16_t)(scoreY - scoreBoxH / 2), scoreBoxW, scoreBoxH, Palette::PANEL);
-    tft.fillRect((int16_t)(rightScoreX - scoreBoxW / 2), (int16_t)(scoreY - scoreBoxH / 2), scoreBoxW, scoreBoxH, Palette::PANEL);
-  }
+  dl.fillRect(leftLogoX, logoY, logoSize, logoSize, Palette::BG);
+  dl.fillRect(rightLogoX, logoY, logoSize, logoSize, Palette::BG);
+  dl.logo(away.id, leftLogoX, logoY, logoSize);
+  dl.logo(home.id, rightLogoX, logoY, logoSize);
+
+  String mid = midLabel;
+  if (mid.isEmpty() && showScores) mid = "-";
+  dl.text(mid, dashX, scoreY, bigScores ? 4 : 2, MC_DATUM, Palette::WHITE, Palette::PANEL);
 
   const bool canShowAbbr = showAbbr && (logoSize <= 72);
   if (canShowAbbr) {
     const int16_t abbrY = (int16_t)(logoY + logoSize + 12);
-    tft.fillRect((int16_t)(leftLogoX - 2), (int16_t)(abbrY - 10), (int16_t)(logoSize + 4), 20, Palette::BG);
-    tft.fillRect((int16_t)(rightLogoX - 2), (int16_t)(abbrY - 10), (int16_t)(logoSize + 4), 20, Palette::BG);
+    dl.fillRect((int16_t)(leftLogoX - 2), (int16_t)(abbrY - 10), (int16_t)(logoSize + 4), 20, Palette::BG);
+    dl.fillRect((int16_t)(rightLogoX - 2), (int16_t)(abbrY - 10), (int16_t)(logoSize + 4), 20, Palette::BG);
+    dl.text(Teams::code(away.id), (int16_t)(leftLogoX + logoSize / 2), abbrY, 2, MC_DATUM, Palette::WHITE, Palette::PANEL);
+    dl.text(Teams::code(home.id), (int16_t)(rightLogoX + logoSize / 2), abbrY, 2, MC_DATUM, Palette::WHITE, Palette::PANEL);
   }
 
-  Assets::drawLogo(tft, away.abbr, away.logoUrl, leftLogoX, logoY, logoSize);
-  Assets::drawLogo(tft, home.abbr, home.logoUrl, rightLogoX, logoY, logoSize);
-
-  tft.setTextDatum(MC_DATUM);
-  tft.setTextColor(Palette::WHITE, Palette::PANEL);
-
   if (showScores) {
-    tft.setTextFont(scoreFont);
-    tft.drawString(String(away.score), leftScoreX, scoreY);
-    tft.drawString(String(home.score), rightScoreX, scoreY);
-  }
-
-  String mid = midLabel;
-  if (mid.isEmpty() && showScores) mid = "-";
-  if (mid.length()) {
-    tft.setTextFont(bigScores ? 4 : 2);
-    tft.drawString(mid, dashX, scoreY);
-  }
-
-  if (canShowAbbr) {
-    const int16_t abbrY = (int16_t)(logoY + logoSize + 12);
-    tft.setTextFont(2);
-    tft.drawString(away.abbr, (int16_t)(leftLogoX + logoSize / 2), abbrY);
-    tft.drawString(home.abbr, (int16_t)(rightLogoX + logoSize / 2), abbrY);
+    dl.region((int16_t)(leftScoreX - scoreBoxW / 2), (int16_t)(scoreY - scoreBoxH / 2), scoreBoxW, scoreBoxH, Palette::PANEL);
+    dl.numeric(String(away.score), leftScoreX, scoreY, scoreFont, MC_DATUM, Palette::WHITE, Palette::PANEL);
+    dl.region((int16_t)(rightScoreX - scoreBoxW / 2), (int16_t)(scoreY - scoreBoxH / 2), scoreBoxW, scoreBoxH, Palette::PANEL);
+    dl.numeric(String(home.score), rightScoreX, scoreY, scoreFont, MC_DATUM, Palette::WHITE, Palette::PANEL);
   }
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 #include <TFT_eSPI.h>
+#include "display_list.h"
 #include "types.h"
 
 class Ui {
@@ -9,6 +10,8 @@ public:
   void setBacklight(uint8_t pct);
   void drawBootSplash(const String &line1, const String &line2);
 
+  // Each call describes the whole screen; only regions that differ from what
+  // is on the panel are pushed.
   void drawNextGame(const GameState &g, const String &focusTeamAbbr);
   void drawLive(const GameState &g);
   void drawGoal(const GameState &g);
@@ -19,73 +22,33 @@ public:
   void drawNoGame(const GameState &g, const String &focusTeamAbbr);    // legacy wrapper
   void drawStandings(const GameState &g, const String &focusTeamAbbr);
 
-private:
-  struct ScoreCache {
-    bool valid = false;
-    String homeAbbr;
-    String awayAbbr;
-    int homeScore = 0;
-    int awayScore = 0;
-  };
-
-  struct StatsCache {
-    bool valid = false;
-    int homeSog = -1;
-    int awaySog = -1;
-    int homeHits = -1;
-    int awayHits = -1;
-    int homeFo = -1;
-    int awayFo = -1;
-  };
-
-  struct StatusCache {
-    bool valid = false;
-    String left;
-    String right;
-    uint16_t dotCol = 0;
-    bool showDot = false;
-  };
+  // Advances the NEXT_GAME countdown without describing the screen again;
+  // only the countdown glyphs that changed are repainted. Returns false when
+  // drawNextGame() is needed instead: no countdown on the panel, or the change
+  // reaches past the countdown box.
+  bool tickCountdown();
 
-  struct InfoCache {
-    bool valid = false;
-    String line1;
-    String line2;
-  };
+  // Regions and bytes the most recent draw call pushed to the panel.
+  const DisplayList::FrameStats &lastFrame() const { return _lastFrame; }
 
+private:
   TFT_eSPI *_tft = nullptr;
   uint8_t _rotation = 0;
-  ScreenMode _lastMode = ScreenMode::NEXT_GAME;
-  bool _hasLastMode = false;
-  String _noGameKey;
-  String _preKey;
-  String _lastGameKey;
-  String _countdownKey;
-  String _countdownValue;
-  String _countdownDate;
-  String _countdownLocation;
-  String _standingsKey;
-
-  ScoreCache _liveScore;
-  StatsCache _liveStats;
-  StatusCache _liveStatus;
-
-  ScoreCache _interScore;
-  StatsCache _interStats;
-  StatusCache _interStatus;
-
-  ScoreCache _finalScore;
-  StatsCache _finalStats;
-  StatusCache _finalStatus;
-
-  ScoreCache _preScore;
-  StatusCache _preStatus;
-  InfoCache _preInfo;
-
-  bool ensureScreen(ScreenMode mode);
-  void resetCaches();
-  void drawFrame();
-  void framePanel(int16_t x, int16_t y, int16_t w, int16_t h);
-  void drawTopScorePanel(const GameState &g, const String &label, bool showScores, const String &midLabel);
-  void drawStatsBand(const GameState &g);
-  void drawStatusBar(const String &left, const String &right, uint16_t dotCol, bool showDot);
-};
+  DisplayList _list;
+  DisplayList::FrameStats _lastFrame;
+
+  // Countdown of the NEXT_GAME frame on the panel, for tickCountdown().
+  int16_t _countdownOp = -1;
+  time_t _countdownStart = 0;
+  bool _countdownGameDay = false;
+  uint8_t _countdownFont = 0;
+  char _countdownText[24] = "";  // "%lldd %02lld:%02lld" fits any day count
+
+  void beginFrame(uint16_t bg, bool framed);
+  void present(const char *screen);
+  void panel(int16_t x, int16_t y, int16_t w, int16_t h);
+  void topScorePanel(const GameState &g, const String &label, bool showScores, const String &midLabel);
+  void statsBand(const GameState &g);
+  void statusBar(const String &left, const String &right, uint16_t dotCol, bool showDot,
+                 bool leftIsClock = false);
+};
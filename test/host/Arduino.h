@@ -0,0 +1,82 @@
+#pragma once
+
+// Native stand-in for the ESP32 Arduino core: the part of its API the firmware
+// uses, so src/ builds and runs on Linux under test/. Time is virtual (see
+// host_sched.h), the heap is modelled (host_heap.h) and the network, flash and
+// panel are in-process fakes (host_net.h, SPIFFS.h, TFT_eSPI.h).
+
+#include <algorithm>
+#include <cmath>
+#include <ctype.h>
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "Esp.h"
+#include "HardwareSerial.h"
+#include "Print.h"
+#include "Stream.h"
+#include "WString.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "host_time.h"
+
+using std::max;
+using std::min;
+
+#define HIGH 0x1
+#define LOW 0x0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define PULLUP 0x04
+#define INPUT_PULLUP 0x05
+
+#define PROGMEM
+#define F(s) (s)
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define SET_LOOP_TASK_STACK_SIZE(bytes)
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+extern "C" size_t strlcpy(char *dst, const char *src, size_t size);
+#endif
+
+typedef uint8_t byte;
+typedef bool boolean;
+
+uint32_t millis();
+uint32_t micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t level);
+int digitalRead(uint8_t pin);
+void dacWrite(uint8_t pin, uint8_t value);
+void dacDisable(uint8_t pin);
+double ledcSetup(uint8_t channel, double freq, uint8_t bits);
+void ledcAttachPin(uint8_t pin, uint8_t channel);
+void ledcWrite(uint8_t channel, uint32_t duty);
+
+long map(long x, long inMin, long inMax, long outMin, long outMax);
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+extern "C" uint32_t esp_random();
+
+// Starts "SNTP": time() reports the wall clock set with HostTime::setWallClock().
+void configTime(long gmtOffsetSec, int daylightOffsetSec, const char *server1, const char *server2 = nullptr,
+                const char *server3 = nullptr);
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+
+namespace HostGpio {
+// Level a digitalRead() of `pin` returns; inputs read HIGH (pulled up) until set.
+void setInput(uint8_t pin, int level);
+// Last value written with ledcWrite() on `channel`.
+uint32_t ledcDuty(uint8_t channel);
+}  // namespace HostGpio
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <stdint.h>
+
+// Heap figures come from the HostHeap model of the device heap.
+class EspClass {
+public:
+  uint32_t getHeapSize();
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getMaxAllocHeap();
+  uint32_t getPsramSize() { return 0; }
+  uint32_t getCpuFreqMHz() { return 240; }
+  const char *getSdkVersion() { return "host"; }
+  void restart();
+};
+
+extern EspClass ESP;
@@ -0,0 +1,200 @@
+#include <FS.h>
+#include <SD.h>
+#include <SPIFFS.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "host_heap.h"
+
+SPIFFSFS SPIFFS;
+SDFS SD;
+SPIClass SPI(VSPI);
+
+namespace fs {
+
+class FileImpl {
+public:
+  FileImpl(FILE *f, std::string path) : file(f), path(std::move(path)) {}
+  ~FileImpl() {
+    if (file) fclose(file);
+  }
+
+  FILE *file;
+  std::string path;
+};
+
+namespace {
+
+bool makeParents(const std::string &path) {
+  for (size_t slash = path.find('/', 1); slash != std::string::npos; slash = path.find('/', slash + 1)) {
+    const std::string dir = path.substr(0, slash);
+    if (::mkdir(dir.c_str(), 0755) != 0 && errno != EEXIST) return false;
+  }
+  return true;
+}
+
+size_t treeBytes(const std::string &dir) {
+  size_t total = 0;
+  DIR *d = opendir(dir.c_str());
+  if (!d) return 0;
+  while (dirent *e = readdir(d)) {
+    const std::string name = e->d_name;
+    if (name == "." || name == "..") continue;
+    const std::string child = dir + "/" + name;
+    struct stat st;
+    if (stat(child.c_str(), &st) != 0) continue;
+    total += S_ISDIR(st.st_mode) ? treeBytes(child) : (size_t)st.st_size;
+  }
+  closedir(d);
+  return total;
+}
+
+}  // namespace
+
+size_t File::write(const uint8_t *buffer, size_t size) {
+  if (!_impl || !_impl->file) return 0;
+  HostHeap::Exclude outside;
+  return fwrite(buffer, 1, size, _impl->file);
+}
+
+int File::available() {
+  if (!_impl || !_impl->file) return 0;
+  const size_t pos = position();
+  const size_t len = size();
+  return pos < len ? (int)(len - pos) : 0;
+}
+
+int File::read() {
+  uint8_t c;
+  return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek() {
+  if (!_impl || !_impl->file) return -1;
+  HostHeap::Exclude outside;
+  const int c = fgetc(_impl->file);
+  if (c != EOF) ungetc(c, _impl->file);
+  return c == EOF ? -1 : c;
+}
+
+void File::flush() {
+  if (_impl && _impl->file) fflush(_impl->file);
+}
+
+size_t File::read(uint8_t *buffer, size_t size) {
+  if (!_impl || !_impl->file) return 0;
+  HostHeap::Exclude outside;
+  return fread(buffer, 1, size, _impl->file);
+}
+
+bool File::seek(uint32_t pos, SeekMode mode) {
+  if (!_impl || !_impl->file) return false;
+  const int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+  return fseek(_impl->file, (long)pos, whence) == 0;
+}
+
+size_t File::position() const {
+  if (!_impl || !_impl->file) return 0;
+  const long pos = ftell(_impl->file);
+  return pos < 0 ? 0 : (size_t)pos;
+}
+
+size_t File::size() const {
+  if (!_impl || !_impl->file) return 0;
+  fflush(_impl->file);
+  struct stat st;
+  return fstat(fileno(_impl->file), &st) == 0 ? (size_t)st.st_size : 0;
+}
+
+void File::close() {
+  HostHeap::Exclude outside;
+  _impl.reset();
+}
+
+const char *File::path() const {
+  return _impl ? _impl->path.c_str() : nullptr;
+}
+
+void FS::setRoot(const std::string &dir) {
+  _root = dir;
+  makeParents(_root + "/");
+}
+
+const std::string &FS::root() {
+  if (_root.empty()) {
+    HostHeap::Exclude outside;
+    const char *tmp = getenv("TMPDIR");
+    std::string pattern = std::string(tmp && tmp[0] ? tmp : "/tmp") + "/host-" + _name + "-XXXXXX";
+    if (mkdtemp(&pattern[0])) _root = pattern;
+  }
+  return _root;
+}
+
+std::string FS::hostPath(const char *path) {
+  std::string p = path ? path : "";
+  if (p.empty() || p[0] != '/') p = "/" + p;
+  return root() + p;
+}
+
+File FS::open(const char *path, const char *mode, bool) {
+  if (!_mounted) return File();
+  HostHeap::Exclude outside;
+  const std::string host = hostPath(path);
+  const bool writing = mode && (mode[0] == 'w' || mode[0] == 'a');
+  if (writing && !makeParents(host)) return File();
+  struct stat st;
+  if (!writing && (stat(host.c_str(), &st) != 0 || S_ISDIR(st.st_mode))) return File();
+  std::string hostMode = mode ? mode : "r";
+  if (hostMode.find('b') == std::string::npos) hostMode += "b";
+  FILE *f = fopen(host.c_str(), hostMode.c_str());
+  if (!f) return File();
+  return File(std::make_shared<FileImpl>(f, path));
+}
+
+bool FS::exists(const char *path) {
+  if (!_mounted) return false;
+  HostHeap::Exclude outside;
+  struct stat st;
+  return stat(hostPath(path).c_str(), &st) == 0;
+}
+
+bool FS::remove(const char *path) {
+  if (!_mounted) return false;
+  HostHeap::Exclude outside;
+  return ::unlink(hostPath(path).c_str()) == 0;
+}
+
+bool FS::rename(const char *from, const char *to) {
+  if (!_mounted) return false;
+  HostHeap::Exclude outside;
+  const std::string dest = hostPath(to);
+  return makeParents(dest) && ::rename(hostPath(from).c_str(), dest.c_str()) == 0;
+}
+
+bool FS::mkdir(const char *path) {
+  if (!_mounted) return false;
+  HostHeap::Exclude outside;
+  const std::string host = hostPath(path);
+  return makeParents(host + "/");
+}
+
+}  // namespace fs
+
+bool SPIFFSFS::begin(bool, const char *, uint8_t, const char *) {
+  _mounted = !root().empty();
+  return _mounted;
+}
+
+bool SPIFFSFS::format() {
+  return _mounted;
+}
+
+size_t SPIFFSFS::usedBytes() {
+  HostHeap::Exclude outside;
+  return fs::treeBytes(root());
+}
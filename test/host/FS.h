@@ -0,0 +1,78 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+#include <string>
+
+// File systems backed by a host directory. Paths are the firmware's ("/x/y"),
+// resolved under the mount's root.
+
+namespace fs {
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+class FileImpl;
+
+class File : public Stream {
+public:
+  File() = default;
+  explicit File(std::shared_ptr<FileImpl> impl) : _impl(std::move(impl)) {}
+
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  int available() override;
+  int read() override;
+  int peek() override;
+  void flush() override;
+  size_t read(uint8_t *buffer, size_t size);
+  size_t readBytes(char *buffer, size_t length) override { return read((uint8_t *)buffer, length); }
+  bool seek(uint32_t pos, SeekMode mode = SeekSet);
+  size_t position() const;
+  size_t size() const;
+  void close();
+  const char *path() const;
+  operator bool() const { return _impl != nullptr; }
+
+private:
+  std::shared_ptr<FileImpl> _impl;
+};
+
+class FS {
+public:
+  FS() = default;
+  explicit FS(const char *name) : _name(name) {}
+
+  File open(const char *path, const char *mode = "r", bool create = false);
+  File open(const String &path, const char *mode = "r", bool create = false) {
+    return open(path.c_str(), mode, create);
+  }
+  bool exists(const char *path);
+  bool exists(const String &path) { return exists(path.c_str()); }
+  bool remove(const char *path);
+  bool remove(const String &path) { return remove(path.c_str()); }
+  bool rename(const char *from, const char *to);
+  bool rename(const String &from, const String &to) { return rename(from.c_str(), to.c_str()); }
+  bool mkdir(const char *path);
+  bool mkdir(const String &path) { return mkdir(path.c_str()); }
+
+  // Test control: the host directory files live in. Created on first use
+  // under the system temp directory unless set.
+  void setRoot(const std::string &dir);
+  const std::string &root();
+
+protected:
+  bool _mounted = false;
+
+private:
+  std::string hostPath(const char *path);
+
+  std::string _name = "fs";
+  std::string _root;
+};
+
+}  // namespace fs
+
+using fs::File;
+using fs::FS;
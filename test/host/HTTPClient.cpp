@@ -0,0 +1,227 @@
+#include <HTTPClient.h>
+
+#include <stdlib.h>
+
+bool HTTPClient::begin(WiFiClient &client, const String &url) {
+  _client = &client;
+  _code = 0;
+  _size = -1;
+  _chunked = false;
+  _canReuse = false;
+  _headers = "";
+
+  const int scheme = url.indexOf("://");
+  if (scheme < 0) return false;
+  const String protocol = url.substring(0, scheme);
+  _port = protocol.equalsIgnoreCase("https") ? 443 : 80;
+  if (!protocol.equalsIgnoreCase("https") && !protocol.equalsIgnoreCase("http")) return false;
+
+  String rest = url.substring(scheme + 3);
+  const int slash = rest.indexOf('/');
+  String host = slash < 0 ? rest : rest.substring(0, slash);
+  _uri = slash < 0 ? String("/") : rest.substring(slash);
+  const int colon = host.indexOf(':');
+  if (colon >= 0) {
+    _port = (uint16_t)host.substring(colon + 1).toInt();
+    host = host.substring(0, colon);
+  }
+  _host = host;
+  return _host.length() > 0;
+}
+
+void HTTPClient::end() {
+  if (!_client) return;
+  if (_client->connected()) {
+    if (_client->available() > 0) {
+      while (_client->available() > 0) _client->read();
+    }
+    if (!(_reuse && _canReuse)) _client->stop();
+  }
+}
+
+void HTTPClient::addHeader(const String &name, const String &value, bool, bool) {
+  if (name.equalsIgnoreCase("Connection") || name.equalsIgnoreCase("User-Agent") || name.equalsIgnoreCase("Host")) {
+    return;
+  }
+  _headers += name;
+  _headers += ": ";
+  _headers += value;
+  _headers += "\r\n";
+}
+
+void HTTPClient::collectHeaders(const char *headerKeys[], const size_t headerKeysCount) {
+  _collected.clear();
+  for (size_t i = 0; i < headerKeysCount; ++i) _collected.emplace_back(String(headerKeys[i]), String());
+}
+
+String HTTPClient::header(const char *name) {
+  for (const auto &h : _collected) {
+    if (h.first.equalsIgnoreCase(name)) return h.second;
+  }
+  return String();
+}
+
+bool HTTPClient::hasHeader(const char *name) {
+  for (const auto &h : _collected) {
+    if (h.first.equalsIgnoreCase(name)) return h.second.length() > 0;
+  }
+  return false;
+}
+
+bool HTTPClient::connected() {
+  return _client && (_client->connected() || _client->available() > 0);
+}
+
+int HTTPClient::GET() {
+  return sendRequest("GET");
+}
+
+int HTTPClient::sendRequest(const char *method) {
+  if (!_client) return HTTPC_ERROR_NOT_CONNECTED;
+  for (auto &h : _collected) h.second = "";
+  _size = -1;
+  _chunked = false;
+  _canReuse = false;
+
+  if (_client->connected()) {
+    // Leftovers of the previous response.
+    while (_client->available() > 0) _client->read();
+  } else if (!_client->connect(_host, _port)) {
+    return HTTPC_ERROR_CONNECTION_REFUSED;
+  }
+  _client->setTimeout(_timeoutMs);
+
+  String request = String(method) + " " + _uri + (_http10 ? " HTTP/1.0\r\n" : " HTTP/1.1\r\n");
+  request += "Host: " + _host;
+  if (_port != 80 && _port != 443) request += ":" + String(_port);
+  request += "\r\nUser-Agent: " + _userAgent + "\r\nConnection: ";
+  request += _reuse ? "keep-alive\r\n" : "close\r\n";
+  if (!_http10) request += "Accept-Encoding: identity;q=1,chunked;q=0.1,*;q=0\r\n";
+  request += _headers;
+  request += "\r\n";
+  if (_client->write((const uint8_t *)request.c_str(), request.length()) != request.length()) {
+    return HTTPC_ERROR_SEND_HEADER_FAILED;
+  }
+  return readResponseHeader();
+}
+
+int HTTPClient::readResponseHeader() {
+  _code = 0;
+  while (connected()) {
+    // readStringUntil() waits on the virtual clock, up to the timeout.
+    String line = _client->readStringUntil('\n');
+    if (!line.length()) return _client->connected() ? HTTPC_ERROR_READ_TIMEOUT : HTTPC_ERROR_CONNECTION_LOST;
+    line.trim();
+    if (!_code) {
+      if (!line.startsWith("HTTP/1.")) return HTTPC_ERROR_NO_HTTP_SERVER;
+      _code = (int)line.substring(9, 12).toInt();
+      _canReuse = line.startsWith("HTTP/1.1");
+      continue;
+    }
+    if (!line.length()) {
+      if (_size < 0 && !_chunked && (_code == 204 || _code == 304)) _size = 0;
+      return _code;
+    }
+    const int colon = line.indexOf(':');
+    if (colon <= 0) continue;
+    String name = line.substring(0, colon);
+    String value = line.substring(colon + 1);
+    value.trim();
+    if (name.equalsIgnoreCase("Content-Length")) _size = (int)value.toInt();
+    if (name.equalsIgnoreCase("Transfer-Encoding") && value.equalsIgnoreCase("chunked")) _chunked = true;
+    if (name.equalsIgnoreCase("Connection") && value.equalsIgnoreCase("close")) _canReuse = false;
+    for (auto &h : _collected) {
+      if (h.first.equalsIgnoreCase(name.c_str())) h.second = value;
+    }
+  }
+  return HTTPC_ERROR_CONNECTION_LOST;
+}
+
+int HTTPClient::readLength(Stream *stream, int size) {
+  uint8_t buf[512];
+  int total = 0;
+  while (size < 0 || total < size) {
+    size_t want = sizeof(buf);
+    if (size >= 0 && (size_t)(size - total) < want) want = (size_t)(size - total);
+    const size_t n = _client->readBytes((char *)buf, want);
+    if (!n) break;
+    if (stream && stream->write(buf, n) != n) return HTTPC_ERROR_STREAM_WRITE;
+    total += (int)n;
+  }
+  if (size >= 0 && total < size) return HTTPC_ERROR_CONNECTION_LOST;
+  return total;
+}
+
+int HTTPClient::readChunked(Stream *stream) {
+  int total = 0;
+  for (;;) {
+    String line = _client->readStringUntil('\n');
+    line.trim();
+    if (!line.length()) return HTTPC_ERROR_READ_TIMEOUT;
+    const int len = (int)strtol(line.c_str(), nullptr, 16);
+    if (len == 0) {
+      // Trailer fields end with an empty line.
+      while (_client->readStringUntil('\n').length() > 1) {
+      }
+      return total;
+    }
+    const int n = readLength(stream, len);
+    if (n < 0) return n;
+    total += n;
+    char crlf[2];
+    if (_client->readBytes(crlf, 2) != 2 || crlf[0] != '\r' || crlf[1] != '\n') return HTTPC_ERROR_READ_TIMEOUT;
+  }
+}
+
+int HTTPClient::writeToStream(Stream *stream) {
+  if (!stream) return HTTPC_ERROR_NO_STREAM;
+  if (!connected()) return HTTPC_ERROR_NOT_CONNECTED;
+  const int n = _chunked ? readChunked(stream) : readLength(stream, _size);
+  if (n < 0) _canReuse = false;
+  end();
+  return n;
+}
+
+namespace {
+
+class StringSink : public Stream {
+public:
+  String text;
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  size_t write(uint8_t c) override {
+    text += (char)c;
+    return 1;
+  }
+  size_t write(const uint8_t *buffer, size_t size) override {
+    text.concat((const char *)buffer, (unsigned int)size);
+    return size;
+  }
+};
+
+}  // namespace
+
+String HTTPClient::getString() {
+  StringSink sink;
+  if (_size > 0) sink.text.reserve((unsigned int)_size);
+  if (_size != 0) writeToStream(&sink);
+  return sink.text;
+}
+
+String HTTPClient::errorToString(int error) {
+  switch (error) {
+    case HTTPC_ERROR_CONNECTION_REFUSED: return String("connection refused");
+    case HTTPC_ERROR_SEND_HEADER_FAILED: return String("send header failed");
+    case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return String("send payload failed");
+    case HTTPC_ERROR_NOT_CONNECTED: return String("not connected");
+    case HTTPC_ERROR_CONNECTION_LOST: return String("connection lost");
+    case HTTPC_ERROR_NO_STREAM: return String("no stream");
+    case HTTPC_ERROR_NO_HTTP_SERVER: return String("no HTTP server");
+    case HTTPC_ERROR_TOO_LESS_RAM: return String("too less ram");
+    case HTTPC_ERROR_ENCODING: return String("Transfer-Encoding not supported");
+    case HTTPC_ERROR_STREAM_WRITE: return String("Stream write error");
+    case HTTPC_ERROR_READ_TIMEOUT: return String("read Timeout");
+    default: return String();
+  }
+}
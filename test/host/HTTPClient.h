@@ -0,0 +1,97 @@
+#pragma once
+
+#include <Arduino.h>
+#include <WiFi.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+// HTTP/1.1 client with the ESP32 core's HTTPClient interface and behaviour
+// (keep-alive, collected headers, chunked bodies in getString() and
+// writeToStream(), its own Accept-Encoding line) over a WiFiClient.
+
+#define HTTPC_ERROR_CONNECTION_REFUSED (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED (-4)
+#define HTTPC_ERROR_CONNECTION_LOST (-5)
+#define HTTPC_ERROR_NO_STREAM (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM (-8)
+#define HTTPC_ERROR_ENCODING (-9)
+#define HTTPC_ERROR_STREAM_WRITE (-10)
+#define HTTPC_ERROR_READ_TIMEOUT (-11)
+
+typedef enum {
+  HTTP_CODE_OK = 200,
+  HTTP_CODE_NO_CONTENT = 204,
+  HTTP_CODE_MOVED_PERMANENTLY = 301,
+  HTTP_CODE_FOUND = 302,
+  HTTP_CODE_SEE_OTHER = 303,
+  HTTP_CODE_NOT_MODIFIED = 304,
+  HTTP_CODE_TEMPORARY_REDIRECT = 307,
+  HTTP_CODE_PERMANENT_REDIRECT = 308,
+  HTTP_CODE_BAD_REQUEST = 400,
+  HTTP_CODE_NOT_FOUND = 404,
+  HTTP_CODE_TOO_MANY_REQUESTS = 429,
+  HTTP_CODE_INTERNAL_SERVER_ERROR = 500,
+  HTTP_CODE_SERVICE_UNAVAILABLE = 503
+} t_http_codes;
+
+typedef enum {
+  HTTPC_DISABLE_FOLLOW_REDIRECTS,
+  HTTPC_STRICT_FOLLOW_REDIRECTS,
+  HTTPC_FORCE_FOLLOW_REDIRECTS
+} followRedirects_t;
+
+class HTTPClient {
+public:
+  bool begin(WiFiClient &client, const String &url);
+  void end();
+
+  void setReuse(bool reuse) { _reuse = reuse; }
+  void setTimeout(uint16_t timeoutMs) { _timeoutMs = timeoutMs; }
+  void setConnectTimeout(int32_t) {}
+  void setFollowRedirects(followRedirects_t) {}
+  void setUserAgent(const String &userAgent) { _userAgent = userAgent; }
+  void useHTTP10(bool http10) { _http10 = http10; }
+
+  // Like the core, Connection, User-Agent and Host cannot be set this way.
+  void addHeader(const String &name, const String &value, bool first = false, bool replace = true);
+  void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+  String header(const char *name);
+  bool hasHeader(const char *name);
+
+  int GET();
+
+  int getSize() { return _size; }
+  WiFiClient &getStream() { return *_client; }
+  WiFiClient *getStreamPtr() { return _client; }
+  String getString();
+  int writeToStream(Stream *stream);
+  bool connected();
+
+  static String errorToString(int error);
+
+private:
+  int sendRequest(const char *method);
+  int readResponseHeader();
+  int readChunked(Stream *stream);
+  int readLength(Stream *stream, int size);
+
+  WiFiClient *_client = nullptr;
+  String _host;
+  uint16_t _port = 80;
+  String _uri;
+  String _userAgent = "ESP32HTTPClient";
+  String _headers;
+  bool _reuse = true;
+  bool _canReuse = false;
+  bool _http10 = false;
+  bool _chunked = false;
+  uint16_t _timeoutMs = 5000;
+  int _code = 0;
+  int _size = -1;
+  std::vector<std::pair<String, String>> _collected;
+};
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Stream.h"
+
+// Serial on the host: lines go to stdout (unless muted) and to an optional
+// listener, which tests use to pick events such as "STATE: LIVE -> GOAL" out
+// of the firmware's own log, time-stamped on the virtual clock.
+class HardwareSerial : public Stream {
+public:
+  typedef void (*LineListener)(const char *line, void *ctx);
+
+  void begin(unsigned long baud) { (void)baud; }
+  void end() {}
+
+  int available() override { return 0; }
+  int read() override { return -1; }
+  int peek() override { return -1; }
+  size_t write(uint8_t c) override;
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+
+  void setEcho(bool echo) { _echo = echo; }
+  void setListener(LineListener listener, void *ctx) {
+    _listener = listener;
+    _ctx = ctx;
+  }
+
+  operator bool() const { return true; }
+
+private:
+  void endLine();
+
+  bool _echo = true;
+  LineListener _listener = nullptr;
+  void *_ctx = nullptr;
+  char _line[512];
+  size_t _lineLen = 0;
+};
+
+extern HardwareSerial Serial;
@@ -0,0 +1,166 @@
+#include "PNGdec.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include "host_heap.h"
+
+namespace {
+
+uint32_t be32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+// Bytes per pixel by PNG colour type; 0 = not a type we decode.
+uint8_t bytesPerPixel(uint8_t colourType) {
+  switch (colourType) {
+    case 0: return 1;  // greyscale
+    case 2: return 3;  // RGB
+    case 3: return 1;  // palette
+    case 4: return 2;  // grey + alpha
+    case 6: return 4;  // RGBA
+    default: return 0;
+  }
+}
+
+uint8_t paeth(int a, int b, int c) {
+  const int p = a + b - c;
+  const int pa = abs(p - a);
+  const int pb = abs(p - b);
+  const int pc = abs(p - c);
+  if (pa <= pb && pa <= pc) return (uint8_t)a;
+  return (uint8_t)(pb <= pc ? b : c);
+}
+
+// Undoes the row filter in place; `prev` is the previous unfiltered row.
+void unfilter(uint8_t filter, uint8_t *row, const uint8_t *prev, size_t pitch, uint8_t bpp) {
+  for (size_t i = 0; i < pitch; ++i) {
+    const int a = i >= bpp ? row[i - bpp] : 0;
+    const int b = prev[i];
+    const int c = i >= bpp ? prev[i - bpp] : 0;
+    int p = 0;
+    switch (filter) {
+      case 1: p = a; break;
+      case 2: p = b; break;
+      case 3: p = (a + b) / 2; break;
+      case 4: p = paeth(a, b, c); break;
+      default: break;
+    }
+    row[i] = (uint8_t)(row[i] + p);
+  }
+}
+
+}  // namespace
+
+int PNG::open(const char *name, PNG_OPEN_CALLBACK *openFn, PNG_CLOSE_CALLBACK *closeFn, PNG_READ_CALLBACK *readFn,
+              PNG_SEEK_CALLBACK *seekFn, PNG_DRAW_CALLBACK *drawFn) {
+  HostHeap::Exclude outside;
+  _closeFn = closeFn;
+  _drawFn = drawFn;
+  _width = _height = 0;
+  _data.clear();
+  _file = PNGFILE();
+  _file.fHandle = openFn(name, &_file.iSize);
+  if (!_file.fHandle) return _error = PNG_INVALID_FILE;
+
+  _data.resize(_file.iSize > 0 ? (size_t)_file.iSize : 0);
+  seekFn(&_file, 0);
+  size_t got = 0;
+  while (got < _data.size()) {
+    const int32_t n = readFn(&_file, _data.data() + got, (int32_t)(_data.size() - got));
+    if (n <= 0) break;
+    got += (size_t)n;
+  }
+  _data.resize(got);
+
+  if (got < 33 || memcmp(_data.data(), "\x89PNG\r\n\x1a\n", 8) != 0) return _error = PNG_INVALID_FILE;
+  const uint8_t *ihdr = &_data[16];
+  _width = be32(ihdr);
+  _height = be32(ihdr + 4);
+  _colourType = ihdr[9];
+  if (ihdr[8] != 8 || ihdr[12] != 0 || !bytesPerPixel(_colourType)) return _error = PNG_UNSUPPORTED_FEATURE;
+  return _error = PNG_SUCCESS;
+}
+
+void PNG::close() {
+  if (_closeFn && _file.fHandle) _closeFn(_file.fHandle);
+  _file.fHandle = nullptr;
+}
+
+int PNG::decode(void *user, int) {
+  HostHeap::Exclude outside;
+  _palette.assign(768 + 256, 0);
+  memset(_palette.data() + 768, 255, 256);
+
+  std::vector<uint8_t> compressed;
+  for (size_t at = 8; at + 12 <= _data.size();) {
+    const uint32_t len = be32(&_data[at]);
+    if (at + 12 + len > _data.size()) break;
+    const uint8_t *type = &_data[at + 4];
+    const uint8_t *body = &_data[at + 8];
+    if (memcmp(type, "PLTE", 4) == 0) memcpy(_palette.data(), body, len < 768 ? len : 768);
+    if (memcmp(type, "tRNS", 4) == 0) memcpy(_palette.data() + 768, body, len < 256 ? len : 256);
+    if (memcmp(type, "IDAT", 4) == 0) compressed.insert(compressed.end(), body, body + len);
+    at += 12 + len;
+  }
+
+  const uint8_t bpp = bytesPerPixel(_colourType);
+  const size_t pitch = (size_t)_width * bpp;
+  std::vector<uint8_t> raw((pitch + 1) * _height);
+  uLongf rawLen = raw.size();
+  if (uncompress(raw.data(), &rawLen, compressed.data(), compressed.size()) != Z_OK || rawLen != raw.size()) {
+    return _error = PNG_DECODE_ERROR;
+  }
+
+  std::vector<uint8_t> prev(pitch, 0);
+  for (uint32_t y = 0; y < _height; ++y) {
+    uint8_t *row = &raw[y * (pitch + 1)];
+    unfilter(row[0], row + 1, prev.data(), pitch, bpp);
+    PNGDRAW draw = {(int)y, (int)_width, (int)pitch, _colourType, 8, _colourType >= 4, user, row + 1, _palette.data()};
+    if (!_drawFn(&draw)) return _error = PNG_QUIT_EARLY;
+    memcpy(prev.data(), row + 1, pitch);
+  }
+  return _error = PNG_SUCCESS;
+}
+
+void PNG::getLineAsRGB565(PNGDRAW *draw, uint16_t *out, int endian, uint32_t background) {
+  const uint8_t *p = draw->pPixels;
+  const uint32_t bgR = (background >> 16) & 0xFF;
+  const uint32_t bgG = (background >> 8) & 0xFF;
+  const uint32_t bgB = background & 0xFF;
+  for (int x = 0; x < draw->iWidth; ++x) {
+    uint32_t r, g, b, a = 255;
+    switch (draw->iPixelType) {
+      case 0:
+        r = g = b = p[x];
+        break;
+      case 2:
+        r = p[x * 3];
+        g = p[x * 3 + 1];
+        b = p[x * 3 + 2];
+        break;
+      case 3:
+        r = draw->pPalette[p[x] * 3];
+        g = draw->pPalette[p[x] * 3 + 1];
+        b = draw->pPalette[p[x] * 3 + 2];
+        a = draw->pPalette[768 + p[x]];
+        break;
+      case 4:
+        r = g = b = p[x * 2];
+        a = p[x * 2 + 1];
+        break;
+      default:
+        r = p[x * 4];
+        g = p[x * 4 + 1];
+        b = p[x * 4 + 2];
+        a = p[x * 4 + 3];
+        break;
+    }
+    r = (r * a + bgR * (255 - a)) / 255;
+    g = (g * a + bgG * (255 - a)) / 255;
+    b = (b * a + bgB * (255 - a)) / 255;
+    const uint16_t v = (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+    out[x] = (endian == PNG_RGB565_BIG_ENDIAN) ? (uint16_t)__builtin_bswap16(v) : v;
+  }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+// bitbank2/PNGdec for the native build: the part of its API assets.cpp uses,
+// decoding through the host's zlib. The real library bundles its own inflate,
+// whose symbols would clash with zlib's in a host binary. Non-interlaced
+// 8-bit greyscale, RGB, palette, grey-alpha and RGBA images only.
+
+#define PNG_SUCCESS 0
+#define PNG_INVALID_PARAMETER 1
+#define PNG_DECODE_ERROR 2
+#define PNG_MEM_ERROR 3
+#define PNG_NO_BUFFER 4
+#define PNG_UNSUPPORTED_FEATURE 5
+#define PNG_INVALID_FILE 6
+#define PNG_TOO_BIG 7
+#define PNG_QUIT_EARLY 8
+
+#define PNG_RGB565_LITTLE_ENDIAN 0
+#define PNG_RGB565_BIG_ENDIAN 1
+
+struct PNGFILE {
+  int32_t iPos;
+  int32_t iSize;
+  void *fHandle;
+};
+
+struct PNGDRAW {
+  int y;
+  int iWidth;
+  int iPitch;
+  int iPixelType;
+  int iBpp;
+  int iHasAlpha;
+  void *pUser;
+  uint8_t *pPixels;
+  uint8_t *pPalette;  // 256 RGB entries, then 256 alpha values
+};
+
+typedef void *(PNG_OPEN_CALLBACK)(const char *, int32_t *);
+typedef void(PNG_CLOSE_CALLBACK)(void *);
+typedef int32_t(PNG_READ_CALLBACK)(PNGFILE *, uint8_t *, int32_t);
+typedef int32_t(PNG_SEEK_CALLBACK)(PNGFILE *, int32_t);
+typedef int(PNG_DRAW_CALLBACK)(PNGDRAW *);
+
+class PNG {
+public:
+  // Reads the whole file through the callbacks and checks the header.
+  int open(const char *name, PNG_OPEN_CALLBACK *openFn, PNG_CLOSE_CALLBACK *closeFn, PNG_READ_CALLBACK *readFn,
+           PNG_SEEK_CALLBACK *seekFn, PNG_DRAW_CALLBACK *drawFn);
+  void close();
+  int getWidth() const { return (int)_width; }
+  int getHeight() const { return (int)_height; }
+  int getLastError() const { return _error; }
+  // Calls the draw callback once per row, top to bottom.
+  int decode(void *user, int options);
+  // Row from the draw callback as RGB565, blended over `background` (0xRRGGBB).
+  void getLineAsRGB565(PNGDRAW *draw, uint16_t *out, int endian, uint32_t background);
+
+private:
+  PNGFILE _file = {};
+  PNG_CLOSE_CALLBACK *_closeFn = nullptr;
+  PNG_DRAW_CALLBACK *_drawFn = nullptr;
+  std::vector<uint8_t> _data;
+  std::vector<uint8_t> _palette;
+  uint32_t _width = 0;
+  uint32_t _height = 0;
+  uint8_t _colourType = 0;
+  int _error = PNG_SUCCESS;
+};
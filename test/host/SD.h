@@ -0,0 +1,17 @@
+#pragma once
+
+#include <FS.h>
+#include <SPI.h>
+
+// No card is ever inserted.
+class SDFS : public fs::FS {
+public:
+  SDFS() : fs::FS("sd") {}
+  bool begin(uint8_t ssPin = 5, SPIClass &spi = SPI, uint32_t frequency = 4000000, const char *mountpoint = "/sd",
+             uint8_t maxFiles = 5, bool formatIfEmpty = false) {
+    return false;
+  }
+  void end() {}
+};
+
+extern SDFS SD;
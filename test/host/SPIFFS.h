@@ -0,0 +1,22 @@
+#pragma once
+
+#include <FS.h>
+
+class SPIFFSFS : public fs::FS {
+public:
+  SPIFFSFS() : fs::FS("spiffs") {}
+  bool begin(bool formatOnFail = false, const char *basePath = "/spiffs", uint8_t maxOpenFiles = 10,
+             const char *partitionLabel = nullptr);
+  void end() { _mounted = false; }
+  bool format();
+  size_t totalBytes() { return _totalBytes; }
+  size_t usedBytes();
+
+  // Test control: the partition size reported by totalBytes().
+  void setTotalBytes(size_t bytes) { _totalBytes = bytes; }
+
+private:
+  size_t _totalBytes = 1408 * 1024;
+};
+
+extern SPIFFSFS SPIFFS;
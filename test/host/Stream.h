@@ -0,0 +1,30 @@
+#pragma once
+
+#include "Print.h"
+
+// Arduino Stream. The timed reads give up after the timeout on the virtual
+// clock, sleeping between attempts so other tasks (and the bytes they wait
+// for) get to run.
+class Stream : public Print {
+public:
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+
+  void setTimeout(unsigned long timeout) { _timeout = timeout; }
+  unsigned long getTimeout() const { return _timeout; }
+
+  bool find(const char *target);
+  bool find(const char *target, size_t length);
+  virtual size_t readBytes(char *buffer, size_t length);
+  size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+  size_t readBytesUntil(char terminator, char *buffer, size_t length);
+  String readString();
+  String readStringUntil(char terminator);
+
+protected:
+  int timedRead();
+  int timedPeek();
+
+  unsigned long _timeout = 1000;
+};
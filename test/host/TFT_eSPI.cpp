@@ -0,0 +1,618 @@
+#include <TFT_eSPI.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "host_fonts.h"
+#include "host_heap.h"
+
+namespace {
+
+// CASET + 4, RASET + 4, RAMWR: what setAddrWindow() clocks out before pixels.
+constexpr uint32_t kWindowBytes = 11;
+
+const HostFonts::Font *findFont(uint8_t id) {
+  for (const HostFonts::Font &f : HostFonts::kFonts) {
+    if (f.id == id) return &f;
+  }
+  return &HostFonts::kFonts[0];
+}
+
+uint8_t glyphWidth(const HostFonts::Font &f, char c) {
+  if (c < 32 || c > 126) return 0;
+  return f.widths[c - 32];
+}
+
+bool glyphBit(const HostFonts::Font &f, char c, int32_t x, int32_t y) {
+  const uint32_t bit = f.offsets[c - 32] + (uint32_t)y * f.widths[c - 32] + (uint32_t)x;
+  return (f.bits[bit >> 3] >> (7 - (bit & 7))) & 1;
+}
+
+uint8_t to332(uint16_t c) {
+  return (uint8_t)(((c >> 8) & 0xE0) | ((c >> 6) & 0x1C) | ((c >> 3) & 0x03));
+}
+
+uint16_t from332(uint8_t c) {
+  const uint16_t r = (uint16_t)(((c >> 5) & 7) * 31 / 7);
+  const uint16_t g = (uint16_t)(((c >> 2) & 7) * 63 / 7);
+  const uint16_t b = (uint16_t)((c & 3) * 31 / 3);
+  return (uint16_t)((r << 11) | (g << 5) | b);
+}
+
+// A panel pixel as the eye sees it, each channel widened to 8 bits.
+void toRgb888(uint16_t c, bool inverted, uint8_t *rgb) {
+  if (inverted) c = (uint16_t)~c;
+  const uint8_t r = (uint8_t)((c >> 11) & 0x1F);
+  const uint8_t g = (uint8_t)((c >> 5) & 0x3F);
+  const uint8_t b = (uint8_t)(c & 0x1F);
+  rgb[0] = (uint8_t)((r << 3) | (r >> 2));
+  rgb[1] = (uint8_t)((g << 2) | (g >> 4));
+  rgb[2] = (uint8_t)((b << 3) | (b >> 2));
+}
+
+void putBe32(std::string &out, uint32_t v) {
+  out.push_back((char)(v >> 24));
+  out.push_back((char)(v >> 16));
+  out.push_back((char)(v >> 8));
+  out.push_back((char)v);
+}
+
+uint32_t getBe32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+void putChunk(std::string &out, const char *type, const std::string &data) {
+  putBe32(out, (uint32_t)data.size());
+  std::string body(type, 4);
+  body += data;
+  out += body;
+  putBe32(out, (uint32_t)crc32(0, (const Bytef *)body.data(), (uInt)body.size()));
+}
+
+}  // namespace
+
+TFT_eSPI::TFT_eSPI(int16_t w, int16_t h) : _width(w), _height(h), _panelW(w), _panelH(h) {}
+
+TFT_eSPI::~TFT_eSPI() {
+  HostHeap::Exclude outside;
+  free(_fb);
+}
+
+void TFT_eSPI::init(uint8_t) {
+  if (!_fb) {
+    // Panel memory, not firmware heap.
+    HostHeap::Exclude outside;
+    _fb = (uint16_t *)calloc((size_t)_panelW * _panelH, sizeof(uint16_t));
+  }
+  _rotation = 0;
+  _width = _panelW;
+  _height = _panelH;
+}
+
+void TFT_eSPI::setRotation(uint8_t r) {
+  _rotation = r & 3;
+  _width = (_rotation & 1) ? _panelH : _panelW;
+  _height = (_rotation & 1) ? _panelW : _panelH;
+}
+
+bool TFT_eSPI::store(int32_t x, int32_t y, uint16_t colour) {
+  if (!_fb || x < 0 || y < 0 || x >= _width || y >= _height) return false;
+  int32_t px = x;
+  int32_t py = y;
+  switch (_rotation) {
+    case 1: px = _panelW - 1 - y; py = x; break;
+    case 2: px = _panelW - 1 - x; py = _panelH - 1 - y; break;
+    case 3: px = y; py = _panelH - 1 - x; break;
+    default: break;
+  }
+  _fb[py * _panelW + px] = colour;
+  return true;
+}
+
+uint16_t TFT_eSPI::load(int32_t x, int32_t y) const {
+  if (!_fb || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  int32_t px = x;
+  int32_t py = y;
+  switch (_rotation) {
+    case 1: px = _panelW - 1 - y; py = x; break;
+    case 2: px = _panelW - 1 - x; py = _panelH - 1 - y; break;
+    case 3: px = y; py = _panelH - 1 - x; break;
+    default: break;
+  }
+  return _fb[py * _panelW + px];
+}
+
+void TFT_eSPI::countWindow(uint64_t pixels) {
+  ++_stats.windows;
+  _stats.pixels += pixels;
+  _stats.spiBytes += kWindowBytes + pixels * 2;
+}
+
+void TFT_eSPI::startWrite() {
+  ++_stats.transactions;
+}
+
+void TFT_eSPI::endWrite() {}
+
+void TFT_eSPI::setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h) {
+  _winX = x;
+  _winY = y;
+  _winW = w > 0 ? w : 0;
+  _winH = h > 0 ? h : 0;
+  _winPos = 0;
+  countWindow(0);
+}
+
+void TFT_eSPI::pushColor(uint16_t colour) {
+  pushColor(colour, 1);
+}
+
+void TFT_eSPI::pushColor(uint16_t colour, uint32_t len) {
+  _stats.pixels += len;
+  _stats.spiBytes += (uint64_t)len * 2;
+  const uint32_t area = (uint32_t)(_winW * _winH);
+  for (uint32_t i = 0; i < len && _winPos < area; ++i, ++_winPos) {
+    store(_winX + (int32_t)(_winPos % _winW), _winY + (int32_t)(_winPos / _winW), colour);
+  }
+}
+
+void TFT_eSPI::pushColors(uint16_t *data, uint32_t len, bool swap) {
+  for (uint32_t i = 0; i < len; ++i) pushColor(swap ? data[i] : (uint16_t)__builtin_bswap16(data[i]));
+}
+
+void TFT_eSPI::pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data) {
+  if (w <= 0 || h <= 0 || !data) return;
+  // Clipped like the library: only the visible part is sent.
+  const int32_t x0 = x < 0 ? 0 : x;
+  const int32_t y0 = y < 0 ? 0 : y;
+  const int32_t x1 = (x + w > _width) ? _width : x + w;
+  const int32_t y1 = (y + h > _height) ? _height : y + h;
+  if (x0 >= x1 || y0 >= y1) return;
+  countWindow((uint64_t)(x1 - x0) * (y1 - y0));
+  for (int32_t yy = y0; yy < y1; ++yy) {
+    for (int32_t xx = x0; xx < x1; ++xx) {
+      const uint16_t v = data[(yy - y) * w + (xx - x)];
+      // With swap off the buffer is already in panel (big-endian) byte order.
+      store(xx, yy, _swapBytes ? v : (uint16_t)__builtin_bswap16(v));
+    }
+  }
+}
+
+bool TFT_eSPI::initDMA(bool) {
+  return true;
+}
+
+void TFT_eSPI::pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *) {
+  pushImage(x, y, w, h, (const uint16_t *)data);
+}
+
+void TFT_eSPI::drawPixel(int32_t x, int32_t y, uint32_t colour) {
+  if (x < 0 || y < 0 || x >= _width || y >= _height) return;
+  countWindow(1);
+  store(x, y, (uint16_t)colour);
+}
+
+uint16_t TFT_eSPI::readPixel(int32_t x, int32_t y) {
+  return load(x, y);
+}
+
+uint16_t TFT_eSPI::pixel(int32_t x, int32_t y) const {
+  return load(x, y);
+}
+
+void TFT_eSPI::fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour) {
+  if (x < 0) {
+    w += x;
+    x = 0;
+  }
+  if (y < 0) {
+    h += y;
+    y = 0;
+  }
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+  if (w <= 0 || h <= 0) return;
+  countWindow((uint64_t)w * h);
+  for (int32_t yy = y; yy < y + h; ++yy) {
+    for (int32_t xx = x; xx < x + w; ++xx) store(xx, yy, (uint16_t)colour);
+  }
+}
+
+void TFT_eSPI::fillSpan(int32_t x, int32_t y, int32_t w, uint16_t colour) {
+  fillRect(x, y, w, 1, colour);
+}
+
+void TFT_eSPI::drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour) {
+  drawFastHLine(x, y, w, colour);
+  drawFastHLine(x, y + h - 1, w, colour);
+  drawFastVLine(x, y + 1, h - 2, colour);
+  drawFastVLine(x + w - 1, y + 1, h - 2, colour);
+}
+
+void TFT_eSPI::drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t colour) {
+  if (y0 == y1) {
+    if (x1 < x0) std::swap(x0, x1);
+    drawFastHLine(x0, y0, x1 - x0 + 1, colour);
+    return;
+  }
+  if (x0 == x1) {
+    if (y1 < y0) std::swap(y0, y1);
+    drawFastVLine(x0, y0, y1 - y0 + 1, colour);
+    return;
+  }
+  const int32_t dx = abs(x1 - x0);
+  const int32_t dy = -abs(y1 - y0);
+  const int32_t sx = x0 < x1 ? 1 : -1;
+  const int32_t sy = y0 < y1 ? 1 : -1;
+  int32_t err = dx + dy;
+  for (;;) {
+    drawPixel(x0, y0, colour);
+    if (x0 == x1 && y0 == y1) break;
+    const int32_t e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+// Bresenham quarter circles. corners: 1 top-left, 2 top-right, 4 bottom-right,
+// 8 bottom-left; `stretch` widens the gap between left and right halves (and
+// top and bottom) for round rects.
+void TFT_eSPI::circleQuadrants(int32_t x, int32_t y, int32_t r, uint8_t corners, int32_t stretch, uint32_t colour,
+                               bool fill) {
+  int32_t f = 1 - r;
+  int32_t ddx = 1;
+  int32_t ddy = -2 * r;
+  int32_t px = 0;
+  int32_t py = r;
+  while (px <= py) {
+    if (fill) {
+      // Spans for both octants of each half.
+      if (corners & 0x3) {
+        fillSpan(x - py, y - px, 2 * py + 1 + stretch, colour);
+        fillSpan(x - px, y - py, 2 * px + 1 + stretch, colour);
+      }
+      if (corners & 0xC) {
+        fillSpan(x - py, y + px, 2 * py + 1 + stretch, colour);
+        fillSpan(x - px, y + py, 2 * px + 1 + stretch, colour);
+      }
+    } else {
+      if (corners & 0x1) {
+        drawPixel(x - px, y - py, colour);
+        drawPixel(x - py, y - px, colour);
+      }
+      if (corners & 0x2) {
+        drawPixel(x + px + stretch, y - py, colour);
+        drawPixel(x + py + stretch, y - px, colour);
+      }
+      if (corners & 0x4) {
+        drawPixel(x + px + stretch, y + py, colour);
+        drawPixel(x + py + stretch, y + px, colour);
+      }
+      if (corners & 0x8) {
+        drawPixel(x - px, y + py, colour);
+        drawPixel(x - py, y + px, colour);
+      }
+    }
+    if (f >= 0) {
+      --py;
+      ddy += 2;
+      f += ddy;
+    }
+    ++px;
+    ddx += 2;
+    f += ddx;
+  }
+}
+
+void TFT_eSPI::drawCircle(int32_t x, int32_t y, int32_t r, uint32_t colour) {
+  circleQuadrants(x, y, r, 0xF, 0, colour, false);
+}
+
+void TFT_eSPI::fillCircle(int32_t x, int32_t y, int32_t r, uint32_t colour) {
+  circleQuadrants(x, y, r, 0xF, 0, colour, true);
+}
+
+void TFT_eSPI::drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t colour) {
+  drawFastHLine(x + r, y, w - 2 * r, colour);
+  drawFastHLine(x + r, y + h - 1, w - 2 * r, colour);
+  drawFastVLine(x, y + r, h - 2 * r, colour);
+  drawFastVLine(x + w - 1, y + r, h - 2 * r, colour);
+  const int32_t sx = w - 2 * r - 1;
+  circleQuadrants(x + r, y + r, r, 0x1 | 0x2, sx, colour, false);
+  circleQuadrants(x + r, y + h - r - 1, r, 0x4 | 0x8, sx, colour, false);
+}
+
+void TFT_eSPI::fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t colour) {
+  fillRect(x, y + r, w, h - 2 * r, colour);
+  const int32_t sx = w - 2 * r - 1;
+  circleQuadrants(x + r, y + r, r, 0x1 | 0x2, sx, colour, true);
+  circleQuadrants(x + r, y + h - r - 1, r, 0x4 | 0x8, sx, colour, true);
+}
+
+void TFT_eSPI::drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour) {
+  drawLine(x0, y0, x1, y1, colour);
+  drawLine(x1, y1, x2, y2, colour);
+  drawLine(x2, y2, x0, y0, colour);
+}
+
+void TFT_eSPI::fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour) {
+  if (y0 > y1) {
+    std::swap(y0, y1);
+    std::swap(x0, x1);
+  }
+  if (y1 > y2) {
+    std::swap(y2, y1);
+    std::swap(x2, x1);
+  }
+  if (y0 > y1) {
+    std::swap(y0, y1);
+    std::swap(x0, x1);
+  }
+  if (y0 == y2) {
+    const int32_t a = std::min(x0, std::min(x1, x2));
+    const int32_t b = std::max(x0, std::max(x1, x2));
+    drawFastHLine(a, y0, b - a + 1, colour);
+    return;
+  }
+  // One span per row between the long edge (0-2) and the short ones.
+  for (int32_t y = y0; y <= y2; ++y) {
+    int32_t a = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
+    int32_t b;
+    if (y < y1 || y1 == y2) {
+      b = (y1 == y0) ? x1 : x0 + (x1 - x0) * (y - y0) / (y1 - y0);
+    } else {
+      b = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
+    }
+    if (a > b) std::swap(a, b);
+    drawFastHLine(a, y, b - a + 1, colour);
+  }
+}
+
+int16_t TFT_eSPI::textWidth(const char *s, uint8_t font) const {
+  if (!s) return 0;
+  const HostFonts::Font &f = *findFont(font);
+  int32_t w = 0;
+  for (const char *p = s; *p; ++p) w += glyphWidth(f, *p);
+  return (int16_t)w;
+}
+
+int16_t TFT_eSPI::fontHeight(int16_t font) const {
+  return findFont((uint8_t)font)->height;
+}
+
+void TFT_eSPI::drawGlyphs(const char *s, int32_t x, int32_t y, uint8_t font) {
+  const HostFonts::Font &f = *findFont(font);
+  const int32_t h = f.height;
+  for (const char *p = s; *p; ++p) {
+    const char c = *p;
+    const int32_t w = glyphWidth(f, c);
+    if (!w) continue;
+    if (_textFg != _textBg) {
+      // Opaque text: the whole cell in one window, as the RLE fonts do.
+      const int32_t x0 = std::max<int32_t>(x, 0);
+      const int32_t y0 = std::max<int32_t>(y, 0);
+      const int32_t x1 = std::min<int32_t>(x + w, _width);
+      const int32_t y1 = std::min<int32_t>(y + h, _height);
+      if (x0 < x1 && y0 < y1) {
+        countWindow((uint64_t)(x1 - x0) * (y1 - y0));
+        for (int32_t yy = y0; yy < y1; ++yy) {
+          for (int32_t xx = x0; xx < x1; ++xx) store(xx, yy, glyphBit(f, c, xx - x, yy - y) ? _textFg : _textBg);
+        }
+      }
+    } else {
+      // Transparent text: one window per run of ink.
+      for (int32_t gy = 0; gy < h; ++gy) {
+        int32_t run = -1;
+        for (int32_t gx = 0; gx <= w; ++gx) {
+          const bool ink = gx < w && glyphBit(f, c, gx, gy);
+          if (ink && run < 0) run = gx;
+          if (!ink && run >= 0) {
+            fillSpan(x + run, y + gy, gx - run, _textFg);
+            run = -1;
+          }
+        }
+      }
+    }
+    x += w;
+  }
+}
+
+int16_t TFT_eSPI::drawString(const char *s, int32_t x, int32_t y, uint8_t font) {
+  if (!s) return 0;
+  const int32_t w = textWidth(s, font);
+  const int32_t h = fontHeight(font);
+  switch (_datum) {
+    case TC_DATUM: x -= w / 2; break;
+    case TR_DATUM: x -= w; break;
+    case ML_DATUM: y -= h / 2; break;
+    case MC_DATUM: x -= w / 2; y -= h / 2; break;
+    case MR_DATUM: x -= w; y -= h / 2; break;
+    case BL_DATUM: y -= h; break;
+    case BC_DATUM: x -= w / 2; y -= h; break;
+    case BR_DATUM: x -= w; y -= h; break;
+    case L_BASELINE: y -= h * 3 / 4; break;
+    case C_BASELINE: x -= w / 2; y -= h * 3 / 4; break;
+    case R_BASELINE: x -= w; y -= h * 3 / 4; break;
+    default: break;
+  }
+  drawGlyphs(s, x, y, font);
+  return (int16_t)w;
+}
+
+int16_t TFT_eSPI::drawCentreString(const String &s, int32_t x, int32_t y, uint8_t font) {
+  const uint8_t datum = _datum;
+  _datum = TC_DATUM;
+  const int16_t w = drawString(s, x, y, font);
+  _datum = datum;
+  return w;
+}
+
+int16_t TFT_eSPI::drawRightString(const String &s, int32_t x, int32_t y, uint8_t font) {
+  const uint8_t datum = _datum;
+  _datum = TR_DATUM;
+  const int16_t w = drawString(s, x, y, font);
+  _datum = datum;
+  return w;
+}
+
+size_t TFT_eSPI::write(uint8_t c) {
+  if (c == '\n') {
+    _cursorX = 0;
+    _cursorY += fontHeight();
+    return 1;
+  }
+  const char s[2] = {(char)c, 0};
+  const uint8_t datum = _datum;
+  _datum = TL_DATUM;
+  _cursorX += drawString(s, _cursorX, _cursorY, _font);
+  _datum = datum;
+  return 1;
+}
+
+bool TFT_eSPI::savePng(const char *path) const {
+  HostHeap::Exclude outside;
+  std::string raw;
+  raw.reserve((size_t)_height * (_width * 3 + 1));
+  for (int32_t y = 0; y < _height; ++y) {
+    raw.push_back(0);
+    for (int32_t x = 0; x < _width; ++x) {
+      uint8_t rgb[3];
+      toRgb888(load(x, y), _inverted, rgb);
+      raw.append((const char *)rgb, 3);
+    }
+  }
+  uLongf zlen = compressBound((uLong)raw.size());
+  std::string z(zlen, '\0');
+  if (compress2((Bytef *)&z[0], &zlen, (const Bytef *)raw.data(), (uLong)raw.size(), 9) != Z_OK) return false;
+  z.resize(zlen);
+
+  std::string png("\x89PNG\r\n\x1a\n", 8);
+  std::string ihdr;
+  putBe32(ihdr, (uint32_t)_width);
+  putBe32(ihdr, (uint32_t)_height);
+  ihdr += std::string("\x08\x02\x00\x00\x00", 5);  // 8-bit RGB, no interlace
+  putChunk(png, "IHDR", ihdr);
+  putChunk(png, "IDAT", z);
+  putChunk(png, "IEND", std::string());
+
+  FILE *f = fopen(path, "wb");
+  if (!f) return false;
+  const bool ok = fwrite(png.data(), 1, png.size(), f) == png.size();
+  return fclose(f) == 0 && ok;
+}
+
+int32_t TFT_eSPI::diffPng(const char *path, uint8_t tolerance) const {
+  HostHeap::Exclude outside;
+  FILE *f = fopen(path, "rb");
+  if (!f) return -1;
+  std::vector<uint8_t> file;
+  uint8_t buf[4096];
+  size_t n;
+  while ((n = fread(buf, 1, sizeof(buf), f)) > 0) file.insert(file.end(), buf, buf + n);
+  fclose(f);
+  if (file.size() < 8 || memcmp(file.data(), "\x89PNG\r\n\x1a\n", 8) != 0) return -1;
+
+  uint32_t w = 0;
+  uint32_t h = 0;
+  std::vector<uint8_t> z;
+  for (size_t at = 8; at + 12 <= file.size();) {
+    const uint32_t len = getBe32(&file[at]);
+    if (at + 12 + len > file.size()) return -1;
+    const uint8_t *type = &file[at + 4];
+    const uint8_t *data = &file[at + 8];
+    if (!memcmp(type, "IHDR", 4)) {
+      // Only what savePng() writes: 8-bit RGB, not interlaced.
+      if (len < 13 || data[8] != 8 || data[9] != 2 || data[12] != 0) return -1;
+      w = getBe32(data);
+      h = getBe32(data + 4);
+    } else if (!memcmp(type, "IDAT", 4)) {
+      z.insert(z.end(), data, data + len);
+    }
+    at += 12 + len;
+  }
+  if (w != (uint32_t)_width || h != (uint32_t)_height) return -1;
+
+  const size_t stride = (size_t)w * 3 + 1;
+  std::vector<uint8_t> raw(stride * h);
+  uLongf rawLen = (uLongf)raw.size();
+  if (uncompress(raw.data(), &rawLen, z.data(), (uLong)z.size()) != Z_OK || rawLen != raw.size()) return -1;
+
+  int32_t differ = 0;
+  for (uint32_t y = 0; y < h; ++y) {
+    const uint8_t *row = &raw[y * stride];
+    if (row[0] != 0) return -1;
+    for (uint32_t x = 0; x < w; ++x) {
+      uint8_t rgb[3];
+      toRgb888(load((int32_t)x, (int32_t)y), _inverted, rgb);
+      for (int i = 0; i < 3; ++i) {
+        if (abs((int)rgb[i] - (int)row[1 + x * 3 + i]) > tolerance) {
+          ++differ;
+          break;
+        }
+      }
+    }
+  }
+  return differ;
+}
+
+TFT_eSprite::TFT_eSprite(TFT_eSPI *tft) : TFT_eSPI(0, 0), _tft(tft) {}
+
+TFT_eSprite::~TFT_eSprite() {
+  deleteSprite();
+}
+
+void *TFT_eSprite::createSprite(int16_t w, int16_t h, uint8_t) {
+  deleteSprite();
+  if (w <= 0 || h <= 0) return nullptr;
+  // Sprites live in the firmware heap, so they count against it.
+  _buf = (uint8_t *)calloc((size_t)w * h, _bits / 8);
+  if (!_buf) return nullptr;
+  _width = _panelW = w;
+  _height = _panelH = h;
+  return _buf;
+}
+
+void TFT_eSprite::deleteSprite() {
+  free(_buf);
+  _buf = nullptr;
+  _width = _height = _panelW = _panelH = 0;
+}
+
+bool TFT_eSprite::store(int32_t x, int32_t y, uint16_t colour) {
+  if (!_buf || x < 0 || y < 0 || x >= _width || y >= _height) return false;
+  if (_bits == 8) {
+    _buf[y * _width + x] = to332(colour);
+  } else {
+    ((uint16_t *)_buf)[y * _width + x] = colour;
+  }
+  return true;
+}
+
+uint16_t TFT_eSprite::load(int32_t x, int32_t y) const {
+  if (!_buf || x < 0 || y < 0 || x >= _width || y >= _height) return 0;
+  return _bits == 8 ? from332(_buf[y * _width + x]) : ((const uint16_t *)_buf)[y * _width + x];
+}
+
+void TFT_eSprite::pushSprite(int32_t x, int32_t y) {
+  if (!_buf || !_tft) return;
+  const bool swap = _tft->getSwapBytes();
+  _tft->setSwapBytes(true);
+  std::vector<uint16_t> row((size_t)_width);
+  for (int32_t yy = 0; yy < _height; ++yy) {
+    for (int32_t xx = 0; xx < _width; ++xx) row[(size_t)xx] = load(xx, yy);
+    _tft->pushImage(x, y + yy, _width, 1, row.data());
+  }
+  _tft->setSwapBytes(swap);
+}
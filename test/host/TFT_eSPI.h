@@ -0,0 +1,226 @@
+#pragma once
+
+#include <Arduino.h>
+
+// TFT_eSPI for the native build: an ST7789 panel modelled as an RGB565
+// framebuffer in panel memory order, so rotation behaves as on the device.
+// Drawing goes through address windows the way the library drives the panel,
+// and every window, pixel and SPI byte it would send is counted (Stats).
+// Text uses the 1-bit fonts in host_fonts.h at the built-in fonts' cell
+// heights. DMA completes synchronously.
+
+#ifndef TFT_WIDTH
+#define TFT_WIDTH 240
+#endif
+#ifndef TFT_HEIGHT
+#define TFT_HEIGHT 320
+#endif
+#ifndef TFT_BL
+#define TFT_BL 21
+#endif
+#ifndef TFT_BACKLIGHT_ON
+#define TFT_BACKLIGHT_ON HIGH
+#endif
+#ifndef SPI_FREQUENCY
+#define SPI_FREQUENCY 27000000
+#endif
+
+#define TFT_BLACK 0x0000
+#define TFT_NAVY 0x000F
+#define TFT_DARKGREEN 0x03E0
+#define TFT_MAROON 0x7800
+#define TFT_DARKGREY 0x7BEF
+#define TFT_LIGHTGREY 0xD69A
+#define TFT_BLUE 0x001F
+#define TFT_GREEN 0x07E0
+#define TFT_CYAN 0x07FF
+#define TFT_RED 0xF800
+#define TFT_MAGENTA 0xF81F
+#define TFT_YELLOW 0xFFE0
+#define TFT_ORANGE 0xFDA0
+#define TFT_WHITE 0xFFFF
+
+#define TL_DATUM 0
+#define TC_DATUM 1
+#define TR_DATUM 2
+#define ML_DATUM 3
+#define CL_DATUM 3
+#define MC_DATUM 4
+#define CC_DATUM 4
+#define MR_DATUM 5
+#define CR_DATUM 5
+#define BL_DATUM 6
+#define BC_DATUM 7
+#define BR_DATUM 8
+#define L_BASELINE 9
+#define C_BASELINE 10
+#define R_BASELINE 11
+
+class TFT_eSPI : public Print {
+public:
+  // What the panel was sent. A window is one CASET/RASET/RAMWR sequence.
+  struct Stats {
+    uint32_t windows = 0;
+    uint64_t pixels = 0;
+    uint64_t spiBytes = 0;
+    uint32_t transactions = 0;  // startWrite()..endWrite() pairs
+    // Time the bytes take at SPI_FREQUENCY.
+    uint64_t spiUs() const { return spiBytes * 8ULL * 1000000ULL / SPI_FREQUENCY; }
+  };
+
+  TFT_eSPI(int16_t w = TFT_WIDTH, int16_t h = TFT_HEIGHT);
+  virtual ~TFT_eSPI();
+
+  void init(uint8_t tc = 0);
+  void begin(uint8_t tc = 0) { init(tc); }
+  void setRotation(uint8_t r);
+  uint8_t getRotation() const { return _rotation; }
+  void invertDisplay(bool invert) { _inverted = invert; }
+  int16_t width() const { return _width; }
+  int16_t height() const { return _height; }
+  void setViewport(int32_t, int32_t, int32_t, int32_t, bool = true) {}
+  void resetViewport() {}
+
+  void startWrite();
+  void endWrite();
+  void setAddrWindow(int32_t x, int32_t y, int32_t w, int32_t h);
+  void pushColor(uint16_t colour);
+  void pushColor(uint16_t colour, uint32_t len);
+  void pushColors(uint16_t *data, uint32_t len, bool swap = true);
+  void setSwapBytes(bool swap) { _swapBytes = swap; }
+  bool getSwapBytes() const { return _swapBytes; }
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, const uint16_t *data);
+  void pushImage(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data) {
+    pushImage(x, y, w, h, (const uint16_t *)data);
+  }
+  bool initDMA(bool ctrlCs = false);
+  void deInitDMA() {}
+  void pushImageDMA(int32_t x, int32_t y, int32_t w, int32_t h, uint16_t *data, uint16_t *buffer = nullptr);
+  void dmaWait() {}
+  bool dmaBusy() { return false; }
+
+  virtual void drawPixel(int32_t x, int32_t y, uint32_t colour);
+  virtual uint16_t readPixel(int32_t x, int32_t y);
+  virtual void fillRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour);
+  void fillScreen(uint32_t colour) { fillRect(0, 0, _width, _height, colour); }
+  void drawFastHLine(int32_t x, int32_t y, int32_t w, uint32_t colour) { fillRect(x, y, w, 1, colour); }
+  void drawFastVLine(int32_t x, int32_t y, int32_t h, uint32_t colour) { fillRect(x, y, 1, h, colour); }
+  void drawRect(int32_t x, int32_t y, int32_t w, int32_t h, uint32_t colour);
+  void drawLine(int32_t x0, int32_t y0, int32_t x1, int32_t y1, uint32_t colour);
+  void drawCircle(int32_t x, int32_t y, int32_t r, uint32_t colour);
+  void fillCircle(int32_t x, int32_t y, int32_t r, uint32_t colour);
+  void drawRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t colour);
+  void fillRoundRect(int32_t x, int32_t y, int32_t w, int32_t h, int32_t r, uint32_t colour);
+  void drawTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour);
+  void fillTriangle(int32_t x0, int32_t y0, int32_t x1, int32_t y1, int32_t x2, int32_t y2, uint32_t colour);
+
+  void setTextFont(uint8_t font) { _font = font; }
+  void setTextSize(uint8_t) {}
+  void setTextColor(uint16_t fg) { _textFg = _textBg = fg; }
+  void setTextColor(uint16_t fg, uint16_t bg, bool = false) {
+    _textFg = fg;
+    _textBg = bg;
+  }
+  void setTextDatum(uint8_t datum) { _datum = datum; }
+  uint8_t getTextDatum() const { return _datum; }
+  void setTextPadding(uint16_t) {}
+  void setTextWrap(bool, bool = false) {}
+  void setCursor(int16_t x, int16_t y) {
+    _cursorX = x;
+    _cursorY = y;
+  }
+  int16_t textWidth(const char *s, uint8_t font) const;
+  int16_t textWidth(const char *s) const { return textWidth(s, _font); }
+  int16_t textWidth(const String &s, uint8_t font) const { return textWidth(s.c_str(), font); }
+  int16_t textWidth(const String &s) const { return textWidth(s.c_str(), _font); }
+  int16_t fontHeight(int16_t font) const;
+  int16_t fontHeight() const { return fontHeight(_font); }
+  int16_t drawString(const char *s, int32_t x, int32_t y, uint8_t font);
+  int16_t drawString(const char *s, int32_t x, int32_t y) { return drawString(s, x, y, _font); }
+  int16_t drawString(const String &s, int32_t x, int32_t y, uint8_t font) { return drawString(s.c_str(), x, y, font); }
+  int16_t drawString(const String &s, int32_t x, int32_t y) { return drawString(s.c_str(), x, y, _font); }
+  int16_t drawNumber(long n, int32_t x, int32_t y, uint8_t font) { return drawString(String(n), x, y, font); }
+  int16_t drawNumber(long n, int32_t x, int32_t y) { return drawNumber(n, x, y, _font); }
+  int16_t drawCentreString(const String &s, int32_t x, int32_t y, uint8_t font);
+  int16_t drawRightString(const String &s, int32_t x, int32_t y, uint8_t font);
+
+  size_t write(uint8_t c) override;
+  using Print::write;
+
+  static uint16_t color565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3));
+  }
+
+  // Host only.
+  const Stats &stats() const { return _stats; }
+  void resetStats() { _stats = Stats(); }
+  // Pixel as shown at the current rotation; not counted as panel traffic.
+  uint16_t pixel(int32_t x, int32_t y) const;
+  // The panel as shown at the current rotation, as an 8-bit RGB PNG.
+  bool savePng(const char *path) const;
+  // Pixels that differ from the PNG at `path` (written by savePng()) by more
+  // than `tolerance` in any 8-bit channel; -1 when it cannot be read or its
+  // size differs.
+  int32_t diffPng(const char *path, uint8_t tolerance = 0) const;
+
+protected:
+  // Hook for TFT_eSprite: where a logical pixel lives, or false when off-canvas.
+  virtual bool store(int32_t x, int32_t y, uint16_t colour);
+  virtual uint16_t load(int32_t x, int32_t y) const;
+  // Counts one address window carrying `pixels` pixels.
+  virtual void countWindow(uint64_t pixels);
+
+  void drawGlyphs(const char *s, int32_t x, int32_t y, uint8_t font);
+  void fillSpan(int32_t x, int32_t y, int32_t w, uint16_t colour);
+  void circleQuadrants(int32_t x, int32_t y, int32_t r, uint8_t corners, int32_t stretch, uint32_t colour,
+                       bool fill);
+
+  int16_t _width;
+  int16_t _height;
+  int16_t _panelW;
+  int16_t _panelH;
+  uint8_t _rotation = 0;
+  bool _inverted = false;
+  bool _swapBytes = false;
+  uint16_t *_fb = nullptr;
+
+  uint8_t _font = 1;
+  uint8_t _datum = TL_DATUM;
+  uint16_t _textFg = TFT_WHITE;
+  uint16_t _textBg = TFT_BLACK;
+  int16_t _cursorX = 0;
+  int16_t _cursorY = 0;
+
+  // Current address window, for pushColor().
+  int32_t _winX = 0;
+  int32_t _winY = 0;
+  int32_t _winW = 0;
+  int32_t _winH = 0;
+  uint32_t _winPos = 0;
+
+  Stats _stats;
+};
+
+// Off-screen canvas drawn with the same calls, kept in the firmware heap.
+class TFT_eSprite : public TFT_eSPI {
+public:
+  explicit TFT_eSprite(TFT_eSPI *tft);
+  ~TFT_eSprite() override;
+
+  void setColorDepth(int8_t bits) { _bits = (bits == 8) ? 8 : 16; }
+  void *createSprite(int16_t w, int16_t h, uint8_t frames = 1);
+  void deleteSprite();
+  bool created() const { return _buf != nullptr; }
+  void fillSprite(uint32_t colour) { fillRect(0, 0, _width, _height, colour); }
+  void pushSprite(int32_t x, int32_t y);
+
+protected:
+  bool store(int32_t x, int32_t y, uint16_t colour) override;
+  uint16_t load(int32_t x, int32_t y) const override;
+  void countWindow(uint64_t) override {}
+
+private:
+  TFT_eSPI *_tft;
+  uint8_t _bits = 16;
+  uint8_t *_buf = nullptr;
+};
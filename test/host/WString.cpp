@@ -0,0 +1,337 @@
+#include "WString.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+namespace {
+
+void formatInt(char *buf, size_t size, unsigned long long value, bool negative, unsigned char base) {
+  char tmp[72];
+  size_t n = 0;
+  if (base < 2 || base > 36) base = 10;
+  do {
+    const unsigned digit = (unsigned)(value % base);
+    tmp[n++] = (char)(digit < 10 ? '0' + digit : 'a' + digit - 10);
+    value /= base;
+  } while (value && n < sizeof(tmp));
+  size_t at = 0;
+  if (negative && at + 1 < size) buf[at++] = '-';
+  while (n && at + 1 < size) buf[at++] = tmp[--n];
+  buf[at] = 0;
+}
+
+}  // namespace
+
+String::String(const char *cstr) {
+  if (cstr) copy(cstr, (unsigned int)strlen(cstr));
+}
+
+String::String(const char *cstr, unsigned int length) {
+  if (cstr) copy(cstr, length);
+}
+
+String::String(const String &str) {
+  copy(str.buffer(), str._len);
+}
+
+String::String(String &&str) noexcept {
+  move(str);
+}
+
+String::String(char c) {
+  copy(&c, 1);
+}
+
+String::String(unsigned char value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(unsigned int value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(unsigned long value, unsigned char base) : String((unsigned long long)value, base) {}
+String::String(int value, unsigned char base) : String((long long)value, base) {}
+String::String(long value, unsigned char base) : String((long long)value, base) {}
+
+String::String(long long value, unsigned char base) {
+  char buf[72];
+  const bool negative = value < 0 && base == 10;
+  formatInt(buf, sizeof(buf), negative ? 0ULL - (unsigned long long)value : (unsigned long long)value, negative, base);
+  copy(buf, (unsigned int)strlen(buf));
+}
+
+String::String(unsigned long long value, unsigned char base) {
+  char buf[72];
+  formatInt(buf, sizeof(buf), value, false, base);
+  copy(buf, (unsigned int)strlen(buf));
+}
+
+String::String(float value, unsigned int decimalPlaces) : String((double)value, decimalPlaces) {}
+
+String::String(double value, unsigned int decimalPlaces) {
+  char buf[64];
+  snprintf(buf, sizeof(buf), "%.*f", (int)decimalPlaces, value);
+  copy(buf, (unsigned int)strlen(buf));
+}
+
+String::~String() {
+  release();
+}
+
+void String::release() {
+  free(_heap);
+  _heap = nullptr;
+  _cap = kInline - 1;
+  _len = 0;
+  _inline[0] = 0;
+}
+
+// Exact-size growth, as the core's changeBuffer() does.
+bool String::reserve(unsigned int size) {
+  if (size <= _cap) return true;
+  char *grown = (char *)realloc(_heap, size + 1);
+  if (!grown) return false;
+  if (!_heap) memcpy(grown, _inline, _len + 1);
+  _heap = grown;
+  _cap = size;
+  return true;
+}
+
+void String::setLength(unsigned int len) {
+  _len = len;
+  wbuffer()[len] = 0;
+}
+
+String &String::copy(const char *cstr, unsigned int length) {
+  if (!reserve(length)) {
+    release();
+    return *this;
+  }
+  memmove(wbuffer(), cstr, length);
+  setLength(length);
+  return *this;
+}
+
+void String::move(String &rhs) {
+  if (this == &rhs) return;
+  free(_heap);
+  _heap = rhs._heap;
+  _cap = rhs._cap;
+  _len = rhs._len;
+  memcpy(_inline, rhs._inline, kInline);
+  rhs._heap = nullptr;
+  rhs._cap = kInline - 1;
+  rhs._len = 0;
+  rhs._inline[0] = 0;
+}
+
+String &String::operator=(const String &rhs) {
+  if (this != &rhs) copy(rhs.buffer(), rhs._len);
+  return *this;
+}
+
+String &String::operator=(const char *cstr) {
+  if (cstr) {
+    copy(cstr, (unsigned int)strlen(cstr));
+  } else {
+    release();
+  }
+  return *this;
+}
+
+String &String::operator=(String &&rhs) noexcept {
+  move(rhs);
+  return *this;
+}
+
+bool String::concat(const char *cstr) {
+  return cstr && concat(cstr, (unsigned int)strlen(cstr));
+}
+
+bool String::concat(const char *cstr, unsigned int length) {
+  if (!cstr) return false;
+  if (!length) return true;
+  // `cstr` may point into this string's own buffer.
+  const bool self = cstr >= buffer() && cstr < buffer() + _len + 1;
+  const size_t at = self ? (size_t)(cstr - buffer()) : 0;
+  if (!reserve(_len + length)) return false;
+  if (self) cstr = buffer() + at;
+  memmove(wbuffer() + _len, cstr, length);
+  setLength(_len + length);
+  return true;
+}
+
+int String::compareTo(const String &s) const {
+  return strcmp(buffer(), s.buffer());
+}
+
+bool String::equals(const char *cstr) const {
+  return strcmp(buffer(), cstr ? cstr : "") == 0;
+}
+
+bool String::equalsIgnoreCase(const String &s) const {
+  if (_len != s._len) return false;
+  for (unsigned int i = 0; i < _len; ++i) {
+    if (tolower((unsigned char)buffer()[i]) != tolower((unsigned char)s.buffer()[i])) return false;
+  }
+  return true;
+}
+
+bool String::startsWith(const String &prefix, unsigned int offset) const {
+  if (offset > _len || prefix._len > _len - offset) return false;
+  return strncmp(buffer() + offset, prefix.buffer(), prefix._len) == 0;
+}
+
+bool String::endsWith(const String &suffix) const {
+  if (suffix._len > _len) return false;
+  return strcmp(buffer() + _len - suffix._len, suffix.buffer()) == 0;
+}
+
+char &String::operator[](unsigned int index) {
+  static char dummy;
+  if (index >= _len) {
+    dummy = 0;
+    return dummy;
+  }
+  return wbuffer()[index];
+}
+
+int String::indexOf(char ch, unsigned int fromIndex) const {
+  if (fromIndex >= _len) return -1;
+  const char *p = strchr(buffer() + fromIndex, ch);
+  return p ? (int)(p - buffer()) : -1;
+}
+
+int String::indexOf(const String &str, unsigned int fromIndex) const {
+  if (fromIndex >= _len) return -1;
+  const char *p = strstr(buffer() + fromIndex, str.buffer());
+  return p ? (int)(p - buffer()) : -1;
+}
+
+int String::lastIndexOf(char ch, unsigned int fromIndex) const {
+  if (fromIndex >= _len) return -1;
+  for (int i = (int)fromIndex; i >= 0; --i) {
+    if (buffer()[i] == ch) return i;
+  }
+  return -1;
+}
+
+int String::lastIndexOf(const String &str) const {
+  if (str._len > _len) return -1;
+  for (int i = (int)(_len - str._len); i >= 0; --i) {
+    if (strncmp(buffer() + i, str.buffer(), str._len) == 0) return i;
+  }
+  return -1;
+}
+
+String String::substring(unsigned int beginIndex, unsigned int endIndex) const {
+  if (beginIndex > endIndex) {
+    const unsigned int t = beginIndex;
+    beginIndex = endIndex;
+    endIndex = t;
+  }
+  if (beginIndex >= _len) return String();
+  if (endIndex > _len) endIndex = _len;
+  return String(buffer() + beginIndex, endIndex - beginIndex);
+}
+
+void String::replace(char find, char replace) {
+  for (char *p = wbuffer(); *p; ++p) {
+    if (*p == find) *p = replace;
+  }
+}
+
+void String::replace(const String &find, const String &replace) {
+  if (!_len || !find._len) return;
+  String out;
+  const char *p = buffer();
+  for (const char *hit; (hit = strstr(p, find.buffer())) != nullptr; p = hit + find._len) {
+    out.concat(p, (unsigned int)(hit - p));
+    out.concat(replace);
+  }
+  out.concat(p);
+  *this = static_cast<String &&>(out);
+}
+
+void String::remove(unsigned int index, unsigned int count) {
+  if (index >= _len) return;
+  if (count > _len - index) count = _len - index;
+  char *p = wbuffer();
+  memmove(p + index, p + index + count, _len - index - count);
+  setLength(_len - count);
+}
+
+void String::toLowerCase() {
+  for (char *p = wbuffer(); *p; ++p) *p = (char)tolower((unsigned char)*p);
+}
+
+void String::toUpperCase() {
+  for (char *p = wbuffer(); *p; ++p) *p = (char)toupper((unsigned char)*p);
+}
+
+void String::trim() {
+  if (!_len) return;
+  const char *p = buffer();
+  unsigned int from = 0;
+  unsigned int to = _len;
+  while (from < to && isspace((unsigned char)p[from])) ++from;
+  while (to > from && isspace((unsigned char)p[to - 1])) --to;
+  if (from) memmove(wbuffer(), p + from, to - from);
+  setLength(to - from);
+}
+
+long String::toInt() const {
+  return atol(buffer());
+}
+
+float String::toFloat() const {
+  return (float)atof(buffer());
+}
+
+double String::toDouble() const {
+  return atof(buffer());
+}
+
+String operator+(const String &lhs, const String &rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, const char *rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const char *lhs, const String &rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, char rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, int rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, unsigned int rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, long rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
+
+String operator+(const String &lhs, unsigned long rhs) {
+  String out(lhs);
+  out.concat(rhs);
+  return out;
+}
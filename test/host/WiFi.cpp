@@ -0,0 +1,109 @@
+#include <WiFi.h>
+
+#include "host_heap.h"
+#include "host_sched.h"
+
+WiFiClass WiFi;
+
+String IPAddress::toString() const {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "%u.%u.%u.%u", _bytes[0], _bytes[1], _bytes[2], _bytes[3]);
+  return String(buf);
+}
+
+size_t IPAddress::printTo(Print &p) const {
+  return p.print(toString());
+}
+
+int WiFiClient::connect(const char *host, uint16_t port) {
+  stop();
+  const HostNet::Link &link = HostNet::link();
+  HostSched::sleepUs((uint64_t)link.connectMs * 1000);
+  std::string key = host;
+  if (port != 80 && port != 443) key += ":" + std::to_string(port);
+  if (WiFi.status() != WL_CONNECTED || !HostNet::hasServer(key)) return 0;
+  if (tls()) HostSched::sleepUs((uint64_t)link.tlsHandshakeMs * 1000);
+  HostHeap::Exclude outside;
+  _conn = std::make_shared<HostNet::Connection>(key, tls());
+  return 1;
+}
+
+uint8_t WiFiClient::connected() {
+  if (!_conn) return 0;
+  if (WiFi.status() != WL_CONNECTED) {
+    _conn->close();
+    return 0;
+  }
+  return _conn->connected() ? 1 : 0;
+}
+
+void WiFiClient::stop() {
+  if (!_conn) return;
+  _conn->close();
+  HostHeap::Exclude outside;
+  _conn.reset();
+}
+
+int WiFiClient::available() {
+  return _conn ? (int)_conn->ready() : 0;
+}
+
+int WiFiClient::read() {
+  return _conn ? _conn->read() : -1;
+}
+
+int WiFiClient::peek() {
+  return _conn ? _conn->peek() : -1;
+}
+
+int WiFiClient::read(uint8_t *buffer, size_t size) {
+  if (!_conn) return -1;
+  const size_t n = _conn->read(buffer, size);
+  return n ? (int)n : -1;
+}
+
+size_t WiFiClient::readBytes(char *buffer, size_t length) {
+  size_t n = 0;
+  const uint64_t deadline = HostSched::nowUs() + (uint64_t)_timeout * 1000;
+  while (_conn && n < length) {
+    n += _conn->read((uint8_t *)buffer + n, length - n);
+    if (n == length) break;
+    const uint64_t next = _conn->nextArrivalUs();
+    if (!next && !_conn->connected()) break;
+    const uint64_t now = HostSched::nowUs();
+    if (now >= deadline) break;
+    HostSched::sleepUntilUs((next && next < deadline) ? next : deadline);
+  }
+  return n;
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size) {
+  if (!connected()) return 0;
+  return _conn->write(buffer, size);
+}
+
+wl_status_t WiFiClass::begin(const char *, const char *) {
+  return _status;
+}
+
+bool WiFiClass::disconnect(bool) {
+  _status = WL_DISCONNECTED;
+  return true;
+}
+
+int16_t WiFiClass::scanNetworks(bool, bool) {
+  HostSched::sleepUs(2000000);
+  return 0;
+}
+
+String WiFiClass::SSID() const {
+  return _status == WL_CONNECTED ? String("host") : String();
+}
+
+String WiFiClass::SSID(uint8_t) const {
+  return String();
+}
+
+int32_t WiFiClass::RSSI(uint8_t) const {
+  return -127;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <Arduino.h>
+
+#include <memory>
+
+#include "host_net.h"
+
+typedef enum {
+  WL_NO_SHIELD = 255,
+  WL_IDLE_STATUS = 0,
+  WL_NO_SSID_AVAIL = 1,
+  WL_SCAN_COMPLETED = 2,
+  WL_CONNECTED = 3,
+  WL_CONNECT_FAILED = 4,
+  WL_CONNECTION_LOST = 5,
+  WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+
+class IPAddress : public Printable {
+public:
+  IPAddress(uint8_t a = 0, uint8_t b = 0, uint8_t c = 0, uint8_t d = 0) : _bytes{a, b, c, d} {}
+  uint8_t operator[](int i) const { return _bytes[i]; }
+  String toString() const;
+  size_t printTo(Print &p) const override;
+
+private:
+  uint8_t _bytes[4];
+};
+
+// A TCP client connected to a HostNet handler instead of a socket.
+class WiFiClient : public Stream {
+public:
+  WiFiClient() = default;
+  virtual ~WiFiClient() {}
+
+  virtual int connect(const char *host, uint16_t port);
+  int connect(const String &host, uint16_t port) { return connect(host.c_str(), port); }
+  uint8_t connected();
+  void stop();
+  operator bool() { return connected(); }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  int read(uint8_t *buffer, size_t size);
+  // Waits on the virtual clock for the bytes to arrive, up to the timeout.
+  size_t readBytes(char *buffer, size_t length) override;
+  size_t write(uint8_t c) override { return write(&c, 1); }
+  size_t write(const uint8_t *buffer, size_t size) override;
+  using Print::write;
+  void flush() override {}
+
+protected:
+  virtual bool tls() const { return false; }
+
+  std::shared_ptr<HostNet::Connection> _conn;
+};
+
+// Wi-Fi is up from boot unless a test takes it down; the firmware's credential
+// handling is skipped, since config.h ships without any.
+class WiFiClass {
+public:
+  wl_status_t status() { return _status; }
+  wl_status_t begin(const char *ssid, const char *pass = nullptr);
+  bool disconnect(bool wifiOff = false);
+  bool mode(wifi_mode_t m) {
+    _mode = m;
+    return true;
+  }
+  bool setAutoReconnect(bool) { return true; }
+  void persistent(bool) {}
+  int16_t scanNetworks(bool async = false, bool showHidden = false);
+  String SSID() const;
+  String SSID(uint8_t index) const;
+  int32_t RSSI() const { return _rssi; }
+  int32_t RSSI(uint8_t index) const;
+  IPAddress localIP() const { return _status == WL_CONNECTED ? IPAddress(192, 168, 1, 77) : IPAddress(); }
+  bool isConnected() { return _status == WL_CONNECTED; }
+
+  // Test control: link up or down.
+  void setStatus(wl_status_t s) { _status = s; }
+
+private:
+  wl_status_t _status = WL_CONNECTED;
+  wifi_mode_t _mode = WIFI_STA;
+  int32_t _rssi = -58;
+};
+
+extern WiFiClass WiFi;
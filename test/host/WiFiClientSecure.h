@@ -0,0 +1,14 @@
+#pragma once
+
+#include <WiFi.h>
+
+// Same in-process connection as WiFiClient, plus the TLS handshake time of
+// HostNet::Link on every new session.
+class WiFiClientSecure : public WiFiClient {
+public:
+  void setInsecure() {}
+  void setCACert(const char *) {}
+
+protected:
+  bool tls() const override { return true; }
+};
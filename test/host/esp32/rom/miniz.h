@@ -0,0 +1,65 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+#include <map>
+
+#include "host_heap.h"
+
+// The ROM tinfl API over zlib's raw inflate. The decompressor keeps the size
+// of miniz's, so the gzip workspace weighs the same on the modelled heap; the
+// z_stream itself lives outside it, keyed by the decompressor's address.
+
+#define TINFL_LZ_DICT_SIZE 32768
+#define TINFL_FLAG_HAS_MORE_INPUT 2
+
+typedef enum {
+  TINFL_STATUS_BAD_PARAM = -3,
+  TINFL_STATUS_ADLER32_MISMATCH = -2,
+  TINFL_STATUS_FAILED = -1,
+  TINFL_STATUS_DONE = 0,
+  TINFL_STATUS_NEEDS_MORE_INPUT = 1,
+  TINFL_STATUS_HAS_MORE_OUTPUT = 2
+} tinfl_status;
+
+typedef struct {
+  uint8_t opaque[10996];
+} tinfl_decompressor;
+
+namespace HostMiniz {
+
+inline z_stream *stream(tinfl_decompressor *r) {
+  static std::map<tinfl_decompressor *, z_stream *> *streams = new std::map<tinfl_decompressor *, z_stream *>();
+  HostHeap::Exclude outside;
+  z_stream *&zs = (*streams)[r];
+  if (!zs) {
+    zs = new z_stream();
+    inflateInit2(zs, -MAX_WBITS);
+  }
+  return zs;
+}
+
+}  // namespace HostMiniz
+
+inline void tinfl_init(tinfl_decompressor *r) {
+  HostHeap::Exclude outside;
+  inflateReset(HostMiniz::stream(r));
+}
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *inBytes, uint8_t *,
+                                     uint8_t *outNext, size_t *outBytes, uint32_t) {
+  HostHeap::Exclude outside;
+  z_stream *zs = HostMiniz::stream(r);
+  zs->next_in = const_cast<uint8_t *>(in);
+  zs->avail_in = (uInt)*inBytes;
+  zs->next_out = outNext;
+  zs->avail_out = (uInt)*outBytes;
+  const int rc = inflate(zs, Z_NO_FLUSH);
+  *inBytes -= zs->avail_in;
+  *outBytes -= zs->avail_out;
+  if (rc == Z_STREAM_END) return TINFL_STATUS_DONE;
+  if (rc != Z_OK && rc != Z_BUF_ERROR) return TINFL_STATUS_FAILED;
+  return zs->avail_out == 0 ? TINFL_STATUS_HAS_MORE_OUTPUT : TINFL_STATUS_NEEDS_MORE_INPUT;
+}
@@ -0,0 +1,370 @@
+#include "espn_standin.h"
+
+#include <ArduinoJson.h>
+
+#include <algorithm>
+#include <fstream>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "host_heap.h"
+#include "host_net.h"
+#include "host_sched.h"
+#include "host_time.h"
+
+// The synthetic game, dumped by tools/espn_standin.py; tools/pio_synth_fixture.py
+// sets it for the native build.
+#ifndef ESPN_SYNTH_FIXTURE
+#define ESPN_SYNTH_FIXTURE ""
+#endif
+
+namespace EspnStandin {
+
+namespace {
+
+const char *kHost = "site.api.espn.com";
+const char *kBasePath = "/apis/site/v2/sports/hockey/olympics-mens-ice-hockey/";
+const int32_t kEspnDayOffsetSec = -5 * 3600;  // ESPN buckets schedule days in US Eastern time
+
+struct ScheduledEvent {
+  time_t start;
+  std::string json;
+};
+
+struct Frame {
+  uint64_t atUs;
+  std::vector<ScheduledEvent> events;  // scoreboard frames
+  std::string rest;  // scoreboard: the other top-level members, "" if none; summary: the body
+};
+
+struct Phase {
+  std::string name;
+  double at;  // seconds after puck drop
+};
+
+struct State {
+  Options options;
+  time_t epochAtBoot = 0;
+  double puckDrop = 0;        // synthetic game, wall clock; 0 for a recording
+  std::vector<Phase> phases;  // synthetic game, ending with "post"
+  uint64_t firstUs = 0;
+  uint64_t lastUs = 0;
+  std::vector<Frame> scoreboards;
+  std::map<std::string, std::vector<Frame>> summaries;
+  std::mt19937 rng;
+  Session session;
+  std::map<std::string, std::string> goalEvent;  // play id -> event id
+};
+
+State *sState = nullptr;
+
+std::string espnDay(time_t epoch) {
+  const time_t shifted = epoch + kEspnDayOffsetSec;
+  struct tm t;
+  gmtime_r(&shifted, &t);
+  char buf[12];
+  strftime(buf, sizeof(buf), "%Y%m%d", &t);
+  return buf;
+}
+
+// Virtual time of wall-clock `epoch`; the timeline before boot is pinned to 0.
+uint64_t usAtEpoch(double epoch) {
+  const double us = (epoch - (double)sState->epochAtBoot) * 1e6;
+  return us > 0 ? (uint64_t)us : 0;
+}
+
+// Latest frame at or before `atUs`, else the first one.
+const Frame *frameAt(const std::vector<Frame> &frames, uint64_t atUs) {
+  if (frames.empty()) return nullptr;
+  auto it = std::upper_bound(frames.begin(), frames.end(), atUs,
+                             [](uint64_t t, const Frame &f) { return t < f.atUs; });
+  return it == frames.begin() ? &frames.front() : &*(it - 1);
+}
+
+// Scoreboard body for `dates` ("lo-hi" ESPN days, "" for all).
+std::string scoreboardJson(const std::vector<ScheduledEvent> &events, const std::string &rest,
+                           const std::string &dates) {
+  std::string lo;
+  std::string hi;
+  if (!dates.empty()) {
+    const size_t dash = dates.find('-');
+    lo = dates.substr(0, dash);
+    hi = dash == std::string::npos ? lo : dates.substr(dash + 1);
+  }
+  std::string out = "{\"events\":[";
+  bool first = true;
+  for (const ScheduledEvent &ev : events) {
+    if (!lo.empty()) {
+      const std::string day = espnDay(ev.start);
+      if (day < lo || day > hi) continue;
+    }
+    if (!first) out += ",";
+    out += ev.json;
+    first = false;
+  }
+  out += "]";
+  if (rest.size() > 2) out += "," + rest.substr(1, rest.size() - 2);
+  return out + "}";
+}
+
+std::string etagOf(const std::string &body) {
+  uint64_t h = 1469598103934665603ULL;
+  for (unsigned char c : body) {
+    h ^= c;
+    h *= 1099511628211ULL;
+  }
+  char buf[24];
+  snprintf(buf, sizeof(buf), "\"%016llx\"", (unsigned long long)h);
+  return buf;
+}
+
+bool inOutage(uint64_t atUs) {
+  const uint64_t sec = atUs / 1000000;
+  for (const auto &w : sState->options.outages) {
+    if (sec >= w.first && sec < w.second) return true;
+  }
+  return false;
+}
+
+void plain(HostNet::Response &res, int status, const char *text) {
+  res.status = status;
+  res.body = text;
+  res.headers.emplace_back("Content-Type", "text/plain");
+  if (status == 429 || status == 503) res.headers.emplace_back("Retry-After", "5");
+}
+
+// Goals the /summary for `eventId` carries when served at `atUs`.
+void noteServedGoals(const std::string &eventId, uint64_t atUs) {
+  auto it = sState->summaries.find(eventId);
+  const Frame *f = it == sState->summaries.end() ? nullptr : frameAt(it->second, atUs);
+  if (!f) return;
+  for (Goal &goal : sState->session.goals) {
+    if (goal.servedUs || goal.happenedUs > f->atUs) continue;
+    if (sState->goalEvent[goal.playId] != eventId) continue;
+    goal.servedUs = atUs;
+  }
+}
+
+void handle(const HostNet::Request &req, HostNet::Response &res) {
+  State &s = *sState;
+  const uint64_t now = HostSched::nowUs();
+  const std::string path = req.path();
+  const std::string kind = path.substr(path.rfind('/') + 1);
+  res.latencyMs = s.options.latencyMs;
+  if (kind == "scoreboard") {
+    s.session.scoreboardUs.push_back(now);
+    s.session.scoreboardDates.push_back(req.query("dates"));
+  }
+  if (kind == "summary") s.session.summaryUs.push_back(now);
+  if (req.acceptsGzip()) s.session.gzipAccepted++;
+
+  std::string body;
+  std::string eventId;
+  bool found = path.compare(0, strlen(kBasePath), kBasePath) == 0;
+  if (found && kind == "scoreboard") {
+    body = scoreboardBody(now, req.query("dates"));
+  } else if (found && kind == "summary") {
+    eventId = req.query("event");
+    body = summaryBody(now, eventId);
+    found = !body.empty();
+  } else {
+    found = false;
+  }
+
+  std::uniform_real_distribution<double> unit(0.0, 1.0);
+  int status = 200;
+  if (!found) {
+    status = 404;
+    plain(res, status, "not found");
+  } else if (inOutage(now) || unit(s.rng) < s.options.errorRate) {
+    status = s.options.errorStatus;
+    plain(res, status, "injected error");
+  } else {
+    const std::string etag = etagOf(body);
+    if (s.options.etag && req.header("If-None-Match") == etag) {
+      status = 304;
+      res.status = 304;
+      res.headers.emplace_back("ETag", etag);
+    } else {
+      res.status = 200;
+      res.headers.emplace_back("Content-Type", "application/json");
+      if (s.options.etag) res.headers.emplace_back("ETag", etag);
+      res.chunked = s.options.chunked;
+      res.chunkBytes = s.options.chunkBytes;
+      res.gzip = s.options.gzip;
+      if (unit(s.rng) < s.options.truncateRate) {
+        res.truncateShare = 0.5;
+        res.close = true;
+      }
+      s.session.bodyBytes += body.size();
+      res.body = std::move(body);
+      if (kind == "summary" && res.truncateShare == 0) noteServedGoals(eventId, now);
+    }
+  }
+  s.session.statuses[status]++;
+}
+
+time_t parseIso(const char *s) {
+  struct tm t;
+  memset(&t, 0, sizeof(t));
+  if (!s || sscanf(s, "%d-%d-%dT%d:%d", &t.tm_year, &t.tm_mon, &t.tm_mday, &t.tm_hour, &t.tm_min) != 5) return 0;
+  t.tm_year -= 1900;
+  t.tm_mon -= 1;
+  return timegm(&t);
+}
+
+// Reads a tools/espn_standin.py fixture: a {"meta": {"origin": ...}} line,
+// then {"t", "kind", "event", "body"} frames. The wall clock at boot is the
+// origin of a recording, and leadSec before puck drop for a synthetic game.
+bool loadFixture(const std::string &path) {
+  State &s = *sState;
+  if (path.empty()) {
+    printf("standin: no fixture; dump one with tools/espn_standin.py synth --dump\n");
+    return false;
+  }
+  std::ifstream in(path);
+  if (!in) {
+    printf("standin: cannot open %s\n", path.c_str());
+    return false;
+  }
+  double origin = 0;
+  std::string line;
+  while (std::getline(in, line)) {
+    if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+    JsonDocument doc;
+    if (deserializeJson(doc, line, DeserializationOption::NestingLimit(64))) {
+      printf("standin: bad fixture line in %s\n", path.c_str());
+      return false;
+    }
+    if (doc["meta"].is<JsonObject>()) {
+      JsonObject meta = doc["meta"];
+      origin = meta["origin"] | 0.0;
+      s.puckDrop = meta["start"] | 0.0;
+      for (JsonArray phase : meta["phases"].as<JsonArray>()) s.phases.push_back({phase[0] | "", phase[1] | 0.0});
+      if (s.puckDrop > 0) {
+        HostTime::setWallClock((time_t)(s.puckDrop - s.options.leadSec));
+      } else if (origin > 0) {
+        HostTime::setWallClock((time_t)origin);
+      }
+      s.epochAtBoot = HostTime::epochAtBoot();
+      continue;
+    }
+    Frame frame;
+    frame.atUs = usAtEpoch(origin + (doc["t"] | 0.0));
+    const char *kind = doc["kind"] | "";
+    JsonObject body = doc["body"];
+    if (strcmp(kind, "scoreboard") == 0) {
+      for (JsonObject ev : body["events"].as<JsonArray>()) {
+        ScheduledEvent e;
+        e.start = parseIso(ev["date"] | "");
+        serializeJson(ev, e.json);
+        frame.events.push_back(std::move(e));
+      }
+      body.remove("events");
+      serializeJson(body, frame.rest);
+      s.scoreboards.push_back(std::move(frame));
+    } else if (strcmp(kind, "summary") == 0) {
+      const std::string eventId = doc["event"] | "";
+      for (JsonObject play : body["plays"].as<JsonArray>()) {
+        if (!(play["scoringPlay"] | false)) continue;
+        const std::string id = play["id"] | "";
+        if (s.goalEvent.count(id)) continue;
+        Goal goal;
+        goal.playId = id;
+        goal.text = play["text"] | "";
+        goal.happenedUs = frame.atUs;
+        s.goalEvent[id] = eventId;
+        s.session.goals.push_back(goal);
+      }
+      serializeJson(body, frame.rest);
+      s.summaries[eventId].push_back(std::move(frame));
+    }
+  }
+  auto byTime = [](const Frame &a, const Frame &b) { return a.atUs < b.atUs; };
+  std::stable_sort(s.scoreboards.begin(), s.scoreboards.end(), byTime);
+  for (auto &kv : s.summaries) std::stable_sort(kv.second.begin(), kv.second.end(), byTime);
+  std::stable_sort(s.session.goals.begin(), s.session.goals.end(),
+                   [](const Goal &a, const Goal &b) { return a.happenedUs < b.happenedUs; });
+  if (s.scoreboards.empty()) {
+    printf("standin: %s has no scoreboard frames\n", path.c_str());
+    return false;
+  }
+  if (s.puckDrop > 0 && !s.phases.empty()) {
+    s.firstUs = usAtEpoch(s.puckDrop);
+    s.lastUs = usAtEpoch(s.puckDrop + s.phases.back().at);
+  } else {
+    s.firstUs = s.scoreboards.front().atUs;
+    s.lastUs = s.scoreboards.back().atUs;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool start(const Options &options) {
+  HostHeap::Exclude outside;
+  stop();
+  sState = new State();
+  State &s = *sState;
+  s.options = options;
+  s.rng.seed(options.seed);
+  s.epochAtBoot = HostTime::epochAtBoot();
+  if (!loadFixture(options.fixture.empty() ? std::string(ESPN_SYNTH_FIXTURE) : options.fixture)) return false;
+  HostNet::serve(kHost, handle);
+  return true;
+}
+
+void stop() {
+  HostHeap::Exclude outside;
+  if (!sState) return;
+  HostNet::stopServing(kHost);
+  delete sState;
+  sState = nullptr;
+}
+
+const Session &session() {
+  return sState->session;
+}
+
+uint64_t startUs() {
+  return sState->firstUs;
+}
+
+uint64_t endUs() {
+  return sState->lastUs;
+}
+
+std::string phaseAt(uint64_t atUs) {
+  if (sState->phases.empty()) return "";
+  const double gt = (double)sState->epochAtBoot + (double)atUs / 1e6 - sState->puckDrop;
+  std::string phase = "pre";
+  for (const Phase &p : sState->phases) {
+    if (gt < p.at) break;
+    phase = p.name;
+  }
+  return phase;
+}
+
+std::string scoreboardBody(uint64_t atUs, const std::string &dates) {
+  HostHeap::Exclude outside;
+  const Frame *f = frameAt(sState->scoreboards, atUs);
+  return f ? scoreboardJson(f->events, f->rest, dates) : std::string("{\"events\":[]}");
+}
+
+std::string summaryBody(uint64_t atUs, const std::string &eventId) {
+  HostHeap::Exclude outside;
+  auto it = sState->summaries.find(eventId);
+  const Frame *f = it == sState->summaries.end() ? nullptr : frameAt(it->second, atUs);
+  return f ? f->rest : std::string();
+}
+
+std::vector<std::string> summaryEvents() {
+  HostHeap::Exclude outside;
+  std::vector<std::string> ids;
+  for (const auto &kv : sState->summaries) ids.push_back(kv.first);
+  return ids;
+}
+
+}  // namespace EspnStandin
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Serves ESPN's Olympic hockey /scoreboard and /summary on site.api.espn.com
+// through HostNet, on the virtual clock, from a tools/espn_standin.py
+// fixture: by default the synthetic CAN-SWE game (pre, three periods with
+// intermissions, OT winner, post) the Python tool dumps at build time, or a
+// recording. On top it injects latency, chunked and gzip bodies, truncation,
+// error statuses and outage windows, and records the session: request times,
+// statuses and when each goal was served.
+
+namespace EspnStandin {
+
+struct Options {
+  // Synthetic game: the wall clock at boot is set this long before puck drop.
+  uint32_t leadSec = 600;
+  // Recorded JSONL fixture to serve instead. Its origin becomes the wall clock
+  // at boot and its timeline runs on the virtual clock.
+  std::string fixture;
+
+  uint32_t latencyMs = 0;  // on top of the HostNet link latency
+  bool chunked = false;
+  size_t chunkBytes = 1024;
+  bool gzip = false;  // when the request accepts it
+  bool etag = true;   // ETag and 304 for If-None-Match
+  double truncateRate = 0.0;  // share of bodies cut in half
+  double errorRate = 0.0;     // share of requests failed with errorStatus
+  int errorStatus = 503;
+  // Seconds after boot during which every request fails: {start, end}.
+  std::vector<std::pair<uint32_t, uint32_t>> outages;
+  uint32_t seed = 1;
+};
+
+struct Goal {
+  std::string playId;
+  std::string text;
+  uint64_t happenedUs = 0;  // first frame of the timeline with the goal in it
+  uint64_t servedUs = 0;    // first /summary response that carried it; 0 = never
+};
+
+struct Session {
+  std::vector<uint64_t> scoreboardUs;  // request times, virtual clock
+  std::vector<std::string> scoreboardDates;  // their "dates" query, same order
+  std::vector<uint64_t> summaryUs;
+  std::map<int, uint32_t> statuses;
+  uint64_t bodyBytes = 0;  // before gzip and truncation
+  uint32_t gzipAccepted = 0;  // requests that offered gzip
+  std::vector<Goal> goals;  // in timeline order
+};
+
+// Registers the handler; the wall clock is set for the timeline.
+bool start(const Options &options);
+void stop();
+
+const Session &session();
+
+// Bounds of the timeline on the virtual clock: puck drop and the final
+// horn for the synthetic game, first and last frame for a recording.
+uint64_t startUs();
+uint64_t endUs();
+
+// Phase of the synthetic game at `atUs`: "pre", "P1".."P3", "I1".."I3", "OT",
+// "post"; "" for a recording.
+std::string phaseAt(uint64_t atUs);
+
+// Bodies as served at `atUs` (uncompressed, without faults), for benchmarks.
+// `dates` is the scoreboard query value, "YYYYMMDD-YYYYMMDD"; empty for all.
+std::string scoreboardBody(uint64_t atUs, const std::string &dates = std::string());
+std::string summaryBody(uint64_t atUs, const std::string &eventId);
+// Events that have a /summary in the fixture.
+std::vector<std::string> summaryEvents();
+
+}  // namespace EspnStandin
@@ -0,0 +1,128 @@
+#include "host_bench.h"
+
+#include <algorithm>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <zlib.h>
+
+#include "espn_standin.h"
+#include "host_heap.h"
+#include "host_time.h"
+
+namespace HostBench {
+
+namespace {
+
+// Thursday 2026-02-12, 12:00 UTC, as in test_replay.
+const time_t kBootEpoch = 1770897600;
+
+uint64_t threadCpuUs() {
+  timespec ts;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+}  // namespace
+
+MemoryStream::MemoryStream(const std::string &data, size_t maxRead) : _data(data), _maxRead(maxRead) {}
+
+int MemoryStream::available() {
+  ++_calls;
+  return (int)(_data.size() - _pos);
+}
+
+int MemoryStream::read() {
+  ++_calls;
+  return _pos < _data.size() ? (uint8_t)_data[_pos++] : -1;
+}
+
+int MemoryStream::peek() {
+  ++_calls;
+  return _pos < _data.size() ? (uint8_t)_data[_pos] : -1;
+}
+
+size_t MemoryStream::readBytes(char *buffer, size_t length) {
+  ++_calls;
+  const size_t n = std::min(std::min(length, _maxRead), _data.size() - _pos);
+  memcpy(buffer, _data.data() + _pos, n);
+  _pos += n;
+  return n;
+}
+
+std::vector<Payload> espnPayloads() {
+  HostHeap::Exclude outside;
+  EspnStandin::Options options;
+  const char *fixture = getenv("ESPN_FIXTURE");
+  if (fixture) options.fixture = fixture;
+  HostTime::setWallClock(kBootEpoch);
+  std::vector<Payload> out;
+  if (!EspnStandin::start(options)) return out;
+
+  const uint64_t first = EspnStandin::startUs();
+  const uint64_t last = EspnStandin::endUs();
+  const struct {
+    const char *name;
+    uint64_t atUs;
+  } points[] = {{"start", first}, {"middle", first + (last - first) / 2}, {"end", last}};
+  for (const auto &p : points) {
+    out.push_back({std::string("scoreboard, ") + p.name, EspnStandin::scoreboardBody(p.atUs)});
+    for (const std::string &id : EspnStandin::summaryEvents()) {
+      std::string body = EspnStandin::summaryBody(p.atUs, id);
+      if (!body.empty()) out.push_back({"summary " + id + ", " + p.name, body});
+    }
+  }
+  EspnStandin::stop();
+  return out;
+}
+
+std::string gzip(const std::string &body) {
+  HostHeap::Exclude outside;
+  z_stream z;
+  memset(&z, 0, sizeof(z));
+  // 15 bits of window plus 16 for the gzip wrapper, as a server sends it.
+  deflateInit2(&z, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+  std::string out(deflateBound(&z, body.size()), '\0');
+  z.next_in = (Bytef *)body.data();
+  z.avail_in = (uInt)body.size();
+  z.next_out = (Bytef *)&out[0];
+  z.avail_out = (uInt)out.size();
+  deflate(&z, Z_FINISH);
+  out.resize(z.total_out);
+  deflateEnd(&z);
+  return out;
+}
+
+std::string chunked(const std::string &body, size_t chunkBytes) {
+  HostHeap::Exclude outside;
+  std::string out;
+  char size[16];
+  for (size_t at = 0; at < body.size(); at += chunkBytes) {
+    const size_t n = std::min(chunkBytes, body.size() - at);
+    snprintf(size, sizeof(size), "%zx\r\n", n);
+    out += size;
+    out.append(body, at, n);
+    out += "\r\n";
+  }
+  out += "0\r\n\r\n";
+  return out;
+}
+
+double usPerRun(const std::function<void()> &fn, uint32_t minMs) {
+  fn();  // warm up caches and lazy allocations
+  uint32_t runs = 0;
+  const uint64_t start = threadCpuUs();
+  uint64_t elapsed = 0;
+  do {
+    fn();
+    ++runs;
+    elapsed = threadCpuUs() - start;
+  } while (elapsed < (uint64_t)minMs * 1000);
+  return (double)elapsed / runs;
+}
+
+double mbPerSec(size_t bytes, double us) {
+  return us > 0 ? (double)bytes / us : 0.0;
+}
+
+}  // namespace HostBench
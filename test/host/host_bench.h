@@ -0,0 +1,64 @@
+#pragma once
+
+#include <Stream.h>
+
+#include <functional>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+// Helpers for the benchmarks on the native build: bodies as the ESPN
+// stand-in serves them, gzip and chunked framing of them, a stream that hands
+// them out the way a socket would, and a host CPU timer.
+
+namespace HostBench {
+
+// Serves `data` from memory. A readBytes() gets at most `maxRead` bytes, like
+// one TCP segment off the socket. Counts the calls made on it: on the device
+// each one is a trip into the TLS client.
+class MemoryStream : public Stream {
+public:
+  explicit MemoryStream(const std::string &data, size_t maxRead = 1460);
+
+  void rewind() {
+    _pos = 0;
+    _calls = 0;
+  }
+  uint32_t calls() const { return _calls; }
+
+  int available() override;
+  int read() override;
+  int peek() override;
+  size_t readBytes(char *buffer, size_t length) override;
+  void flush() override {}
+  size_t write(uint8_t) override { return 0; }
+
+private:
+  const std::string &_data;
+  size_t _maxRead;
+  size_t _pos = 0;
+  uint32_t _calls = 0;
+};
+
+struct Payload {
+  std::string name;
+  std::string body;
+};
+
+// Scoreboard and game summary at puck drop, mid-game and the final horn of
+// the synthetic game, or the first, middle and last frame of ESPN_FIXTURE
+// when that is set.
+std::vector<Payload> espnPayloads();
+
+std::string gzip(const std::string &body);
+std::string chunked(const std::string &body, size_t chunkBytes);
+
+// Runs `fn` until it has taken at least `minMs` of host CPU and returns the
+// microseconds per run.
+double usPerRun(const std::function<void()> &fn, uint32_t minMs = 300);
+
+// Megabytes per second for `bytes` handled in `us`.
+double mbPerSec(size_t bytes, double us);
+
+}  // namespace HostBench
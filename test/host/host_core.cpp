@@ -0,0 +1,427 @@
+#include <Arduino.h>
+
+#include "host_heap.h"
+#include "host_sched.h"
+
+HardwareSerial Serial;
+EspClass ESP;
+
+// --- Print / Stream ---
+
+size_t Print::write(const uint8_t *buffer, size_t size) {
+  size_t n = 0;
+  while (size--) {
+    if (!write(*buffer++)) break;
+    n++;
+  }
+  return n;
+}
+
+size_t Print::printf(const char *format, ...) {
+  char small[256];
+  va_list args;
+  va_start(args, format);
+  int len = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (len < 0) return 0;
+  if ((size_t)len < sizeof(small)) return write((const uint8_t *)small, (size_t)len);
+
+  char *big = (char *)malloc((size_t)len + 1);
+  if (!big) return 0;
+  va_start(args, format);
+  vsnprintf(big, (size_t)len + 1, format, args);
+  va_end(args);
+  const size_t n = write((const uint8_t *)big, (size_t)len);
+  free(big);
+  return n;
+}
+
+size_t Print::print(long n, int base) {
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long n, int base) {
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::print(long long n, int base) {
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long long n, int base) {
+  return print(String(n, (unsigned char)base));
+}
+
+size_t Print::print(double n, int digits) {
+  return print(String(n, (unsigned int)digits));
+}
+
+int Stream::timedRead() {
+  const uint32_t start = millis();
+  for (;;) {
+    const int c = read();
+    if (c >= 0) return c;
+    if (millis() - start >= _timeout) return -1;
+    HostSched::sleepUs(1000);
+  }
+}
+
+int Stream::timedPeek() {
+  const uint32_t start = millis();
+  for (;;) {
+    const int c = peek();
+    if (c >= 0) return c;
+    if (millis() - start >= _timeout) return -1;
+    HostSched::sleepUs(1000);
+  }
+}
+
+bool Stream::find(const char *target) {
+  return find(target, strlen(target));
+}
+
+bool Stream::find(const char *target, size_t length) {
+  if (!length) return true;
+  size_t matched = 0;
+  for (int c; (c = timedRead()) >= 0;) {
+    if (c == target[matched]) {
+      if (++matched == length) return true;
+    } else {
+      matched = (c == target[0]) ? 1 : 0;
+    }
+  }
+  return false;
+}
+
+size_t Stream::readBytes(char *buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    const int c = timedRead();
+    if (c < 0) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+size_t Stream::readBytesUntil(char terminator, char *buffer, size_t length) {
+  size_t n = 0;
+  while (n < length) {
+    const int c = timedRead();
+    if (c < 0 || c == terminator) break;
+    buffer[n++] = (char)c;
+  }
+  return n;
+}
+
+String Stream::readString() {
+  String out;
+  for (int c; (c = timedRead()) >= 0;) out += (char)c;
+  return out;
+}
+
+String Stream::readStringUntil(char terminator) {
+  String out;
+  for (int c; (c = timedRead()) >= 0 && c != terminator;) out += (char)c;
+  return out;
+}
+
+// --- Serial ---
+
+size_t HardwareSerial::write(uint8_t c) {
+  return write(&c, 1);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    const char c = (char)buffer[i];
+    if (c == '\r') continue;
+    if (c == '\n') {
+      endLine();
+      continue;
+    }
+    if (_lineLen + 1 < sizeof(_line)) _line[_lineLen++] = c;
+  }
+  return size;
+}
+
+void HardwareSerial::endLine() {
+  _line[_lineLen] = 0;
+  if (_echo) {
+    ::printf("[%9.3f] %s\n", (double)HostSched::nowUs() / 1e6, _line);
+  }
+  if (_listener) {
+    HostHeap::Exclude outside;
+    _listener(_line, _ctx);
+  }
+  _lineLen = 0;
+}
+
+// --- ESP ---
+
+uint32_t EspClass::getHeapSize() {
+  return (uint32_t)HostHeap::capacity();
+}
+
+uint32_t EspClass::getFreeHeap() {
+  return (uint32_t)HostHeap::freeBytes();
+}
+
+uint32_t EspClass::getMinFreeHeap() {
+  return (uint32_t)HostHeap::minFreeBytes();
+}
+
+uint32_t EspClass::getMaxAllocHeap() {
+  return (uint32_t)HostHeap::largestFreeBlock();
+}
+
+void EspClass::restart() {
+  ::printf("ESP.restart() on the host\n");
+  abort();
+}
+
+// --- Time ---
+
+namespace {
+
+time_t sEpochAtBoot = 1767225600;  // 2026-01-01T00:00:00Z
+bool sSynced = false;
+
+uint8_t sLevels[64];
+bool sLevelSet[64];
+uint32_t sDuty[16];
+uint32_t sRandom = 0x2545F491u;
+
+}  // namespace
+
+uint32_t millis() {
+  return (uint32_t)(HostSched::nowUs() / 1000);
+}
+
+uint32_t micros() {
+  return (uint32_t)HostSched::nowUs();
+}
+
+void delay(uint32_t ms) {
+  HostSched::sleepUs((uint64_t)ms * 1000);
+}
+
+void delayMicroseconds(uint32_t us) {
+  HostSched::sleepUs(us);
+}
+
+void yield() {
+  HostSched::sleepUs(0);
+}
+
+namespace HostTime {
+
+void setWallClock(time_t epochAtBoot) {
+  sEpochAtBoot = epochAtBoot;
+}
+
+time_t epochAtBoot() {
+  return sEpochAtBoot;
+}
+
+bool synced() {
+  return sSynced;
+}
+
+}  // namespace HostTime
+
+void configTime(long, int, const char *, const char *, const char *) {
+  sSynced = true;
+}
+
+#if defined(__GLIBC__)
+// Replaces libc's time() for the whole program, so the firmware's clock
+// follows the virtual one.
+extern "C" time_t time(time_t *out) noexcept {
+  const time_t sinceBoot = (time_t)(HostSched::nowUs() / 1000000);
+  const time_t now = sSynced ? sEpochAtBoot + sinceBoot : sinceBoot;
+  if (out) *out = now;
+  return now;
+}
+#endif
+
+bool getLocalTime(struct tm *info, uint32_t) {
+  const time_t now = time(nullptr);
+  if (now < 1577836800) return false;
+  localtime_r(&now, info);
+  return true;
+}
+
+// --- GPIO, PWM, DAC ---
+
+void pinMode(uint8_t, uint8_t) {}
+
+void digitalWrite(uint8_t pin, uint8_t level) {
+  if (pin < 64) {
+    sLevels[pin] = level;
+    sLevelSet[pin] = true;
+  }
+}
+
+int digitalRead(uint8_t pin) {
+  if (pin >= 64 || !sLevelSet[pin]) return HIGH;
+  return sLevels[pin];
+}
+
+void dacWrite(uint8_t, uint8_t) {}
+void dacDisable(uint8_t) {}
+
+double ledcSetup(uint8_t, double freq, uint8_t) {
+  return freq;
+}
+
+void ledcAttachPin(uint8_t, uint8_t) {}
+
+void ledcWrite(uint8_t channel, uint32_t duty) {
+  if (channel < 16) sDuty[channel] = duty;
+}
+
+namespace HostGpio {
+
+void setInput(uint8_t pin, int level) {
+  if (pin < 64) {
+    sLevels[pin] = (uint8_t)level;
+    sLevelSet[pin] = true;
+  }
+}
+
+uint32_t ledcDuty(uint8_t channel) {
+  return channel < 16 ? sDuty[channel] : 0;
+}
+
+}  // namespace HostGpio
+
+// --- Misc ---
+
+long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  const long span = inMax - inMin;
+  if (!span) return outMin;
+  return (x - inMin) * (outMax - outMin) / span + outMin;
+}
+
+// xorshift32: the same sequence every run.
+extern "C" uint32_t esp_random() {
+  sRandom ^= sRandom << 13;
+  sRandom ^= sRandom >> 17;
+  sRandom ^= sRandom << 5;
+  return sRandom;
+}
+
+#if !defined(__GLIBC__) || !__GLIBC_PREREQ(2, 38)
+extern "C" size_t strlcpy(char *dst, const char *src, size_t size) {
+  const size_t len = strlen(src);
+  if (size) {
+    const size_t n = len < size - 1 ? len : size - 1;
+    memcpy(dst, src, n);
+    dst[n] = '\0';
+  }
+  return len;
+}
+#endif
+
+long random(long max) {
+  return max > 0 ? (long)(esp_random() % (uint32_t)max) : 0;
+}
+
+long random(long min, long max) {
+  return max > min ? min + random(max - min) : min;
+}
+
+void randomSeed(unsigned long seed) {
+  sRandom = seed ? (uint32_t)seed : 0x2545F491u;
+}
+
+// --- FreeRTOS ---
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn,
+                                   const char *name,
+                                   uint32_t,
+                                   void *arg,
+                                   UBaseType_t,
+                                   TaskHandle_t *handle,
+                                   BaseType_t) {
+  HostSched::spawn(fn, arg, name);
+  if (handle) *handle = nullptr;
+  return pdPASS;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn,
+                       const char *name,
+                       uint32_t stackDepth,
+                       void *arg,
+                       UBaseType_t priority,
+                       TaskHandle_t *handle) {
+  return xTaskCreatePinnedToCore(fn, name, stackDepth, arg, priority, handle, tskNO_AFFINITY);
+}
+
+void vTaskDelay(TickType_t ticks) {
+  HostSched::sleepUs((uint64_t)ticks * 1000);
+}
+
+TickType_t xTaskGetTickCount() {
+  return (TickType_t)millis();
+}
+
+struct HostSemaphore {
+  bool recursive;
+  uintptr_t owner;
+  uint32_t depth;
+};
+
+namespace {
+
+SemaphoreHandle_t createSemaphore(bool recursive) {
+  HostSemaphore *sem = (HostSemaphore *)malloc(sizeof(HostSemaphore));
+  if (sem) *sem = HostSemaphore{recursive, 0, 0};
+  return sem;
+}
+
+BaseType_t take(SemaphoreHandle_t sem, TickType_t ticks) {
+  const uintptr_t me = HostSched::currentId();
+  const uint32_t start = millis();
+  for (;;) {
+    if (!sem->owner || (sem->recursive && sem->owner == me)) {
+      sem->owner = me;
+      sem->depth++;
+      return pdTRUE;
+    }
+    if (ticks != portMAX_DELAY && millis() - start >= ticks) return pdFALSE;
+    HostSched::sleepUs(1000);
+  }
+}
+
+BaseType_t give(SemaphoreHandle_t sem) {
+  if (sem->owner != HostSched::currentId() || !sem->depth) return pdFALSE;
+  if (--sem->depth == 0) sem->owner = 0;
+  return pdTRUE;
+}
+
+}  // namespace
+
+SemaphoreHandle_t xSemaphoreCreateMutex() {
+  return createSemaphore(false);
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() {
+  return createSemaphore(true);
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+  return take(sem, ticks);
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+  return give(sem);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks) {
+  return take(sem, ticks);
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+  return give(sem);
+}
@@ -0,0 +1,1180 @@
+#pragma once
+
+#include <stdint.h>
+
+// Generated by tools/host_font.py from Lato-Regular.ttf and SourceCodePro-Regular.ttf; do not edit.
+// Glyph bitmaps are 1 bit per pixel, rows left to right, MSB first, packed
+// across row boundaries.
+
+namespace HostFonts {
+
+struct Font {
+  uint8_t id;
+  uint8_t height;
+  const uint8_t *widths;     // per character 32..126; 0 when not in the font
+  const uint32_t *offsets;   // bit offset of each glyph in bits
+  const uint8_t *bits;
+};
+
+static const uint8_t kFont1Widths[95] = {
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+};
+static const uint32_t kFont1Offsets[95] = {
+  0, 48, 96, 144, 192, 240, 288, 336, 384, 432,
+  480, 528, 576, 624, 672, 720, 768, 816, 864, 912,
+  960, 1008, 1056, 1104, 1152, 1200, 1248, 1296, 1344, 1392,
+  1440, 1488, 1536, 1584, 1632, 1680, 1728, 1776, 1824, 1872,
+  1920, 1968, 2016, 2064, 2112, 2160, 2208, 2256, 2304, 2352,
+  2400, 2448, 2496, 2544, 2592, 2640, 2688, 2736, 2784, 2832,
+  2880, 2928, 2976, 3024, 3072, 3120, 3168, 3216, 3264, 3312,
+  3360, 3408, 3456, 3504, 3552, 3600, 3648, 3696, 3744, 3792,
+  3840, 3888, 3936, 3984, 4032, 4080, 4128, 4176, 4224, 4272,
+  4320, 4368, 4416, 4464, 4512,
+};
+static const uint8_t kFont1Bits[570] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x41, 0x04, 0x10, 0x00, 0x00, 0x28, 0xa0, 0x00, 0x00,
+  0x00, 0x00, 0x28, 0xe2, 0x8e, 0x20, 0x00, 0x00, 0x38, 0x83, 0x82, 0x38, 0x40, 0x00, 0x75, 0x63,
+  0x8d, 0x5c, 0x00, 0x00, 0x30, 0xc2, 0x16, 0x78, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0x41, 0x04, 0x10, 0x20, 0x00, 0x20, 0x41, 0x04, 0x10, 0x80, 0x00, 0x00, 0x43, 0x8e, 0x00,
+  0x00, 0x00, 0x10, 0x43, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x40, 0x00, 0x00, 0x03,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x08, 0x41, 0x04, 0x20, 0x80, 0x00,
+  0x31, 0x25, 0x92, 0x30, 0x00, 0x00, 0x30, 0x41, 0x04, 0x38, 0x00, 0x00, 0x38, 0x21, 0x8c, 0x78,
+  0x00, 0x00, 0x38, 0x21, 0x02, 0x78, 0x00, 0x00, 0x18, 0x62, 0x8f, 0x08, 0x00, 0x00, 0x79, 0xc0,
+  0x82, 0x70, 0x00, 0x00, 0x39, 0x07, 0x12, 0x38, 0x00, 0x00, 0x3c, 0x21, 0x04, 0x10, 0x00, 0x00,
+  0x79, 0x23, 0x12, 0x78, 0x00, 0x00, 0x71, 0x23, 0x82, 0x70, 0x00, 0x00, 0x00, 0x40, 0x00, 0x10,
+  0x00, 0x00, 0x00, 0x40, 0x00, 0x10, 0x40, 0x00, 0x08, 0x42, 0x06, 0x00, 0x00, 0x00, 0x00, 0xe3,
+  0x80, 0x00, 0x00, 0x00, 0x20, 0x40, 0x8c, 0x00, 0x00, 0x00, 0x38, 0x21, 0x00, 0x10, 0x00, 0x00,
+  0x39, 0x25, 0x9a, 0x79, 0x03, 0x00, 0x10, 0xc2, 0x8e, 0x4c, 0x00, 0x00, 0x3c, 0x93, 0xc9, 0x3c,
+  0x00, 0x00, 0x39, 0x04, 0x10, 0x38, 0x00, 0x00, 0x38, 0x92, 0x49, 0x38, 0x00, 0x00, 0x38, 0x83,
+  0x88, 0x38, 0x00, 0x00, 0x38, 0x83, 0x88, 0x20, 0x00, 0x00, 0x39, 0x05, 0x92, 0x38, 0x00, 0x00,
+  0x49, 0x27, 0x92, 0x48, 0x00, 0x00, 0x38, 0x41, 0x04, 0x38, 0x00, 0x00, 0x38, 0x20, 0x82, 0x38,
+  0x00, 0x00, 0x2c, 0xa3, 0x8a, 0x24, 0x00, 0x00, 0x20, 0x82, 0x08, 0x38, 0x00, 0x00, 0x49, 0xe7,
+  0x92, 0x48, 0x00, 0x00, 0x24, 0xd3, 0xcb, 0x24, 0x00, 0x00, 0x31, 0x24, 0x92, 0x30, 0x00, 0x00,
+  0x3c, 0x93, 0x88, 0x20, 0x00, 0x00, 0x31, 0x24, 0x92, 0x78, 0xc1, 0x80, 0x3c, 0x93, 0x8a, 0x24,
+  0x00, 0x00, 0x38, 0x81, 0x81, 0x3c, 0x00, 0x00, 0x7c, 0x41, 0x04, 0x10, 0x00, 0x00, 0x49, 0x24,
+  0x92, 0x30, 0x00, 0x00, 0x48, 0xa2, 0x8c, 0x10, 0x00, 0x00, 0x45, 0x57, 0xda, 0x28, 0x00, 0x00,
+  0x28, 0xe1, 0x0a, 0x28, 0x00, 0x00, 0x6c, 0xa1, 0x04, 0x10, 0x00, 0x00, 0x3c, 0x21, 0x84, 0x3c,
+  0x00, 0x00, 0x10, 0x41, 0x04, 0x10, 0x60, 0x00, 0x20, 0x41, 0x04, 0x08, 0x20, 0x00, 0x10, 0x41,
+  0x04, 0x10, 0xc0, 0x00, 0x10, 0x82, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xc9, 0x3c, 0x00, 0x00, 0x20, 0xf2, 0x49, 0x38,
+  0x00, 0x00, 0x00, 0x72, 0x08, 0x1c, 0x00, 0x00, 0x08, 0xe4, 0x92, 0x78, 0x00, 0x00, 0x00, 0x73,
+  0xc8, 0x1c, 0x00, 0x00, 0x10, 0xe1, 0x04, 0x10, 0x00, 0x00, 0x01, 0xe5, 0x18, 0x70, 0x23, 0x00,
+  0x20, 0xf2, 0x49, 0x24, 0x00, 0x00, 0x01, 0xc1, 0x04, 0x10, 0x00, 0x00, 0x01, 0xc1, 0x04, 0x10,
+  0x47, 0x00, 0x20, 0xa3, 0x8e, 0x24, 0x00, 0x00, 0x10, 0x41, 0x04, 0x18, 0x00, 0x00, 0x01, 0xf5,
+  0x55, 0x54, 0x00, 0x00, 0x00, 0xf2, 0x49, 0x24, 0x00, 0x00, 0x00, 0xc4, 0x92, 0x30, 0x00, 0x00,
+  0x00, 0xf2, 0x49, 0x38, 0x82, 0x00, 0x00, 0xe4, 0x92, 0x78, 0x20, 0x80, 0x00, 0xe2, 0x08, 0x20,
+  0x00, 0x00, 0x00, 0xe3, 0x03, 0x38, 0x00, 0x00, 0x10, 0xf1, 0x04, 0x1c, 0x00, 0x00, 0x01, 0x24,
+  0x92, 0x78, 0x00, 0x00, 0x01, 0x22, 0x8a, 0x10, 0x00, 0x00, 0x01, 0x55, 0x5e, 0x28, 0x00, 0x00,
+  0x00, 0xa3, 0x0c, 0x28, 0x00, 0x00, 0x01, 0x22, 0x8a, 0x10, 0x42, 0x00, 0x00, 0xf0, 0x84, 0x38,
+  0x00, 0x00, 0x10, 0x43, 0x04, 0x10, 0x60, 0x00, 0x10, 0x41, 0x04, 0x10, 0x41, 0x00, 0x10, 0x41,
+  0x84, 0x10, 0xc0, 0x00, 0x00, 0x81, 0x80, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t kFont2Widths[95] = {
+  4, 6, 7, 10, 10, 14, 12, 5, 6, 6, 7, 10, 4, 7, 4, 7, 10, 10, 10,
+  10, 10, 10, 10, 10, 10, 10, 5, 5, 10, 10, 10, 7, 14, 12, 11, 12, 13, 10,
+  10, 13, 13, 6, 8, 12, 9, 16, 13, 14, 11, 14, 11, 9, 10, 13, 12, 17, 11,
+  11, 11, 6, 7, 6, 10, 7, 6, 9, 10, 8, 10, 9, 6, 9, 10, 5, 5, 9,
+  5, 14, 10, 10, 10, 10, 7, 8, 7, 10, 9, 13, 9, 9, 8, 6, 6, 6, 10,
+};
+static const uint32_t kFont2Offsets[95] = {
+  0, 64, 160, 272, 432, 592, 816, 1008, 1088, 1184,
+  1280, 1392, 1552, 1616, 1728, 1792, 1904, 2064, 2224, 2384,
+  2544, 2704, 2864, 3024, 3184, 3344, 3504, 3584, 3664, 3824,
+  3984, 4144, 4256, 4480, 4672, 4848, 5040, 5248, 5408, 5568,
+  5776, 5984, 6080, 6208, 6400, 6544, 6800, 7008, 7232, 7408,
+  7632, 7808, 7952, 8112, 8320, 8512, 8784, 8960, 9136, 9312,
+  9408, 9520, 9616, 9776, 9888, 9984, 10128, 10288, 10416, 10576,
+  10720, 10816, 10960, 11120, 11200, 11280, 11424, 11504, 11728, 11888,
+  12048, 12208, 12368, 12480, 12608, 12720, 12880, 13024, 13232, 13376,
+  13520, 13648, 13744, 13840, 13936,
+};
+static const uint8_t kFont2Bits[1762] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x82, 0x08, 0x20, 0x82, 0x00, 0x00, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x48, 0x91, 0x22, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x19, 0x04, 0x81, 0x21, 0xfe, 0x12, 0x0c, 0x82, 0x63, 0xfc, 0x24, 0x09, 0x06, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0d, 0x46, 0x01, 0x80, 0x38, 0x07, 0x80, 0xb0, 0x24,
+  0x09, 0x1a, 0xc3, 0xe0, 0x20, 0x08, 0x00, 0x00, 0x00, 0x00, 0x38, 0x21, 0x21, 0x04, 0xc8, 0x12,
+  0x40, 0x3b, 0x00, 0x08, 0x00, 0x4e, 0x02, 0x4c, 0x19, 0x10, 0xc4, 0x42, 0x0e, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x03, 0x30, 0x30, 0x03, 0x00, 0x18, 0x03, 0xc4, 0x66,
+  0xc4, 0x38, 0x41, 0x86, 0x3c, 0x3c, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x10,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x82, 0x18, 0x41, 0x04, 0x10, 0x60, 0x82,
+  0x0c, 0x10, 0x00, 0x00, 0x40, 0x82, 0x08, 0x30, 0xc3, 0x0c, 0x20, 0x82, 0x10, 0x40, 0x00, 0x00,
+  0x10, 0xb0, 0xc2, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x80, 0x20, 0x08, 0x02, 0x07, 0xf0, 0x20, 0x08, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+  0x04, 0x10, 0x20, 0xc1, 0x02, 0x08, 0x10, 0x60, 0x81, 0x04, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x08,
+  0xc4, 0x11, 0x06, 0x41, 0xb0, 0x64, 0x19, 0x06, 0x41, 0x08, 0xc1, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0c, 0x07, 0x03, 0x40, 0x10, 0x04, 0x01, 0x00, 0x40, 0x10, 0x04, 0x01, 0x03, 0xf0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x08, 0xc6, 0x10, 0x04, 0x03, 0x00, 0x80, 0x60, 0x30,
+  0x18, 0x0c, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x0c, 0xc6, 0x10, 0x04, 0x03,
+  0x03, 0x80, 0x30, 0x06, 0x41, 0x18, 0xc1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x01,
+  0x80, 0xa0, 0x68, 0x32, 0x08, 0x84, 0x23, 0xfe, 0x02, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0x08, 0x02, 0x00, 0x80, 0x3e, 0x00, 0xc0, 0x10, 0x04, 0x03, 0x10, 0x83, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x80, 0x40, 0x3e, 0x18, 0xc4, 0x11, 0x06,
+  0x41, 0x08, 0xc1, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x40, 0x30, 0x08, 0x06,
+  0x01, 0x00, 0xc0, 0x20, 0x18, 0x04, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x08,
+  0xc6, 0x11, 0x84, 0x23, 0x0f, 0x86, 0x31, 0x04, 0x41, 0x18, 0xc3, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1e, 0x08, 0xc6, 0x11, 0x86, 0x23, 0x07, 0xc0, 0x30, 0x18, 0x0c, 0x02, 0x01, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x18, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18,
+  0x18, 0x03, 0x80, 0x38, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xe0, 0x0e, 0x00, 0xc0, 0x60, 0x60, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x98, 0x10, 0x60, 0x82, 0x0c, 0x10, 0x00, 0x00, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x01, 0x86, 0x08, 0x04, 0x43, 0x91, 0x12, 0x44, 0x89,
+  0x12, 0x24, 0x49, 0x91, 0x3b, 0x82, 0x00, 0x06, 0x08, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0c, 0x00, 0xe0, 0x0a, 0x01, 0xb0, 0x11, 0x03, 0x18, 0x31, 0x83, 0xf8, 0x60, 0xc4, 0x04, 0xc0,
+  0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x0c, 0x31, 0x86, 0x30, 0xc6, 0x10, 0xfe,
+  0x18, 0x63, 0x04, 0x60, 0x8c, 0x31, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x83,
+  0x04, 0x20, 0x06, 0x00, 0x40, 0x04, 0x00, 0x40, 0x06, 0x00, 0x20, 0x03, 0x0c, 0x0f, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x03, 0x06, 0x18, 0x18, 0xc0, 0xc6, 0x02, 0x30, 0x11,
+  0x80, 0x8c, 0x0c, 0x60, 0x63, 0x06, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1f, 0x86, 0x01, 0x80, 0x60, 0x18, 0x07, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0x18, 0x06, 0x01, 0x80, 0x60, 0x1f, 0xc6, 0x01, 0x80, 0x60, 0x18,
+  0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x81, 0x82, 0x08, 0x00, 0xc0, 0x04, 0x00,
+  0x20, 0x01, 0x07, 0x8c, 0x0c, 0x20, 0x61, 0x83, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x63, 0x03, 0x18, 0x18, 0xc0, 0xc6, 0x06, 0x3f, 0xf1, 0x81, 0x8c, 0x0c, 0x60,
+  0x63, 0x03, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x82, 0x08, 0x20,
+  0x82, 0x08, 0x20, 0x82, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x08, 0x18, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xc2, 0x18, 0x23, 0x02, 0x20, 0x24, 0x03,
+  0xc0, 0x26, 0x02, 0x30, 0x21, 0x02, 0x08, 0x20, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x1f, 0xc0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x08, 0x70, 0x18, 0x70, 0x38, 0x68, 0x28, 0x6c, 0x68, 0x64, 0x48, 0x66, 0x88,
+  0x63, 0x88, 0x63, 0x08, 0x60, 0x08, 0x60, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x63, 0x83, 0x1c, 0x18, 0xd0, 0xc6, 0x46, 0x33, 0x31, 0x8d, 0x8c, 0x2c, 0x60,
+  0xe3, 0x07, 0x18, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80, 0xc3, 0x02,
+  0x02, 0x18, 0x0c, 0x40, 0x31, 0x00, 0xc4, 0x03, 0x18, 0x0c, 0x20, 0x20, 0xc3, 0x00, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x30, 0x86, 0x10, 0x42, 0x18, 0x43,
+  0x0f, 0x81, 0x00, 0x20, 0x04, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x80,
+  0xc3, 0x02, 0x02, 0x18, 0x0c, 0x40, 0x31, 0x00, 0xc4, 0x03, 0x18, 0x0c, 0x20, 0x20, 0xc3, 0x80,
+  0xfc, 0x00, 0x18, 0x00, 0x20, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x3e, 0x04, 0x30, 0x86, 0x10, 0xc2,
+  0x10, 0x7c, 0x09, 0x81, 0x18, 0x21, 0x04, 0x30, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1e, 0x31, 0x10, 0x0c, 0x07, 0x80, 0xf0, 0x1c, 0x06, 0x03, 0x21, 0x0f, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x83, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0, 0x30, 0x0c, 0x03, 0x00, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x43, 0x02, 0x18, 0x10, 0xc0, 0x86, 0x04, 0x30, 0x21,
+  0x81, 0x0c, 0x08, 0x20, 0xc1, 0x84, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0x64, 0x04, 0x60, 0xc2, 0x08, 0x31, 0x83, 0x10, 0x13, 0x01, 0xb0, 0x0e, 0x00, 0xe0, 0x04,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0x83, 0x20, 0xc1, 0x98, 0x70, 0x8c, 0x68,
+  0xc2, 0x24, 0x61, 0x93, 0x20, 0xd8, 0x90, 0x28, 0x58, 0x1c, 0x38, 0x0e, 0x0c, 0x02, 0x06, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xcc, 0x30, 0xc4, 0x09, 0x81,
+  0xe0, 0x18, 0x07, 0x80, 0x98, 0x21, 0x0c, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xc0, 0xcc, 0x30, 0x84, 0x19, 0x81, 0x20, 0x1c, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x30, 0x0c, 0x01, 0x00, 0x60, 0x18, 0x06, 0x00,
+  0xc0, 0x30, 0x0c, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x04, 0x10, 0x41,
+  0x04, 0x10, 0x41, 0x04, 0x10, 0x70, 0x00, 0x00, 0x81, 0x81, 0x02, 0x02, 0x04, 0x04, 0x08, 0x18,
+  0x10, 0x20, 0x20, 0x00, 0x00, 0x00, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x30, 0xc3, 0x0c, 0x70,
+  0x00, 0x00, 0x08, 0x07, 0x01, 0x40, 0x88, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0x86, 0x60, 0x10, 0x08, 0x7c, 0x62, 0x23, 0x1e, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0xb8, 0x63, 0x18, 0x46, 0x11, 0x84, 0x61, 0x18, 0xc7, 0xe0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x60, 0x40, 0x40, 0x40, 0x40, 0x62,
+  0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0xc0, 0x30, 0xfc, 0x63, 0x10, 0xc4, 0x31, 0x0c,
+  0x43, 0x18, 0xc3, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x86, 0x22,
+  0x19, 0xfc, 0x80, 0x40, 0x31, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x86, 0x3e, 0x61,
+  0x86, 0x18, 0x61, 0x86, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe6, 0x62, 0x11, 0x98,
+  0x78, 0x40, 0x30, 0x1f, 0x88, 0x64, 0x23, 0xe0, 0x00, 0x00, 0x60, 0x18, 0x06, 0x01, 0xb8, 0x63,
+  0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00,
+  0xc6, 0x31, 0x8c, 0x63, 0x18, 0x00, 0x00, 0x00, 0x60, 0x00, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6,
+  0x60, 0x00, 0x60, 0x30, 0x18, 0x0c, 0x46, 0x43, 0x41, 0xe0, 0xd0, 0x64, 0x33, 0x18, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x63, 0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x17, 0x38, 0x67, 0x31, 0x88, 0x46, 0x21, 0x18, 0x84, 0x62, 0x11, 0x88, 0x46,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x63,
+  0x18, 0xc6, 0x31, 0x8c, 0x63, 0x18, 0xc6, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x63, 0x10, 0x44, 0x11, 0x04, 0x41, 0x18, 0xc1, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x38, 0x63, 0x18, 0x46, 0x11, 0x84, 0x61, 0x18, 0xc7, 0xe1,
+  0x80, 0x60, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x63, 0x10, 0xc4, 0x31, 0x0c,
+  0x43, 0x18, 0xc3, 0xb0, 0x0c, 0x03, 0x00, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe6, 0x0c, 0x18,
+  0x30, 0x60, 0xc1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x40, 0x40, 0x70, 0x1c,
+  0x04, 0x44, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x87, 0xc2, 0x04, 0x08, 0x10, 0x20,
+  0x40, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x0c, 0x43, 0x10, 0xc4, 0x31, 0x0c,
+  0x43, 0x18, 0xc3, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x64, 0x23,
+  0x10, 0x98, 0x48, 0x3c, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x8c, 0x24, 0x63, 0x23, 0x91, 0xb4, 0x85, 0x2c, 0x29, 0xc1, 0xc6, 0x04, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x46, 0x61, 0xa0, 0x60, 0x30, 0x24,
+  0x33, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x64, 0x23, 0x10, 0x98,
+  0x68, 0x3c, 0x0c, 0x06, 0x02, 0x01, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x04, 0x0c,
+  0x18, 0x10, 0x20, 0x60, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0x04, 0x18, 0x63, 0x04, 0x18,
+  0x61, 0x04, 0x18, 0x30, 0x00, 0x00, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20, 0x82, 0x08, 0x20,
+  0x80, 0x00, 0x30, 0xc3, 0x08, 0x30, 0x43, 0x08, 0x30, 0xc3, 0x0c, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x44, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+};
+
+static const uint8_t kFont4Widths[95] = {
+  6, 10, 11, 16, 16, 21, 19, 7, 9, 9, 11, 16, 7, 10, 7, 11, 16, 16, 16,
+  16, 16, 16, 16, 16, 16, 16, 8, 8, 16, 16, 16, 11, 22, 19, 18, 19, 21, 16,
+  16, 20, 21, 9, 13, 19, 14, 25, 21, 22, 17, 22, 18, 15, 16, 20, 19, 28, 18,
+  17, 17, 9, 11, 9, 16, 11, 9, 14, 16, 13, 16, 15, 10, 14, 15, 8, 8, 15,
+  8, 22, 15, 15, 15, 16, 11, 12, 11, 15, 14, 21, 14, 14, 13, 9, 9, 9, 16,
+};
+static const uint32_t kFont4Offsets[95] = {
+  0, 156, 416, 702, 1118, 1534, 2080, 2574, 2756, 2990,
+  3224, 3510, 3926, 4108, 4368, 4550, 4836, 5252, 5668, 6084,
+  6500, 6916, 7332, 7748, 8164, 8580, 8996, 9204, 9412, 9828,
+  10244, 10660, 10946, 11518, 12012, 12480, 12974, 13520, 13936, 14352,
+  14872, 15418, 15652, 15990, 16484, 16848, 17498, 18044, 18616, 19058,
+  19630, 20098, 20488, 20904, 21424, 21918, 22646, 23114, 23556, 23998,
+  24232, 24518, 24752, 25168, 25454, 25688, 26052, 26468, 26806, 27222,
+  27612, 27872, 28236, 28626, 28834, 29042, 29432, 29640, 30212, 30602,
+  30992, 31382, 31798, 32084, 32396, 32682, 33072, 33436, 33982, 34346,
+  34710, 35048, 35282, 35516, 35750,
+};
+static const uint8_t kFont4Bits[4521] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x01, 0xc0, 0x70, 0x1c, 0x07, 0x01, 0xc0, 0x70, 0x1c, 0x07, 0x01, 0xc0, 0x70,
+  0x18, 0x02, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x33, 0x06, 0x60, 0xcc, 0x19, 0x83, 0x30, 0x66, 0x0c, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40, 0x18, 0xc0, 0x18, 0xc0, 0x18, 0xc0,
+  0x18, 0xc0, 0xff, 0xf1, 0xff, 0xf0, 0x31, 0x80, 0x31, 0x80, 0x31, 0x80, 0x21, 0x81, 0xff, 0xe1,
+  0xff, 0xe0, 0x63, 0x00, 0x63, 0x00, 0x63, 0x00, 0x43, 0x00, 0xc2, 0x00, 0xc2, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x3f, 0xe0,
+  0x72, 0x60, 0xe2, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xe6, 0x00, 0x76, 0x00, 0x3e, 0x00, 0x1f, 0x80,
+  0x07, 0xe0, 0x04, 0xe0, 0x04, 0x70, 0x04, 0x30, 0x04, 0x70, 0x84, 0x60, 0xe4, 0xe0, 0xff, 0xc0,
+  0x3f, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x78, 0x03, 0x07, 0xe0, 0x30, 0x73, 0x83, 0x03, 0x0c, 0x38, 0x18, 0x61, 0x80, 0xc3, 0x18, 0x07,
+  0x19, 0x80, 0x1f, 0x8c, 0x00, 0x78, 0xc0, 0x00, 0x0c, 0xf0, 0x00, 0xef, 0xc0, 0x06, 0x63, 0x00,
+  0x66, 0x18, 0x06, 0x30, 0x40, 0x71, 0x82, 0x03, 0x0c, 0x30, 0x30, 0x31, 0x83, 0x01, 0xf8, 0x18,
+  0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0xfe, 0x00, 0x38, 0xe0, 0x06, 0x0c, 0x00, 0xc0, 0x00,
+  0x18, 0x00, 0x03, 0x00, 0x00, 0x30, 0x00, 0x07, 0x00, 0x03, 0xf0, 0x60, 0xe7, 0x0c, 0x18, 0x71,
+  0x87, 0x07, 0x60, 0xc0, 0x7c, 0x1c, 0x07, 0x03, 0x80, 0xf0, 0x38, 0x7f, 0x03, 0xfc, 0x70, 0x3e,
+  0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xc1, 0x83, 0x06, 0x0c, 0x18, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x70, 0x30, 0x18, 0x18, 0x0c,
+  0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x80, 0xc0, 0x60, 0x18, 0x0c,
+  0x03, 0x01, 0x00, 0x00, 0x00, 0x01, 0x80, 0x60, 0x30, 0x0c, 0x06, 0x03, 0x01, 0x80, 0x60, 0x30,
+  0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0xc0, 0x60, 0x30, 0x38, 0x18, 0x1c, 0x0c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x65, 0x87, 0xe0, 0x38, 0x0f, 0x86, 0x58, 0x08, 0x01, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x04,
+  0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x01, 0xff, 0xf1, 0xff, 0xf0, 0x04, 0x00, 0x04,
+  0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0x02, 0x0c, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x1f,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xe1, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0xc0, 0x18, 0x06, 0x00, 0xc0,
+  0x10, 0x06, 0x00, 0xc0, 0x30, 0x06, 0x00, 0xc0, 0x30, 0x06, 0x01, 0x80, 0x30, 0x06, 0x01, 0x80,
+  0x30, 0x04, 0x01, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xff,
+  0x01, 0xc7, 0x03, 0x83, 0x83, 0x01, 0x87, 0x01, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00,
+  0xc6, 0x00, 0xc6, 0x00, 0xc6, 0x00, 0xc7, 0x01, 0xc3, 0x01, 0x83, 0x83, 0x81, 0xc7, 0x00, 0xff,
+  0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0x00, 0x3c, 0x00, 0x7c, 0x00, 0xfc, 0x01, 0xcc, 0x01, 0x8c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0c,
+  0x00, 0x0c, 0x00, 0xff, 0xc0, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0xff, 0x01, 0xc3, 0x83, 0x81, 0x83, 0x01, 0x80, 0x01,
+  0x80, 0x01, 0x80, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70,
+  0x00, 0xe0, 0x01, 0xc0, 0x03, 0x80, 0x03, 0xff, 0xc7, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0xff, 0x01, 0xc3, 0x83, 0x81,
+  0x83, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x00, 0x1e, 0x00, 0x1f, 0x00, 0x03, 0x80, 0x01,
+  0xc0, 0x01, 0xc0, 0x00, 0xc3, 0x01, 0xc3, 0x81, 0x81, 0xc3, 0x81, 0xff, 0x00, 0x7c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0f,
+  0x00, 0x0f, 0x00, 0x1f, 0x00, 0x3b, 0x00, 0x33, 0x00, 0x63, 0x00, 0xc3, 0x01, 0xc3, 0x01, 0x83,
+  0x03, 0x03, 0x06, 0x03, 0x07, 0xff, 0xe7, 0xff, 0xc0, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x80, 0xff, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0xfc, 0x03, 0xfe,
+  0x00, 0x07, 0x00, 0x03, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x03, 0x80, 0x03,
+  0x03, 0x87, 0x03, 0xfe, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x38, 0x00, 0x70, 0x00, 0x60,
+  0x00, 0xe0, 0x01, 0xfe, 0x01, 0xff, 0x03, 0xc3, 0x83, 0x81, 0xc3, 0x01, 0xc7, 0x00, 0xc7, 0x00,
+  0xc3, 0x01, 0xc3, 0x01, 0x81, 0xc3, 0x81, 0xff, 0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xc3, 0xff, 0xc0, 0x01, 0xc0, 0x01,
+  0x80, 0x03, 0x80, 0x03, 0x00, 0x07, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x18,
+  0x00, 0x38, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xe0, 0x00, 0xc0, 0x01, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x01, 0xff,
+  0x01, 0xc7, 0x83, 0x83, 0x83, 0x01, 0x83, 0x01, 0x83, 0x83, 0x81, 0xc7, 0x00, 0xfe, 0x00, 0xfe,
+  0x03, 0x83, 0x83, 0x01, 0x87, 0x01, 0xc7, 0x01, 0xc7, 0x01, 0xc3, 0x01, 0x83, 0x83, 0x81, 0xff,
+  0x00, 0x7c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x3e, 0x00, 0xff, 0x01, 0xc3, 0x83, 0x81, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x00, 0xc3, 0x81,
+  0xc1, 0xc3, 0xc1, 0xff, 0x80, 0x7b, 0x80, 0x07, 0x00, 0x06, 0x00, 0x0e, 0x00, 0x1c, 0x00, 0x18,
+  0x00, 0x38, 0x00, 0x70, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
+  0x03, 0x81, 0x81, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x00, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x03, 0xc0, 0x03, 0x80, 0x01, 0xe0,
+  0x00, 0x78, 0x00, 0x1e, 0x00, 0x07, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x83, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0x83, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x01, 0xe0, 0x00, 0x78,
+  0x00, 0x1e, 0x00, 0x07, 0x80, 0x03, 0x80, 0x0f, 0x00, 0x3c, 0x00, 0xf0, 0x01, 0xc0, 0x01, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0xff, 0x18, 0x60, 0x0e, 0x00, 0xc0, 0x18, 0x06, 0x01, 0xc0,
+  0x70, 0x1c, 0x03, 0x00, 0x60, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x07, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x03, 0xff, 0x00, 0x1c, 0x0f,
+  0x00, 0xe0, 0x0c, 0x06, 0x00, 0x18, 0x38, 0x00, 0x30, 0xc0, 0xf8, 0xc2, 0x0f, 0xe1, 0x18, 0x71,
+  0x84, 0x61, 0x86, 0x11, 0x8c, 0x10, 0x46, 0x30, 0xc3, 0x18, 0xc3, 0x0c, 0x63, 0x1c, 0x60, 0x87,
+  0xdf, 0x03, 0x0e, 0x38, 0x0c, 0x00, 0x00, 0x18, 0x00, 0x00, 0x30, 0x00, 0x00, 0x78, 0x1e, 0x00,
+  0xff, 0xe0, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x00, 0x00, 0xf0, 0x00, 0x1e, 0x00, 0x07, 0xe0, 0x00, 0xdc, 0x00, 0x39, 0x80, 0x06, 0x38,
+  0x00, 0xc3, 0x00, 0x38, 0x60, 0x06, 0x0e, 0x01, 0xc0, 0xc0, 0x38, 0x1c, 0x07, 0xff, 0x81, 0xff,
+  0xf0, 0x30, 0x07, 0x0e, 0x00, 0x61, 0xc0, 0x0e, 0x30, 0x01, 0xce, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0x00,
+  0xff, 0xe0, 0x38, 0x1c, 0x0e, 0x03, 0x83, 0x80, 0xe0, 0xe0, 0x38, 0x38, 0x0c, 0x0e, 0x07, 0x03,
+  0xff, 0x00, 0xff, 0xe0, 0x38, 0x1c, 0x0e, 0x03, 0x83, 0x80, 0x60, 0xe0, 0x18, 0x38, 0x06, 0x0e,
+  0x03, 0x83, 0x81, 0xc0, 0xff, 0xf0, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0xff, 0xe0, 0x3c, 0x1c, 0x0e,
+  0x00, 0x83, 0x80, 0x00, 0x70, 0x00, 0x0c, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01,
+  0xc0, 0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x00, 0xe0, 0x08, 0x0f, 0x07,
+  0x00, 0xff, 0xc0, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x07, 0xff, 0x80, 0x38, 0x0f, 0x01, 0xc0, 0x3c,
+  0x0e, 0x00, 0xe0, 0x70, 0x03, 0x83, 0x80, 0x1c, 0x1c, 0x00, 0x60, 0xe0, 0x03, 0x07, 0x00, 0x18,
+  0x38, 0x00, 0xc1, 0xc0, 0x06, 0x0e, 0x00, 0x70, 0x70, 0x03, 0x83, 0x80, 0x38, 0x1c, 0x01, 0xc0,
+  0xe0, 0x3c, 0x07, 0xff, 0x80, 0x3f, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x3f, 0xfc, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3f, 0xf0, 0x3f, 0xf0, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x3f, 0xfc, 0x3f, 0xfc,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc,
+  0x3f, 0xfc, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x3f, 0xf0, 0x3f, 0xf0, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00,
+  0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0xf0, 0x0f, 0x03, 0x81, 0xc0, 0x00, 0x38, 0x00, 0x03, 0x80,
+  0x00, 0x30, 0x00, 0x07, 0x00, 0x00, 0x70, 0x00, 0x07, 0x00, 0xf8, 0x70, 0x0f, 0x87, 0x00, 0x18,
+  0x30, 0x01, 0x83, 0x80, 0x18, 0x38, 0x01, 0x81, 0xc0, 0x18, 0x0f, 0x03, 0x80, 0x7f, 0xf8, 0x01,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x38, 0x01, 0x81, 0xc0, 0x0c, 0x0e, 0x00, 0x60, 0x70, 0x03, 0x03, 0x80, 0x18,
+  0x1c, 0x00, 0xc0, 0xe0, 0x06, 0x07, 0x00, 0x30, 0x3f, 0xff, 0x81, 0xff, 0xfc, 0x0e, 0x00, 0x60,
+  0x70, 0x03, 0x03, 0x80, 0x18, 0x1c, 0x00, 0xc0, 0xe0, 0x06, 0x07, 0x00, 0x30, 0x38, 0x01, 0x81,
+  0xc0, 0x0c, 0x0e, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c,
+  0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00, 0x60,
+  0x03, 0x00, 0x18, 0x00, 0xc0, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0c, 0x00, 0xe0, 0x07, 0x00, 0x70,
+  0x3f, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60,
+  0x0c, 0x0c, 0x03, 0x81, 0x80, 0xe0, 0x30, 0x38, 0x06, 0x0e, 0x00, 0xc3, 0x80, 0x18, 0xe0, 0x03,
+  0x38, 0x00, 0x7e, 0x00, 0x0f, 0xe0, 0x01, 0x9e, 0x00, 0x31, 0xc0, 0x06, 0x1c, 0x00, 0xc1, 0xc0,
+  0x18, 0x1c, 0x03, 0x01, 0xc0, 0x60, 0x38, 0x0c, 0x03, 0x81, 0x80, 0x38, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80, 0x0e, 0x00,
+  0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00,
+  0xe0, 0x03, 0x80, 0x0e, 0x00, 0x38, 0x00, 0xe0, 0x03, 0x80, 0x0f, 0xfe, 0x3f, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1c, 0x1e, 0x00, 0x1e,
+  0x0f, 0x00, 0x0f, 0x07, 0xc0, 0x0f, 0x83, 0xe0, 0x07, 0xc1, 0xb8, 0x07, 0xe0, 0xcc, 0x03, 0x70,
+  0x67, 0x03, 0xb8, 0x31, 0x81, 0x9c, 0x18, 0xe1, 0x8e, 0x0c, 0x39, 0xc7, 0x06, 0x0c, 0xc3, 0x83,
+  0x07, 0xe1, 0xc1, 0x81, 0xe0, 0xe0, 0xc0, 0xf0, 0x70, 0x60, 0x30, 0x38, 0x30, 0x00, 0x1c, 0x18,
+  0x00, 0x0e, 0x0c, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x00, 0x60, 0x70, 0x03,
+  0x03, 0xc0, 0x18, 0x1f, 0x00, 0xc0, 0xfc, 0x06, 0x06, 0xe0, 0x30, 0x33, 0x81, 0x81, 0x8e, 0x0c,
+  0x0c, 0x78, 0x60, 0x61, 0xc3, 0x03, 0x07, 0x18, 0x18, 0x1c, 0xc0, 0xc0, 0x76, 0x06, 0x03, 0xb0,
+  0x30, 0x0f, 0x81, 0x80, 0x3c, 0x0c, 0x00, 0xe0, 0x60, 0x07, 0x03, 0x00, 0x18, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0x80, 0x01, 0xff, 0xc0, 0x0f, 0x07, 0x80, 0x70, 0x07, 0x03, 0x80, 0x0c, 0x0e, 0x00, 0x38,
+  0x30, 0x00, 0x61, 0xc0, 0x01, 0x87, 0x00, 0x06, 0x1c, 0x00, 0x1c, 0x70, 0x00, 0x61, 0xc0, 0x01,
+  0x83, 0x00, 0x06, 0x0e, 0x00, 0x38, 0x38, 0x00, 0xc0, 0x70, 0x07, 0x00, 0xf0, 0x78, 0x01, 0xff,
+  0xc0, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x0f, 0xfc, 0x06, 0x0f, 0x03, 0x01, 0xc1,
+  0x80, 0xe0, 0xc0, 0x70, 0x60, 0x38, 0x30, 0x1c, 0x18, 0x0c, 0x0c, 0x1e, 0x07, 0xfe, 0x03, 0xfc,
+  0x01, 0x80, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0c, 0x00, 0x06, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e,
+  0x00, 0x07, 0xff, 0x00, 0x3c, 0x1e, 0x01, 0xc0, 0x1c, 0x0e, 0x00, 0x30, 0x38, 0x00, 0xe0, 0xc0,
+  0x01, 0x87, 0x00, 0x06, 0x1c, 0x00, 0x18, 0x70, 0x00, 0x71, 0xc0, 0x01, 0xc7, 0x00, 0x06, 0x0c,
+  0x00, 0x18, 0x38, 0x00, 0xe0, 0xe0, 0x03, 0x01, 0xc0, 0x1c, 0x03, 0xc1, 0xe0, 0x07, 0xff, 0x00,
+  0x07, 0xfc, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70, 0x00, 0x00, 0xe0, 0x00, 0x01, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x1f, 0xf8, 0x06, 0x0f, 0x01, 0x80, 0xc0, 0x60,
+  0x38, 0x18, 0x0e, 0x06, 0x03, 0x01, 0x81, 0xc0, 0x60, 0xe0, 0x1f, 0xf0, 0x07, 0xf0, 0x01, 0x8e,
+  0x00, 0x61, 0xc0, 0x18, 0x30, 0x06, 0x0e, 0x01, 0x81, 0xc0, 0x60, 0x38, 0x18, 0x0e, 0x06, 0x01,
+  0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xf0, 0x0f, 0xf8, 0x38, 0x70, 0x60, 0x00, 0xc0, 0x01, 0x80, 0x03, 0x80, 0x07, 0x80, 0x07,
+  0xe0, 0x07, 0xf0, 0x01, 0xf0, 0x00, 0xf0, 0x00, 0xe0, 0x01, 0xc0, 0x03, 0x84, 0x06, 0x1c, 0x1c,
+  0x1f, 0xf0, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xfe, 0xff, 0xfe, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x03,
+  0x80, 0x03, 0x80, 0x03, 0x80, 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x03, 0x83, 0x80, 0x38, 0x38, 0x03, 0x83, 0x80, 0x38, 0x38,
+  0x03, 0x83, 0x80, 0x38, 0x38, 0x03, 0x83, 0x80, 0x38, 0x38, 0x03, 0x83, 0x80, 0x38, 0x38, 0x03,
+  0x83, 0x80, 0x38, 0x38, 0x03, 0x83, 0x80, 0x38, 0x18, 0x03, 0x01, 0xc0, 0x70, 0x0e, 0x0e, 0x00,
+  0x7f, 0xc0, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x01, 0x8c, 0x00, 0x71, 0xc0, 0x0e, 0x18, 0x01, 0x83,
+  0x80, 0x70, 0x70, 0x0c, 0x06, 0x03, 0x80, 0xe0, 0x70, 0x0c, 0x0c, 0x01, 0x83, 0x80, 0x38, 0x60,
+  0x03, 0x1c, 0x00, 0x73, 0x80, 0x06, 0x60, 0x00, 0xdc, 0x00, 0x1f, 0x00, 0x01, 0xe0, 0x00, 0x3c,
+  0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x03, 0x80, 0x30, 0x03, 0x18, 0x03, 0x80, 0x71, 0xc0, 0x78, 0x07, 0x1c, 0x07,
+  0x80, 0x60, 0xc0, 0x7c, 0x0e, 0x0e, 0x0e, 0xc0, 0xe0, 0xe0, 0xcc, 0x0c, 0x0e, 0x0c, 0xe1, 0xc0,
+  0x61, 0xc6, 0x1c, 0x07, 0x18, 0x61, 0x80, 0x71, 0x87, 0x18, 0x03, 0x38, 0x33, 0x80, 0x3b, 0x03,
+  0x30, 0x03, 0xb0, 0x3b, 0x00, 0x1f, 0x01, 0xf0, 0x01, 0xe0, 0x1f, 0x00, 0x1e, 0x01, 0xe0, 0x00,
+  0xe0, 0x0e, 0x00, 0x0c, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0,
+  0x1c, 0x70, 0x06, 0x0e, 0x03, 0x81, 0xc1, 0xc0, 0x70, 0x60, 0x0e, 0x38, 0x01, 0xdc, 0x00, 0x7e,
+  0x00, 0x0f, 0x80, 0x03, 0xc0, 0x00, 0xf8, 0x00, 0x77, 0x00, 0x39, 0xc0, 0x0e, 0x38, 0x07, 0x07,
+  0x03, 0x81, 0xc0, 0xe0, 0x38, 0x70, 0x07, 0x18, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x01, 0xce, 0x00, 0xc3, 0x00, 0xe1,
+  0xc0, 0x60, 0x60, 0x70, 0x38, 0x70, 0x0e, 0x30, 0x03, 0x38, 0x01, 0xd8, 0x00, 0x7c, 0x00, 0x3c,
+  0x00, 0x0e, 0x00, 0x06, 0x00, 0x03, 0x00, 0x01, 0x80, 0x00, 0xc0, 0x00, 0x60, 0x00, 0x30, 0x00,
+  0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0xe1, 0xff, 0xf0, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1c, 0x00,
+  0x1c, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x07, 0x00, 0x07, 0x00, 0x07, 0x00,
+  0x03, 0x00, 0x03, 0x80, 0x03, 0xff, 0xf1, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01,
+  0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x07,
+  0x83, 0xe0, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x01, 0x80, 0x30, 0x03, 0x00, 0x60, 0x04, 0x00, 0xc0,
+  0x18, 0x01, 0x80, 0x30, 0x06, 0x00, 0x60, 0x0c, 0x00, 0x80, 0x18, 0x03, 0x00, 0x30, 0x06, 0x00,
+  0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80,
+  0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03,
+  0x0f, 0x87, 0xc0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x80, 0x07, 0x80, 0x06, 0xc0, 0x0e, 0xe0,
+  0x0c, 0x60, 0x1c, 0x70, 0x18, 0x30, 0x30, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xbf, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x60,
+  0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x3e, 0x01, 0xfc, 0x0e, 0x38, 0x00, 0x60, 0x01, 0xc0, 0x07, 0x01, 0xfc,
+  0x1f, 0xf0, 0xe1, 0xc7, 0x07, 0x18, 0x1c, 0x70, 0xf0, 0xfe, 0xc1, 0xe3, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00, 0x03, 0x00,
+  0x03, 0x00, 0x03, 0x1e, 0x03, 0x7f, 0x03, 0xc3, 0x83, 0x83, 0x83, 0x01, 0x83, 0x01, 0xc3, 0x01,
+  0xc3, 0x01, 0xc3, 0x01, 0x83, 0x01, 0x83, 0x03, 0x83, 0x87, 0x03, 0x7f, 0x03, 0x3c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x07, 0xf8, 0x70, 0xc3, 0x00, 0x38, 0x01, 0xc0, 0x0c, 0x00,
+  0x60, 0x03, 0x00, 0x1c, 0x00, 0x60, 0x03, 0x86, 0x0f, 0xf0, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+  0xe0, 0x3e, 0xe0, 0x7f, 0xe0, 0xe1, 0xe0, 0xc0, 0xe1, 0xc0, 0xe1, 0x80, 0xe1, 0x80, 0xe1, 0x80,
+  0xe1, 0x80, 0xe1, 0xc0, 0xe1, 0xc0, 0xe0, 0xe1, 0xe0, 0x7e, 0xe0, 0x3c, 0x60, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x03, 0xc0, 0x1f, 0xe0, 0x70, 0xe0, 0xc0, 0xc3, 0x01, 0x87, 0xff, 0x8f,
+  0xfe, 0x18, 0x00, 0x30, 0x00, 0x70, 0x00, 0x60, 0x00, 0xe0, 0xc0, 0xff, 0x80, 0x7c, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x7c, 0x18, 0x0e,
+  0x03, 0x83, 0xfc, 0x7f, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03, 0x80, 0xe0, 0x38, 0x0e, 0x03,
+  0x80, 0xe0, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x03, 0xff, 0x8e, 0x3c, 0x70, 0x61, 0xc1, 0x87, 0x06, 0x0e,
+  0x38, 0x1f, 0xc0, 0x7e, 0x03, 0x00, 0x0c, 0x00, 0x3f, 0xe0, 0x7f, 0xc6, 0x03, 0x18, 0x0e, 0x60,
+  0x31, 0xc1, 0xc3, 0xfe, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x18,
+  0x00, 0x30, 0x00, 0x67, 0xc0, 0xdf, 0xc1, 0xe3, 0x83, 0x83, 0x86, 0x07, 0x0c, 0x06, 0x18, 0x0c,
+  0x30, 0x18, 0x60, 0x30, 0xc0, 0x61, 0x80, 0xc3, 0x01, 0x86, 0x03, 0x0c, 0x06, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x0c,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0e, 0x0c, 0x00, 0x00, 0x00, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c,
+  0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x0c, 0x3c, 0x38, 0x00, 0x00, 0x0c, 0x00,
+  0x18, 0x00, 0x30, 0x00, 0x60, 0x00, 0xc0, 0x01, 0x81, 0x83, 0x07, 0x06, 0x1c, 0x0c, 0x70, 0x18,
+  0xc0, 0x33, 0x00, 0x7e, 0x00, 0xfc, 0x01, 0x9c, 0x03, 0x1c, 0x06, 0x18, 0x0c, 0x18, 0x18, 0x38,
+  0x30, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xce, 0x1e, 0x03, 0x7c, 0xfe, 0x0f, 0x1e, 0x38, 0x38,
+  0x70, 0x70, 0xc0, 0xc1, 0xc3, 0x03, 0x07, 0x0c, 0x0c, 0x1c, 0x30, 0x30, 0x70, 0xc0, 0xc1, 0xc3,
+  0x03, 0x07, 0x0c, 0x0c, 0x1c, 0x30, 0x30, 0x70, 0xc0, 0xc1, 0xc3, 0x03, 0x07, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x67, 0xc0, 0xdf, 0xc1, 0xe3, 0x83,
+  0x83, 0x86, 0x07, 0x0c, 0x06, 0x18, 0x0c, 0x30, 0x18, 0x60, 0x30, 0xc0, 0x61, 0x80, 0xc3, 0x01,
+  0x86, 0x03, 0x0c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x01, 0xfe, 0x07, 0x0e,
+  0x0c, 0x0e, 0x38, 0x0c, 0x60, 0x18, 0xc0, 0x31, 0x80, 0x63, 0x00, 0xc7, 0x01, 0x86, 0x07, 0x0e,
+  0x1c, 0x0f, 0xf0, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x7c, 0x0d, 0xfc, 0x1e,
+  0x3c, 0x38, 0x38, 0x60, 0x30, 0xc0, 0x61, 0x80, 0xc3, 0x01, 0x86, 0x03, 0x0c, 0x06, 0x18, 0x1c,
+  0x38, 0x70, 0x7f, 0xc0, 0xcf, 0x01, 0x80, 0x03, 0x00, 0x06, 0x00, 0x0c, 0x00, 0x18, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x60, 0x7f,
+  0xe0, 0xe1, 0xe0, 0xc0, 0xe1, 0xc0, 0xe1, 0x80, 0xe1, 0x80, 0xe1, 0x80, 0xe1, 0x80, 0xe1, 0xc0,
+  0xe1, 0xc0, 0xe0, 0xe1, 0xe0, 0x7e, 0xe0, 0x3c, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00,
+  0xe0, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9e, 0x37,
+  0xc7, 0x80, 0xe0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x03,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x03, 0xfc, 0x70, 0x86, 0x00, 0x70, 0x03, 0x80, 0x1e, 0x00, 0x78, 0x01, 0xc0,
+  0x0c, 0x00, 0xc6, 0x1c, 0x7f, 0x81, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x30, 0x06, 0x00, 0xc0, 0x18, 0x0f, 0xf1, 0xfe, 0x0c, 0x01, 0x80, 0x30, 0x06,
+  0x00, 0xc0, 0x18, 0x03, 0x00, 0x60, 0x0c, 0x01, 0x80, 0x3f, 0x03, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x81,
+  0xc3, 0x03, 0x86, 0x07, 0x0c, 0x0e, 0x18, 0x1c, 0x30, 0x38, 0x60, 0x70, 0xc0, 0xe1, 0x81, 0xc3,
+  0x03, 0x86, 0x07, 0x0e, 0x1e, 0x0f, 0xfc, 0x0f, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x80,
+  0x66, 0x03, 0x1c, 0x0c, 0x30, 0x70, 0xc1, 0x83, 0x86, 0x06, 0x38, 0x18, 0xc0, 0x73, 0x00, 0xd8,
+  0x03, 0xe0, 0x07, 0x80, 0x1c, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x07, 0x03, 0x03, 0x98, 0x18, 0x18, 0xc1, 0xe0, 0xc7, 0x0f, 0x0e, 0x18, 0x78, 0x60, 0xc6, 0x63,
+  0x06, 0x33, 0x18, 0x39, 0x99, 0x80, 0xd8, 0x6c, 0x06, 0xc3, 0x60, 0x3e, 0x1f, 0x00, 0xe0, 0x70,
+  0x07, 0x03, 0x80, 0x38, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x06, 0x03, 0x0c, 0x1c, 0x38, 0xe0, 0x63, 0x01, 0xdc, 0x03, 0xe0, 0x07, 0x00, 0x1e, 0x00, 0xf8,
+  0x07, 0x70, 0x18, 0xc0, 0xc1, 0x87, 0x07, 0x18, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x19,
+  0x80, 0xe7, 0x03, 0x0c, 0x1c, 0x30, 0x60, 0xe1, 0x81, 0x8e, 0x07, 0x30, 0x0c, 0xc0, 0x36, 0x00,
+  0xf8, 0x01, 0xe0, 0x07, 0x00, 0x0c, 0x00, 0x60, 0x01, 0x80, 0x0e, 0x00, 0x30, 0x01, 0xc0, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xc7, 0xfe, 0x00, 0x60,
+  0x07, 0x00, 0x30, 0x03, 0x00, 0x38, 0x03, 0x80, 0x18, 0x01, 0x80, 0x1c, 0x00, 0xc0, 0x0f, 0xfc,
+  0x7f, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x18, 0x0c,
+  0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x18, 0x0c, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30,
+  0x18, 0x0c, 0x06, 0x03, 0x81, 0xf0, 0x38, 0x00, 0x00, 0x00, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60,
+  0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01, 0x80,
+  0xc0, 0x60, 0x30, 0x18, 0x0c, 0x00, 0x00, 0x01, 0xc0, 0x60, 0x30, 0x18, 0x0c, 0x06, 0x03, 0x01,
+  0x00, 0xc0, 0x60, 0x18, 0x1c, 0x0c, 0x06, 0x02, 0x01, 0x80, 0xc0, 0x60, 0x30, 0x18, 0x1c, 0x3c,
+  0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x7c, 0x60, 0xff, 0xe0, 0xc7, 0xc0, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t kFont6Widths[95] = {
+  10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 11, 0, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 40, 0, 0, 28, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint32_t kFont6Offsets[95] = {
+  0, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+  480, 480, 480, 480, 1344, 1872, 1872, 3264, 4656, 6048,
+  7440, 8832, 10224, 11616, 13008, 14400, 15792, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 17616, 17616, 17616, 17616,
+  17616, 17616, 17616, 17616, 17616, 17616, 17616, 17616, 19536, 19536,
+  19536, 20880, 20880, 20880, 20880, 20880, 20880, 20880, 20880, 20880,
+  20880, 20880, 20880, 20880, 20880,
+};
+static const uint8_t kFont6Bits[2610] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0xf8, 0x3f, 0x07, 0xe0, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0x3f, 0xfc, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x3e, 0x0f, 0xc0, 0x03, 0xe0, 0x1f, 0x00,
+  0x3e, 0x00, 0x7c, 0x01, 0xe0, 0x01, 0xe0, 0x1f, 0x00, 0x0f, 0x80, 0xf0, 0x00, 0x3c, 0x0f, 0x80,
+  0x01, 0xe0, 0x7c, 0x00, 0x0f, 0x83, 0xc0, 0x00, 0x7c, 0x1e, 0x00, 0x01, 0xe0, 0xf0, 0x00, 0x0f,
+  0x07, 0x80, 0x00, 0x78, 0x7c, 0x00, 0x03, 0xc3, 0xe0, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0xf0, 0xf8,
+  0x00, 0x07, 0x87, 0xc0, 0x00, 0x3c, 0x1e, 0x00, 0x01, 0xe0, 0xf0, 0x00, 0x0f, 0x07, 0x80, 0x00,
+  0x78, 0x3c, 0x00, 0x07, 0xc1, 0xf0, 0x00, 0x3e, 0x0f, 0x80, 0x01, 0xe0, 0x3c, 0x00, 0x0f, 0x01,
+  0xf0, 0x00, 0xf8, 0x07, 0x80, 0x07, 0x80, 0x3e, 0x00, 0x7c, 0x00, 0xf8, 0x07, 0xc0, 0x03, 0xe0,
+  0xfc, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x01, 0xf8, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01, 0xff,
+  0x80, 0x00, 0x1f, 0xfc, 0x00, 0x01, 0xf3, 0xe0, 0x00, 0x1f, 0x1f, 0x00, 0x01, 0xf0, 0xf8, 0x00,
+  0x07, 0x07, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0xc0,
+  0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3e,
+  0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0xe0, 0x00,
+  0x0f, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xe0, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x3f, 0xfc,
+  0x00, 0x03, 0xff, 0xf8, 0x00, 0x3f, 0x07, 0xe0, 0x03, 0xe0, 0x1f, 0x00, 0x3e, 0x00, 0x7c, 0x01,
+  0xe0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf8, 0x00, 0x7c, 0x03, 0x80, 0x03, 0xe0, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0xe0,
+  0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80,
+  0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01,
+  0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0xff, 0xff,
+  0xfc, 0x07, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x03,
+  0xff, 0xf8, 0x00, 0x3f, 0x07, 0xe0, 0x03, 0xe0, 0x0f, 0x80, 0x1e, 0x00, 0x3c, 0x01, 0xf0, 0x01,
+  0xf0, 0x0f, 0x00, 0x07, 0x80, 0x78, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x07,
+  0xf0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x07, 0xc0, 0x00,
+  0x00, 0x3e, 0x03, 0x00, 0x01, 0xf0, 0x3c, 0x00, 0x0f, 0x01, 0xf0, 0x00, 0x78, 0x0f, 0x80, 0x07,
+  0xc0, 0x3e, 0x00, 0x3c, 0x00, 0xf8, 0x03, 0xe0, 0x07, 0xe0, 0x7e, 0x00, 0x1f, 0xff, 0xe0, 0x00,
+  0x3f, 0xfc, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf8,
+  0x00, 0x00, 0x1f, 0xc0, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xf7, 0x80, 0x00,
+  0x0f, 0xbc, 0x00, 0x00, 0xf9, 0xe0, 0x00, 0x07, 0x8f, 0x00, 0x00, 0x78, 0x78, 0x00, 0x07, 0xc3,
+  0xc0, 0x00, 0x3c, 0x1e, 0x00, 0x03, 0xc0, 0xf0, 0x00, 0x3e, 0x07, 0x80, 0x03, 0xe0, 0x3c, 0x00,
+  0x1e, 0x01, 0xe0, 0x01, 0xe0, 0x0f, 0x00, 0x1f, 0x00, 0x78, 0x01, 0xf0, 0x03, 0xc0, 0x0f, 0x00,
+  0x1e, 0x00, 0xf8, 0x00, 0xf0, 0x0f, 0x80, 0x07, 0x80, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0x80, 0x03, 0xff, 0xfc, 0x00, 0x1c,
+  0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x1c, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03,
+  0xc0, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xf8, 0x00, 0x3c, 0x07,
+  0xe0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x03, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf8,
+  0x01, 0xc0, 0x0f, 0x80, 0x1f, 0x81, 0xf8, 0x00, 0xff, 0xff, 0x80, 0x01, 0xff, 0xf0, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x3e, 0x00,
+  0x00, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0xbf, 0x80, 0x00, 0x7f, 0xff, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x7f, 0x83, 0xf0, 0x03,
+  0xf0, 0x07, 0xc0, 0x1f, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0xf8, 0x0f, 0x00, 0x03, 0xc0, 0x78, 0x00,
+  0x1f, 0x03, 0xc0, 0x00, 0xf8, 0x1e, 0x00, 0x07, 0xc0, 0xf0, 0x00, 0x3e, 0x07, 0x80, 0x01, 0xf0,
+  0x3c, 0x00, 0x0f, 0x01, 0xe0, 0x00, 0x78, 0x07, 0x80, 0x07, 0xc0, 0x3c, 0x00, 0x3c, 0x00, 0xf0,
+  0x07, 0xc0, 0x07, 0xe0, 0x7e, 0x00, 0x0f, 0xff, 0xe0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x03, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x03, 0xe0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x7c,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc,
+  0x00, 0x00, 0x3f, 0xfc, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x7e, 0x07, 0xc0, 0x03, 0xe0, 0x1f, 0x00,
+  0x3e, 0x00, 0x7c, 0x01, 0xe0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0x78, 0x00, 0x78, 0x03, 0xc0,
+  0x03, 0xc0, 0x1e, 0x00, 0x1e, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0xc0, 0x0f, 0x00, 0x1f, 0x00, 0xf8,
+  0x00, 0x7c, 0x0f, 0x80, 0x01, 0xff, 0xf8, 0x00, 0x07, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0f,
+  0xc0, 0xfc, 0x00, 0xf8, 0x01, 0xf0, 0x0f, 0x80, 0x07, 0x80, 0x78, 0x00, 0x3e, 0x03, 0xc0, 0x00,
+  0xf0, 0x3e, 0x00, 0x07, 0x81, 0xf0, 0x00, 0x3c, 0x0f, 0x80, 0x01, 0xe0, 0x7c, 0x00, 0x0f, 0x01,
+  0xe0, 0x00, 0x78, 0x0f, 0x80, 0x07, 0xc0, 0x7c, 0x00, 0x3c, 0x01, 0xf0, 0x03, 0xe0, 0x07, 0xe0,
+  0x7e, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+  0x1f, 0xfe, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x3f, 0x07, 0xe0, 0x01, 0xe0, 0x0f, 0x80, 0x1e, 0x00,
+  0x3e, 0x00, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0x07, 0x80, 0x78, 0x00, 0x1e, 0x03, 0xc0, 0x00, 0xf0,
+  0x1e, 0x00, 0x07, 0x80, 0xf0, 0x00, 0x3c, 0x07, 0x80, 0x01, 0xe0, 0x3c, 0x00, 0x1f, 0x01, 0xf0,
+  0x00, 0xf0, 0x0f, 0x80, 0x0f, 0x80, 0x3e, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xc0, 0x03, 0xff, 0xfe,
+  0x00, 0x0f, 0xff, 0xe0, 0x00, 0x1f, 0xcf, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0xf8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x7c,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x03, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0xc0, 0x7e, 0x03, 0xf0,
+  0x0f, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x01, 0xf0, 0x1f, 0x80, 0xfc, 0x03, 0xe0, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x3f, 0xfc, 0x00, 0x3f, 0xff, 0x00,
+  0x3f, 0x07, 0xc0, 0x1e, 0x01, 0xe0, 0x04, 0x00, 0xf8, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x1e, 0x00,
+  0x00, 0x0f, 0x00, 0x00, 0x07, 0x80, 0x00, 0x03, 0xc0, 0x00, 0x7f, 0xe0, 0x03, 0xff, 0xf0, 0x07,
+  0xff, 0xf8, 0x07, 0xf8, 0x3c, 0x07, 0xc0, 0x1e, 0x03, 0xc0, 0x0f, 0x03, 0xe0, 0x07, 0x81, 0xe0,
+  0x03, 0xc0, 0xf0, 0x03, 0xe0, 0x7c, 0x03, 0xf0, 0x1f, 0x07, 0xf8, 0x0f, 0xff, 0x9c, 0x03, 0xff,
+  0x8e, 0x00, 0x7e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1e, 0x0f, 0x80, 0x7e, 0x00, 0x1e, 0x3f, 0xe1, 0xff, 0x80, 0x1e, 0x7f, 0xe3, 0xff, 0xc0,
+  0x1f, 0xe1, 0xf7, 0x83, 0xe0, 0x1f, 0xc0, 0x7f, 0x01, 0xf0, 0x1f, 0x80, 0x7e, 0x00, 0xf0, 0x1f,
+  0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00,
+  0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c,
+  0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00,
+  0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0,
+  0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f,
+  0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x1f, 0x00, 0x3c, 0x00, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0xe0, 0x7e, 0x00, 0x1e, 0x3f, 0xf8, 0x01, 0xe7, 0xff, 0xc0, 0x1f, 0xf0, 0x7e, 0x01, 0xfc,
+  0x03, 0xe0, 0x1f, 0x80, 0x1f, 0x01, 0xf0, 0x00, 0xf0, 0x1f, 0x00, 0x0f, 0x01, 0xf0, 0x00, 0xf8,
+  0x1f, 0x00, 0x0f, 0x81, 0xf0, 0x00, 0xf8, 0x1f, 0x00, 0x0f, 0x81, 0xf0, 0x00, 0xf8, 0x1f, 0x00,
+  0x0f, 0x81, 0xf0, 0x00, 0xf8, 0x1f, 0x00, 0x0f, 0x81, 0xf0, 0x00, 0xf0, 0x1f, 0x00, 0x0f, 0x01,
+  0xf0, 0x01, 0xf0, 0x1f, 0x00, 0x1e, 0x01, 0xf8, 0x03, 0xe0, 0x1f, 0xe0, 0xfc, 0x01, 0xff, 0xff,
+  0x80, 0x1f, 0x7f, 0xf0, 0x01, 0xf1, 0xfc, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f,
+  0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00,
+};
+
+static const uint8_t kFont7Widths[95] = {
+  10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 18, 11, 0, 29, 29, 29,
+  29, 29, 29, 29, 29, 29, 29, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint32_t kFont7Offsets[95] = {
+  0, 480, 480, 480, 480, 480, 480, 480, 480, 480,
+  480, 480, 480, 480, 1344, 1872, 1872, 3264, 4656, 6048,
+  7440, 8832, 10224, 11616, 13008, 14400, 15792, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416, 16416,
+  16416, 16416, 16416, 16416, 16416,
+};
+static const uint8_t kFont7Bits[2052] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x0f, 0xff, 0x03, 0xff, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0x80, 0xf8, 0x3f, 0x07, 0xe0, 0x7c, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc,
+  0x00, 0x00, 0x3f, 0xfc, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x3e, 0x0f, 0xc0, 0x03, 0xe0, 0x1f, 0x00,
+  0x3e, 0x00, 0x7c, 0x01, 0xe0, 0x01, 0xe0, 0x1f, 0x00, 0x0f, 0x80, 0xf0, 0x00, 0x3c, 0x0f, 0x80,
+  0x01, 0xe0, 0x7c, 0x00, 0x0f, 0x83, 0xc0, 0x00, 0x7c, 0x1e, 0x00, 0x01, 0xe0, 0xf0, 0x00, 0x0f,
+  0x07, 0x80, 0x00, 0x78, 0x7c, 0x00, 0x03, 0xc3, 0xe0, 0x00, 0x1e, 0x1f, 0x00, 0x00, 0xf0, 0xf8,
+  0x00, 0x07, 0x87, 0xc0, 0x00, 0x3c, 0x1e, 0x00, 0x01, 0xe0, 0xf0, 0x00, 0x0f, 0x07, 0x80, 0x00,
+  0x78, 0x3c, 0x00, 0x07, 0xc1, 0xf0, 0x00, 0x3e, 0x0f, 0x80, 0x01, 0xe0, 0x3c, 0x00, 0x0f, 0x01,
+  0xf0, 0x00, 0xf8, 0x07, 0x80, 0x07, 0x80, 0x3e, 0x00, 0x7c, 0x00, 0xf8, 0x07, 0xc0, 0x03, 0xe0,
+  0xfc, 0x00, 0x0f, 0xff, 0xc0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x01, 0xf8, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x1f, 0xf0, 0x00, 0x01, 0xff,
+  0x80, 0x00, 0x1f, 0xfc, 0x00, 0x01, 0xf3, 0xe0, 0x00, 0x1f, 0x1f, 0x00, 0x01, 0xf0, 0xf8, 0x00,
+  0x07, 0x07, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00,
+  0x7c, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0xc0,
+  0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3e,
+  0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0xe0, 0x00,
+  0x0f, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xe0, 0x03, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x3f, 0xfc,
+  0x00, 0x03, 0xff, 0xf8, 0x00, 0x3f, 0x07, 0xe0, 0x03, 0xe0, 0x1f, 0x00, 0x3e, 0x00, 0x7c, 0x01,
+  0xe0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0xf8, 0x00, 0x7c, 0x03, 0x80, 0x03, 0xe0, 0x00, 0x00,
+  0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0xe0,
+  0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00,
+  0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80,
+  0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01,
+  0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0xff, 0xff,
+  0xfc, 0x07, 0xff, 0xff, 0xe0, 0x7f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x03,
+  0xff, 0xf8, 0x00, 0x3f, 0x07, 0xe0, 0x03, 0xe0, 0x0f, 0x80, 0x1e, 0x00, 0x3c, 0x01, 0xf0, 0x01,
+  0xf0, 0x0f, 0x00, 0x07, 0x80, 0x78, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x00,
+  0x00, 0x00, 0xf0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x07,
+  0xf0, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x01, 0xff, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x01, 0xf0,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x07, 0xc0, 0x00,
+  0x00, 0x3e, 0x03, 0x00, 0x01, 0xf0, 0x3c, 0x00, 0x0f, 0x01, 0xf0, 0x00, 0x78, 0x0f, 0x80, 0x07,
+  0xc0, 0x3e, 0x00, 0x3c, 0x00, 0xf8, 0x03, 0xe0, 0x07, 0xe0, 0x7e, 0x00, 0x1f, 0xff, 0xe0, 0x00,
+  0x3f, 0xfc, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf8,
+  0x00, 0x00, 0x1f, 0xc0, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0xf7, 0x80, 0x00,
+  0x0f, 0xbc, 0x00, 0x00, 0xf9, 0xe0, 0x00, 0x07, 0x8f, 0x00, 0x00, 0x78, 0x78, 0x00, 0x07, 0xc3,
+  0xc0, 0x00, 0x3c, 0x1e, 0x00, 0x03, 0xc0, 0xf0, 0x00, 0x3e, 0x07, 0x80, 0x03, 0xe0, 0x3c, 0x00,
+  0x1e, 0x01, 0xe0, 0x01, 0xe0, 0x0f, 0x00, 0x1f, 0x00, 0x78, 0x01, 0xf0, 0x03, 0xc0, 0x0f, 0x00,
+  0x1e, 0x00, 0xf8, 0x00, 0xf0, 0x0f, 0x80, 0x07, 0x80, 0x7f, 0xff, 0xff, 0xe3, 0xff, 0xff, 0xff,
+  0x0f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f,
+  0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xf0, 0x00, 0x7f, 0xff, 0x80, 0x03, 0xff, 0xfc, 0x00, 0x1c,
+  0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03, 0x80, 0x00,
+  0x00, 0x1c, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x03,
+  0xc0, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x07, 0xff, 0xf8, 0x00, 0x3c, 0x07,
+  0xe0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x07, 0x80,
+  0x00, 0x00, 0x3c, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00,
+  0x03, 0xc0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf8,
+  0x01, 0xc0, 0x0f, 0x80, 0x1f, 0x81, 0xf8, 0x00, 0xff, 0xff, 0x80, 0x01, 0xff, 0xf0, 0x00, 0x01,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x3e, 0x00,
+  0x00, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01,
+  0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf0, 0x00,
+  0x00, 0x0f, 0xbf, 0x80, 0x00, 0x7f, 0xff, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x7f, 0x83, 0xf0, 0x03,
+  0xf0, 0x07, 0xc0, 0x1f, 0x00, 0x1f, 0x01, 0xf0, 0x00, 0xf8, 0x0f, 0x00, 0x03, 0xc0, 0x78, 0x00,
+  0x1f, 0x03, 0xc0, 0x00, 0xf8, 0x1e, 0x00, 0x07, 0xc0, 0xf0, 0x00, 0x3e, 0x07, 0x80, 0x01, 0xf0,
+  0x3c, 0x00, 0x0f, 0x01, 0xe0, 0x00, 0x78, 0x07, 0x80, 0x07, 0xc0, 0x3c, 0x00, 0x3c, 0x00, 0xf0,
+  0x07, 0xc0, 0x07, 0xe0, 0x7e, 0x00, 0x0f, 0xff, 0xe0, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0xff, 0xfe, 0x07, 0xff, 0xff, 0xf0, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x03, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf0,
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3c, 0x00, 0x00,
+  0x03, 0xe0, 0x00, 0x00, 0x1e, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0xf8,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x01, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x7c,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x1f, 0x00, 0x00,
+  0x00, 0xf0, 0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfc,
+  0x00, 0x00, 0x3f, 0xfc, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x7e, 0x07, 0xc0, 0x03, 0xe0, 0x1f, 0x00,
+  0x3e, 0x00, 0x7c, 0x01, 0xe0, 0x01, 0xe0, 0x0f, 0x00, 0x0f, 0x00, 0x78, 0x00, 0x78, 0x03, 0xc0,
+  0x03, 0xc0, 0x1e, 0x00, 0x1e, 0x00, 0xf0, 0x00, 0xf0, 0x07, 0xc0, 0x0f, 0x00, 0x1f, 0x00, 0xf8,
+  0x00, 0x7c, 0x0f, 0x80, 0x01, 0xff, 0xf8, 0x00, 0x07, 0xff, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x0f,
+  0xc0, 0xfc, 0x00, 0xf8, 0x01, 0xf0, 0x0f, 0x80, 0x07, 0x80, 0x78, 0x00, 0x3e, 0x03, 0xc0, 0x00,
+  0xf0, 0x3e, 0x00, 0x07, 0x81, 0xf0, 0x00, 0x3c, 0x0f, 0x80, 0x01, 0xe0, 0x7c, 0x00, 0x0f, 0x01,
+  0xe0, 0x00, 0x78, 0x0f, 0x80, 0x07, 0xc0, 0x7c, 0x00, 0x3c, 0x01, 0xf0, 0x03, 0xe0, 0x07, 0xe0,
+  0x7e, 0x00, 0x1f, 0xff, 0xe0, 0x00, 0x7f, 0xfc, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+  0x1f, 0xfe, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x3f, 0x07, 0xe0, 0x01, 0xe0, 0x0f, 0x80, 0x1e, 0x00,
+  0x3e, 0x00, 0xf0, 0x00, 0xf0, 0x0f, 0x00, 0x07, 0x80, 0x78, 0x00, 0x1e, 0x03, 0xc0, 0x00, 0xf0,
+  0x1e, 0x00, 0x07, 0x80, 0xf0, 0x00, 0x3c, 0x07, 0x80, 0x01, 0xe0, 0x3c, 0x00, 0x1f, 0x01, 0xf0,
+  0x00, 0xf0, 0x0f, 0x80, 0x0f, 0x80, 0x3e, 0x00, 0xfc, 0x00, 0xfc, 0x1f, 0xc0, 0x03, 0xff, 0xfe,
+  0x00, 0x0f, 0xff, 0xe0, 0x00, 0x1f, 0xcf, 0x00, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x0f, 0x00, 0x00,
+  0x00, 0xf8, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x78, 0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x7c,
+  0x00, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x03, 0xf0, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x07, 0xc0, 0x7e, 0x03, 0xf0,
+  0x0f, 0x80, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x01, 0xf0, 0x1f, 0x80, 0xfc, 0x03, 0xe0, 0x1e,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00,
+};
+
+static const uint8_t kFont8Widths[95] = {
+  15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 16, 0, 43, 43, 43,
+  43, 43, 43, 43, 43, 43, 43, 19, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint32_t kFont8Offsets[95] = {
+  0, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125, 1125,
+  1125, 1125, 1125, 1125, 3075, 4275, 4275, 7500, 10725, 13950,
+  17175, 20400, 23625, 26850, 30075, 33300, 36525, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950, 37950,
+  37950, 37950, 37950, 37950, 37950,
+};
+static const uint8_t kFont8Bits[4744] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x1f, 0xff, 0xf0, 0x07, 0xff, 0xfc, 0x01, 0xff,
+  0xff, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xf8, 0x01, 0xfc, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xfe, 0x03, 0xfe, 0x01, 0xfc, 0x00, 0xf8,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0,
+  0x00, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff,
+  0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00, 0x03, 0xfe, 0x01, 0xff, 0x00, 0x00, 0xff, 0x00, 0x0f,
+  0xf0, 0x00, 0x1f, 0xc0, 0x00, 0xfe, 0x00, 0x07, 0xf0, 0x00, 0x0f, 0xe0, 0x01, 0xfc, 0x00, 0x01,
+  0xfc, 0x00, 0x3f, 0x80, 0x00, 0x1f, 0xc0, 0x07, 0xe0, 0x00, 0x01, 0xf8, 0x01, 0xfc, 0x00, 0x00,
+  0x3f, 0x80, 0x3f, 0x00, 0x00, 0x07, 0xf0, 0x07, 0xe0, 0x00, 0x00, 0x7e, 0x01, 0xfc, 0x00, 0x00,
+  0x0f, 0xc0, 0x3f, 0x80, 0x00, 0x01, 0xfc, 0x07, 0xe0, 0x00, 0x00, 0x3f, 0x80, 0xfc, 0x00, 0x00,
+  0x07, 0xf0, 0x1f, 0x80, 0x00, 0x00, 0x7e, 0x07, 0xf0, 0x00, 0x00, 0x0f, 0xc0, 0xfe, 0x00, 0x00,
+  0x01, 0xf8, 0x1f, 0xc0, 0x00, 0x00, 0x3f, 0x03, 0xf8, 0x00, 0x00, 0x07, 0xf0, 0x7f, 0x00, 0x00,
+  0x00, 0xfe, 0x0f, 0xe0, 0x00, 0x00, 0x1f, 0xc1, 0xfc, 0x00, 0x00, 0x03, 0xf8, 0x3f, 0x80, 0x00,
+  0x00, 0x7f, 0x07, 0xf0, 0x00, 0x00, 0x0f, 0xe0, 0xfe, 0x00, 0x00, 0x01, 0xf8, 0x1f, 0xc0, 0x00,
+  0x00, 0x3f, 0x03, 0xf8, 0x00, 0x00, 0x07, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0xfc, 0x07, 0xe0, 0x00,
+  0x00, 0x3f, 0x80, 0xfc, 0x00, 0x00, 0x07, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0xfe, 0x03, 0xf8, 0x00,
+  0x00, 0x1f, 0x80, 0x3f, 0x00, 0x00, 0x03, 0xf0, 0x07, 0xe0, 0x00, 0x00, 0xfe, 0x00, 0xfe, 0x00,
+  0x00, 0x1f, 0xc0, 0x0f, 0xc0, 0x00, 0x03, 0xf0, 0x01, 0xfc, 0x00, 0x00, 0xfe, 0x00, 0x3f, 0x80,
+  0x00, 0x3f, 0x80, 0x03, 0xf8, 0x00, 0x07, 0xf0, 0x00, 0x7f, 0x80, 0x01, 0xfc, 0x00, 0x07, 0xf8,
+  0x00, 0x7f, 0x80, 0x00, 0x7f, 0x80, 0x3f, 0xe0, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x7f,
+  0xff, 0xfe, 0x00, 0x00, 0x07, 0xff, 0xff, 0x80, 0x00, 0x00, 0x3f, 0xff, 0xc0, 0x00, 0x00, 0x01,
+  0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00,
+  0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x07, 0xff, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00,
+  0x00, 0x7f, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xf0, 0x00, 0x00,
+  0x01, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x7f, 0x9f, 0xc0, 0x00, 0x00, 0x3f, 0xe3, 0xf8, 0x00, 0x00,
+  0x0f, 0xf8, 0x7f, 0x00, 0x00, 0x03, 0xfe, 0x0f, 0xe0, 0x00, 0x00, 0x3f, 0x81, 0xfc, 0x00, 0x00,
+  0x03, 0xc0, 0x3f, 0x80, 0x00, 0x00, 0x30, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00,
+  0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00,
+  0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00,
+  0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00,
+  0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00,
+  0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff,
+  0xe0, 0x00, 0x3f, 0xff, 0xff, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0x80, 0x00, 0xff, 0xff, 0xff,
+  0xf0, 0x00, 0x1f, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff,
+  0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xe0, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x00, 0x00, 0xff, 0x80,
+  0x3f, 0xc0, 0x00, 0x1f, 0xc0, 0x03, 0xfc, 0x00, 0x07, 0xf0, 0x00, 0x3f, 0xc0, 0x01, 0xfc, 0x00,
+  0x03, 0xf8, 0x00, 0x3f, 0x80, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0x07, 0xf0, 0x01, 0xfc, 0x00,
+  0x00, 0xfe, 0x00, 0x3f, 0x00, 0x00, 0x1f, 0xc0, 0x07, 0xe0, 0x00, 0x01, 0xf8, 0x00, 0x18, 0x00,
+  0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00,
+  0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00,
+  0x0f, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00, 0x03,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x00, 0x00, 0x00, 0x0f,
+  0xf8, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x3f,
+  0xff, 0xff, 0xff, 0xe0, 0x07, 0xff, 0xff, 0xff, 0xfe, 0x00, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x1f,
+  0xff, 0xff, 0xff, 0xf8, 0x03, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xfc, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xf0, 0x00,
+  0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff, 0x00,
+  0x00, 0x3f, 0xc0, 0x0f, 0xf0, 0x00, 0x0f, 0xf0, 0x00, 0xff, 0x00, 0x01, 0xfc, 0x00, 0x0f, 0xe0,
+  0x00, 0x7f, 0x00, 0x00, 0xfe, 0x00, 0x0f, 0xc0, 0x00, 0x1f, 0xc0, 0x03, 0xf8, 0x00, 0x01, 0xf8,
+  0x00, 0x7e, 0x00, 0x00, 0x3f, 0x00, 0x0f, 0xc0, 0x00, 0x07, 0xe0, 0x01, 0xf8, 0x00, 0x00, 0xfc,
+  0x00, 0x04, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7e,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x0f, 0xf8,
+  0x00, 0x00, 0x00, 0x3f, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0,
+  0x00, 0x00, 0x00, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x07,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x00,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0x00, 0x3c, 0x00, 0x00, 0x0f, 0xc0, 0x1f, 0x80, 0x00, 0x01, 0xf8, 0x03, 0xf8, 0x00, 0x00,
+  0x3f, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0xe0, 0x07, 0xf0, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0x00, 0x00,
+  0x7f, 0x00, 0x0f, 0xf0, 0x00, 0x1f, 0xe0, 0x00, 0xff, 0x00, 0x07, 0xf8, 0x00, 0x1f, 0xf0, 0x03,
+  0xfe, 0x00, 0x01, 0xff, 0xff, 0xff, 0x80, 0x00, 0x1f, 0xff, 0xff, 0xe0, 0x00, 0x01, 0xff, 0xff,
+  0xf8, 0x00, 0x00, 0x0f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00,
+  0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x00, 0x00, 0x00,
+  0x03, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x00,
+  0x07, 0xff, 0x80, 0x00, 0x00, 0x01, 0xfb, 0xf0, 0x00, 0x00, 0x00, 0x7f, 0x7e, 0x00, 0x00, 0x00,
+  0x0f, 0xcf, 0xc0, 0x00, 0x00, 0x03, 0xf1, 0xf8, 0x00, 0x00, 0x00, 0xfc, 0x3f, 0x00, 0x00, 0x00,
+  0x3f, 0x87, 0xe0, 0x00, 0x00, 0x07, 0xe0, 0xfc, 0x00, 0x00, 0x01, 0xf8, 0x1f, 0x80, 0x00, 0x00,
+  0x7f, 0x03, 0xf0, 0x00, 0x00, 0x1f, 0xc0, 0x7e, 0x00, 0x00, 0x03, 0xf0, 0x0f, 0xc0, 0x00, 0x00,
+  0xfc, 0x01, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x3f, 0x00, 0x00, 0x0f, 0xe0, 0x07, 0xe0, 0x00, 0x01,
+  0xf8, 0x00, 0xfc, 0x00, 0x00, 0x7e, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0xc0, 0x03, 0xf0, 0x00, 0x07,
+  0xf0, 0x00, 0x7e, 0x00, 0x00, 0xfc, 0x00, 0x0f, 0xc0, 0x00, 0x3f, 0x00, 0x01, 0xf8, 0x00, 0x0f,
+  0xe0, 0x00, 0x3f, 0x00, 0x03, 0xf8, 0x00, 0x07, 0xe0, 0x00, 0x7e, 0x00, 0x00, 0xfc, 0x00, 0x1f,
+  0x80, 0x00, 0x1f, 0x80, 0x07, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x1f,
+  0xff, 0xff, 0xff, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x7f, 0xff, 0xff, 0xff, 0xfe, 0x07,
+  0xff, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00,
+  0x00, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00,
+  0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00,
+  0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xfe,
+  0x00, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x0f, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xff,
+  0x00, 0x00, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x07, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7c, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0x80, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xcf, 0xfc, 0x00, 0x00, 0x01, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff,
+  0x80, 0x00, 0x07, 0xff, 0xff, 0xf8, 0x00, 0x00, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xc0, 0x1f,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xc0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00,
+  0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc0, 0x00, 0x00, 0x00,
+  0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00,
+  0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x03, 0x80, 0x00, 0x1f, 0xc0, 0x00, 0xfc, 0x00,
+  0x0f, 0xf0, 0x00, 0x1f, 0xe0, 0x03, 0xfc, 0x00, 0x07, 0xff, 0xff, 0xff, 0x80, 0x00, 0x7f, 0xff,
+  0xff, 0xc0, 0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x00, 0xff,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00,
+  0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00,
+  0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00,
+  0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x87, 0xf0, 0x00, 0x00,
+  0x07, 0xf7, 0xff, 0xc0, 0x00, 0x01, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xe0, 0x00,
+  0x0f, 0xff, 0xff, 0xfe, 0x00, 0x03, 0xff, 0xc0, 0x7f, 0xe0, 0x00, 0x7f, 0xe0, 0x03, 0xfe, 0x00,
+  0x1f, 0xf0, 0x00, 0x1f, 0xe0, 0x03, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x7f, 0x00, 0x00, 0x3f, 0xc0,
+  0x1f, 0xe0, 0x00, 0x03, 0xf8, 0x03, 0xf8, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x07, 0xe0,
+  0x0f, 0xc0, 0x00, 0x00, 0xfe, 0x01, 0xf8, 0x00, 0x00, 0x1f, 0xc0, 0x3f, 0x00, 0x00, 0x03, 0xf8,
+  0x07, 0xe0, 0x00, 0x00, 0x7f, 0x00, 0xfc, 0x00, 0x00, 0x0f, 0xe0, 0x1f, 0x80, 0x00, 0x01, 0xf8,
+  0x03, 0xf8, 0x00, 0x00, 0x3f, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0xe0, 0x07, 0xe0, 0x00, 0x01, 0xfc,
+  0x00, 0xfe, 0x00, 0x00, 0x7f, 0x00, 0x0f, 0xc0, 0x00, 0x0f, 0xe0, 0x01, 0xfc, 0x00, 0x03, 0xf8,
+  0x00, 0x1f, 0xc0, 0x00, 0xff, 0x00, 0x01, 0xfe, 0x00, 0x7f, 0xc0, 0x00, 0x3f, 0xff, 0xff, 0xf0,
+  0x00, 0x03, 0xff, 0xff, 0xfc, 0x00, 0x00, 0x1f, 0xff, 0xfe, 0x00, 0x00, 0x01, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x3f, 0xff, 0xff, 0xff, 0xf8, 0x07, 0xff, 0xff, 0xff, 0xff, 0x00, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0x1f, 0xff, 0xff, 0xff, 0xfc, 0x03, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x07, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00,
+  0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x1f, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x80, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x00,
+  0xfe, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x01,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x01,
+  0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x03,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x03,
+  0xf8, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x07,
+  0xf0, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xf0, 0x00,
+  0x03, 0xfc, 0x01, 0xff, 0x00, 0x00, 0xff, 0x00, 0x0f, 0xe0, 0x00, 0x1f, 0xc0, 0x00, 0xfe, 0x00,
+  0x07, 0xf0, 0x00, 0x0f, 0xe0, 0x00, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x1f, 0x80, 0x00, 0x1f, 0x80,
+  0x07, 0xf0, 0x00, 0x03, 0xf0, 0x00, 0xfe, 0x00, 0x00, 0x7e, 0x00, 0x1f, 0xc0, 0x00, 0x0f, 0xc0,
+  0x03, 0xf8, 0x00, 0x01, 0xf8, 0x00, 0x7f, 0x00, 0x00, 0x3f, 0x00, 0x07, 0xe0, 0x00, 0x07, 0xe0,
+  0x00, 0xfc, 0x00, 0x01, 0xfc, 0x00, 0x1f, 0xc0, 0x00, 0x3f, 0x00, 0x01, 0xf8, 0x00, 0x0f, 0xe0,
+  0x00, 0x3f, 0x80, 0x01, 0xf8, 0x00, 0x03, 0xf8, 0x00, 0xff, 0x00, 0x00, 0x3f, 0xe0, 0x7f, 0xc0,
+  0x00, 0x03, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x1f, 0xff, 0xf8, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x00,
+  0x00, 0x00, 0xff, 0xff, 0xf0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x3f, 0xf0, 0x0f, 0xf8,
+  0x00, 0x0f, 0xf8, 0x00, 0x7f, 0x80, 0x01, 0xfc, 0x00, 0x03, 0xf8, 0x00, 0x7f, 0x00, 0x00, 0x3f,
+  0x80, 0x0f, 0xc0, 0x00, 0x07, 0xf0, 0x03, 0xf8, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x0f,
+  0xe0, 0x0f, 0xc0, 0x00, 0x01, 0xfc, 0x01, 0xf8, 0x00, 0x00, 0x3f, 0x80, 0x7f, 0x00, 0x00, 0x03,
+  0xf0, 0x0f, 0xe0, 0x00, 0x00, 0x7e, 0x00, 0xfc, 0x00, 0x00, 0x1f, 0xc0, 0x1f, 0x80, 0x00, 0x03,
+  0xf8, 0x03, 0xf8, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x1f, 0xe0, 0x0f, 0xf0, 0x00, 0x03,
+  0xf8, 0x00, 0xff, 0x00, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x3f, 0xc0, 0x01, 0xff, 0x80, 0x1f,
+  0xf0, 0x00, 0x1f, 0xff, 0xff, 0xfc, 0x00, 0x01, 0xff, 0xff, 0xff, 0x00, 0x00, 0x0f, 0xff, 0xff,
+  0xc0, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x7f,
+  0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x03, 0xff,
+  0xff, 0xfe, 0x00, 0x00, 0xff, 0x80, 0x3f, 0xc0, 0x00, 0x3f, 0xc0, 0x01, 0xfc, 0x00, 0x07, 0xf0,
+  0x00, 0x1f, 0xc0, 0x01, 0xfc, 0x00, 0x01, 0xf8, 0x00, 0x3f, 0x00, 0x00, 0x3f, 0x80, 0x0f, 0xe0,
+  0x00, 0x03, 0xf0, 0x01, 0xf8, 0x00, 0x00, 0x7e, 0x00, 0x3f, 0x00, 0x00, 0x0f, 0xc0, 0x07, 0xe0,
+  0x00, 0x01, 0xfc, 0x01, 0xfc, 0x00, 0x00, 0x1f, 0x80, 0x3f, 0x80, 0x00, 0x03, 0xf0, 0x07, 0xf0,
+  0x00, 0x00, 0x7e, 0x00, 0xfe, 0x00, 0x00, 0x1f, 0xc0, 0x1f, 0xc0, 0x00, 0x03, 0xf8, 0x01, 0xf8,
+  0x00, 0x00, 0x7f, 0x00, 0x3f, 0x80, 0x00, 0x1f, 0xc0, 0x07, 0xf0, 0x00, 0x03, 0xf8, 0x00, 0x7f,
+  0x00, 0x00, 0xff, 0x00, 0x0f, 0xf0, 0x00, 0x3f, 0xe0, 0x00, 0xff, 0x00, 0x0f, 0xf8, 0x00, 0x1f,
+  0xf8, 0x0f, 0xff, 0x00, 0x01, 0xff, 0xff, 0xff, 0xc0, 0x00, 0x1f, 0xff, 0xff, 0xf8, 0x00, 0x01,
+  0xff, 0xff, 0x7e, 0x00, 0x00, 0x0f, 0xff, 0xdf, 0xc0, 0x00, 0x00, 0x3f, 0xc3, 0xf0, 0x00, 0x00,
+  0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x00, 0x00,
+  0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xc0, 0x00, 0x00,
+  0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00,
+  0x00, 0x0f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x1f, 0xc0, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x7f, 0x80, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xfc, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xc0, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1e, 0x00, 0x07, 0xe0, 0x01, 0xfe, 0x00, 0x3f,
+  0xc0, 0x07, 0xfc, 0x00, 0xff, 0x00, 0x1f, 0xe0, 0x01, 0xf8, 0x00, 0x1e, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x07, 0xf8, 0x00, 0xff, 0x00, 0x1f,
+  0xf0, 0x03, 0xfe, 0x00, 0x7f, 0x80, 0x0f, 0xf0, 0x00, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const Font kFonts[] = {
+  {1, 8, kFont1Widths, kFont1Offsets, kFont1Bits},
+  {2, 16, kFont2Widths, kFont2Offsets, kFont2Bits},
+  {4, 26, kFont4Widths, kFont4Offsets, kFont4Bits},
+  {6, 48, kFont6Widths, kFont6Offsets, kFont6Bits},
+  {7, 48, kFont7Widths, kFont7Offsets, kFont7Bits},
+  {8, 75, kFont8Widths, kFont8Offsets, kFont8Bits},
+};
+
+}  // namespace HostFonts
@@ -0,0 +1,251 @@
+#include "host_heap.h"
+
+#include <atomic>
+#include <string.h>
+
+#if defined(__GLIBC__)
+#define HOST_HEAP_MIRROR 1
+extern "C" {
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *ptr, size_t size);
+void __libc_free(void *ptr);
+}
+#else
+#define HOST_HEAP_MIRROR 0
+#endif
+
+namespace {
+
+// multi_heap puts an 8-byte header in front of every block and rounds sizes
+// to 4 bytes.
+constexpr uint32_t kHeader = 8;
+constexpr uint32_t kMinBlock = 16;
+constexpr uint32_t kMaxSegments = 8192;
+constexpr uint32_t kSlots = 1u << 17;
+
+struct Segment {
+  uint32_t offset;
+  uint32_t length;
+};
+
+struct Live {
+  uintptr_t ptr;  // 0 = empty slot
+  uint32_t offset;
+  uint32_t length;
+};
+
+std::atomic_flag sLock = ATOMIC_FLAG_INIT;
+size_t sCapacity = 160 * 1024;
+bool sStarted = false;
+Segment sFree[kMaxSegments];
+uint32_t sFreeCount = 0;
+size_t sFreeBytes = 0;
+size_t sMinFree = 0;
+size_t sLiveBlocks = 0;
+Live sLive[kSlots];
+HostHeap::Counters sCounters;
+thread_local int tExcluded = 0;
+
+struct Guard {
+  Guard() {
+    while (sLock.test_and_set(std::memory_order_acquire)) {
+    }
+  }
+  ~Guard() { sLock.clear(std::memory_order_release); }
+};
+
+void start() {
+  if (sStarted) return;
+  sStarted = true;
+  sFree[0] = {0, (uint32_t)sCapacity};
+  sFreeCount = 1;
+  sFreeBytes = sMinFree = sCapacity;
+}
+
+uint32_t slotOf(uintptr_t ptr) {
+  return (uint32_t)((ptr >> 4) * 2654435761u) & (kSlots - 1);
+}
+
+bool arenaAlloc(uint32_t length, uint32_t &offset) {
+  for (uint32_t i = 0; i < sFreeCount; ++i) {
+    Segment &s = sFree[i];
+    if (s.length < length) continue;
+    offset = s.offset;
+    s.offset += length;
+    s.length -= length;
+    if (!s.length) {
+      memmove(&sFree[i], &sFree[i + 1], (sFreeCount - i - 1) * sizeof(Segment));
+      sFreeCount--;
+    }
+    sFreeBytes -= length;
+    if (sFreeBytes < sMinFree) sMinFree = sFreeBytes;
+    return true;
+  }
+  return false;
+}
+
+void arenaFree(uint32_t offset, uint32_t length) {
+  uint32_t lo = 0;
+  uint32_t hi = sFreeCount;
+  while (lo < hi) {
+    const uint32_t mid = (lo + hi) / 2;
+    if (sFree[mid].offset < offset) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  sFreeBytes += length;
+  const bool joinsPrev = lo > 0 && sFree[lo - 1].offset + sFree[lo - 1].length == offset;
+  const bool joinsNext = lo < sFreeCount && offset + length == sFree[lo].offset;
+  if (joinsPrev && joinsNext) {
+    sFree[lo - 1].length += length + sFree[lo].length;
+    memmove(&sFree[lo], &sFree[lo + 1], (sFreeCount - lo - 1) * sizeof(Segment));
+    sFreeCount--;
+  } else if (joinsPrev) {
+    sFree[lo - 1].length += length;
+  } else if (joinsNext) {
+    sFree[lo].offset = offset;
+    sFree[lo].length += length;
+  } else if (sFreeCount < kMaxSegments) {
+    memmove(&sFree[lo + 1], &sFree[lo], (sFreeCount - lo) * sizeof(Segment));
+    sFree[lo] = {offset, length};
+    sFreeCount++;
+  }
+}
+
+void track(void *ptr, size_t size) {
+  if (!ptr || tExcluded) return;
+  Guard held;
+  start();
+  sCounters.allocs++;
+  uint32_t length = (uint32_t)((size + 3) & ~(size_t)3) + kHeader;
+  if (length < kMinBlock) length = kMinBlock;
+  uint32_t offset = 0;
+  if (!arenaAlloc(length, offset)) {
+    sCounters.failed++;
+    return;
+  }
+  uint32_t slot = slotOf((uintptr_t)ptr);
+  while (sLive[slot].ptr) slot = (slot + 1) & (kSlots - 1);
+  sLive[slot] = {(uintptr_t)ptr, offset, length};
+  sLiveBlocks++;
+}
+
+// Backward-shift delete keeps probe chains intact without tombstones.
+void untrack(void *ptr) {
+  if (!ptr) return;
+  Guard held;
+  if (!sStarted) return;
+  uint32_t slot = slotOf((uintptr_t)ptr);
+  while (sLive[slot].ptr && sLive[slot].ptr != (uintptr_t)ptr) slot = (slot + 1) & (kSlots - 1);
+  if (!sLive[slot].ptr) return;
+  arenaFree(sLive[slot].offset, sLive[slot].length);
+  sLiveBlocks--;
+  sCounters.frees++;
+  uint32_t hole = slot;
+  uint32_t next = (slot + 1) & (kSlots - 1);
+  while (sLive[next].ptr) {
+    const uint32_t home = slotOf(sLive[next].ptr);
+    const bool movable = (hole <= next) ? (home <= hole || home > next) : (home <= hole && home > next);
+    if (movable) {
+      sLive[hole] = sLive[next];
+      hole = next;
+    }
+    next = (next + 1) & (kSlots - 1);
+  }
+  sLive[hole].ptr = 0;
+}
+
+}  // namespace
+
+#if HOST_HEAP_MIRROR
+extern "C" {
+
+void *malloc(size_t size) {
+  void *p = __libc_malloc(size);
+  track(p, size);
+  return p;
+}
+
+void *calloc(size_t count, size_t size) {
+  void *p = __libc_calloc(count, size);
+  track(p, count * size);
+  return p;
+}
+
+void *realloc(void *ptr, size_t size) {
+  void *p = __libc_realloc(ptr, size);
+  // A failed realloc leaves the old block in place.
+  if (p || !size) untrack(ptr);
+  track(p, size);
+  return p;
+}
+
+void free(void *ptr) {
+  untrack(ptr);
+  __libc_free(ptr);
+}
+
+}  // extern "C"
+#endif
+
+namespace HostHeap {
+
+void setCapacity(size_t bytes) {
+  Guard held;
+  if (!sStarted) sCapacity = bytes;
+}
+
+size_t capacity() {
+  return sCapacity;
+}
+
+size_t freeBytes() {
+  Guard held;
+  start();
+  return sFreeBytes;
+}
+
+size_t minFreeBytes() {
+  Guard held;
+  start();
+  return sMinFree;
+}
+
+size_t largestFreeBlock() {
+  Guard held;
+  start();
+  uint32_t largest = 0;
+  for (uint32_t i = 0; i < sFreeCount; ++i) {
+    if (sFree[i].length > largest) largest = sFree[i].length;
+  }
+  return largest > kHeader ? largest - kHeader : 0;
+}
+
+size_t liveBlocks() {
+  Guard held;
+  return sLiveBlocks;
+}
+
+void resetMinFree() {
+  Guard held;
+  start();
+  sMinFree = sFreeBytes;
+}
+
+Counters counters() {
+  Guard held;
+  return sCounters;
+}
+
+Exclude::Exclude() {
+  tExcluded++;
+}
+
+Exclude::~Exclude() {
+  tExcluded--;
+}
+
+}  // namespace HostHeap
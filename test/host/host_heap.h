@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Model of the ESP32 data heap for the native build. Every malloc/free made by
+// firmware code is mirrored into a first-fit arena of the device's size, so
+// ESP.getFreeHeap(), getMinFreeHeap() and getMaxAllocHeap() report free space,
+// the low-water mark and fragmentation the way the device would see them
+// (with host object sizes). Allocations made by the stand-ins themselves are
+// excluded with HostHeap::Exclude. Needs glibc; elsewhere nothing is mirrored
+// and the heap always reads as empty.
+
+namespace HostHeap {
+
+struct Counters {
+  uint32_t allocs = 0;
+  uint32_t frees = 0;
+  uint32_t failed = 0;  // allocations the arena had no block for (still served)
+};
+
+// Arena size; 160 KB is about what the firmware has left once Wi-Fi is up.
+// Only takes effect before the first allocation is mirrored.
+void setCapacity(size_t bytes);
+
+size_t capacity();
+size_t freeBytes();
+size_t minFreeBytes();
+size_t largestFreeBlock();
+size_t liveBlocks();
+
+// Starts a new low-water mark at the current free space.
+void resetMinFree();
+
+Counters counters();
+
+// While one is alive on a thread, that thread's allocations are not mirrored.
+class Exclude {
+public:
+  Exclude();
+  ~Exclude();
+  Exclude(const Exclude &) = delete;
+  Exclude &operator=(const Exclude &) = delete;
+};
+
+}  // namespace HostHeap
@@ -0,0 +1,325 @@
+#include "host_net.h"
+
+#include <chrono>
+#include <math.h>
+#include <map>
+#include <string.h>
+#include <strings.h>
+#include <zlib.h>
+
+#include "host_heap.h"
+#include "host_sched.h"
+
+namespace {
+
+std::map<std::string, HostNet::Handler> &servers() {
+  static auto *s = new std::map<std::string, HostNet::Handler>();
+  return *s;
+}
+
+HostNet::Link sLink;
+HostNet::Stats sStats;
+
+const char *reason(int status) {
+  switch (status) {
+    case 200: return "OK";
+    case 204: return "No Content";
+    case 301: return "Moved Permanently";
+    case 302: return "Found";
+    case 304: return "Not Modified";
+    case 400: return "Bad Request";
+    case 404: return "Not Found";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 502: return "Bad Gateway";
+    case 503: return "Service Unavailable";
+    default: return "Status";
+  }
+}
+
+std::string gzipped(const std::string &in) {
+  z_stream z;
+  memset(&z, 0, sizeof(z));
+  deflateInit2(&z, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+  std::string out(deflateBound(&z, (uLong)in.size()) + 32, '\0');
+  z.next_in = (Bytef *)in.data();
+  z.avail_in = (uInt)in.size();
+  z.next_out = (Bytef *)&out[0];
+  z.avail_out = (uInt)out.size();
+  deflate(&z, Z_FINISH);
+  out.resize(z.total_out);
+  deflateEnd(&z);
+  return out;
+}
+
+std::string lower(std::string s) {
+  for (char &c : s) c = (char)tolower((unsigned char)c);
+  return s;
+}
+
+std::string trim(const std::string &s) {
+  size_t a = 0;
+  size_t b = s.size();
+  while (a < b && isspace((unsigned char)s[a])) ++a;
+  while (b > a && isspace((unsigned char)s[b - 1])) --b;
+  return s.substr(a, b - a);
+}
+
+}  // namespace
+
+namespace HostNet {
+
+std::string Request::header(const char *name) const {
+  for (const auto &h : headers) {
+    if (strcasecmp(h.first.c_str(), name) == 0) return h.second;
+  }
+  return "";
+}
+
+std::string Request::path() const {
+  const size_t q = target.find('?');
+  return q == std::string::npos ? target : target.substr(0, q);
+}
+
+std::string Request::query(const char *name) const {
+  const size_t q = target.find('?');
+  if (q == std::string::npos) return "";
+  const std::string key = std::string(name) + "=";
+  size_t at = q + 1;
+  while (at < target.size()) {
+    size_t end = target.find('&', at);
+    if (end == std::string::npos) end = target.size();
+    if (target.compare(at, key.size(), key) == 0) return target.substr(at + key.size(), end - at - key.size());
+    at = end + 1;
+  }
+  return "";
+}
+
+// Every Accept-Encoding line counts; HTTPClient sends its own identity
+// preference before the ones added by the firmware.
+bool Request::acceptsGzip() const {
+  for (const auto &h : headers) {
+    if (strcasecmp(h.first.c_str(), "Accept-Encoding") != 0) continue;
+    const std::string v = lower(h.second);
+    size_t at = 0;
+    while (at <= v.size()) {
+      size_t end = v.find(',', at);
+      if (end == std::string::npos) end = v.size();
+      const std::string item = trim(v.substr(at, end - at));
+      if (item.compare(0, 4, "gzip") == 0 && item.find("q=0") == std::string::npos) return true;
+      at = end + 1;
+    }
+  }
+  return false;
+}
+
+void serve(const std::string &host, Handler handler) {
+  HostHeap::Exclude outside;
+  servers()[lower(host)] = std::move(handler);
+}
+
+void stopServing(const std::string &host) {
+  HostHeap::Exclude outside;
+  servers().erase(lower(host));
+}
+
+void setLink(const Link &l) {
+  sLink = l;
+}
+
+const Link &link() {
+  return sLink;
+}
+
+const Stats &stats() {
+  return sStats;
+}
+
+void resetStats() {
+  sStats = Stats();
+}
+
+Connection::Connection(std::string host, bool tls) : _host(lower(host)), _tls(tls) {
+  sStats.connects++;
+  if (tls) sStats.tlsHandshakes++;
+}
+
+size_t Connection::arrivedBy(uint64_t nowUs) const {
+  size_t arrived = 0;
+  for (const Burst &b : _bursts) {
+    if (nowUs < b.firstUs) break;
+    const size_t n = (size_t)((double)(nowUs - b.firstUs) / b.usPerByte + 1e-9) + 1;
+    arrived = (b.begin + n < b.end) ? b.begin + n : b.end;
+  }
+  return arrived;
+}
+
+size_t Connection::ready() {
+  const size_t arrived = arrivedBy(HostSched::nowUs());
+  return arrived > _rxPos ? arrived - _rxPos : 0;
+}
+
+uint64_t Connection::nextArrivalUs() const {
+  for (const Burst &b : _bursts) {
+    if (_rxPos >= b.end) continue;
+    const size_t at = _rxPos > b.begin ? _rxPos - b.begin : 0;
+    // Rounded up so that arrivedBy() has counted the byte by then.
+    return b.firstUs + (uint64_t)ceil((double)at * b.usPerByte);
+  }
+  return 0;
+}
+
+int Connection::read() {
+  if (!ready()) return -1;
+  const int c = (uint8_t)_rx[_rxPos++];
+  compact();
+  return c;
+}
+
+int Connection::peek() {
+  return ready() ? (uint8_t)_rx[_rxPos] : -1;
+}
+
+size_t Connection::read(uint8_t *buffer, size_t length) {
+  size_t n = ready();
+  if (n > length) n = length;
+  memcpy(buffer, _rx.data() + _rxPos, n);
+  _rxPos += n;
+  compact();
+  return n;
+}
+
+void Connection::compact() {
+  if (_rxPos < _rx.size()) return;
+  HostHeap::Exclude outside;
+  _rx.clear();
+  _bursts.clear();
+  _rxPos = 0;
+}
+
+bool Connection::connected() {
+  if (!_open) return false;
+  if (_rxPos < _rx.size()) return true;
+  return !_hangUp;
+}
+
+void Connection::close() {
+  _open = false;
+}
+
+size_t Connection::write(const uint8_t *buffer, size_t length) {
+  if (!_open || _hangUp) return 0;
+  HostHeap::Exclude outside;
+  _tx.append((const char *)buffer, length);
+  size_t end;
+  while ((end = _tx.find("\r\n\r\n")) != std::string::npos) {
+    const std::string head = _tx.substr(0, end + 2);
+    _tx.erase(0, end + 4);
+    dispatch(head);
+  }
+  return length;
+}
+
+void Connection::receive(const std::string &bytes, uint64_t firstUs, uint32_t bytesPerSec) {
+  if (bytes.empty()) return;
+  if (firstUs < _busyUntilUs) firstUs = _busyUntilUs;
+  const double usPerByte = bytesPerSec ? 1e6 / bytesPerSec : 1e-3;
+  Burst b{_rx.size(), _rx.size() + bytes.size(), firstUs, usPerByte};
+  _rx += bytes;
+  _bursts.push_back(b);
+  _busyUntilUs = firstUs + (uint64_t)((double)(bytes.size() - 1) * usPerByte) + 1;
+  sStats.bytesSent += bytes.size();
+}
+
+void Connection::dispatch(const std::string &head) {
+  Request req;
+  req.host = _host;
+  req.tls = _tls;
+  size_t lineEnd = head.find("\r\n");
+  const std::string start = head.substr(0, lineEnd);
+  const size_t sp1 = start.find(' ');
+  const size_t sp2 = start.find(' ', sp1 + 1);
+  req.method = start.substr(0, sp1);
+  req.target = start.substr(sp1 + 1, sp2 - sp1 - 1);
+  for (size_t at = lineEnd + 2; at < head.size(); at = lineEnd + 2) {
+    lineEnd = head.find("\r\n", at);
+    if (lineEnd == std::string::npos) break;
+    const std::string line = head.substr(at, lineEnd - at);
+    const size_t colon = line.find(':');
+    if (colon == std::string::npos) continue;
+    req.headers.emplace_back(trim(line.substr(0, colon)), trim(line.substr(colon + 1)));
+  }
+  sStats.requests++;
+  const auto began = std::chrono::steady_clock::now();
+  struct Charge {
+    std::chrono::steady_clock::time_point began;
+    ~Charge() {
+      sStats.serverUs += (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                             std::chrono::steady_clock::now() - began)
+                             .count();
+    }
+  } charge{began};
+
+  Response res;
+  auto it = servers().find(_host);
+  if (it == servers().end()) {
+    _hangUp = true;
+    return;
+  }
+  it->second(req, res);
+  if (res.silent) return;
+
+  std::string body = res.body;
+  const bool noBody = res.status == 304 || res.status == 204 || req.method == "HEAD";
+  const bool gzip = res.gzip && !noBody && req.acceptsGzip();
+  if (gzip) body = gzipped(body);
+
+  std::string wire = "HTTP/1.1 " + std::to_string(res.status) + " " + reason(res.status) + "\r\n";
+  for (const auto &h : res.headers) wire += h.first + ": " + h.second + "\r\n";
+  if (gzip) wire += "Content-Encoding: gzip\r\n";
+  if (!noBody) {
+    if (res.chunked) {
+      wire += "Transfer-Encoding: chunked\r\n";
+    } else {
+      wire += "Content-Length: " + std::to_string(body.size()) + "\r\n";
+    }
+  }
+  wire += res.close ? "Connection: close\r\n" : "Connection: keep-alive\r\n";
+  wire += "\r\n";
+  const size_t headerBytes = wire.size();
+
+  if (!noBody) {
+    if (res.chunked) {
+      const size_t step = res.chunkBytes ? res.chunkBytes : body.size();
+      char size[24];
+      for (size_t at = 0; at < body.size(); at += step) {
+        const size_t n = (body.size() - at < step) ? body.size() - at : step;
+        snprintf(size, sizeof(size), "%zx\r\n", n);
+        wire += size;
+        wire.append(body, at, n);
+        wire += "\r\n";
+      }
+      wire += res.chunkEnd ? res.chunkEnd : "0\r\n\r\n";
+    } else {
+      wire += body;
+    }
+  }
+
+  if (res.truncateShare > 0) res.truncateAt = (int64_t)((double)(wire.size() - headerBytes) * res.truncateShare);
+  if (res.truncateAt >= 0 && headerBytes + (size_t)res.truncateAt < wire.size()) {
+    wire.resize(headerBytes + (size_t)res.truncateAt);
+    _hangUp = true;
+  }
+  if (res.close) _hangUp = true;
+
+  uint32_t rate = sLink.bytesPerSec;
+  if (res.bytesPerSec && (!rate || res.bytesPerSec < rate)) rate = res.bytesPerSec;
+  const uint64_t firstUs = HostSched::nowUs() + (uint64_t)(sLink.latencyMs + res.latencyMs) * 1000;
+  receive(wire, firstUs, rate);
+}
+
+bool hasServer(const std::string &host) {
+  return servers().count(lower(host)) != 0;
+}
+
+}  // namespace HostNet
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <functional>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+// In-process network for the native build. Tests register a handler per host
+// name; WiFiClient connects to it instead of a socket, and HTTPClient talks
+// real HTTP/1.1 over that connection. Replies reach the client on the virtual
+// clock: connect and TLS handshake time, then latency to the first byte, then
+// bytes at the link rate, so a slow body really does keep the network task
+// busy while loop() carries on.
+
+namespace HostNet {
+
+struct Request {
+  std::string method;
+  std::string host;  // as registered: name, or name:port for plain HTTP on a port
+  bool tls = false;
+  std::string target;  // path and query
+  std::vector<std::pair<std::string, std::string>> headers;
+
+  // Value of the first header named `name` (any case), "" when absent.
+  std::string header(const char *name) const;
+  // Path without the query string.
+  std::string path() const;
+  // Value of query parameter `name`, "" when absent.
+  std::string query(const char *name) const;
+  bool acceptsGzip() const;
+};
+
+struct Response {
+  int status = 200;
+  std::vector<std::pair<std::string, std::string>> headers;
+  std::string body;
+
+  bool chunked = false;     // Transfer-Encoding: chunked instead of Content-Length
+  size_t chunkBytes = 1024; // payload bytes per chunk
+  const char *chunkEnd = nullptr;  // sent instead of the terminating "0\r\n\r\n" when set
+  bool gzip = false;        // compress the body when the request accepts gzip
+  bool close = false;       // Connection: close, and the server hangs up after it
+
+  uint32_t latencyMs = 0;    // extra delay before the first byte
+  uint32_t bytesPerSec = 0;  // cap below the link rate; 0 = link rate
+  int64_t truncateAt = -1;   // hang up after this many bytes of the (encoded) body
+  double truncateShare = 0;  // or after this share of it
+  bool silent = false;       // never answer; the client times out
+};
+
+typedef std::function<void(const Request &, Response &)> Handler;
+
+// Routes connections for `host` ("site.api.espn.com", or "192.168.1.50:8080"
+// for a plain-HTTP port) to `handler`. Unknown hosts refuse connections.
+void serve(const std::string &host, Handler handler);
+void stopServing(const std::string &host);
+bool hasServer(const std::string &host);
+
+struct Link {
+  uint32_t connectMs = 40;       // TCP connect
+  uint32_t tlsHandshakeMs = 700; // added for TLS sessions
+  uint32_t latencyMs = 30;       // request to first byte
+  uint32_t bytesPerSec = 120000; // body rate
+};
+
+void setLink(const Link &link);
+const Link &link();
+
+struct Stats {
+  uint32_t connects = 0;
+  uint32_t tlsHandshakes = 0;
+  uint32_t requests = 0;
+  uint64_t bytesSent = 0;  // response bytes put on the wire, headers included
+  // Host time spent in handlers and building responses. It is charged to the
+  // requesting task, so subtract it from that task's HostSched::cpuUs().
+  uint64_t serverUs = 0;
+};
+
+const Stats &stats();
+void resetStats();
+
+// One client connection; WiFiClient holds it. Exposed for the stand-in
+// clients only.
+class Connection {
+public:
+  Connection(std::string host, bool tls);
+
+  const std::string &host() const { return _host; }
+
+  // Bytes readable now, and the virtual time the next one arrives (0 when no
+  // more are coming).
+  size_t ready();
+  uint64_t nextArrivalUs() const;
+  int read();
+  int peek();
+  size_t read(uint8_t *buffer, size_t length);
+
+  // Request bytes from the client; a complete request header is answered.
+  size_t write(const uint8_t *buffer, size_t length);
+
+  // Still open from the server side, or holding unread bytes.
+  bool connected();
+  void close();
+
+private:
+  struct Burst {
+    size_t begin;
+    size_t end;
+    uint64_t firstUs;
+    double usPerByte;
+  };
+
+  void dispatch(const std::string &head);
+  void receive(const std::string &bytes, uint64_t firstUs, uint32_t bytesPerSec);
+  size_t arrivedBy(uint64_t nowUs) const;
+  void compact();
+
+  std::string _host;
+  bool _tls;
+  std::string _tx;
+  std::string _rx;
+  size_t _rxPos = 0;
+  std::vector<Burst> _bursts;
+  bool _open = true;
+  bool _hangUp = false;   // server closes once the queued bytes are out
+  uint64_t _busyUntilUs = 0;  // last queued byte on the wire
+};
+
+}  // namespace HostNet
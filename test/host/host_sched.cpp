@@ -0,0 +1,155 @@
+#include "host_sched.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Task {
+  const char *name = "";
+  std::condition_variable cv;
+  uint64_t wakeUs = 0;
+  uint64_t order = 0;  // FIFO among tasks due at the same time
+  bool done = false;
+  uint64_t cpuNs = 0;
+  Clock::time_point ranFrom;
+};
+
+struct State {
+  std::mutex lock;
+  std::vector<Task *> tasks;
+  Task *current = nullptr;
+  uint64_t nowUs = 0;
+  uint64_t order = 0;
+};
+
+// Never destroyed: tasks still parked in wait() when the test exits must not
+// find their condition variables gone.
+State &state() {
+  static State *s = new State();
+  return *s;
+}
+
+thread_local Task *tSelf = nullptr;
+
+Task *self(State &s) {
+  if (tSelf) return tSelf;
+  Task *t = new Task();
+  t->name = "loopTask";
+  t->ranFrom = Clock::now();
+  s.tasks.push_back(t);
+  if (!s.current) s.current = t;
+  tSelf = t;
+  return t;
+}
+
+Task *nextDue(State &s) {
+  Task *best = nullptr;
+  for (Task *t : s.tasks) {
+    if (t->done) continue;
+    if (!best || t->wakeUs < best->wakeUs || (t->wakeUs == best->wakeUs && t->order < best->order)) best = t;
+  }
+  return best;
+}
+
+void charge(Task *t) {
+  t->cpuNs += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t->ranFrom).count();
+}
+
+// Hands the CPU to the task due first and, unless that is `me` or `me` is
+// finished, waits for it to come back.
+void switchFrom(State &s, Task *me, std::unique_lock<std::mutex> &held) {
+  charge(me);
+  Task *next = nextDue(s);
+  if (!next) return;
+  if (next->wakeUs > s.nowUs) s.nowUs = next->wakeUs;
+  s.current = next;
+  if (next != me) {
+    next->cv.notify_one();
+    if (me->done) return;
+    me->cv.wait(held, [&] { return s.current == me; });
+  }
+  me->ranFrom = Clock::now();
+}
+
+}  // namespace
+
+namespace HostSched {
+
+uint64_t nowUs() {
+  State &s = state();
+  std::lock_guard<std::mutex> held(s.lock);
+  return s.nowUs;
+}
+
+void sleepUntilUs(uint64_t wakeUs) {
+  State &s = state();
+  std::unique_lock<std::mutex> held(s.lock);
+  Task *me = self(s);
+  me->wakeUs = wakeUs > s.nowUs ? wakeUs : s.nowUs;
+  me->order = ++s.order;
+  switchFrom(s, me, held);
+}
+
+void sleepUs(uint64_t us) {
+  sleepUntilUs(nowUs() + us);
+}
+
+void spawn(void (*fn)(void *), void *arg, const char *name) {
+  State &s = state();
+  std::unique_lock<std::mutex> held(s.lock);
+  self(s);
+  Task *t = new Task();
+  t->name = name;
+  t->wakeUs = s.nowUs;
+  t->order = ++s.order;
+  s.tasks.push_back(t);
+  std::thread([t, fn, arg] {
+    State &st = state();
+    {
+      std::unique_lock<std::mutex> wait(st.lock);
+      t->cv.wait(wait, [&] { return st.current == t; });
+      t->ranFrom = Clock::now();
+    }
+    tSelf = t;
+    fn(arg);
+    std::unique_lock<std::mutex> finish(st.lock);
+    t->done = true;
+    switchFrom(st, t, finish);
+  }).detach();
+}
+
+const char *currentName() {
+  State &s = state();
+  std::lock_guard<std::mutex> held(s.lock);
+  return self(s)->name;
+}
+
+uintptr_t currentId() {
+  State &s = state();
+  std::lock_guard<std::mutex> held(s.lock);
+  return (uintptr_t)self(s);
+}
+
+uint64_t cpuUs(const char *name) {
+  State &s = state();
+  std::lock_guard<std::mutex> held(s.lock);
+  uint64_t ns = 0;
+  for (Task *t : s.tasks) {
+    if (strcmp(t->name, name) != 0) continue;
+    ns += t->cpuNs;
+    // The caller's own slice so far.
+    if (t == s.current) {
+      ns += (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t->ranFrom).count();
+    }
+  }
+  return ns / 1000;
+}
+
+}  // namespace HostSched
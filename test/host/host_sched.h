@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdint.h>
+
+// Virtual time and task switching for the native build. Every FreeRTOS task,
+// and the Arduino loop task (whichever thread first calls into the scheduler,
+// normally the test calling setup() and loop()), runs on its own thread, but
+// only one of them runs at a time: a task keeps the CPU until it sleeps
+// (delay(), vTaskDelay(), a socket read waiting for bytes) and the clock then
+// jumps to the earliest wake-up. Runs are deterministic, and a simulated game
+// day passes in seconds.
+
+namespace HostSched {
+
+// Microseconds since boot on the virtual clock.
+uint64_t nowUs();
+
+// Puts the calling task to sleep; the clock moves on to whatever task is due
+// first. Sleeping until a time already passed lets every other task that is
+// due run first.
+void sleepUntilUs(uint64_t wakeUs);
+void sleepUs(uint64_t us);
+
+// Starts `fn(arg)` as a new task. It first runs when the caller next sleeps.
+void spawn(void (*fn)(void *), void *arg, const char *name);
+
+// Name of the calling task ("loopTask" for the thread that started it all).
+const char *currentName();
+
+// Identifies the calling task; never 0.
+uintptr_t currentId();
+
+// Host CPU time the named task has spent running, in microseconds.
+uint64_t cpuUs(const char *name);
+
+}  // namespace HostSched
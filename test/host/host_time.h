@@ -0,0 +1,18 @@
+#pragma once
+
+#include <time.h>
+
+// Wall clock of the native build. time() counts seconds since boot, like an
+// ESP32 that has not heard from SNTP yet; once the firmware calls configTime()
+// it follows the epoch set here, moving with the virtual clock.
+
+namespace HostTime {
+
+// Wall-clock time at virtual boot (millis() == 0).
+void setWallClock(time_t epochAtBoot);
+time_t epochAtBoot();
+
+// Whether configTime() has been called.
+bool synced();
+
+}  // namespace HostTime
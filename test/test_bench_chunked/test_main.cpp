@@ -0,0 +1,241 @@
+// Throughput of ChunkedStream against the per-byte decoder the ESPN and NHL
+// clients each carried before it (kept below as LegacyChunkedStream), on the
+// bodies ESPN serves over a game in 1 KB chunks. Each is read the way
+// deserializeJson() pulls from a Stream, one readBytes(&c, 1) per byte, and
+// in 1 KB readBytes() calls. Besides MB/s it reports calls into the source
+// stream per KB of payload: on the device each is a trip into
+// WiFiClientSecure, which costs far more than the host shows. Also checks
+// that HttpBody drops a session whose chunked framing ended badly.
+//
+// Environment (optional):
+//   ESPN_FIXTURE=path.jsonl   bodies from a tools/espn_standin.py fixture
+//                             instead of the synthetic game
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "chunked_stream.h"
+#include "host_bench.h"
+#include "host_net.h"
+#include "http_body.h"
+#include "http_pool.h"
+
+namespace {
+
+// The decoder as it was in espn_olympic_client.cpp and nhl_client.cpp: a
+// byte at a time from the socket, chunk headers through readBytesUntil(),
+// no readBytes() of its own.
+class LegacyChunkedStream : public Stream {
+public:
+  explicit LegacyChunkedStream(Stream &src) : _src(src) {}
+
+  int available() override {
+    if (_done) return 0;
+    if (_peeked >= 0) return 1;
+    if (_remaining > 0) {
+      int avail = _src.available();
+      if (avail > _remaining) avail = (int)_remaining;
+      return avail;
+    }
+    return _src.available();
+  }
+
+  int read() override {
+    if (_peeked >= 0) {
+      int c = _peeked;
+      _peeked = -1;
+      return c;
+    }
+    if (_done) return -1;
+    if (_remaining == 0) {
+      if (!readChunkHeader()) return -1;
+    }
+    int c = _src.read();
+    if (c < 0) return -1;
+    _remaining--;
+    if (_remaining == 0) consumeCRLF();
+    return c;
+  }
+
+  int peek() override {
+    if (_peeked < 0) _peeked = read();
+    return _peeked;
+  }
+
+  void flush() override {}
+  size_t write(uint8_t) override { return 0; }
+
+private:
+  Stream &_src;
+  int _peeked = -1;
+  int32_t _remaining = 0;
+  bool _done = false;
+
+  bool readChunkHeader() {
+    char line[24];
+    size_t n = _src.readBytesUntil('\n', line, sizeof(line) - 1);
+    if (n == 0) return false;
+    line[n] = '\0';
+    if (n && line[n - 1] == '\r') line[n - 1] = '\0';
+    char *semi = strchr(line, ';');
+    if (semi) *semi = '\0';
+    _remaining = (int32_t)strtol(line, nullptr, 16);
+    if (_remaining == 0) {
+      while (true) {
+        n = _src.readBytesUntil('\n', line, sizeof(line) - 1);
+        if (n == 0) break;
+        line[n] = '\0';
+        if (n == 1 && line[0] == '\r') break;
+        if (line[0] == '\r') break;
+      }
+      _done = true;
+      return false;
+    }
+    return true;
+  }
+
+  void consumeCRLF() {
+    (void)_src.read();
+    (void)_src.read();
+  }
+};
+
+const size_t kChunkBytes = 1024;
+
+std::vector<HostBench::Payload> sPayloads;
+
+// Reads exactly `want` payload bytes from `body` into `out`, stopping short
+// of the end so no read waits out the stream timeout.
+template <typename Decoder>
+size_t decode(HostBench::MemoryStream &src, char *out, size_t want, bool bulk) {
+  src.rewind();
+  Decoder body(src);
+  size_t n = 0;
+  while (n < want) {
+    const size_t got = body.readBytes(out + n, bulk ? std::min<size_t>(1024, want - n) : 1);
+    if (got == 0) break;
+    n += got;
+  }
+  return n;
+}
+
+const char *const kTailHost = "tail.example.com";
+const char *const kTailJson = "{\"ok\":true}";
+
+// Reads one JSON object and stops at its closing brace, as deserializeJson()
+// does, leaving whatever follows to HttpBody.
+bool readObject(Stream &body, int32_t, void *) {
+  std::string seen;
+  for (int c; (c = body.read()) >= 0;) {
+    seen += (char)c;
+    if (c == '}') return seen == kTailJson;
+  }
+  return false;
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_both_decode_the_same() {
+  TEST_ASSERT_FALSE_MESSAGE(sPayloads.empty(), "no payloads from the stand-in");
+  for (const HostBench::Payload &p : sPayloads) {
+    const std::string wire = HostBench::chunked(p.body, kChunkBytes);
+    HostBench::MemoryStream src(wire);
+    std::string out(p.body.size(), '\0');
+    for (const bool bulk : {false, true}) {
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(p.body.size(), decode<ChunkedStream>(src, &out[0], out.size(), bulk),
+                                       p.name.c_str());
+      TEST_ASSERT_TRUE_MESSAGE(out == p.body, p.name.c_str());
+      TEST_ASSERT_EQUAL_UINT32_MESSAGE(p.body.size(), decode<LegacyChunkedStream>(src, &out[0], out.size(), bulk),
+                                       p.name.c_str());
+      TEST_ASSERT_TRUE_MESSAGE(out == p.body, p.name.c_str());
+    }
+  }
+}
+
+static void test_throughput() {
+  printf("%-26s %7s | %-23s | %-23s | %s\n", "", "", "per byte MB/s", "1 KB reads MB/s", "source calls/KB");
+  printf("%-26s %7s | %7s %7s %7s | %7s %7s %7s | %7s %7s\n", "payload", "KB", "legacy", "new", "x", "legacy",
+         "new", "x", "legacy", "new");
+  for (const HostBench::Payload &p : sPayloads) {
+    const std::string wire = HostBench::chunked(p.body, kChunkBytes);
+    HostBench::MemoryStream src(wire);
+    std::string out(p.body.size(), '\0');
+    const size_t n = p.body.size();
+    double mb[4];
+    uint32_t calls[2] = {0, 0};
+    for (int i = 0; i < 4; ++i) {
+      const bool bulk = i >= 2;
+      const bool legacy = (i % 2) == 0;
+      const double us = HostBench::usPerRun([&] {
+        if (legacy) {
+          decode<LegacyChunkedStream>(src, &out[0], n, bulk);
+        } else {
+          decode<ChunkedStream>(src, &out[0], n, bulk);
+        }
+      });
+      mb[i] = HostBench::mbPerSec(n, us);
+      if (!bulk) calls[legacy ? 0 : 1] = src.calls();
+    }
+    printf("%-26s %7.1f | %7.1f %7.1f %6.1fx | %7.1f %7.1f %6.1fx | %7.0f %7.1f\n", p.name.c_str(), n / 1024.0, mb[0],
+           mb[1], mb[1] / mb[0], mb[2], mb[3], mb[3] / mb[2], calls[0] * 1024.0 / n, calls[1] * 1024.0 / n);
+    TEST_ASSERT_TRUE_MESSAGE(calls[1] < calls[0], "ChunkedStream makes fewer source calls");
+  }
+}
+
+// A body whose JSON was complete but whose chunked framing ended early or
+// malformed must not leave its session for the next request, which would
+// read the stray bytes as its status line and count a healthy endpoint as
+// failing.
+static void test_bad_tail_drops_session() {
+  struct Case {
+    const char *name;
+    const char *chunkEnd;
+    int64_t truncateAt;
+    bool reused;
+  };
+  const size_t framed = strlen(kTailJson) + 5;  // "b\r\n" + JSON + "\r\n"
+  const Case cases[] = {
+      {"clean terminator", nullptr, -1, true},
+      {"malformed terminator", "zz\r\n\r\n", -1, false},
+      {"missing terminator", nullptr, (int64_t)framed, false},
+  };
+  for (const Case &c : cases) {
+    HostNet::serve(kTailHost, [&c](const HostNet::Request &req, HostNet::Response &res) {
+      res.headers.emplace_back("Content-Type", "application/json");
+      res.body = kTailJson;
+      res.chunked = true;
+      if (req.path() == "/first") {
+        res.chunkEnd = c.chunkEnd;
+        res.truncateAt = c.truncateAt;
+      }
+    });
+    const String host = String("https://") + kTailHost;
+    TEST_ASSERT_TRUE_MESSAGE(HttpBody::get(host + "/first", "test", nullptr, readObject, nullptr), c.name);
+    const uint32_t connects = HostNet::stats().connects;
+    TEST_ASSERT_TRUE_MESSAGE(HttpBody::get(host + "/second", "test", nullptr, readObject, nullptr), c.name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(c.reused ? connects : connects + 1, HostNet::stats().connects, c.name);
+    HttpPool::EndpointHealth health;
+    TEST_ASSERT_TRUE_MESSAGE(HttpPool::health(host + "/second", health), c.name);
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, health.failures, c.name);
+    HostNet::stopServing(kTailHost);
+    // Next case starts on a fresh session.
+    HttpPool::tick(millis() + 10 * 60 * 1000);
+  }
+}
+
+int main() {
+  sPayloads = HostBench::espnPayloads();
+  UNITY_BEGIN();
+  RUN_TEST(test_both_decode_the_same);
+  RUN_TEST(test_throughput);
+  RUN_TEST(test_bad_tail_drops_session);
+  return UNITY_END();
+}
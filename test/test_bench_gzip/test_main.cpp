@@ -0,0 +1,125 @@
+// Throughput of GzipStream on the bodies ESPN serves over a game, read the
+// way the clients read them: through readBytes() into a buffer and a byte at
+// a time with read(), as deserializeJson() does. zlib inflating the same body
+// into one buffer is the reference; on the host GzipStream sits on zlib too,
+// so the gap is the cost of the stream wrapper. Also reports what gzip saves
+// on the wire at the HostNet link rate, and checks that the workspace is
+// allocated once per gzipped body and never for a plain one.
+//
+// Environment (optional):
+//   ESPN_FIXTURE=path.jsonl   bodies from a tools/espn_standin.py fixture
+//                             instead of the synthetic game
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "gzip_stream.h"
+#include "host_bench.h"
+#include "host_heap.h"
+#include "host_net.h"
+
+namespace {
+
+std::vector<HostBench::Payload> sPayloads;
+
+// Inflates `gz` through a fresh GzipStream into `out`, `bulk` choosing
+// readBytes() over read(). Returns the inflated length.
+size_t inflateStream(const std::string &gz, char *out, size_t capacity, bool bulk) {
+  HostBench::MemoryStream src(gz);
+  GzipStream body;
+  if (!body.begin(src, (int32_t)gz.size())) return 0;
+  size_t n = 0;
+  if (bulk) {
+    size_t got;
+    while (n < capacity && (got = body.readBytes(out + n, std::min<size_t>(1024, capacity - n))) > 0) n += got;
+  } else {
+    int c;
+    while (n < capacity && (c = body.read()) >= 0) out[n++] = (char)c;
+  }
+  return n;
+}
+
+size_t inflateZlib(const std::string &gz, char *out, size_t capacity) {
+  HostHeap::Exclude outside;
+  z_stream z;
+  memset(&z, 0, sizeof(z));
+  inflateInit2(&z, 15 + 16);
+  z.next_in = (Bytef *)gz.data();
+  z.avail_in = (uInt)gz.size();
+  z.next_out = (Bytef *)out;
+  z.avail_out = (uInt)capacity;
+  inflate(&z, Z_FINISH);
+  const size_t n = z.total_out;
+  inflateEnd(&z);
+  return n;
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_payloads_round_trip() {
+  TEST_ASSERT_FALSE_MESSAGE(sPayloads.empty(), "no payloads from the stand-in");
+  for (const HostBench::Payload &p : sPayloads) {
+    const std::string gz = HostBench::gzip(p.body);
+    std::string out(p.body.size() + 16, '\0');
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(p.body.size(), inflateStream(gz, &out[0], out.size(), true), p.name.c_str());
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(out.data(), p.body.data(), p.body.size()) == 0, p.name.c_str());
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(p.body.size(), inflateStream(gz, &out[0], out.size(), false), p.name.c_str());
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(out.data(), p.body.data(), p.body.size()) == 0, p.name.c_str());
+  }
+}
+
+static void test_workspace_only_for_gzip() {
+  const std::string gz = HostBench::gzip(sPayloads.front().body);
+  char out[2048];
+
+  // A 304 or a plain body: the stream is never begun.
+  HostHeap::Counters before = HostHeap::counters();
+  { GzipStream unused; }
+  TEST_ASSERT_EQUAL_UINT32(before.allocs, HostHeap::counters().allocs);
+
+  before = HostHeap::counters();
+  HostBench::MemoryStream src(gz);
+  {
+    GzipStream body;
+    TEST_ASSERT_TRUE(body.begin(src, (int32_t)gz.size()));
+    body.readBytes(out, sizeof(out));
+  }
+  const HostHeap::Counters after = HostHeap::counters();
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, after.allocs - before.allocs, "one workspace per gzipped body");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(1, after.frees - before.frees, "released with the stream");
+}
+
+static void test_throughput() {
+  const uint32_t linkRate = HostNet::link().bytesPerSec;
+  printf("%-26s %8s %8s %6s %9s %9s %9s %9s\n", "payload", "raw KB", "gzip KB", "ratio", "bulk MB/s", "byte MB/s",
+         "zlib MB/s", "wire -ms");
+  for (const HostBench::Payload &p : sPayloads) {
+    const std::string gz = HostBench::gzip(p.body);
+    std::string out(p.body.size() + 16, '\0');
+    const double bulkUs = HostBench::usPerRun([&] { inflateStream(gz, &out[0], out.size(), true); });
+    const double byteUs = HostBench::usPerRun([&] { inflateStream(gz, &out[0], out.size(), false); });
+    const double zlibUs = HostBench::usPerRun([&] { inflateZlib(gz, &out[0], out.size()); });
+    const double savedMs = (double)(p.body.size() - gz.size()) * 1000.0 / linkRate;
+    printf("%-26s %8.1f %8.1f %5.1fx %9.1f %9.1f %9.1f %9.0f\n", p.name.c_str(), p.body.size() / 1024.0,
+           gz.size() / 1024.0, (double)p.body.size() / gz.size(), HostBench::mbPerSec(p.body.size(), bulkUs),
+           HostBench::mbPerSec(p.body.size(), byteUs), HostBench::mbPerSec(p.body.size(), zlibUs), savedMs);
+  }
+  printf("wire -ms: transfer time gzip saves at the %u B/s link rate\n", (unsigned)linkRate);
+}
+
+int main() {
+  sPayloads = HostBench::espnPayloads();
+  UNITY_BEGIN();
+  RUN_TEST(test_payloads_round_trip);
+  RUN_TEST(test_workspace_only_for_gzip);
+  RUN_TEST(test_throughput);
+  return UNITY_END();
+}
@@ -0,0 +1,220 @@
+// Scoreboard parsing: the JsonPull reader every poll uses against the
+// ArduinoJson filter path it replaced (deserializeJson() through the old
+// scoreboard filter, then a walk of events[]). Bodies are the stand-in's
+// scoreboards and, to show how each path scales with the tournament, the
+// mid-game one with its events repeated up to a full schedule. Reports host
+// CPU and MB/s, the heap low-water dip on the modelled ESP32 heap, and how
+// much of the body is read before the first event is ready.
+//
+// Environment (optional):
+//   ESPN_FIXTURE=path.jsonl   bodies from a tools/espn_standin.py fixture
+//                             instead of the synthetic game
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include <unity.h>
+
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "espn_olympic_client.h"
+#include "host_bench.h"
+#include "host_heap.h"
+
+namespace {
+
+const char *const kFocus = "CAN";
+
+// The filter the scoreboard went through before the pull reader.
+void buildScoreboardFilter(JsonDocument &filter) {
+  filter["events"][0]["id"] = true;
+  filter["events"][0]["date"] = true;
+  filter["events"][0]["competitions"][0]["status"]["type"]["state"] = true;
+  filter["events"][0]["competitions"][0]["status"]["type"]["completed"] = true;
+  filter["events"][0]["competitions"][0]["status"]["type"]["detail"] = true;
+  filter["events"][0]["competitions"][0]["status"]["type"]["shortDetail"] = true;
+  filter["events"][0]["competitions"][0]["status"]["displayClock"] = true;
+  filter["events"][0]["competitions"][0]["status"]["period"] = true;
+  filter["events"][0]["competitions"][0]["notes"][0]["headline"] = true;
+  filter["events"][0]["competitions"][0]["venue"]["fullName"] = true;
+  filter["events"][0]["competitions"][0]["venue"]["address"]["city"] = true;
+  filter["events"][0]["competitions"][0]["competitors"][0]["homeAway"] = true;
+  filter["events"][0]["competitions"][0]["competitors"][0]["score"] = true;
+  filter["events"][0]["competitions"][0]["competitors"][0]["team"]["abbreviation"] = true;
+  filter["events"][0]["competitions"][0]["competitors"][0]["team"]["displayName"] = true;
+  filter["events"][0]["competitions"][0]["competitors"][0]["team"]["logo"] = true;
+}
+
+// What the filter path pulled out of each event, in fixed fields so the
+// comparison is parsing alone.
+struct FilteredEvent {
+  char id[12];
+  char state[8];
+  char detail[40];
+  char clock[8];
+  int period;
+  char home[8];
+  char away[8];
+  int homeScore;
+  int awayScore;
+};
+
+// The filter path: returns the events read, 0 on a parse error.
+uint16_t parseFiltered(Stream &body, const JsonDocument &filter, FilteredEvent *out, uint16_t max) {
+  JsonDocument doc;
+  if (deserializeJson(doc, body, DeserializationOption::Filter(filter), DeserializationOption::NestingLimit(24))) {
+    return 0;
+  }
+  uint16_t n = 0;
+  for (JsonObjectConst ev : doc["events"].as<JsonArrayConst>()) {
+    if (n >= max) break;
+    JsonObjectConst comp = ev["competitions"][0];
+    if (comp.isNull()) continue;
+    FilteredEvent &e = out[n++];
+    strlcpy(e.id, ev["id"] | "", sizeof(e.id));
+    strlcpy(e.state, comp["status"]["type"]["state"] | "", sizeof(e.state));
+    strlcpy(e.detail, comp["status"]["type"]["detail"] | "", sizeof(e.detail));
+    strlcpy(e.clock, comp["status"]["displayClock"] | "", sizeof(e.clock));
+    e.period = comp["status"]["period"] | 0;
+    for (JsonObjectConst c : comp["competitors"].as<JsonArrayConst>()) {
+      const bool home = strcmp(c["homeAway"] | "", "home") == 0;
+      strlcpy(home ? e.home : e.away, c["team"]["abbreviation"] | "", sizeof(e.home));
+      (home ? e.homeScore : e.awayScore) = atoi(c["score"] | "0");
+    }
+  }
+  return n;
+}
+
+// `body` with the entries of its events[] repeated `times` times.
+std::string repeatEvents(const std::string &body, int times) {
+  HostHeap::Exclude outside;
+  const size_t key = body.find("\"events\"");
+  const size_t open = key == std::string::npos ? key : body.find('[', key);
+  if (open == std::string::npos) return body;
+  int depth = 0;
+  bool inString = false;
+  size_t close = open;
+  for (size_t i = open; i < body.size(); ++i) {
+    const char c = body[i];
+    if (inString) {
+      if (c == '\\') ++i;
+      else if (c == '"') inString = false;
+    } else if (c == '"') {
+      inString = true;
+    } else if (c == '[' || c == '{') {
+      ++depth;
+    } else if ((c == ']' || c == '}') && --depth == 0) {
+      close = i;
+      break;
+    }
+  }
+  const std::string entries = body.substr(open + 1, close - open - 1);
+  if (entries.find_first_not_of(" \r\n\t") == std::string::npos) return body;
+  std::string out = body.substr(0, open + 1);
+  for (int i = 0; i < times; ++i) {
+    if (i) out += ',';
+    out += entries;
+  }
+  return out + body.substr(close);
+}
+
+struct Body {
+  std::string name;
+  std::string json;
+};
+
+std::vector<Body> sBodies;
+
+struct Run {
+  double us = 0;
+  size_t heapDip = 0;
+  uint16_t events = 0;
+  uint32_t firstEventBytes = 0;
+};
+
+template <typename Fn>
+Run measure(const std::string &json, Fn parse) {
+  Run run;
+  HostBench::MemoryStream src(json);
+  src.rewind();
+  const size_t before = HostHeap::freeBytes();
+  HostHeap::resetMinFree();
+  parse(src, run);
+  run.heapDip = before - HostHeap::minFreeBytes();
+  run.us = HostBench::usPerRun([&] {
+    src.rewind();
+    Run ignored;
+    parse(src, ignored);
+  });
+  return run;
+}
+
+void scanPull(HostBench::MemoryStream &src, const std::string &json, Run &run) {
+  EspnOlympicClient::scanScoreboard(src, (int32_t)json.size(), kFocus, run.events, run.firstEventBytes);
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_same_events() {
+  TEST_ASSERT_FALSE_MESSAGE(sBodies.empty(), "no scoreboards from the stand-in");
+  JsonDocument filter;
+  buildScoreboardFilter(filter);
+  static FilteredEvent events[512];
+  for (const Body &b : sBodies) {
+    HostBench::MemoryStream src(b.json);
+    uint16_t pulled = 0;
+    uint32_t firstBytes = 0;
+    TEST_ASSERT_TRUE_MESSAGE(
+        EspnOlympicClient::scanScoreboard(src, (int32_t)b.json.size(), kFocus, pulled, firstBytes), b.name.c_str());
+    src.rewind();
+    TEST_ASSERT_EQUAL_UINT32_MESSAGE(parseFiltered(src, filter, events, 512), pulled, b.name.c_str());
+    TEST_ASSERT_TRUE_MESSAGE(firstBytes > 0 && firstBytes < b.json.size(), b.name.c_str());
+  }
+}
+
+static void test_throughput() {
+  JsonDocument filter;
+  buildScoreboardFilter(filter);
+  static FilteredEvent events[512];
+  printf("%-22s %6s %7s | %-27s | %-27s | %s\n", "", "", "", "pull reader", "ArduinoJson filter",
+         "first event after");
+  printf("%-22s %6s %7s | %8s %8s %9s | %8s %8s %9s | %8s %8s\n", "scoreboard", "events", "KB", "us", "MB/s",
+         "heap dip", "us", "MB/s", "heap dip", "pull", "filter");
+  size_t smallDip = 0;
+  for (size_t i = 0; i < sBodies.size(); ++i) {
+    const Body &b = sBodies[i];
+    const Run pull = measure(b.json, [&](HostBench::MemoryStream &src, Run &run) { scanPull(src, b.json, run); });
+    const Run filtered = measure(b.json, [&](HostBench::MemoryStream &src, Run &run) {
+      run.events = parseFiltered(src, filter, events, 512);
+      run.firstEventBytes = (uint32_t)b.json.size();
+    });
+    printf("%-22s %6u %7.1f | %8.0f %8.1f %9u | %8.0f %8.1f %9u | %7.1fK %7.1fK\n", b.name.c_str(),
+           (unsigned)pull.events, b.json.size() / 1024.0, pull.us, HostBench::mbPerSec(b.json.size(), pull.us),
+           (unsigned)pull.heapDip, filtered.us, HostBench::mbPerSec(b.json.size(), filtered.us),
+           (unsigned)filtered.heapDip, pull.firstEventBytes / 1024.0, filtered.firstEventBytes / 1024.0);
+    if (i == 0) smallDip = pull.heapDip;
+    // Flat: the reader's heap use does not grow with the body.
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(smallDip + 512, pull.heapDip, b.name.c_str());
+  }
+}
+
+int main() {
+  Serial.setEcho(false);  // one log line per parse
+  for (const HostBench::Payload &p : HostBench::espnPayloads()) {
+    if (p.name.rfind("scoreboard", 0) == 0) sBodies.push_back({p.name, p.body});
+  }
+  if (!sBodies.empty()) {
+    const std::string middle = sBodies[sBodies.size() / 2].json;
+    for (const int times : {4, 12}) {
+      sBodies.push_back({"scoreboard x" + std::to_string(times), repeatEvents(middle, times)});
+    }
+  }
+  UNITY_BEGIN();
+  RUN_TEST(test_same_events);
+  RUN_TEST(test_throughput);
+  return UNITY_END();
+}
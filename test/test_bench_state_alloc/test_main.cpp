@@ -0,0 +1,229 @@
+// Heap allocations per poll on the modelled ESP32 heap: the scoreboard and
+// /summary handoffs into the working state and the published slot, as the
+// network task does them now (StateMerge, a reused /summary scratch state)
+// against the copies they replaced (`g = next`, and a full GameState copy
+// around every /summary fetch). Both run on the same bodies of the synthetic
+// game, polled through live play; the fetches themselves are counted apart.
+//
+// JsonDocument memory is not on the modelled heap, so the fetch figures cover
+// the HTTP and String work only. The scoreboard fetch includes the Strings of
+// the fresh state it fills, which the handoffs then move or copy.
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include "config.h"
+#include "espn_olympic_client.h"
+#include "espn_standin.h"
+#include "host_heap.h"
+#include "host_sched.h"
+#include "host_time.h"
+#include "net_task.h"
+#include "state_merge.h"
+
+namespace {
+
+// Thursday 2026-02-12, 12:00 UTC: inside the tournament window.
+const time_t kBootEpoch = 1770897600;
+const uint32_t kLeadSec = 120;
+const uint32_t kPolls = 60;
+const uint64_t kPollUs = 30ULL * 1000000;
+
+// A writer and its three slots, published round robin: enough to keep each
+// slot's Strings holding an older state, as with a reader in the loop.
+struct Pipeline {
+  NetTask::Snapshot working;
+  NetTask::Snapshot slots[3];
+  uint8_t slot = 0;
+  StateMerge::Merger merger;
+  GameState detail;
+
+  void publish() {
+    working.versions = merger.versions();
+    slots[slot] = working;
+    slot = (uint8_t)((slot + 1) % 3);
+  }
+};
+
+// Alloc and free counts of a stretch of code, summed over the polls.
+struct Tally {
+  uint64_t allocs = 0;
+  uint64_t frees = 0;
+  uint32_t runs = 0;
+  HostHeap::Counters at;
+
+  void start() { at = HostHeap::counters(); }
+  void stop() {
+    const HostHeap::Counters now = HostHeap::counters();
+    allocs += now.allocs - at.allocs;
+    frees += now.frees - at.frees;
+  }
+  void print(const char *name) const {
+    printf("%-36s %6.1f %6.1f\n", name, runs ? (double)allocs / runs : 0.0, runs ? (double)frees / runs : 0.0);
+  }
+};
+
+EspnOlympicClient sClient;
+Pipeline sOld;
+Pipeline sNew;
+Tally sScoreboardFetch, sScoreboardOld, sScoreboardNew;
+Tally sDetailFetch, sDetailOld, sDetailNew;
+
+// net_task.cpp before StateMerge: stats the scoreboard lacks carried over by
+// hand, then the whole state copy-assigned.
+void oldScoreboard(Pipeline &p, GameState &next) {
+  GameState &g = p.working.state;
+  if (!g.gameId.isEmpty() && next.gameId == g.gameId && next.home.id == g.home.id && next.away.id == g.away.id) {
+    if (next.home.sog < 0) next.home.sog = g.home.sog;
+    if (next.home.hits < 0) next.home.hits = g.home.hits;
+    if (next.home.foPct < 0) next.home.foPct = g.home.foPct;
+    if (next.away.sog < 0) next.away.sog = g.away.sog;
+    if (next.away.hits < 0) next.away.hits = g.away.hits;
+    if (next.away.foPct < 0) next.away.foPct = g.away.foPct;
+  }
+  g = next;
+  p.publish();
+}
+
+void newScoreboard(Pipeline &p, GameState &next) {
+  p.merger.mergeScoreboard(p.working.state, next, millis());
+  p.publish();
+}
+
+// net_task.cpp before StateMerge: the /summary parsed into a copy of the
+// whole working state, then the fields it feeds copied back.
+void oldDetail(Pipeline &p) {
+  GameState &g = p.working.state;
+  sDetailOld.start();
+  {
+    GameState tmp = g;
+    sDetailOld.stop();
+    bool gotGoal = false;
+    sDetailFetch.start();
+    const bool ok = sClient.fetchGameDetail(tmp, FOCUS_TEAM_ABBR, gotGoal);
+    sDetailFetch.stop();
+    sDetailFetch.runs++;
+    sDetailOld.start();
+    if (ok) {
+      g.clock = tmp.clock;
+      g.period = tmp.period;
+      g.isLive = tmp.isLive;
+      g.isPre = tmp.isPre;
+      g.isFinal = tmp.isFinal;
+      g.isIntermission = tmp.isIntermission;
+      g.statusDetail = tmp.statusDetail;
+    }
+    if (tmp.home.foPct >= 0) g.home.foPct = tmp.home.foPct;
+    if (tmp.away.foPct >= 0) g.away.foPct = tmp.away.foPct;
+    if (tmp.home.sog >= 0) g.home.sog = tmp.home.sog;
+    if (tmp.away.sog >= 0) g.away.sog = tmp.away.sog;
+    if (tmp.home.hits >= 0) g.home.hits = tmp.home.hits;
+    if (tmp.away.hits >= 0) g.away.hits = tmp.away.hits;
+    if (tmp.strengthLabel.length()) g.strengthLabel = tmp.strengthLabel;
+    if (gotGoal && tmp.lastGoalEventId != 0) {
+      g.lastGoalEventId = tmp.lastGoalEventId;
+      g.goalText = tmp.goalText;
+      g.goalTeam = tmp.goalTeam;
+      g.goalScorer = tmp.goalScorer;
+      g.focusJustScored = tmp.focusJustScored;
+    }
+    p.publish();
+  }
+  sDetailOld.stop();
+}
+
+// net_task.cpp's pollDetail.
+void newDetail(Pipeline &p) {
+  const GameState &g = p.working.state;
+  GameState &d = p.detail;
+  sDetailNew.start();
+  d.hasGame = g.hasGame;
+  d.gameId = g.gameId;
+  d.home.id = g.home.id;
+  d.away.id = g.away.id;
+  d.isPre = g.isPre;
+  d.isLive = g.isLive;
+  d.isFinal = g.isFinal;
+  d.isIntermission = g.isIntermission;
+  d.period = g.period;
+  d.statusShortDetail = g.statusShortDetail;
+  d.home.sog = d.home.hits = d.home.foPct = -1;
+  d.away.sog = d.away.hits = d.away.foPct = -1;
+  d.strengthLabel = "";
+  d.lastGoalEventId = 0;
+  sDetailNew.stop();
+  bool gotGoal = false;
+  if (!sClient.fetchGameDetail(d, FOCUS_TEAM_ABBR, gotGoal)) return;
+  sDetailNew.start();
+  if (p.merger.mergeSummary(p.working.state, d, gotGoal, millis())) p.publish();
+  sDetailNew.stop();
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_allocs_per_poll() {
+  EspnStandin::Options options;
+  options.leadSec = kLeadSec;
+  options.chunked = true;
+  options.gzip = true;
+  HostTime::setWallClock(kBootEpoch);
+  TEST_ASSERT_TRUE_MESSAGE(EspnStandin::start(options), "stand-in did not start");
+  Serial.setEcho(false);
+
+  // First polls fill both pipelines' Strings; only the steady state counts.
+  HostSched::sleepUntilUs(EspnStandin::startUs());
+  for (uint32_t i = 0; i <= kPolls; ++i) {
+    const bool counted = i > 0;
+    GameState next;
+    bool changed = true;
+    sScoreboardFetch.start();
+    const bool fetched = sClient.fetchScoreboardIfChanged(next, FOCUS_TEAM_ABBR, (uint32_t)(kPollUs / 1000), changed);
+    sScoreboardFetch.stop();
+    if (fetched && changed) {
+      GameState forOld = next;
+      sScoreboardOld.start();
+      oldScoreboard(sOld, forOld);
+      sScoreboardOld.stop();
+      sScoreboardNew.start();
+      newScoreboard(sNew, next);
+      sScoreboardNew.stop();
+      sScoreboardOld.runs += counted;
+      sScoreboardNew.runs += counted;
+    }
+    sScoreboardFetch.runs += counted;
+
+    oldDetail(sOld);
+    newDetail(sNew);
+    sDetailOld.runs += counted;
+    sDetailNew.runs += counted;
+
+    if (!counted) {
+      sScoreboardFetch = sScoreboardOld = sScoreboardNew = Tally();
+      sDetailFetch = sDetailOld = sDetailNew = Tally();
+    }
+    HostSched::sleepUs(kPollUs);
+  }
+
+  printf("\n--- allocs and frees per poll, %u polls %u s apart from puck drop ---\n", (unsigned)kPolls,
+         (unsigned)(kPollUs / 1000000));
+  printf("%-36s %6s %6s\n", "", "allocs", "frees");
+  sScoreboardFetch.print("scoreboard fetch");
+  sScoreboardOld.print("scoreboard handoff, g = next");
+  sScoreboardNew.print("scoreboard handoff, mergeScoreboard");
+  sDetailFetch.print("summary fetch");
+  sDetailOld.print("summary handoff, GameState copy");
+  sDetailNew.print("summary handoff, mergeSummary");
+
+  TEST_ASSERT_TRUE_MESSAGE(sScoreboardNew.runs > 0, "no scoreboard poll returned new data");
+  TEST_ASSERT_TRUE_MESSAGE(sDetailNew.allocs < sDetailOld.allocs, "summary handoff allocates as much as the copy");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, HostHeap::counters().failed, "an allocation found no free block");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_allocs_per_poll);
+  return UNITY_END();
+}
@@ -0,0 +1,473 @@
+// Draws every Ui screen into the TFT_eSPI stand-in and compares the panel
+// with the PNG under golden/, then walks the GameState transitions of a game
+// day and reports what each one sends to the panel: regions repainted,
+// address windows, pixels and SPI bytes, and the host CPU the draw call took.
+//
+// Environment (all optional):
+//   UPDATE_GOLDEN=1   rewrite golden/*.png from this run
+//   RENDER_OUT=dir    save every screen as a PNG there; a screen that does
+//                     not match its golden is saved to the temp directory
+//                     either way
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include <unity.h>
+
+#include <chrono>
+#include <filesystem>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+
+#include "assets.h"
+#include "host_sched.h"
+#include "host_time.h"
+#include "palette.h"
+#include "ui.h"
+
+namespace {
+
+namespace fsys = std::filesystem;
+
+// Thursday 2026-02-12, 12:00 UTC; TZ_INFO keeps it at 12:00 local.
+const time_t kNow = 1770897600;
+const uint8_t kRotation = 1;
+// Per-channel slack for float rounding in the glyph atlas between compilers.
+const uint8_t kTolerance = 8;
+const char *const kFocus = "CAN";
+
+TFT_eSPI sTft;
+Ui sUi;
+
+bool envSet(const char *name) {
+  const char *v = getenv(name);
+  return v && v[0] && strcmp(v, "0") != 0;
+}
+
+fsys::path sourceDir() {
+  return fsys::absolute(fsys::path(__FILE__)).parent_path();
+}
+
+void setUpPanel() {
+  static bool done = false;
+  if (done) return;
+  done = true;
+  setenv("TZ", "GMT0BST,M3.5.0/1,M10.5.0/2", 1);
+  tzset();
+  HostTime::setWallClock(kNow);
+  configTime(0, 0, "pool.ntp.org");
+
+  // The flags and splash from data/, in a copy: drawing must not write to it.
+  const fsys::path root = fsys::temp_directory_path() / ("render-spiffs-" + std::to_string(getpid()));
+  fsys::remove_all(root);
+  fsys::copy(sourceDir() / ".." / ".." / "data", root, fsys::copy_options::recursive);
+  SPIFFS.setRoot(root.string());
+
+  sUi.begin(sTft, kRotation);
+  Assets::begin(sTft);
+}
+
+// Compares the panel with golden/<name>.png, or rewrites it.
+void checkGolden(const char *name) {
+  const fsys::path golden = sourceDir() / "golden" / (std::string(name) + ".png");
+  if (const char *out = getenv("RENDER_OUT")) {
+    fsys::create_directories(out);
+    sTft.savePng((fsys::path(out) / (std::string(name) + ".png")).c_str());
+  }
+  if (envSet("UPDATE_GOLDEN")) {
+    fsys::create_directories(golden.parent_path());
+    TEST_ASSERT_TRUE_MESSAGE(sTft.savePng(golden.c_str()), "cannot write golden");
+    return;
+  }
+  const int32_t differ = sTft.diffPng(golden.c_str(), kTolerance);
+  if (differ != 0) {
+    const fsys::path actual = fsys::temp_directory_path() / (std::string(name) + ".actual.png");
+    sTft.savePng(actual.c_str());
+    printf("%s: %d pixels differ from %s; this run is in %s\n", name, (int)differ, golden.c_str(), actual.c_str());
+  }
+  TEST_ASSERT_EQUAL_INT32_MESSAGE(0, differ, name);
+}
+
+// Screens are drawn from a cleared panel, so each golden holds one screen.
+void freshPanel() {
+  sUi.setRotation(kRotation);
+}
+
+TeamLine team(const char *code, int score, int sog, int hits, int foPct) {
+  TeamLine t;
+  t.id = Teams::intern(code);
+  t.name = code;
+  t.score = score;
+  t.sog = sog;
+  t.hits = hits;
+  t.foPct = foPct;
+  return t;
+}
+
+void addGroup(OlympicStandings &s, char group, const char *const *codes, const uint8_t *pts) {
+  GroupStandings &g = s.groups[s.groupCount++];
+  g.group = group;
+  for (uint8_t i = 0; i < 4; ++i) {
+    StandingsRow &r = g.rows[g.rowCount++];
+    r.team = Teams::intern(codes[i]);
+    r.gp = 2;
+    r.w = pts[i] / 3;
+    r.otw = (pts[i] % 3) == 2 ? 1 : 0;
+    r.otl = (pts[i] % 3) == 1 ? 1 : 0;
+    r.l = (uint8_t)(2 - r.w - r.otw - r.otl);
+    r.pts = pts[i];
+  }
+}
+
+OlympicStandings standings() {
+  OlympicStandings s;
+  static const char *const a[] = {"CAN", "SUI", "CZE", "FRA"};
+  static const char *const b[] = {"SWE", "FIN", "SVK", "ITA"};
+  static const char *const c[] = {"USA", "GER", "LAT", "DEN"};
+  static const uint8_t pts[] = {6, 4, 2, 0};
+  addGroup(s, 'A', a, pts);
+  addGroup(s, 'B', b, pts);
+  addGroup(s, 'C', c, pts);
+  s.canadaGroup = 'A';
+  s.canadaRank = 1;
+  s.canadaPts = 6;
+  return s;
+}
+
+GameState nextGame(time_t startEpoch) {
+  GameState g;
+  g.wifiConnected = true;
+  g.hasNextGame = true;
+  g.nextOpp = Teams::intern("SWE");
+  g.nextIsHome = true;
+  g.nextVenue = "Milano Santagiulia Ice Hockey Arena";
+  g.nextCity = "Milan";
+  g.nextGroup = 'A';
+  g.nextGroupHeadline = "Men's Preliminary Round - Group A";
+  g.nextStartEpoch = startEpoch;
+  g.standings = standings();
+  return g;
+}
+
+GameState liveGame() {
+  GameState g;
+  g.wifiConnected = true;
+  g.hasGame = true;
+  g.isLive = true;
+  g.gameId = "401900001";
+  g.startEpoch = kNow;
+  g.statusDetail = "12:34 - 2nd Period";
+  g.statusShortDetail = "12:34 - 2nd";
+  g.clock = "12:34";
+  g.period = 2;
+  g.group = 'A';
+  g.away = team("SWE", 1, 14, 11, 48);
+  g.home = team("CAN", 2, 19, 9, 52);
+  g.standings = standings();
+  return g;
+}
+
+GameState goal(const GameState &live, bool focus) {
+  GameState g = live;
+  g.focusJustScored = focus;
+  g.goalTeam = Teams::intern(focus ? "CAN" : "SWE");
+  g.goalScorer = focus ? "Connor McDavid" : "William Nylander";
+  g.goalText = focus ? "Connor McDavid Goal (Even Strength)" : "William Nylander Goal (Power Play)";
+  return g;
+}
+
+GameState lastGame() {
+  GameState g = nextGame(kNow + 2 * 86400 + 5 * 3600);
+  LastGameRecap &r = g.last;
+  r.hasGame = true;
+  r.gameId = "401900001";
+  r.away = team("SWE", 2, 27, 20, 47);
+  r.home = team("CAN", 3, 33, 18, 53);
+  r.startEpoch = kNow - 86400;
+  r.venue = "Milano Santagiulia Ice Hockey Arena";
+  r.city = "Milan";
+  r.homeScorers[r.homeScorerCount++] = {"C. McDavid", 2};
+  r.homeScorers[r.homeScorerCount++] = {"S. Crosby", 1};
+  r.awayScorers[r.awayScorerCount++] = {"W. Nylander", 1};
+  r.awayScorers[r.awayScorerCount++] = {"E. Pettersson", 1};
+  r.periods[r.periodCount++] = {"P1", 1, 0};
+  r.periods[r.periodCount++] = {"P2", 0, 1};
+  r.periods[r.periodCount++] = {"P3", 1, 1};
+  r.periods[r.periodCount++] = {"OT", 1, 0};
+  return g;
+}
+
+// What one draw call cost.
+struct Cost {
+  DisplayList::FrameStats frame;
+  TFT_eSPI::Stats panel;
+  uint64_t hostUs = 0;
+};
+
+template <typename Draw>
+Cost measure(Draw draw) {
+  sTft.resetStats();
+  const auto started = std::chrono::steady_clock::now();
+  draw();
+  const auto took = std::chrono::steady_clock::now() - started;
+  Cost c;
+  c.frame = sUi.lastFrame();
+  c.panel = sTft.stats();
+  c.hostUs = (uint64_t)std::chrono::duration_cast<std::chrono::microseconds>(took).count();
+  return c;
+}
+
+void printCostHeader() {
+  printf("%-32s %7s %4s %8s %7s %8s %8s %7s %7s\n", "transition", "regions", "ops", "est B", "windows", "pixels",
+         "SPI B", "SPI ms", "host us");
+}
+
+void printCost(const char *step, const Cost &c) {
+  printf("%-32s %3u/%-3u %4u %8lu %7u %8llu %8llu %7.2f %7llu\n", step, (unsigned)c.frame.dirty,
+         (unsigned)c.frame.regions, (unsigned)c.frame.ops, (unsigned long)c.frame.bytes, (unsigned)c.panel.windows,
+         (unsigned long long)c.panel.pixels, (unsigned long long)c.panel.spiBytes, c.panel.spiUs() / 1e3,
+         (unsigned long long)c.hostUs);
+}
+
+// tickCountdown() patches the frame on the panel rather than presenting one.
+void printPatchCost(const char *step, const Cost &c) {
+  printf("%-32s %7s %4s %8s %7u %8llu %8llu %7.2f %7llu\n", step, "patch", "-", "-", (unsigned)c.panel.windows,
+         (unsigned long long)c.panel.pixels, (unsigned long long)c.panel.spiBytes, c.panel.spiUs() / 1e3,
+         (unsigned long long)c.hostUs);
+}
+
+}  // namespace
+
+void setUp() {
+  setUpPanel();
+}
+
+void tearDown() {}
+
+static void test_boot_splash() {
+  freshPanel();
+  sUi.drawBootSplash("MILANO CORTINA 2026", "MEN'S ICE HOCKEY - CONNECTING WIFI");
+  checkGolden("boot_splash");
+}
+
+static void test_next_game() {
+  freshPanel();
+  sUi.drawNextGame(nextGame(kNow + 2 * 86400 + 5 * 3600), kFocus);
+  checkGolden("next_game");
+}
+
+static void test_next_game_day() {
+  freshPanel();
+  sUi.drawNextGame(nextGame(kNow + 3 * 3600 + 25 * 60 + 7), kFocus);
+  checkGolden("next_game_day");
+}
+
+static void test_no_game() {
+  freshPanel();
+  GameState g;
+  g.wifiConnected = true;
+  sUi.drawNoGame(g, kFocus);
+  checkGolden("no_game");
+}
+
+static void test_pregame() {
+  freshPanel();
+  GameState g = liveGame();
+  g.isLive = false;
+  g.isPre = true;
+  g.clock = "";
+  g.period = 0;
+  g.away.score = g.home.score = 0;
+  g.startEpoch = kNow + 40 * 60;
+  g.statusDetail = "Milano Santagiulia Ice Hockey Arena";
+  sUi.drawPregame(g, kFocus);
+  checkGolden("pregame");
+}
+
+static void test_live() {
+  freshPanel();
+  GameState g = liveGame();
+  g.strengthLabel = "CAN POWER PLAY";
+  g.strengthColour = Palette::STATUS_PP;
+  sUi.drawLive(g);
+  checkGolden("live");
+}
+
+static void test_live_stale() {
+  freshPanel();
+  GameState g = liveGame();
+  g.dataStale = true;
+  g.staleReason = StaleReason::SERVICE_DOWN;
+  sUi.drawLive(g);
+  checkGolden("live_stale");
+}
+
+static void test_goal_focus() {
+  freshPanel();
+  sUi.drawGoal(goal(liveGame(), true));
+  checkGolden("goal_focus");
+}
+
+static void test_goal_opponent() {
+  freshPanel();
+  sUi.drawGoal(goal(liveGame(), false));
+  checkGolden("goal_opponent");
+}
+
+static void test_intermission() {
+  freshPanel();
+  GameState g = liveGame();
+  g.isLive = false;
+  g.isIntermission = true;
+  g.clock = "0:00";
+  sUi.drawIntermission(g);
+  checkGolden("intermission");
+}
+
+static void test_final() {
+  freshPanel();
+  GameState g = liveGame();
+  g.isLive = false;
+  g.isFinal = true;
+  g.home.score = 3;
+  sUi.drawFinal(g);
+  checkGolden("final");
+}
+
+static void test_last_game() {
+  freshPanel();
+  sUi.drawLastGame(lastGame());
+  checkGolden("last_game");
+}
+
+static void test_no_last_game() {
+  freshPanel();
+  sUi.drawLastGame(GameState());
+  checkGolden("no_last_game");
+}
+
+static void test_standings() {
+  freshPanel();
+  GameState g;
+  g.standings = standings();
+  g.standings.usedRegulationFallback = true;
+  sUi.drawStandings(g, kFocus);
+  checkGolden("standings");
+}
+
+static void test_no_standings() {
+  freshPanel();
+  sUi.drawStandings(GameState(), kFocus);
+  checkGolden("no_standings");
+}
+
+// A game day as the loop draws it, one GameState change at a time.
+static void test_transition_cost() {
+  freshPanel();
+  const uint32_t fullFrameBytes = (uint32_t)sTft.width() * sTft.height() * 2;
+  printCostHeader();
+
+  GameState next = nextGame(kNow + 3 * 3600 + 25 * 60 + 7);
+  Cost c = measure([&] { sUi.drawNextGame(next, kFocus); });
+  printCost("next game, first frame", c);
+  c = measure([&] { sUi.drawNextGame(next, kFocus); });
+  printCost("next game, unchanged", c);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, c.panel.windows, "an unchanged frame sends nothing");
+
+  HostSched::sleepUs(1000000);
+  bool ticked = false;
+  c = measure([&] { ticked = sUi.tickCountdown(); });
+  printPatchCost("next game, countdown tick", c);
+  TEST_ASSERT_TRUE(ticked);
+  TEST_ASSERT_LESS_THAN_UINT64(fullFrameBytes / 20, c.panel.spiBytes);
+
+  GameState live = liveGame();
+  c = measure([&] { sUi.drawLive(live); });
+  printCost("next game -> live", c);
+  TEST_ASSERT_GREATER_OR_EQUAL_UINT64(fullFrameBytes, c.panel.spiBytes);
+
+  live.clock = "12:33";
+  c = measure([&] { sUi.drawLive(live); });
+  printCost("live, clock tick", c);
+  TEST_ASSERT_EQUAL_UINT8(1, c.frame.dirty);
+  TEST_ASSERT_LESS_THAN_UINT64(fullFrameBytes / 4, c.panel.spiBytes);
+
+  live.home.sog++;
+  c = measure([&] { sUi.drawLive(live); });
+  printCost("live, shots change", c);
+  TEST_ASSERT_EQUAL_UINT8(1, c.frame.dirty);
+
+  live.home.score++;
+  c = measure([&] { sUi.drawLive(live); });
+  printCost("live, score change", c);
+  TEST_ASSERT_EQUAL_UINT8(1, c.frame.dirty);
+  TEST_ASSERT_LESS_THAN_UINT64(fullFrameBytes / 20, c.panel.spiBytes);
+
+  live.strengthLabel = "CAN POWER PLAY";
+  live.strengthColour = Palette::STATUS_PP;
+  c = measure([&] { sUi.drawLive(live); });
+  printCost("live, power play", c);
+
+  c = measure([&] { sUi.drawGoal(goal(live, true)); });
+  printCost("live -> goal banner", c);
+  c = measure([&] { sUi.drawLive(live); });
+  printCost("goal banner -> live", c);
+  // The banner's 96 px flag is cached once decoded, so the next goal skips
+  // SPIFFS and the PNG inflate.
+  const FlagCache::Stats flags = Assets::flagCacheStats();
+  c = measure([&] { sUi.drawGoal(goal(live, true)); });
+  printCost("live -> goal banner, again", c);
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(flags.hits + 1, Assets::flagCacheStats().hits, "96 px flag not cached");
+  TEST_ASSERT_EQUAL_UINT32(flags.misses, Assets::flagCacheStats().misses);
+  sUi.drawLive(live);
+
+  GameState inter = live;
+  inter.isLive = false;
+  inter.isIntermission = true;
+  c = measure([&] { sUi.drawIntermission(inter); });
+  printCost("live -> intermission", c);
+  c = measure([&] { sUi.drawIntermission(inter); });
+  printCost("intermission, unchanged", c);
+  TEST_ASSERT_EQUAL_UINT32(0, c.panel.windows);
+
+  GameState fin = live;
+  fin.isLive = false;
+  fin.isFinal = true;
+  sUi.drawLive(live);
+  c = measure([&] { sUi.drawFinal(fin); });
+  printCost("live -> final", c);
+
+  GameState last = lastGame();
+  c = measure([&] { sUi.drawLastGame(last); });
+  printCost("final -> last game", c);
+
+  GameState table;
+  table.standings = standings();
+  c = measure([&] { sUi.drawStandings(table, kFocus); });
+  printCost("last game -> standings", c);
+  table.standings.groups[1].rows[2].pts++;
+  c = measure([&] { sUi.drawStandings(table, kFocus); });
+  printCost("standings, one group changes", c);
+  TEST_ASSERT_EQUAL_UINT8(1, c.frame.dirty);
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_boot_splash);
+  RUN_TEST(test_next_game);
+  RUN_TEST(test_next_game_day);
+  RUN_TEST(test_no_game);
+  RUN_TEST(test_pregame);
+  RUN_TEST(test_live);
+  RUN_TEST(test_live_stale);
+  RUN_TEST(test_goal_focus);
+  RUN_TEST(test_goal_opponent);
+  RUN_TEST(test_intermission);
+  RUN_TEST(test_final);
+  RUN_TEST(test_last_game);
+  RUN_TEST(test_no_last_game);
+  RUN_TEST(test_standings);
+  RUN_TEST(test_no_standings);
+  RUN_TEST(test_transition_cost);
+  return UNITY_END();
+}
@@ -0,0 +1,215 @@
+// Replays a whole game through the firmware on the virtual clock: setup() and
+// loop() from src/main.cpp, the network task, EspnOlympicClient and the UI,
+// against the ESPN stand-in. Reports poll intervals per game phase, goal
+// detection delay and network task CPU per request, and fails when a goal is
+// missed or shown late.
+//
+// Environment (all optional):
+//   ESPN_FIXTURE=path.jsonl   serve a tools/espn_standin.py fixture instead
+//                             of the synthetic game
+//   REPLAY_FAULTS=1           400 ms latency, 10% truncated bodies, 5% 503s
+//                             and a 5 minute outage in the second period;
+//                             test_replay_faults builds it in
+//   REPLAY_ECHO=1             print the firmware's serial log
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <map>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "espn_standin.h"
+#include "host_net.h"
+#include "host_sched.h"
+#include "host_time.h"
+
+#ifndef REPLAY_FAULTS
+#define REPLAY_FAULTS 0
+#endif
+
+void setup();
+void loop();
+
+namespace {
+
+// Thursday 2026-02-12, 12:00 UTC: inside the tournament window.
+const time_t kBootEpoch = 1770897600;
+const uint32_t kLeadSec = 1800;
+// Room after the final horn for the cooldown polls and the last-game screen.
+const uint64_t kAfterUs = 20ULL * 60 * 1000000;
+// A goal must be on screen within this long of happening: a clutch or live
+// detail interval plus the request itself.
+const uint64_t kGoalDeadlineUs = 20ULL * 1000000;
+const uint64_t kGoalDeadlineFaultsUs = 6ULL * 60 * 1000000;
+
+struct Transition {
+  uint64_t atUs;
+  std::string line;
+};
+
+std::vector<Transition> sTransitions;
+bool sFaults = false;
+bool sFixture = false;
+
+void onSerialLine(const char *line, void *) {
+  if (strncmp(line, "STATE: ", 7) == 0) sTransitions.push_back({HostSched::nowUs(), line + 7});
+}
+
+double sec(uint64_t us) {
+  return (double)us / 1e6;
+}
+
+bool envSet(const char *name) {
+  const char *v = getenv(name);
+  return v && v[0] && strcmp(v, "0") != 0;
+}
+
+void runGame() {
+  EspnStandin::Options options;
+  options.leadSec = kLeadSec;
+  options.chunked = true;
+  options.gzip = true;
+  if (const char *fixture = getenv("ESPN_FIXTURE")) {
+    options.fixture = fixture;
+    sFixture = true;
+  }
+  if (sFaults) {
+    options.latencyMs = 400;
+    options.truncateRate = 0.10;
+    options.errorRate = 0.05;
+    const uint32_t secondPeriod = kLeadSec + 1200 + 1080 + 300;
+    options.outages.push_back({secondPeriod, secondPeriod + 300});
+  }
+  HostTime::setWallClock(kBootEpoch);
+  TEST_ASSERT_TRUE_MESSAGE(EspnStandin::start(options), "stand-in did not start");
+
+  Serial.setEcho(envSet("REPLAY_ECHO"));
+  Serial.setListener(onSerialLine, nullptr);
+  setup();
+  const uint64_t until = EspnStandin::endUs() + kAfterUs;
+  while (HostSched::nowUs() < until) loop();
+  Serial.setListener(nullptr, nullptr);
+}
+
+void reportPolls() {
+  const EspnStandin::Session &s = EspnStandin::session();
+  struct Gaps {
+    uint32_t n = 0;
+    double sum = 0;
+    double min = 1e18;
+    double max = 0;
+  };
+  auto byPhase = [](const std::vector<uint64_t> &times, const char *kind) {
+    std::map<std::string, Gaps> phases;
+    std::vector<std::string> order;
+    for (size_t i = 1; i < times.size(); ++i) {
+      const std::string phase = EspnStandin::phaseAt(times[i]);
+      if (!phases.count(phase)) order.push_back(phase);
+      Gaps &g = phases[phase];
+      const double gap = sec(times[i] - times[i - 1]);
+      g.n++;
+      g.sum += gap;
+      g.min = std::min(g.min, gap);
+      g.max = std::max(g.max, gap);
+    }
+    printf("%s: %u requests\n", kind, (unsigned)times.size());
+    for (const std::string &phase : order) {
+      const Gaps &g = phases[phase];
+      printf("  %-5s %4u  interval avg %6.1fs  min %6.1fs  max %6.1fs\n", phase.empty() ? "-" : phase.c_str(),
+             (unsigned)g.n, g.sum / g.n, g.min, g.max);
+    }
+  };
+  byPhase(s.scoreboardUs, "scoreboard");
+  byPhase(s.summaryUs, "summary");
+  printf("statuses:");
+  for (const auto &kv : s.statuses) printf(" %d x%u", kv.first, (unsigned)kv.second);
+  const HostNet::Stats &net = HostNet::stats();
+  printf("\nbody bytes %llu, on the wire %llu, %u connects, %u TLS handshakes\n", (unsigned long long)s.bodyBytes,
+         (unsigned long long)net.bytesSent, (unsigned)net.connects, (unsigned)net.tlsHandshakes);
+}
+
+// Network task CPU per request: HTTP, decoding, parsing and merging, without
+// the stand-in's own time building responses.
+void reportCost() {
+  const HostNet::Stats &net = HostNet::stats();
+  const uint64_t netUs = HostSched::cpuUs("net");
+  const uint64_t clientUs = netUs > net.serverUs ? netUs - net.serverUs : 0;
+  printf("net task: %.1f ms host CPU, %.1f ms of it in the stand-in; %u requests, %.1f us per request\n",
+         netUs / 1e3, net.serverUs / 1e3, (unsigned)net.requests,
+         net.requests ? (double)clientUs / net.requests : 0.0);
+  printf("loop task: %.1f ms host CPU\n", HostSched::cpuUs("loopTask") / 1e3);
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_replay_game() {
+  runGame();
+  printf("\n--- %s%s ---\n", sFixture ? getenv("ESPN_FIXTURE") : "synthetic CAN-SWE", sFaults ? ", faults" : "");
+  for (const Transition &t : sTransitions) printf("%9.1fs  %s\n", sec(t.atUs), t.line.c_str());
+  reportPolls();
+  reportCost();
+}
+
+static void test_goals_shown() {
+  const std::vector<EspnStandin::Goal> &goals = EspnStandin::session().goals;
+  std::vector<uint64_t> shown;
+  for (const Transition &t : sTransitions) {
+    if (t.line.find("-> GOAL (goal)") != std::string::npos) shown.push_back(t.atUs);
+  }
+  printf("goal                                         happened    served   shown    delay\n");
+  for (size_t i = 0; i < goals.size(); ++i) {
+    const EspnStandin::Goal &g = goals[i];
+    // Banners come up in goal order, one per goal.
+    const uint64_t at = i < shown.size() ? shown[i] : 0;
+    printf("%-42s %9.1fs %8.1fs %8.1fs %7.1fs\n", g.text.c_str(), sec(g.happenedUs),
+           g.servedUs ? sec(g.servedUs) : -1.0, at ? sec(at) : -1.0, at ? sec(at - g.happenedUs) : -1.0);
+  }
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(goals.size(), shown.size(), "every goal gets one banner");
+  if (sFixture) return;
+  const uint64_t deadline = sFaults ? kGoalDeadlineFaultsUs : kGoalDeadlineUs;
+  for (size_t i = 0; i < goals.size(); ++i) {
+    TEST_ASSERT_TRUE_MESSAGE(shown[i] >= goals[i].happenedUs, "banner before the goal");
+    TEST_ASSERT_LESS_OR_EQUAL_MESSAGE(deadline, shown[i] - goals[i].happenedUs, "goal shown late");
+  }
+}
+
+static void test_game_flow() {
+  if (sFixture) TEST_IGNORE_MESSAGE("synthetic game only");
+  auto seen = [](const char *to) {
+    for (const Transition &t : sTransitions) {
+      if (t.line.find(to) != std::string::npos) return true;
+    }
+    return false;
+  };
+  TEST_ASSERT_TRUE_MESSAGE(seen("-> LIVE"), "never went live");
+  TEST_ASSERT_TRUE_MESSAGE(seen("-> INTERMISSION"), "no intermission");
+  TEST_ASSERT_TRUE_MESSAGE(seen("-> FINAL"), "never went final");
+  // The scoreboard is not hammered before puck drop or after the final. Each
+  // date range is its own poll: the look-ahead to the next day rides along.
+  const EspnStandin::Session &s = EspnStandin::session();
+  std::map<std::string, uint64_t> last;
+  for (size_t i = 0; i < s.scoreboardUs.size(); ++i) {
+    const uint64_t at = s.scoreboardUs[i];
+    const std::string &dates = s.scoreboardDates[i];
+    const std::string phase = EspnStandin::phaseAt(at);
+    if (last.count(dates) && (phase == "pre" || phase == "post")) {
+      TEST_ASSERT_GREATER_OR_EQUAL(sFaults ? 1000000ULL : 14000000ULL, at - last[dates]);
+    }
+    last[dates] = at;
+  }
+}
+
+int main() {
+  sFaults = REPLAY_FAULTS || envSet("REPLAY_FAULTS");
+  UNITY_BEGIN();
+  RUN_TEST(test_replay_game);
+  RUN_TEST(test_goals_shown);
+  RUN_TEST(test_game_flow);
+  return UNITY_END();
+}
@@ -0,0 +1,4 @@
+// test_replay with network faults: each test program boots the firmware once,
+// so the faulty run gets its own.
+#define REPLAY_FAULTS 1
+#include "../test_replay/test_main.cpp"
@@ -0,0 +1,123 @@
+// Long soak on the modelled ESP32 heap: boots the firmware hours before the
+// synthetic game, plays it through and keeps polling long after, sampling
+// free heap and the largest free block on every loop(). Reports the heap
+// high-water mark and the smallest largest-free-block per game phase, and
+// fails when an allocation found no block or a request could not offer gzip
+// because no block was left for the inflater, the usual first casualty of
+// fragmentation.
+//
+// Environment (optional):
+//   SOAK_HOURS=n   virtual hours to run, 12 by default
+
+#include <Arduino.h>
+#include <unity.h>
+
+#include <algorithm>
+#include <map>
+#include <stdlib.h>
+#include <string>
+#include <vector>
+
+#include "espn_standin.h"
+#include "host_heap.h"
+#include "host_sched.h"
+#include "host_time.h"
+
+void setup();
+void loop();
+
+namespace {
+
+// Thursday 2026-02-12, 12:00 UTC: inside the tournament window.
+const time_t kBootEpoch = 1770897600;
+const uint32_t kLeadSec = 4 * 3600;
+// Boot itself (Wi-Fi, caches, first render) is not part of the steady state.
+const uint64_t kWarmupUs = 10ULL * 60 * 1000000;
+
+struct Phase {
+  size_t minFree = SIZE_MAX;
+  size_t minLargest = SIZE_MAX;
+  uint32_t samples = 0;
+};
+
+std::map<std::string, Phase> sPhases;
+std::vector<std::string> sOrder;
+HostHeap::Counters sAtWarmup;
+size_t sPollsAtWarmup = 0;
+uint32_t sGzipAtWarmup = 0;
+
+uint32_t soakHours() {
+  const char *v = getenv("SOAK_HOURS");
+  const int hours = v ? atoi(v) : 0;
+  return hours > 0 ? (uint32_t)hours : 12;
+}
+
+void sample() {
+  const uint64_t now = HostSched::nowUs();
+  if (now < kWarmupUs) return;
+  const std::string phase = EspnStandin::phaseAt(now);
+  if (!sPhases.count(phase)) sOrder.push_back(phase);
+  Phase &p = sPhases[phase];
+  p.minFree = std::min(p.minFree, HostHeap::freeBytes());
+  p.minLargest = std::min(p.minLargest, HostHeap::largestFreeBlock());
+  p.samples++;
+}
+
+}  // namespace
+
+void setUp() {}
+void tearDown() {}
+
+static void test_soak() {
+  EspnStandin::Options options;
+  options.leadSec = kLeadSec;
+  options.chunked = true;
+  options.gzip = true;
+  HostTime::setWallClock(kBootEpoch);
+  TEST_ASSERT_TRUE_MESSAGE(EspnStandin::start(options), "stand-in did not start");
+
+  Serial.setEcho(false);
+  setup();
+  const uint64_t until = (uint64_t)soakHours() * 3600 * 1000000;
+  bool warm = false;
+  while (HostSched::nowUs() < until) {
+    loop();
+    if (!warm && HostSched::nowUs() >= kWarmupUs) {
+      warm = true;
+      HostHeap::resetMinFree();
+      sAtWarmup = HostHeap::counters();
+      sPollsAtWarmup = EspnStandin::session().scoreboardUs.size() + EspnStandin::session().summaryUs.size();
+      sGzipAtWarmup = EspnStandin::session().gzipAccepted;
+    }
+    sample();
+  }
+
+  const HostHeap::Counters end = HostHeap::counters();
+  const size_t polls =
+      EspnStandin::session().scoreboardUs.size() + EspnStandin::session().summaryUs.size() - sPollsAtWarmup;
+  printf("\n--- %u h soak, %u KB heap ---\n", (unsigned)soakHours(), (unsigned)(HostHeap::capacity() / 1024));
+  printf("phase  samples  high-water  min largest block\n");
+  for (const std::string &name : sOrder) {
+    const Phase &p = sPhases[name];
+    printf("%-5s %8u %9u B %15u B\n", name.empty() ? "-" : name.c_str(), (unsigned)p.samples,
+           (unsigned)(HostHeap::capacity() - p.minFree), (unsigned)p.minLargest);
+  }
+  printf("after warm-up: high-water %u B, %u requests, %.1f allocs and %.1f frees per request\n",
+         (unsigned)(HostHeap::capacity() - HostHeap::minFreeBytes()), (unsigned)polls,
+         polls ? (double)(end.allocs - sAtWarmup.allocs) / polls : 0.0,
+         polls ? (double)(end.frees - sAtWarmup.frees) / polls : 0.0);
+  printf("at the end: %u B free, largest block %u B, %u live blocks\n", (unsigned)HostHeap::freeBytes(),
+         (unsigned)HostHeap::largestFreeBlock(), (unsigned)HostHeap::liveBlocks());
+
+  const uint32_t gzipOffered = EspnStandin::session().gzipAccepted - sGzipAtWarmup;
+  printf("%u of %u requests offered gzip\n", (unsigned)gzipOffered, (unsigned)polls);
+
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(0, end.failed, "an allocation found no free block");
+  TEST_ASSERT_EQUAL_UINT32_MESSAGE(polls, gzipOffered, "no block left for the gzip inflater");
+}
+
+int main() {
+  UNITY_BEGIN();
+  RUN_TEST(test_soak);
+  return UNITY_END();
+}
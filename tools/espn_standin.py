@@ -0,0 +1,568 @@
+#!/usr/bin/env python3
+"""Local stand-in for the ESPN Olympic hockey API, so the firmware can be run without live ESPN.
+
+Serves /scoreboard and /summary on the LAN from a timeline - either a synthetic game generated on
+the fly (pre -> 1st/2nd/3rd periods with intermissions -> OT winner -> post) or a recorded
+fixture - with accelerated time, chunked and gzip bodies and ETags. It logs every request and, on
+exit, poll intervals and goal-detection delays for the session.
+
+This is the only definition of the synthetic game: the native tests replay it from a fixture this
+tool dumps (tools/pio_synth_fixture.py runs the dump for `pio test -e native`), and latency,
+truncation, error and outage injection live in their stand-in, test/host/espn_standin.cpp.
+
+Usage (PowerShell):
+  python tools/espn_standin.py synth --speed 20 --lead 90
+  python tools/espn_standin.py synth --dump fixtures/synth_game.jsonl --origin 1770897600
+  python tools/espn_standin.py record fixtures/live.jsonl --interval 15
+  python tools/espn_standin.py replay fixtures/live.jsonl --speed 10 --chunked --gzip
+
+Point the firmware at it in include/config.h (use your PC's LAN address):
+  #define ESPN_BASE_URL "http://192.168.1.50:8080/apis/site/v2/sports/hockey/olympics-mens-ice-hockey"
+
+Fixture format: JSON lines. The first line is {"meta": {"origin": <epoch at t=0>}}; every other
+line is {"t": <seconds since origin>, "kind": "scoreboard"|"summary", "event": <id or null>,
+"body": <response JSON>}. A request at timeline position T gets the latest frame with t <= T.
+A dumped synthetic game adds "start" (puck drop, epoch) and "phases" ([name, seconds after puck
+drop] for "P1", "I1", ... "OT" and "post") to the meta line, and has a frame wherever a body
+changes on the --dump-step grid plus one at every goal and phase change.
+"""
+
+from __future__ import annotations
+
+import argparse
+import bisect
+import gzip
+import hashlib
+import json
+import sys
+import threading
+import time
+import urllib.error
+import urllib.request
+from datetime import datetime, timedelta, timezone
+from http.server import BaseHTTPRequestHandler, ThreadingHTTPServer
+from typing import Dict, List, Optional, Tuple
+from urllib.parse import parse_qs, urlparse
+
+ESPN_BASE = "https://site.api.espn.com/apis/site/v2/sports/hockey/olympics-mens-ice-hockey"
+DEFAULT_START = "20260101"
+DEFAULT_END = "20260222"
+ESPN_DAY_OFFSET = timedelta(hours=-5)  # ESPN buckets schedule days in US Eastern time
+
+LOGO = "https://a.espncdn.com/i/teamlogos/countries/500/{}.png"
+TEAM_NAMES = {
+    "CAN": "Canada", "SWE": "Sweden", "ITA": "Italy", "FIN": "Finland",
+    "USA": "United States", "SUI": "Switzerland", "CZE": "Czechia", "GER": "Germany",
+}
+GROUP_A = "Men's Preliminary Round - Group A"
+VENUE = ("Milano Santagiulia Ice Hockey Arena", "Milan")
+
+# Synthetic game: (kind, period, length in game seconds). "P" = play, "I" = intermission.
+SEGMENTS = [("P", 1, 1200), ("I", 1, 1080), ("P", 2, 1200), ("I", 2, 1080),
+            ("P", 3, 1200), ("I", 3, 180), ("P", 4, 150)]
+# (period, seconds into period, team, scorer, strength)
+GOALS = [
+    (1, 312, "CAN", "Connor McDavid", "Even Strength"),
+    (2, 760, "SWE", "William Nylander", "Power Play"),
+    (3, 480, "CAN", "Sidney Crosby", "Even Strength"),
+    (3, 1150, "SWE", "Elias Pettersson", "Even Strength"),
+    (4, 150, "CAN", "Nathan MacKinnon", "Even Strength"),
+]
+SHOT_EVERY = 75  # game seconds between synthetic shot plays (per team, offset)
+
+
+def iso(epoch: float) -> str:
+    return datetime.fromtimestamp(epoch, timezone.utc).strftime("%Y-%m-%dT%H:%MZ")
+
+
+def espn_day(epoch: float) -> str:
+    return (datetime.fromtimestamp(epoch, timezone.utc) + ESPN_DAY_OFFSET).strftime("%Y%m%d")
+
+
+def ordinal(n: int) -> str:
+    return {1: "1st", 2: "2nd", 3: "3rd"}.get(n, f"{n}th")
+
+
+def clock_str(seconds: int) -> str:
+    seconds = max(0, seconds)
+    return f"{seconds // 60}:{seconds % 60:02d}"
+
+
+def event_json(ev_id: str, start: float, home: str, away: str, hs: int, as_: int, state: str,
+               detail: str, clock: str = "0:00", period: int = 0, headline: str = GROUP_A) -> dict:
+    def competitor(abbr: str, side: str, score: int) -> dict:
+        return {"homeAway": side, "score": str(score),
+                "team": {"abbreviation": abbr, "displayName": TEAM_NAMES.get(abbr, abbr),
+                         "logo": LOGO.format(abbr.lower())}}
+
+    return {
+        "id": ev_id,
+        "date": iso(start),
+        "competitions": [{
+            "status": {"displayClock": clock, "period": period,
+                       "type": {"state": state, "completed": state == "post",
+                                "detail": detail, "shortDetail": detail}},
+            "notes": [{"headline": headline}],
+            "venue": {"fullName": VENUE[0], "address": {"city": VENUE[1]}},
+            "competitors": [competitor(home, "home", hs), competitor(away, "away", as_)],
+        }],
+    }
+
+
+# --------------------------------------------------------------------------------------------
+# Sources: map a request at real time `now` to a response body.
+# --------------------------------------------------------------------------------------------
+
+
+def local_start(epoch: float) -> str:
+    # UTC, so a dump is the same wherever it is made.
+    return datetime.fromtimestamp(epoch, timezone.utc).strftime("%a, %b %d at %I:%M %p")
+
+
+class SynthSource:
+    """A CAN-SWE game starting `lead` real seconds after `origin` (default: launch), played `speed`
+    times faster."""
+
+    GAME_ID = "401900001"
+
+    def __init__(self, speed: float, lead: float, origin: Optional[float] = None) -> None:
+        self.speed = speed
+        self.t0 = time.time() if origin is None else origin
+        self.start = self.t0 + lead
+        self.game_len = sum(length for _, _, length in SEGMENTS)
+
+    def game_time(self, now: float) -> float:
+        return (now - self.start) * self.speed
+
+    def real_time(self, game_seconds: float) -> float:
+        return self.start + game_seconds / self.speed
+
+    def goal_offsets(self) -> List[Tuple[float, int, tuple]]:
+        """(game seconds since puck drop, play id, goal) for every scripted goal."""
+        out = []
+        for i, goal in enumerate(GOALS):
+            period, into, *_ = goal
+            offset = 0
+            for kind, p, length in SEGMENTS:
+                if kind == "P" and p == period:
+                    out.append((offset + into, 9000 + i, goal))
+                    break
+                offset += length
+        return out
+
+    def goal_times(self) -> Dict[str, float]:
+        return {str(pid): self.real_time(t) for t, pid, _ in self.goal_offsets()}
+
+    def _status(self, gt: float) -> Tuple[str, str, str, int]:
+        """(state, detail, clock, period) at game time `gt`."""
+        if gt < 0:
+            return "pre", local_start(self.start), "0:00", 0
+        if gt >= self.game_len:
+            return "post", "Final/OT", "0:00", 4
+        offset = 0
+        for kind, period, length in SEGMENTS:
+            if gt < offset + length:
+                if kind == "I":
+                    return "in", f"End of {ordinal(period)} Period", "0:00", period
+                left = int(length - (gt - offset)) if period < 4 else int(300 - (gt - offset))
+                label = "OT" if period == 4 else f"{ordinal(period)} Period"
+                return "in", f"{clock_str(left)} - {label}", clock_str(left), period
+            offset += length
+        return "post", "Final/OT", "0:00", 4
+
+    def _score(self, gt: float) -> Tuple[int, int]:
+        home = sum(1 for t, _, g in self.goal_offsets() if t <= gt and g[2] == "CAN")
+        away = sum(1 for t, _, g in self.goal_offsets() if t <= gt and g[2] == "SWE")
+        return home, away
+
+    def scoreboard(self, now: float) -> dict:
+        gt = self.game_time(now)
+        state, detail, clock, period = self._status(gt)
+        hs, as_ = self._score(gt)
+        day = 86400
+        return {"events": [
+            event_json("401900000", self.start - 2 * day, "ITA", "CAN", 1, 4, "post", "Final", period=3),
+            event_json("401900002", self.start - 2 * day + 4 * 3600, "SWE", "ITA", 3, 2, "post", "Final/OT", period=4),
+            event_json(self.GAME_ID, self.start, "CAN", "SWE", hs, as_, state, detail, clock, period),
+            event_json("401900003", self.start + day, "FIN", "CAN", 0, 0, "pre", local_start(self.start + day)),
+            event_json("401900004", self.start + day + 4 * 3600, "USA", "SUI", 0, 0, "pre", "Scheduled",
+                       headline="Men's Preliminary Round - Group C"),
+        ]}
+
+    def summary(self, now: float, event: str) -> Optional[dict]:
+        if event != self.GAME_ID:
+            return None
+        gt = self.game_time(now)
+        state, detail, clock, period = self._status(gt)
+        plays = []
+        shots = {"CAN": 0, "SWE": 0}
+        for n in range(int(max(0.0, min(gt, self.game_len)) // SHOT_EVERY)):
+            team = "CAN" if n % 2 == 0 else "SWE"
+            shots[team] += 1
+            plays.append({"id": str(1000 + n), "text": f"Shot on goal by {TEAM_NAMES[team]}",
+                          "scoringPlay": False, "team": {"abbreviation": team}, "type": {"text": "Shot"}})
+        for t, pid, (_, _, team, scorer, strength) in self.goal_offsets():
+            if t <= gt:
+                shots[team] += 1
+                plays.append({"id": str(pid), "text": f"{scorer} Goal ({strength})", "scoringPlay": True,
+                              "team": {"abbreviation": team}, "type": {"text": "Goal"},
+                              "participants": [{"athlete": {"displayName": scorer}}]})
+        plays.sort(key=lambda p: int(p["id"]) % 9000 if p["scoringPlay"] else int(p["id"]))
+        minutes = max(0, int(gt // 60))
+
+        def team_stats(abbr: str, fo: int) -> dict:
+            return {"team": {"abbreviation": abbr}, "statistics": [
+                {"name": "shotsTotal", "displayName": "Shots", "displayValue": str(shots[abbr])},
+                {"name": "hits", "displayName": "Hits", "displayValue": str(minutes // 3)},
+                {"name": "faceoffPercent", "displayName": "Faceoff %", "displayValue": str(fo)},
+            ]}
+
+        return {
+            "header": {"competitions": [{"status": {"displayClock": clock, "period": period,
+                                                    "type": {"state": state, "detail": detail}}}]},
+            "boxscore": {"teams": [team_stats("SWE", 48), team_stats("CAN", 52)]},
+            "plays": plays,
+        }
+
+    def label(self, now: float) -> str:
+        gt = self.game_time(now)
+        state, detail, _, _ = self._status(gt)
+        return f"[{state} {detail}]" if state != "pre" else f"[pre T-{int(-gt / self.speed)}s]"
+
+    def phases(self) -> List[Tuple[str, int]]:
+        """(name, game seconds since puck drop) of each segment, then "post"."""
+        out, offset = [], 0
+        for kind, period, length in SEGMENTS:
+            out.append(("OT" if period == 4 else f"{kind}{period}", offset))
+            offset += length
+        return out + [("post", offset)]
+
+    def frames(self, step: float) -> List[dict]:
+        """Samples the synthetic game into fixture frames (for --dump): every `step` seconds plus
+        the instant of each goal and phase change, keeping only frames whose body changed."""
+        out: List[dict] = [{"meta": {"origin": self.t0, "start": self.start,
+                                     "phases": [list(p) for p in self.phases()]}}]
+        end = self.real_time(self.game_len) + 60
+        times = {self.t0 + i * step for i in range(int((end - self.t0) // step) + 1)}
+        times.update(self.real_time(t) for t, _, _ in self.goal_offsets())
+        times.update(self.real_time(t) for _, t in self.phases())
+        last: Dict[str, str] = {}
+        for now in sorted(times):
+            bodies = [("scoreboard", None, self.scoreboard(now))]
+            if now >= self.start:
+                bodies.append(("summary", self.GAME_ID, self.summary(now, self.GAME_ID)))
+            for kind, event, body in bodies:
+                text = json.dumps(body, separators=(",", ":"))
+                if last.get(kind) == text:
+                    continue
+                last[kind] = text
+                out.append({"t": round(now - self.t0, 2), "kind": kind, "event": event, "body": body})
+        return out
+
+
+class FixtureSource:
+    """Replays a recorded JSONL timeline `speed` times faster, shifting event dates to match."""
+
+    def __init__(self, path: str, speed: float) -> None:
+        self.speed = speed
+        self.t0 = time.time()
+        self.origin = self.t0
+        self.frames: Dict[Tuple[str, Optional[str]], List[Tuple[float, dict]]] = {}
+        with open(path, "r", encoding="utf-8") as f:
+            for line in f:
+                if not line.strip():
+                    continue
+                rec = json.loads(line)
+                if "meta" in rec:
+                    self.origin = rec["meta"].get("origin", self.origin)
+                    continue
+                key = (rec["kind"], rec.get("event"))
+                self.frames.setdefault(key, []).append((float(rec["t"]), rec["body"]))
+        for frames in self.frames.values():
+            frames.sort(key=lambda fr: fr[0])
+        if not self.frames:
+            raise SystemExit(f"{path}: no frames")
+
+    def timeline(self, now: float) -> float:
+        return (now - self.t0) * self.speed
+
+    def real_time(self, t: float) -> float:
+        return self.t0 + t / self.speed
+
+    def _rebase(self, epoch: float) -> float:
+        return self.t0 + (epoch - self.origin) / self.speed
+
+    def _frame(self, key: Tuple[str, Optional[str]], now: float) -> Optional[dict]:
+        frames = self.frames.get(key)
+        if not frames:
+            return None
+        i = bisect.bisect_right([t for t, _ in frames], self.timeline(now)) - 1
+        return frames[max(i, 0)][1]
+
+    def scoreboard(self, now: float) -> dict:
+        body = json.loads(json.dumps(self._frame(("scoreboard", None), now) or {"events": []}))
+        for ev in body.get("events", []):
+            try:
+                start = datetime.strptime(ev["date"], "%Y-%m-%dT%H:%MZ").replace(tzinfo=timezone.utc)
+            except (KeyError, ValueError):
+                continue
+            ev["date"] = iso(self._rebase(start.timestamp()))
+        return body
+
+    def summary(self, now: float, event: str) -> Optional[dict]:
+        return self._frame(("summary", event), now)
+
+    def goal_times(self) -> Dict[str, float]:
+        seen: Dict[str, float] = {}
+        for (kind, _), frames in self.frames.items():
+            if kind != "summary":
+                continue
+            for t, body in frames:
+                for play in body.get("plays", []):
+                    if play.get("scoringPlay") and str(play.get("id")) not in seen:
+                        seen[str(play.get("id"))] = self.real_time(t)
+        return seen
+
+    def label(self, now: float) -> str:
+        return f"[t={self.timeline(now):.0f}s]"
+
+
+# --------------------------------------------------------------------------------------------
+# HTTP server.
+# --------------------------------------------------------------------------------------------
+
+
+class Session:
+    def __init__(self, source, args: argparse.Namespace) -> None:
+        self.source = source
+        self.args = args
+        self.lock = threading.Lock()
+        self.goal_visible = source.goal_times()
+        self.goal_served: Dict[str, float] = {}
+        self.poll_times: Dict[str, List[float]] = {"scoreboard": [], "summary": []}
+        self.bytes_out = 0
+        self.statuses: Dict[int, int] = {}
+
+    def note(self, kind: str, status: int, body: Optional[dict], now: float) -> None:
+        with self.lock:
+            self.statuses[status] = self.statuses.get(status, 0) + 1
+            if kind in self.poll_times:
+                self.poll_times[kind].append(now)
+            if kind == "summary" and body:
+                for play in body.get("plays", []):
+                    pid = str(play.get("id"))
+                    if play.get("scoringPlay") and pid not in self.goal_served:
+                        self.goal_served[pid] = now
+                        visible = self.goal_visible.get(pid, now)
+                        print(f"  goal {pid} ({play.get('text', '')}) served {now - visible:.1f}s after it happened")
+
+    def report(self) -> None:
+        print("\n--- session ---")
+        for kind, times in self.poll_times.items():
+            if len(times) > 1:
+                gaps = [b - a for a, b in zip(times, times[1:])]
+                print(f"{kind}: {len(times)} requests, interval avg {sum(gaps) / len(gaps):.1f}s "
+                      f"min {min(gaps):.1f}s max {max(gaps):.1f}s")
+            else:
+                print(f"{kind}: {len(times)} requests")
+        print(f"statuses: {dict(sorted(self.statuses.items()))}, body bytes sent: {self.bytes_out}")
+        for pid, visible in sorted(self.goal_visible.items(), key=lambda kv: kv[1]):
+            served = self.goal_served.get(pid)
+            delay = f"{served - visible:.1f}s" if served else "never served"
+            print(f"goal {pid}: detection delay {delay}")
+
+
+def make_handler(session: Session):
+    args = session.args
+
+    class Handler(BaseHTTPRequestHandler):
+        protocol_version = "HTTP/1.1"
+
+        def log_message(self, fmt, *a):  # noqa: D401 - quiet default logging
+            pass
+
+        def do_GET(self) -> None:  # noqa: N802
+            now = time.time()
+            url = urlparse(self.path)
+            query = parse_qs(url.query)
+            kind = url.path.rsplit("/", 1)[-1]
+            label = session.source.label(now)
+            target = kind + ("?" + url.query if url.query else "")
+
+            body: Optional[dict] = None
+            if kind == "scoreboard":
+                body = session.source.scoreboard(now)
+                dates = (query.get("dates") or [""])[0]
+                if dates:
+                    lo, _, hi = dates.partition("-")
+                    hi = hi or lo
+                    body["events"] = [ev for ev in body.get("events", [])
+                                      if lo <= espn_day(datetime.strptime(ev["date"], "%Y-%m-%dT%H:%MZ")
+                                                        .replace(tzinfo=timezone.utc).timestamp()) <= hi]
+            elif kind == "summary":
+                body = session.source.summary(now, (query.get("event") or [""])[0])
+
+            if body is None:
+                self.send_plain(404, "not found")
+                session.note(kind, 404, None, now)
+                return
+            payload = json.dumps(body, separators=(",", ":")).encode("utf-8")
+            etag = '"' + hashlib.sha1(payload).hexdigest()[:16] + '"'
+            if not args.no_etag and self.headers.get("If-None-Match") == etag:
+                self.send_response(304)
+                self.send_header("ETag", etag)
+                self.send_header("Content-Length", "0")
+                self.end_headers()
+                print(f"{label} GET {target} -> 304")
+                session.note(kind, 304, None, now)
+                return
+
+            encoding = ""
+            if args.gzip and "gzip" in (self.headers.get("Accept-Encoding") or ""):
+                payload = gzip.compress(payload)
+                encoding = "gzip"
+            self.send_response(200)
+            self.send_header("Content-Type", "application/json")
+            if not args.no_etag:
+                self.send_header("ETag", etag)
+            if encoding:
+                self.send_header("Content-Encoding", encoding)
+            if args.chunked:
+                self.send_header("Transfer-Encoding", "chunked")
+            else:
+                self.send_header("Content-Length", str(len(payload)))
+            self.end_headers()
+
+            if args.chunked:
+                for i in range(0, len(payload), args.chunk_size):
+                    piece = payload[i:i + args.chunk_size]
+                    self.wfile.write(f"{len(piece):x};standin=1\r\n".encode() + piece + b"\r\n")
+                self.wfile.write(b"0\r\nX-Standin-Trailer: 1\r\n\r\n")
+            else:
+                self.wfile.write(payload)
+            self.wfile.flush()
+
+            with session.lock:
+                session.bytes_out += len(payload)
+            print(f"{label} GET {target} -> 200 {len(payload)}B"
+                  f"{' ' + encoding if encoding else ''}{' chunked' if args.chunked else ''}")
+            session.note(kind, 200, body, now)
+
+        def send_plain(self, status: int, text: str) -> None:
+            data = text.encode()
+            self.send_response(status)
+            self.send_header("Content-Type", "text/plain")
+            self.send_header("Content-Length", str(len(data)))
+            self.end_headers()
+            self.wfile.write(data)
+
+    return Handler
+
+
+def serve(source, args: argparse.Namespace) -> int:
+    session = Session(source, args)
+    server = ThreadingHTTPServer((args.host, args.port), make_handler(session))
+    print(f"Stand-in listening on http://{args.host}:{args.port}/apis/site/v2/sports/hockey/olympics-mens-ice-hockey")
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+    finally:
+        server.server_close()
+        session.report()
+    return 0
+
+
+# --------------------------------------------------------------------------------------------
+# Recording live ESPN into a fixture.
+# --------------------------------------------------------------------------------------------
+
+
+def fetch_json(url: str) -> dict:
+    req = urllib.request.Request(url, headers={"User-Agent": "espn-standin/1.0"})
+    with urllib.request.urlopen(req, timeout=30) as resp:
+        return json.loads(resp.read().decode("utf-8"))
+
+
+def record(args: argparse.Namespace) -> int:
+    origin = time.time()
+    scoreboard_url = f"{ESPN_BASE}/scoreboard?dates={args.start}-{args.end}"
+    with open(args.fixture, "w", encoding="utf-8") as out:
+        out.write(json.dumps({"meta": {"origin": origin}}) + "\n")
+        print(f"Recording into {args.fixture} every {args.interval}s, Ctrl-C to stop")
+        try:
+            while True:
+                t = round(time.time() - origin, 2)
+                try:
+                    board = fetch_json(scoreboard_url)
+                except (urllib.error.URLError, ValueError) as exc:
+                    print(f"  ! scoreboard: {exc}")
+                    board = None
+                if board is not None:
+                    out.write(json.dumps({"t": t, "kind": "scoreboard", "event": None, "body": board}) + "\n")
+                    live = [ev["id"] for ev in board.get("events", [])
+                            if ev.get("competitions", [{}])[0].get("status", {}).get("type", {}).get("state") == "in"]
+                    for ev_id in args.event or live:
+                        try:
+                            summary = fetch_json(f"{ESPN_BASE}/summary?event={ev_id}")
+                        except (urllib.error.URLError, ValueError) as exc:
+                            print(f"  ! summary {ev_id}: {exc}")
+                            continue
+                        out.write(json.dumps({"t": t, "kind": "summary", "event": ev_id, "body": summary}) + "\n")
+                    out.flush()
+                    print(f"t={t:.0f}s scoreboard + {len(args.event or live)} summaries")
+                time.sleep(args.interval)
+        except KeyboardInterrupt:
+            pass
+    return 0
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description="Local ESPN stand-in server and fixture recorder")
+    sub = parser.add_subparsers(dest="cmd", required=True)
+
+    def add_serve_args(p: argparse.ArgumentParser) -> None:
+        p.add_argument("--host", default="0.0.0.0")
+        p.add_argument("--port", type=int, default=8080)
+        p.add_argument("--speed", type=float, default=10.0, help="timeline seconds per real second")
+        p.add_argument("--chunked", action="store_true", help="chunked transfer encoding with extensions/trailer")
+        p.add_argument("--chunk-size", type=int, default=1024)
+        p.add_argument("--gzip", action="store_true", help="gzip bodies when the client accepts it")
+        p.add_argument("--no-etag", action="store_true", help="never send ETag / 304")
+
+    p_synth = sub.add_parser("synth", help="serve a synthetic CAN-SWE game")
+    add_serve_args(p_synth)
+    p_synth.add_argument("--lead", type=float, default=60.0, help="real seconds until puck drop")
+    p_synth.add_argument("--dump", metavar="FILE", help="write the game as a fixture instead of serving")
+    p_synth.add_argument("--dump-step", type=float, default=5.0, help="game seconds between dumped frames")
+    p_synth.add_argument("--origin", type=float, help="epoch of t=0 in the dump (default: now)")
+
+    p_replay = sub.add_parser("replay", help="serve a recorded fixture")
+    add_serve_args(p_replay)
+    p_replay.add_argument("fixture")
+
+    p_record = sub.add_parser("record", help="record live ESPN into a fixture")
+    p_record.add_argument("fixture")
+    p_record.add_argument("--interval", type=float, default=15.0)
+    p_record.add_argument("--start", default=DEFAULT_START)
+    p_record.add_argument("--end", default=DEFAULT_END)
+    p_record.add_argument("--event", action="append", help="summary event id to record (default: live games)")
+
+    args = parser.parse_args()
+    if args.cmd == "record":
+        return record(args)
+    if args.cmd == "synth":
+        if args.dump:
+            # A fixture is a timeline in game seconds; whoever replays it sets the speed.
+            frames = SynthSource(1.0, args.lead, args.origin).frames(args.dump_step)
+            with open(args.dump, "w", encoding="utf-8", newline="\n") as f:
+                for frame in frames:
+                    f.write(json.dumps(frame, separators=(",", ":")) + "\n")
+            print(f"Wrote {args.dump}: {len(frames) - 1} frames")
+            return 0
+        return serve(SynthSource(args.speed, args.lead), args)
+    return serve(FixtureSource(args.fixture, args.speed), args)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
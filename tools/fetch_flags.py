@@ -1,9 +1,11 @@
 #!/usr/bin/env python3
-"""Fetch Olympic hockey country flags from ESPN into data/flags for SPIFFS upload.
+"""Fetch Olympic hockey country flags from ESPN into data/flags for SPIFFS upload,
+and pack them into an RGB565 atlas for the `flags` flash partition.
 
 Usage (PowerShell):
   python tools/fetch_flags.py
   python tools/fetch_flags.py --start 20260101 --end 20260222 --out data/flags
+  python tools/fetch_flags.py --pack-only
 """
 
 from __future__ import annotations
@@ -13,10 +15,12 @@ import json
 import os
 import re
 import shutil
+import struct
 import sys
 import urllib.error
 import urllib.request
-from typing import Dict
+import zlib
+from typing import Dict, List, Tuple
 
 SCOREBOARD_URL = (
     "https://site.api.espn.com/apis/site/v2/sports/hockey/"
@@ -27,6 +31,15 @@ DEFAULT_START = "20260101"
 DEFAULT_END = "20260222"
 SIZES = (56, 64, 96)
 
+# Must match partitions.csv and src/flag_atlas.cpp.
+ATLAS_PARTITION_OFFSET = 0x270000
+ATLAS_PARTITION_SIZE = 0x20000
+ATLAS_MAGIC = b"FLA1"
+ATLAS_VERSION = 1
+ATLAS_HEADER = struct.Struct("<4sHH")          # magic, version, entry count
+ATLAS_ENTRY = struct.Struct("<4sHHHHII")      # code, size, w, h, flags, offset, bytes
+ATLAS_FLAG_RLE = 0x0001
+
 
 def fetch_json(url: str) -> dict:
     req = urllib.request.Request(url, headers={"User-Agent": "flag-fetcher/1.0"})
@@ -73,13 +86,154 @@ def collect_flags(payload: dict) -> Dict[str, str]:
     return out
 
 
+def decode_png(path: str) -> Tuple[int, int, List[Tuple[int, int, int, int]]]:
+    """Minimal decoder for the 8-bit, non-interlaced PNGs ESPN serves. Returns RGBA rows."""
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG")
+
+    pos = 8
+    idat = b""
+    palette: List[Tuple[int, int, int]] = []
+    trns = b""
+    width = height = depth = colour = interlace = 0
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            width, height, depth, colour, _, _, interlace = struct.unpack(">IIBBBBB", body)
+        elif kind == b"PLTE":
+            palette = [tuple(body[i:i + 3]) for i in range(0, len(body), 3)]
+        elif kind == b"tRNS":
+            trns = body
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}.get(colour)
+    if depth != 8 or interlace or channels is None:
+        raise ValueError(f"unsupported PNG (depth {depth}, colour type {colour}, interlace {interlace})")
+
+    raw = zlib.decompress(idat)
+    stride = width * channels
+    prev = bytearray(stride)
+    pixels: List[Tuple[int, int, int, int]] = []
+    for y in range(height):
+        filt = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - channels] if i >= channels else 0
+            b = prev[i]
+            c = prev[i - channels] if i >= channels else 0
+            if filt == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif filt == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif filt == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif filt == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        prev = line
+        for x in range(width):
+            px = line[x * channels:(x + 1) * channels]
+            if colour == 0:
+                pixels.append((px[0], px[0], px[0], 255))
+            elif colour == 2:
+                pixels.append((px[0], px[1], px[2], 255))
+            elif colour == 3:
+                r, g, b = palette[px[0]]
+                pixels.append((r, g, b, trns[px[0]] if px[0] < len(trns) else 255))
+            elif colour == 4:
+                pixels.append((px[0], px[0], px[0], px[1]))
+            else:
+                pixels.append((px[0], px[1], px[2], px[3]))
+    return width, height, pixels
+
+
+def to_rgb565(r: int, g: int, b: int, a: int) -> int:
+    # Alpha is blended onto black, as PNGdec does for the on-device decode.
+    r, g, b = r * a // 255, g * a // 255, b * a // 255
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)
+
+
+def encode_flag(colours: List[int]) -> Tuple[int, bytes]:
+    """Same choice as FlagCache: {count, colour} runs when smaller, else raw big-endian pixels."""
+    runs: List[Tuple[int, int]] = []
+    for c in colours:
+        if runs and runs[-1][1] == c and runs[-1][0] < 0xFFFF:
+            runs[-1] = (runs[-1][0] + 1, c)
+        else:
+            runs.append((1, c))
+    if len(runs) * 2 < len(colours):
+        return ATLAS_FLAG_RLE, b"".join(struct.pack("<HH", n, c) for n, c in runs)
+    return 0, b"".join(struct.pack(">H", c) for c in colours)
+
+
+def pack_atlas(flags_root: str, atlas_path: str) -> bool:
+    items = []
+    for size in SIZES:
+        folder = os.path.join(flags_root, str(size))
+        if not os.path.isdir(folder):
+            continue
+        for name in sorted(os.listdir(folder)):
+            abbr, ext = os.path.splitext(name)
+            if ext.lower() != ".png" or not 1 <= len(abbr) <= 3:
+                continue
+            try:
+                w, h, pixels = decode_png(os.path.join(folder, name))
+            except (ValueError, zlib.error) as exc:
+                print(f"  ! {size}/{name}: {exc}")
+                continue
+            flags, blob = encode_flag([to_rgb565(*p) for p in pixels])
+            items.append((abbr.upper(), size, w, h, flags, blob))
+
+    if not items:
+        print(f"No flags to pack under {flags_root}")
+        return False
+
+    items.sort(key=lambda it: (it[0], it[1]))
+    offset = ATLAS_HEADER.size + ATLAS_ENTRY.size * len(items)
+    table = bytearray(ATLAS_HEADER.pack(ATLAS_MAGIC, ATLAS_VERSION, len(items)))
+    blobs = bytearray()
+    for abbr, size, w, h, flags, blob in items:
+        offset += (-offset) % 4  # keep pixel data word-aligned in flash
+        pad = offset - (ATLAS_HEADER.size + ATLAS_ENTRY.size * len(items) + len(blobs))
+        blobs += b"\x00" * pad
+        table += ATLAS_ENTRY.pack(abbr.encode("ascii"), size, w, h, flags, offset, len(blob))
+        blobs += blob
+        offset += len(blob)
+
+    image = bytes(table + blobs)
+    if len(image) > ATLAS_PARTITION_SIZE:
+        print(f"Atlas is {len(image)} bytes, larger than the {ATLAS_PARTITION_SIZE}-byte flags partition")
+        return False
+
+    with open(atlas_path, "wb") as f:
+        f.write(image)
+    rle = sum(1 for it in items if it[4] & ATLAS_FLAG_RLE)
+    print(f"Packed {len(items)} flags ({rle} RLE) into {atlas_path}: {len(image)} bytes")
+    print(f"Flash with: esptool.py --chip esp32 write_flash 0x{ATLAS_PARTITION_OFFSET:X} {atlas_path}")
+    return True
+
+
 def main() -> int:
     parser = argparse.ArgumentParser(description="Fetch ESPN Olympic country flags into data/flags")
     parser.add_argument("--start", default=DEFAULT_START, help="start date YYYYMMDD")
     parser.add_argument("--end", default=DEFAULT_END, help="end date YYYYMMDD")
     parser.add_argument("--out", default=os.path.join("data", "flags"), help="output root folder")
+    parser.add_argument("--atlas", default="flags_atlas.bin", help="RGB565 atlas image for the flags partition")
+    parser.add_argument("--pack-only", action="store_true", help="skip the download, just pack --out into --atlas")
     args = parser.parse_args()
 
+    if args.pack_only:
+        return 0 if pack_atlas(args.out, args.atlas) else 1
+
     url = SCOREBOARD_URL.format(start=args.start, end=args.end)
     print(f"Fetching schedule: {url}")
 
@@ -115,9 +269,10 @@ def main() -> int:
 
     print(f"Done. Downloaded {ok_count} sized flag files into {args.out}")
     print("Upload to SPIFFS with: pio run -e esp32-cyd-sdfix -t uploadfs")
+    pack_atlas(args.out, args.atlas)
     return 0
 
 
 if __name__ == "__main__":
-    sys.exit(main())
-
+    sys.exit(main())
+
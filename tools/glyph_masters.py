@@ -0,0 +1,114 @@
+#!/usr/bin/env python3
+"""Generate src/glyph_masters.h: anti-aliased masters for the firmware's glyph atlas.
+
+GlyphAtlas draws scores, the game clock and the countdown from 4-bit coverage masks. The masks
+start from these masters: the ink of each character, rendered from a TrueType font at 4x and
+box-filtered down to a digit height of MASTER_HEIGHT, so every edge pixel carries its real
+coverage. At boot each master is resampled into the ink box of the matching built-in font glyph,
+which keeps the fonts' cell widths and layout.
+
+Usage (PowerShell):
+  python tools/glyph_masters.py --ttf C:/Windows/Fonts/arial.ttf
+  python tools/glyph_masters.py --ttf /usr/share/fonts/truetype/lato/Lato-Regular.ttf --out src/glyph_masters.h
+"""
+
+from __future__ import annotations
+
+import argparse
+import os
+import sys
+from typing import List, Tuple
+
+from PIL import Image, ImageDraw, ImageFont
+
+# Everything a score, clock ("12:34  P2") or countdown ("2d 05:00", "--:--:--") draws; the space
+# has no ink and needs no master. Keep in step with kCharset in src/glyph_atlas.cpp.
+CHARSET = "0123456789:-dP"
+# Digit ink height of the masters, above the tallest built-in digit (font 6) so boot only scales down.
+MASTER_HEIGHT = 48
+SUPERSAMPLE = 4
+
+
+def font_for(ttf: str, digit_height: int) -> ImageFont.FreeTypeFont:
+    """Size at which the digits' ink is `digit_height` pixels tall."""
+    size = digit_height
+    while True:
+        font = ImageFont.truetype(ttf, size)
+        _, top, _, bottom = font.getbbox("0123456789", anchor="ls")
+        if bottom - top >= digit_height:
+            return font
+        size += 1
+
+
+def master(font: ImageFont.FreeTypeFont, ch: str) -> Tuple[int, int, List[int]]:
+    """Ink box of `ch` at 1/SUPERSAMPLE scale, as 0-15 coverage."""
+    left, top, right, bottom = font.getbbox(ch, anchor="ls")
+    image = Image.new("L", (right - left + 2, bottom - top + 2), 0)
+    ImageDraw.Draw(image).text((1 - left, 1 - top), ch, fill=255, font=font, anchor="ls")
+    box = image.getbbox()
+    image = image.crop(box)
+    w = max(1, round(image.width / SUPERSAMPLE))
+    h = max(1, round(image.height / SUPERSAMPLE))
+    small = image.resize((w, h), Image.BOX)
+    return w, h, [round(v * 15 / 255) for v in small.tobytes()]
+
+
+def pack(values: List[int]) -> List[int]:
+    out = []
+    for i in range(0, len(values), 2):
+        hi = values[i]
+        lo = values[i + 1] if i + 1 < len(values) else 0
+        out.append((hi << 4) | lo)
+    return out
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--ttf", required=True, help="TrueType font the masters are drawn from")
+    parser.add_argument("--out", default=os.path.join("src", "glyph_masters.h"))
+    args = parser.parse_args()
+
+    font = font_for(args.ttf, MASTER_HEIGHT * SUPERSAMPLE)
+    entries, data = [], []
+    for ch in CHARSET:
+        w, h, coverage = master(font, ch)
+        entries.append(f"  {{'{ch}', {w}, {h}, {len(data)}}},")
+        data.extend(pack(coverage))
+
+    lines = [
+        "#pragma once",
+        "",
+        "#include <Arduino.h>",
+        "",
+        f"// Generated by tools/glyph_masters.py from {os.path.basename(args.ttf)}; do not edit.",
+        f"// Ink of each character at a digit height of {MASTER_HEIGHT} px, 4-bit coverage, two",
+        "// pixels per byte, high nibble first; each master starts on a byte.",
+        "",
+        "namespace GlyphMasters {",
+        "",
+        "struct Master {",
+        "  char c;",
+        "  uint8_t w;",
+        "  uint8_t h;",
+        "  uint16_t offset;  // into kBits",
+        "};",
+        "",
+        f"static const uint8_t kCount = {len(CHARSET)};",
+        "static const Master kMasters[kCount] = {",
+        *entries,
+        "};",
+        "",
+        f"static const uint8_t kBits[{len(data)}] PROGMEM = {{",
+        *("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + "," for i in range(0, len(data), 16)),
+        "};",
+        "",
+        "}  // namespace GlyphMasters",
+    ]
+    with open(args.out, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print(f"wrote {args.out}: {len(CHARSET)} masters, {len(data)} B")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Generate test/host/host_fonts.h: 1-bit bitmap fonts for the native TFT_eSPI stand-in.
+
+The stand-in draws text for the render tests with these in place of TFT_eSPI's built-in fonts,
+at the same cell heights (GLCD 8, font 2 16, font 4 26, fonts 6 and 7 48, font 8 75) and with
+the same character sets, so layouts, elision and region sizes come out close to the panel's.
+Glyph shapes are from whatever TrueType font is given, so goldens are only comparable with goldens
+made from the same header. The fixed-width GLCD font is better drawn from a monospaced one.
+
+Usage (PowerShell):
+  python tools/host_font.py --ttf C:/Windows/Fonts/arialbd.ttf
+  python tools/host_font.py --ttf /usr/share/fonts/truetype/lato/Lato-Regular.ttf \
+      --mono-ttf /usr/share/fonts/truetype/source-code-pro/SourceCodePro-Regular.ttf
+"""
+
+from __future__ import annotations
+
+import argparse
+import os
+import sys
+from typing import List, Tuple
+
+from PIL import Image, ImageDraw, ImageFont
+
+ASCII = "".join(chr(c) for c in range(32, 127))
+# font id, cell height, characters drawn (others have zero width, as in TFT_eSPI), fixed width
+FONTS = (
+    (1, 8, ASCII, 6),
+    (2, 16, ASCII, 0),
+    (4, 26, ASCII, 0),
+    (6, 48, "0123456789:-.apm ", 0),
+    (7, 48, "0123456789:-. ", 0),
+    (8, 75, "0123456789:-. ", 0),
+)
+# Digit height as a share of the cell, about what the built-in fonts use.
+CAP_RATIO = 0.72
+# Coverage a pixel needs to be ink. Strokes of the 8-pixel GLCD cell are thinner
+# than a pixel, so it takes less.
+THRESHOLD = 128
+SMALL_THRESHOLD = 80
+
+
+def fit_font(ttf: str, height: int) -> ImageFont.FreeTypeFont:
+    """Largest size whose digits are at most CAP_RATIO of the cell and whose descenders still fit."""
+    size = height
+    while size > 4:
+        font = ImageFont.truetype(ttf, size)
+        top, bottom = digit_extent(font)
+        descent = font.getmetrics()[1]
+        if bottom - top <= round(height * CAP_RATIO) and bottom - top + descent <= height:
+            return font
+        size -= 1
+    return ImageFont.truetype(ttf, 4)
+
+
+def digit_extent(font: ImageFont.FreeTypeFont) -> Tuple[int, int]:
+    """Top and bottom of the digits' ink, relative to the text origin."""
+    left, top, right, bottom = font.getbbox("0123456789", anchor="ls")
+    return top, bottom
+
+
+def render(font: ImageFont.FreeTypeFont, ch: str, height: int, fixed: int) -> Tuple[int, List[int]]:
+    advance = fixed or max(1, int(round(font.getlength(ch))) + (1 if height > 8 else 0))
+    image = Image.new("L", (advance, height), 0)
+    top, bottom = digit_extent(font)
+    descent = font.getmetrics()[1]
+    # Baseline so that digits plus descenders sit centred in the cell.
+    baseline = (height - (bottom - top) - descent) // 2 + (bottom - top)
+    draw = ImageDraw.Draw(image)
+    x = 0 if not fixed else (fixed - font.getlength(ch)) / 2
+    draw.text((x, baseline), ch, fill=255, font=font, anchor="ls")
+    threshold = SMALL_THRESHOLD if height <= 8 else THRESHOLD
+    bits = []
+    for y in range(height):
+        for x in range(advance):
+            bits.append(1 if image.getpixel((x, y)) >= threshold else 0)
+    return advance, bits
+
+
+def pack(bits: List[int]) -> List[int]:
+    out = []
+    for i in range(0, len(bits), 8):
+        byte = 0
+        for j, b in enumerate(bits[i:i + 8]):
+            byte |= b << (7 - j)
+        out.append(byte)
+    return out
+
+
+def main() -> int:
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--ttf", required=True, help="TrueType font the glyphs are drawn from")
+    parser.add_argument("--mono-ttf", help="TrueType font for the fixed-width GLCD font (default: --ttf)")
+    parser.add_argument("--out", default=os.path.join("test", "host", "host_fonts.h"))
+    args = parser.parse_args()
+
+    mono_ttf = args.mono_ttf or args.ttf
+    sources = os.path.basename(args.ttf)
+    if mono_ttf != args.ttf:
+        sources += f" and {os.path.basename(mono_ttf)}"
+    lines = [
+        "#pragma once",
+        "",
+        "#include <stdint.h>",
+        "",
+        f"// Generated by tools/host_font.py from {sources}; do not edit.",
+        "// Glyph bitmaps are 1 bit per pixel, rows left to right, MSB first, packed",
+        "// across row boundaries.",
+        "",
+        "namespace HostFonts {",
+        "",
+        "struct Font {",
+        "  uint8_t id;",
+        "  uint8_t height;",
+        "  const uint8_t *widths;     // per character 32..126; 0 when not in the font",
+        "  const uint32_t *offsets;   // bit offset of each glyph in bits",
+        "  const uint8_t *bits;",
+        "};",
+        "",
+    ]
+    entries = []
+    for font_id, height, charset, fixed in FONTS:
+        font = fit_font(mono_ttf if fixed else args.ttf, height)
+        widths, offsets, bits = [], [], []
+        for code in range(32, 127):
+            ch = chr(code)
+            offsets.append(len(bits))
+            if ch not in charset:
+                widths.append(0)
+                continue
+            w, glyph = render(font, ch, height, fixed)
+            widths.append(w)
+            bits.extend(glyph)
+        data = pack(bits)
+        name = f"kFont{font_id}"
+        lines.append(f"static const uint8_t {name}Widths[95] = {{")
+        lines.extend("  " + ", ".join(str(w) for w in widths[i:i + 19]) + "," for i in range(0, 95, 19))
+        lines.append("};")
+        lines.append(f"static const uint32_t {name}Offsets[95] = {{")
+        lines.extend("  " + ", ".join(str(o) for o in offsets[i:i + 10]) + "," for i in range(0, 95, 10))
+        lines.append("};")
+        lines.append(f"static const uint8_t {name}Bits[{len(data)}] = {{")
+        lines.extend("  " + ", ".join(f"0x{b:02x}" for b in data[i:i + 16]) + "," for i in range(0, len(data), 16))
+        lines.append("};")
+        lines.append("")
+        entries.append(f"  {{{font_id}, {height}, {name}Widths, {name}Offsets, {name}Bits}},")
+
+    lines.append("static const Font kFonts[] = {")
+    lines.extend(entries)
+    lines.append("};")
+    lines.append("")
+    lines.append("}  // namespace HostFonts")
+    with open(args.out, "w", newline="\n") as f:
+        f.write("\n".join(lines) + "\n")
+    print(f"wrote {args.out}")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,24 @@
+"""PlatformIO pre-build script for env:native: dumps the synthetic game for the native stand-in.
+
+tools/espn_standin.py is the only definition of the synthetic CAN-SWE game. This runs its
+`synth --dump` into the build directory whenever the tool is newer than the dump, and points
+test/host/espn_standin.cpp at the file through ESPN_SYNTH_FIXTURE.
+"""
+
+import os
+import subprocess
+
+Import("env")  # noqa: F821 - provided by PlatformIO
+
+# Thursday 2026-02-12, 12:00 UTC: inside the tournament window. The stand-in moves the wall clock
+# to each test's lead before puck drop, so this only fixes the dates the dump is written with.
+ORIGIN = "1770897600"
+LEAD_SEC = "60"
+
+tool = os.path.join(env.subst("$PROJECT_DIR"), "tools", "espn_standin.py")
+out = os.path.join(env.subst("$BUILD_DIR"), "synth_game.jsonl")
+if not os.path.isfile(out) or os.path.getmtime(out) < os.path.getmtime(tool):
+    os.makedirs(os.path.dirname(out), exist_ok=True)
+    subprocess.check_call([env.subst("$PYTHONEXE"), tool, "synth", "--dump", out,
+                           "--origin", ORIGIN, "--lead", LEAD_SEC])
+env.Append(CPPDEFINES=[("ESPN_SYNTH_FIXTURE", env.StringifyMacro(out.replace("\\", "/")))])